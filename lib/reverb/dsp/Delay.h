@@ -50,10 +50,23 @@ class Delay
 
 		void init (uint n)
 			{
-				size = next_power_of_2 (n);
-				assert (size <= (1 << 20));
-				data = (sample_t *) calloc (sizeof (sample_t), size);
-				--size; /* used as mask for confining access */
+				uint alloc_size = next_power_of_2 (n);
+				assert (alloc_size <= (1 << 20));
+				if (data && alloc_size == size + 1)
+					{
+					/* re-init with unchanged length: reuse the existing
+					 * allocation and just zero the history, so that
+					 * re-enabling a reverb never allocates (or leaks)
+					 * memory in the audio thread */
+					memset (data, 0, alloc_size * sizeof (sample_t));
+					}
+				else
+					{
+					free (data);
+					data = (sample_t *) calloc (sizeof (sample_t), alloc_size);
+					size = alloc_size - 1; /* used as mask for confining access */
+					}
+				read = 0;
 				write = n;
 			}
 
@@ -23,6 +23,23 @@ class Analyzer {
     //  3. If the initialization failed log the internal error and return false.
     virtual bool initialize(TrackPointer tio, int sampleRate, int totalSamples) = 0;
 
+    // Optional support for windowed re-analysis: restrict the analysis to
+    // the sample region [regionFirstSample, regionLastSample) and merge the
+    // new results into the previously stored ones in storeResults(). This
+    // avoids a full re-scan when only a bounded part of a track became
+    // invalid, e.g. after a beatgrid correction. The analysis loop still
+    // feeds samples from the beginning of the track; analyzers discard
+    // everything outside the region in processSamples().
+    // The default implementation reports that region analysis is not
+    // supported; callers have to fall back to a full analysis then.
+    virtual bool initializeRegion(TrackPointer /*tio*/,
+            int /*sampleRate*/,
+            int /*totalSamples*/,
+            int /*regionFirstSample*/,
+            int /*regionLastSample*/) {
+        return false;
+    }
+
     /////////////////////////////////////////////////////////////////////////
     // All following methods will only be invoked after initialize()
     // returned true!
@@ -34,6 +51,14 @@ class Analyzer {
     // but not finalize()!
     virtual bool processSamples(const CSAMPLE* pIn, const int iLen) = 0;
 
+    // Returns false as soon as the analyzer does not consume any further
+    // sample data, e.g. when fast analysis restricts it to a bounded prefix
+    // of the track. The analysis loop stops decoding once no active analyzer
+    // needs more samples. By default analyzers consume the whole track.
+    virtual bool needsMoreSamples() const {
+        return true;
+    }
+
     // Update the track object with the analysis results after
     // processing finished successfully, i.e. all available audio
     // samples have been processed.
@@ -71,6 +96,23 @@ class AnalyzerWithState final {
         return m_active = m_analyzer->initialize(tio, sampleRate, totalSamples);
     }
 
+    bool initializeRegion(TrackPointer tio,
+            int sampleRate,
+            int totalSamples,
+            int regionFirstSample,
+            int regionLastSample) {
+        DEBUG_ASSERT(!m_active);
+        return m_active = m_analyzer->initializeRegion(tio,
+                       sampleRate,
+                       totalSamples,
+                       regionFirstSample,
+                       regionLastSample);
+    }
+
+    bool needsMoreSamples() const {
+        return m_active && m_analyzer->needsMoreSamples();
+    }
+
     void processSamples(const CSAMPLE* pIn, const int iLen) {
         if (m_active) {
             m_active = m_analyzer->processSamples(pIn, iLen);
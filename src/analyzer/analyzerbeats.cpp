@@ -39,7 +39,11 @@ AnalyzerBeats::AnalyzerBeats(UserSettingsPointer pConfig, bool enforceBpmDetecti
           m_bPreferencesFastAnalysis(false),
           m_totalSamples(0),
           m_iMaxSamplesToProcess(0),
-          m_iCurrentSample(0) {
+          m_iCurrentSample(0),
+          m_decimationFactor(1),
+          m_decimationFrameCount(0),
+          m_decimationSumL(0),
+          m_decimationSumR(0) {
 }
 
 bool AnalyzerBeats::initialize(TrackPointer pTrack, int sampleRate, int totalSamples) {
@@ -110,8 +114,28 @@ bool AnalyzerBeats::initialize(TrackPointer pTrack, int sampleRate, int totalSam
             DEBUG_ASSERT(false);
         }
 
+        // The beat detectors derive their window and step sizes from the
+        // input sample rate, so high-rate material doubles or quadruples the
+        // FFT cost without improving the result: there is no musically
+        // relevant onset information above 22 kHz. Decimate such input down
+        // to the 44.1/48 kHz family before analysis; the reported beat
+        // positions are scaled back to the original rate in storeResults().
+        m_decimationFactor = 1;
+        while (sampleRate / (m_decimationFactor * 2) >= 44100) {
+            m_decimationFactor *= 2;
+        }
+        m_decimationFrameCount = 0;
+        m_decimationSumL = 0;
+        m_decimationSumR = 0;
+        if (m_decimationFactor > 1) {
+            qDebug() << "Decimating beat analysis input from" << sampleRate
+                     << "to" << sampleRate / m_decimationFactor << "Hz";
+            m_decimationBuffer.resize(
+                    mixxx::kAnalysisSamplesPerChunk / m_decimationFactor);
+        }
+
         if (m_pPlugin) {
-            if (m_pPlugin->initialize(sampleRate)) {
+            if (m_pPlugin->initialize(sampleRate / m_decimationFactor)) {
                 qDebug() << "Beat calculation started with plugin" << m_pluginId;
             } else {
                 qDebug() << "Beat calculation will not start.";
@@ -200,7 +224,34 @@ bool AnalyzerBeats::processSamples(const CSAMPLE *pIn, const int iLen) {
         return true; // silently ignore all remaining samples
     }
 
-    return m_pPlugin->processSamples(pIn, iLen);
+    if (m_decimationFactor == 1) {
+        return m_pPlugin->processSamples(pIn, iLen);
+    }
+
+    // Decimate by averaging m_decimationFactor successive frames per
+    // channel. Partially accumulated frames carry over to the next chunk.
+    CSAMPLE* pDecimated = m_decimationBuffer.data();
+    const CSAMPLE gain = 1.0f / m_decimationFactor;
+    int decimatedSamples = 0;
+    for (int i = 0; i < iLen; i += 2) {
+        m_decimationSumL += pIn[i];
+        m_decimationSumR += pIn[i + 1];
+        if (++m_decimationFrameCount == m_decimationFactor) {
+            pDecimated[decimatedSamples++] = m_decimationSumL * gain;
+            pDecimated[decimatedSamples++] = m_decimationSumR * gain;
+            m_decimationFrameCount = 0;
+            m_decimationSumL = 0;
+            m_decimationSumR = 0;
+        }
+    }
+    if (decimatedSamples == 0) {
+        return true;
+    }
+    return m_pPlugin->processSamples(pDecimated, decimatedSamples);
+}
+
+bool AnalyzerBeats::needsMoreSamples() const {
+    return m_iCurrentSample < m_iMaxSamplesToProcess;
 }
 
 void AnalyzerBeats::cleanup() {
@@ -220,6 +271,12 @@ void AnalyzerBeats::storeResults(TrackPointer pTrack) {
     mixxx::BeatsPointer pBeats;
     if (m_pPlugin->supportsBeatTracking()) {
         QVector<double> beats = m_pPlugin->getBeats();
+        if (m_decimationFactor > 1) {
+            // The plugin reported frame positions at the decimated rate
+            for (double& beatFramePos : beats) {
+                beatFramePos *= m_decimationFactor;
+            }
+        }
         QHash<QString, QString> extraVersionInfo = getExtraVersionInfo(
                 m_pluginId, m_bPreferencesFastAnalysis);
         pBeats = BeatFactory::makePreferredBeats(
@@ -10,6 +10,8 @@
 #include <QHash>
 #include <QList>
 
+#include <vector>
+
 #include "analyzer/analyzer.h"
 #include "analyzer/plugins/analyzerplugin.h"
 #include "preferences/beatdetectionsettings.h"
@@ -28,6 +30,7 @@ class AnalyzerBeats : public Analyzer {
 
     bool initialize(TrackPointer pTrack, int sampleRate, int totalSamples) override;
     bool processSamples(const CSAMPLE *pIn, const int iLen) override;
+    bool needsMoreSamples() const override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
 
@@ -49,4 +52,12 @@ class AnalyzerBeats : public Analyzer {
     SINT m_totalSamples;
     int m_iMaxSamplesToProcess;
     int m_iCurrentSample;
+
+    // High-rate input is decimated down to the 44.1/48 kHz family before it
+    // is fed into the beat detection plugin, see initialize().
+    int m_decimationFactor;
+    int m_decimationFrameCount;
+    CSAMPLE m_decimationSumL;
+    CSAMPLE m_decimationSumR;
+    std::vector<CSAMPLE> m_decimationBuffer;
 };
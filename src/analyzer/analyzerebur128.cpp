@@ -2,6 +2,7 @@
 
 #include <QtDebug>
 
+#include "track/loudnesscurve.h"
 #include "track/track.h"
 #include "util/math.h"
 #include "util/sample.h"
@@ -9,11 +10,15 @@
 
 namespace {
 const double kReplayGain2ReferenceLUFS = -18;
+// One short-term (3 s window) loudness measurement per second of audio.
+const double kShortTermIntervalSeconds = 1.0;
 } // anonymous namespace
 
 AnalyzerEbur128::AnalyzerEbur128(UserSettingsPointer pConfig)
         : m_rgSettings(pConfig),
-          m_pState(nullptr) {
+          m_pState(nullptr),
+          m_measureIntervalFrames(0),
+          m_framesUntilMeasurement(0) {
 }
 
 AnalyzerEbur128::~AnalyzerEbur128() {
@@ -30,8 +35,16 @@ bool AnalyzerEbur128::initialize(TrackPointer tio,
     DEBUG_ASSERT(m_pState == nullptr);
     m_pState = ebur128_init(2u,
             static_cast<unsigned long>(sampleRate),
-            EBUR128_MODE_I);
-    return m_pState != nullptr;
+            EBUR128_MODE_I | EBUR128_MODE_S);
+    if (m_pState == nullptr) {
+        return false;
+    }
+    m_measureIntervalFrames = static_cast<int>(
+            sampleRate * kShortTermIntervalSeconds);
+    m_framesUntilMeasurement = m_measureIntervalFrames;
+    m_shortTermLufs.clear();
+    m_shortTermLufs.reserve(totalSamples / 2 / m_measureIntervalFrames + 1);
+    return true;
 }
 
 void AnalyzerEbur128::cleanup() {
@@ -40,6 +53,7 @@ void AnalyzerEbur128::cleanup() {
         // ebur128_destroy clears the pointer but let's not rely on that.
         m_pState = nullptr;
     }
+    m_shortTermLufs.clear();
 }
 
 bool AnalyzerEbur128::processSamples(const CSAMPLE *pIn, const int iLen) {
@@ -53,6 +67,20 @@ bool AnalyzerEbur128::processSamples(const CSAMPLE *pIn, const int iLen) {
         qWarning() << "AnalyzerEbur128::processSamples() failed with" << e;
         return false;
     }
+    // Sample the short-term loudness at a fixed interval to build the
+    // loudness curve that AutoDJ uses for transition gain planning.
+    m_framesUntilMeasurement -= static_cast<int>(frames);
+    while (m_framesUntilMeasurement <= 0) {
+        double shortTermLufs;
+        e = ebur128_loudness_shortterm(m_pState, &shortTermLufs);
+        VERIFY_OR_DEBUG_ASSERT(e == EBUR128_SUCCESS) {
+            qWarning() << "AnalyzerEbur128: short-term loudness failed with" << e;
+            m_shortTermLufs.clear();
+            break;
+        }
+        m_shortTermLufs.append(shortTermLufs);
+        m_framesUntilMeasurement += m_measureIntervalFrames;
+    }
     return true;
 }
 
@@ -77,4 +105,9 @@ void AnalyzerEbur128::storeResults(TrackPointer tio) {
     replayGain.setRatio(db2ratio(fReplayGain2));
     tio->setReplayGain(replayGain);
     qDebug() << "ReplayGain 2.0 (libebur128) result is" << fReplayGain2 << "dB for" << tio->getFileInfo();
+
+    if (!m_shortTermLufs.isEmpty()) {
+        tio->setLoudnessCurve(mixxx::LoudnessCurve(
+                kShortTermIntervalSeconds, m_shortTermLufs));
+    }
 }
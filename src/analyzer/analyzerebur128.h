@@ -2,6 +2,8 @@
 
 #include <ebur128.h>
 
+#include <QVector>
+
 #include "analyzer/analyzer.h"
 #include "preferences/replaygainsettings.h"
 
@@ -22,4 +24,10 @@ class AnalyzerEbur128 : public Analyzer {
   private:
     ReplayGainSettings m_rgSettings;
     ebur128_state* m_pState;
+
+    // Short-term loudness samples collected while processing, one per
+    // measurement interval. Stored on the track as a LoudnessCurve.
+    QVector<double> m_shortTermLufs;
+    int m_measureIntervalFrames;
+    int m_framesUntilMeasurement;
 };
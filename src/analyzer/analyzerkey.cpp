@@ -11,6 +11,7 @@
 #include "proto/keys.pb.h"
 #include "track/keyfactory.h"
 #include "track/track.h"
+#include "util/math.h"
 
 // static
 QList<mixxx::AnalyzerPluginInfo> AnalyzerKey::availablePlugins() {
@@ -36,6 +37,9 @@ AnalyzerKey::AnalyzerKey(const KeyDetectionSettings& keySettings)
           m_iTotalSamples(0),
           m_iMaxSamplesToProcess(0),
           m_iCurrentSample(0),
+          m_iRegionFirstSample(0),
+          m_iRegionLastSample(0),
+          m_bRegionAnalysis(false),
           m_bPreferencesKeyDetectionEnabled(true),
           m_bPreferencesFastAnalysisEnabled(false),
           m_bPreferencesReanalyzeEnabled(false) {
@@ -55,17 +59,7 @@ bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples)
     m_bPreferencesFastAnalysisEnabled = m_keySettings.getFastAnalysis();
     m_bPreferencesReanalyzeEnabled = m_keySettings.getReanalyzeWhenSettingsChange();
 
-    const auto plugins = availablePlugins();
-    if (!plugins.isEmpty()) {
-        m_pluginId = defaultPlugin().id();
-        QString pluginId = m_keySettings.getKeyPluginId();
-        for (const auto& info : plugins) {
-            if (info.id() == pluginId) {
-                m_pluginId = pluginId; // configured Plug-In available
-                break;
-            }
-        }
-    }
+    m_pluginId = selectPluginId();
 
     qDebug() << "AnalyzerKey preference settings:"
              << "\nPlugin:" << m_pluginId
@@ -88,31 +82,98 @@ bool AnalyzerKey::initialize(TrackPointer tio, int sampleRate, int totalSamples)
 
     DEBUG_ASSERT(!m_pPlugin);
     if (bShouldAnalyze) {
-        if (m_pluginId == mixxx::AnalyzerQueenMaryKey::pluginInfo().id()) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
+        bShouldAnalyze = instantiatePlugin(sampleRate);
+    }
+    return bShouldAnalyze;
+}
+
+bool AnalyzerKey::initializeRegion(TrackPointer tio,
+        int sampleRate,
+        int totalSamples,
+        int regionFirstSample,
+        int regionLastSample) {
+    if (totalSamples == 0) {
+        return false;
+    }
+    VERIFY_OR_DEBUG_ASSERT(regionFirstSample >= 0 &&
+            regionFirstSample < regionLastSample &&
+            regionLastSample <= totalSamples) {
+        return false;
+    }
+
+    const Keys baseKeys(tio->getKeys());
+    if (!baseKeys.isValid() || baseKeys.getKeyChanges().isEmpty()) {
+        // Nothing to merge the region results into, a full analysis is
+        // required anyway.
+        return initialize(tio, sampleRate, totalSamples);
+    }
+
+    m_bPreferencesKeyDetectionEnabled = m_keySettings.getKeyDetectionEnabled();
+    if (!m_bPreferencesKeyDetectionEnabled) {
+        qDebug() << "Key detection is deactivated";
+        return false;
+    }
+    // The region is already bounded, fast analysis would only truncate it.
+    m_bPreferencesFastAnalysisEnabled = false;
+    m_bPreferencesReanalyzeEnabled = m_keySettings.getReanalyzeWhenSettingsChange();
+
+    m_pluginId = selectPluginId();
+    m_iSampleRate = sampleRate;
+    m_iTotalSamples = totalSamples;
+    // Snap the region to frame boundaries; the plugins only accept whole
+    // sample frames.
+    m_iRegionFirstSample = regionFirstSample -
+            (regionFirstSample % mixxx::kAnalysisChannels);
+    m_iRegionLastSample = regionLastSample -
+            (regionLastSample % mixxx::kAnalysisChannels);
+    // Stop consuming samples once the region has been passed.
+    m_iMaxSamplesToProcess = m_iRegionLastSample;
+    m_iCurrentSample = 0;
+    m_bRegionAnalysis = true;
+    m_regionBaseKeys = baseKeys;
+
+    // No shouldAnalyze() check here: a windowed re-analysis is always an
+    // explicit request, e.g. after a beatgrid correction.
+    DEBUG_ASSERT(!m_pPlugin);
+    return instantiatePlugin(sampleRate);
+}
+
+QString AnalyzerKey::selectPluginId() const {
+    QString pluginId = defaultPlugin().id();
+    const QString configuredPluginId = m_keySettings.getKeyPluginId();
+    const auto plugins = availablePlugins();
+    for (const auto& info : plugins) {
+        if (info.id() == configuredPluginId) {
+            pluginId = configuredPluginId; // configured Plug-In available
+            break;
+        }
+    }
+    return pluginId;
+}
+
+bool AnalyzerKey::instantiatePlugin(int sampleRate) {
+    if (m_pluginId == mixxx::AnalyzerQueenMaryKey::pluginInfo().id()) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerQueenMaryKey>();
 #if defined __KEYFINDER__
-        } else if (m_pluginId == mixxx::AnalyzerKeyFinder::pluginInfo().id()) {
-            m_pPlugin = std::make_unique<mixxx::AnalyzerKeyFinder>();
+    } else if (m_pluginId == mixxx::AnalyzerKeyFinder::pluginInfo().id()) {
+        m_pPlugin = std::make_unique<mixxx::AnalyzerKeyFinder>();
 #endif
-        } else {
-            // This must not happen, because we have already verified above
-            // that the PlugInId is valid
-            DEBUG_ASSERT(false);
-        }
+    } else {
+        // This must not happen, because we have already verified above
+        // that the PlugInId is valid
+        DEBUG_ASSERT(false);
+    }
 
-        if (m_pPlugin) {
-            if (m_pPlugin->initialize(sampleRate)) {
-                qDebug() << "Key calculation started with plugin" << m_pluginId;
-            } else {
-                qDebug() << "Key calculation will not start.";
-                m_pPlugin.reset();
-                bShouldAnalyze = false;
-            }
-        } else {
-            bShouldAnalyze = false;
-        }
+    if (!m_pPlugin) {
+        return false;
     }
-    return bShouldAnalyze;
+    if (!m_pPlugin->initialize(sampleRate)) {
+        qDebug() << "Key calculation will not start.";
+        m_pPlugin.reset();
+        return false;
+    }
+    qDebug() << "Key calculation started with plugin" << m_pluginId;
+    return true;
 }
 
 bool AnalyzerKey::shouldAnalyze(TrackPointer tio) const {
@@ -153,6 +214,22 @@ bool AnalyzerKey::processSamples(const CSAMPLE *pIn, const int iLen) {
         return false;
     }
 
+    if (m_bRegionAnalysis) {
+        // Feed the plugin only the part of the chunk that overlaps the
+        // region. The plugin never sees samples outside the region, so the
+        // result positions are relative to the region start.
+        const int chunkFirstSample = m_iCurrentSample;
+        m_iCurrentSample += iLen;
+        const int firstSample = math_max(chunkFirstSample, m_iRegionFirstSample);
+        const int lastSample = math_min(m_iCurrentSample, m_iRegionLastSample);
+        if (firstSample >= lastSample) {
+            return true; // chunk entirely outside the region
+        }
+        return m_pPlugin->processSamples(
+                pIn + (firstSample - chunkFirstSample),
+                lastSample - firstSample);
+    }
+
     m_iCurrentSample += iLen;
     if (m_iCurrentSample > m_iMaxSamplesToProcess) {
         return true; // silently ignore remaining samples
@@ -161,8 +238,14 @@ bool AnalyzerKey::processSamples(const CSAMPLE *pIn, const int iLen) {
     return m_pPlugin->processSamples(pIn, iLen);
 }
 
+bool AnalyzerKey::needsMoreSamples() const {
+    return m_iCurrentSample < m_iMaxSamplesToProcess;
+}
+
 void AnalyzerKey::cleanup() {
     m_pPlugin.reset();
+    m_bRegionAnalysis = false;
+    m_regionBaseKeys = Keys();
 }
 
 void AnalyzerKey::storeResults(TrackPointer tio) {
@@ -176,6 +259,41 @@ void AnalyzerKey::storeResults(TrackPointer tio) {
     }
 
     KeyChangeList key_changes = m_pPlugin->getKeyChanges();
+    if (m_bRegionAnalysis) {
+        // The plugin only saw the region, so its positions are relative to
+        // the region start.
+        const double regionFirstFrame =
+                m_iRegionFirstSample / mixxx::kAnalysisChannels;
+        const double regionLastFrame =
+                m_iRegionLastSample / mixxx::kAnalysisChannels;
+        for (auto& change : key_changes) {
+            change.second += regionFirstFrame;
+        }
+        // Merge: keep the previous key changes outside the region and
+        // replace the ones inside it, dropping changes that repeat the
+        // preceding key.
+        const KeyChangeList previousChanges = m_regionBaseKeys.getKeyChanges();
+        KeyChangeList merged;
+        merged.reserve(previousChanges.size() + key_changes.size());
+        for (const auto& change : previousChanges) {
+            if (change.second < regionFirstFrame) {
+                merged.push_back(change);
+            }
+        }
+        for (const auto& change : key_changes) {
+            if (merged.isEmpty() || merged.constLast().first != change.first) {
+                merged.push_back(change);
+            }
+        }
+        for (const auto& change : previousChanges) {
+            if (change.second >= regionLastFrame &&
+                    (merged.isEmpty() ||
+                            merged.constLast().first != change.first)) {
+                merged.push_back(change);
+            }
+        }
+        key_changes = merged;
+    }
     QHash<QString, QString> extraVersionInfo = getExtraVersionInfo(
             m_pluginId, m_bPreferencesFastAnalysisEnabled);
     Keys track_keys = KeyFactory::makePreferredKeys(
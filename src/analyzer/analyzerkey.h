@@ -8,6 +8,7 @@
 #include "analyzer/plugins/analyzerplugin.h"
 #include "preferences/keydetectionsettings.h"
 #include "preferences/usersettings.h"
+#include "track/keys.h"
 #include "track/track_decl.h"
 #include "util/memory.h"
 
@@ -20,7 +21,13 @@ class AnalyzerKey : public Analyzer {
     static mixxx::AnalyzerPluginInfo defaultPlugin();
 
     bool initialize(TrackPointer tio, int sampleRate, int totalSamples) override;
+    bool initializeRegion(TrackPointer tio,
+            int sampleRate,
+            int totalSamples,
+            int regionFirstSample,
+            int regionLastSample) override;
     bool processSamples(const CSAMPLE *pIn, const int iLen) override;
+    bool needsMoreSamples() const override;
     void storeResults(TrackPointer tio) override;
     void cleanup() override;
 
@@ -29,6 +36,8 @@ class AnalyzerKey : public Analyzer {
             const QString& pluginId, bool bPreferencesFastAnalysis);
 
     bool shouldAnalyze(TrackPointer tio) const;
+    QString selectPluginId() const;
+    bool instantiatePlugin(int sampleRate);
 
     KeyDetectionSettings m_keySettings;
     std::unique_ptr<mixxx::AnalyzerKeyPlugin> m_pPlugin;
@@ -38,6 +47,14 @@ class AnalyzerKey : public Analyzer {
     int m_iMaxSamplesToProcess;
     int m_iCurrentSample;
 
+    // Bounds of a windowed re-analysis in samples; only valid while
+    // m_bRegionAnalysis is set. See Analyzer::initializeRegion().
+    int m_iRegionFirstSample;
+    int m_iRegionLastSample;
+    bool m_bRegionAnalysis;
+    // The previously stored keys that the region results are merged into.
+    Keys m_regionBaseKeys;
+
     bool m_bPreferencesKeyDetectionEnabled;
     bool m_bPreferencesFastAnalysisEnabled;
     bool m_bPreferencesReanalyzeEnabled;
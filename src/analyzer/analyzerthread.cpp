@@ -17,13 +17,54 @@
 #include "track/track.h"
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
+#include "util/denormalsarezero.h"
+#include "util/event.h"
 #include "util/logger.h"
 #include "util/timer.h"
 
+#if defined(Q_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#endif
+
 namespace {
 
 mixxx::Logger kLogger("AnalyzerThread");
 
+// Optionally pin each analyzer thread to a fixed CPU core. On multi-socket
+// machines this keeps a worker and the buffers it first-touched on the same
+// memory node instead of migrating across nodes mid-track.
+const ConfigKey kPinAnalysisThreadsKey("[Library]", "PinAnalysisThreads");
+
+void pinCurrentThreadToCore(int threadId) {
+    const int numCores = QThread::idealThreadCount();
+    if (numCores <= 0) {
+        return;
+    }
+    const int core = threadId % numCores;
+#if defined(Q_OS_LINUX)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0) {
+        kLogger.debug() << "Pinned analyzer thread" << threadId << "to core" << core;
+    } else {
+        kLogger.warning() << "Failed to pin analyzer thread" << threadId << "to core" << core;
+    }
+#elif defined(Q_OS_WIN)
+    if (SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0) {
+        kLogger.debug() << "Pinned analyzer thread" << threadId << "to core" << core;
+    } else {
+        kLogger.warning() << "Failed to pin analyzer thread" << threadId << "to core" << core;
+    }
+#else
+    Q_UNUSED(core);
+    kLogger.warning() << "Analyzer thread pinning is not supported on this platform";
+#endif
+}
+
 // NOTE(uklotzde, 2018-11-23): The parameterization for the analyzers
 // has not been touched while transforming the code from single- to
 // multi-threaded processing! Feel free to adjust this if justified.
@@ -84,12 +125,25 @@ AnalyzerThread::AnalyzerThread(
           m_pConfig(pConfig),
           m_modeFlags(modeFlags),
           m_nextTrack(2), // minimum capacity
-          m_sampleBuffer(mixxx::kAnalysisSamplesPerChunk),
+          m_processedFrames(0),
           m_emittedState(AnalyzerThreadState::Void) {
     std::call_once(registerMetaTypesOnceFlag, registerMetaTypesOnce);
 }
 
 void AnalyzerThread::doRun() {
+    // The analyzers run heavy filter banks over whole tracks; denormals
+    // in decaying filter states would slow them down by an order of
+    // magnitude, so flush them to zero for the lifetime of this thread.
+    const mixxx::DenormalsAreZeroScope denormalsAreZeroScope;
+
+    if (m_pConfig->getValue(kPinAnalysisThreadsKey, false)) {
+        pinCurrentThreadToCore(m_id);
+    }
+    // Allocate the sample buffer from the worker thread itself, after the
+    // optional pinning, so its pages end up on the local memory node.
+    DEBUG_ASSERT(m_sampleBuffer.size() == 0);
+    m_sampleBuffer = mixxx::SampleBuffer(mixxx::kAnalysisSamplesPerChunk);
+
     std::unique_ptr<AnalysisDao> pAnalysisDao;
     // The thread-local database connection  must not be closed
     // before returning from this function.
@@ -152,7 +206,26 @@ void AnalyzerThread::doRun() {
         }
 
         if (processTrack) {
+            // Span for the recorded timeline (--developer --timeline <file>)
+            static const QString kAnalyzeTag =
+                    QStringLiteral("AnalyzerThread analyze");
+            Event::start(kAnalyzeTag);
+            m_processedFrames = 0;
+            PerformanceTimer trackTimer;
+            trackTimer.start();
             const auto analysisResult = analyzeAudioSource(audioSource);
+            const double analysisSeconds = trackTimer.elapsed().toDoubleSeconds();
+            Event::end(kAnalyzeTag);
+            if (m_processedFrames > 0 && analysisSeconds > 0) {
+                // Per-thread throughput, e.g. for verifying thread/memory
+                // placement on multi-socket machines.
+                kLogger.debug()
+                        << "Thread" << m_id
+                        << "analyzed" << m_processedFrames << "frames in"
+                        << analysisSeconds << "s ="
+                        << (m_processedFrames / analysisSeconds / 1e6)
+                        << "Mframes/s";
+            }
             DEBUG_ASSERT(analysisResult != AnalysisResult::Pending);
             if (analysisResult == AnalysisResult::Finished) {
                 // The analysis has been finished, and is either complete without
@@ -298,10 +371,21 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
 
         // 2nd: step: Analyze chunk of decoded audio data
         if (!readableSampleFrames.frameIndexRange().empty()) {
+            m_processedFrames += readableSampleFrames.frameIndexRange().length();
+            bool needMoreSamples = false;
             for (auto&& analyzer : m_analyzers) {
                 analyzer.processSamples(
                         readableSampleFrames.readableData(),
                         readableSampleFrames.readableLength());
+                if (analyzer.needsMoreSamples()) {
+                    needMoreSamples = true;
+                }
+            }
+            if (!needMoreSamples) {
+                // All remaining analyzers only consume a bounded prefix of
+                // the track (fast analysis) or have aborted. Don't decode
+                // the remaining audio data that nobody would look at.
+                break;
             }
         }
 
@@ -70,11 +70,13 @@ class AnalyzerThread : public WorkerThread {
         return m_id;
     }
 
-    // Submits the next track to the worker thread without
-    // blocking. This is only allowed after a progress() signal
-    // with state Idle has been received to avoid overwriting
-    // a previously sent track that has not been received by the
-    // worker thread, yet.
+    // Submits the next track to the worker thread without blocking.
+    // The internal queue buffers a second track in addition to the
+    // one currently being analyzed, so the worker can continue with
+    // the next track immediately instead of sleeping until the host
+    // has responded to its Idle signal. Returns false if the queue
+    // is full. Must only be invoked from the host thread (single
+    // producer).
     bool submitNextTrack(TrackPointer nextTrack);
 
   signals:
@@ -116,10 +118,17 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
+    // Allocated lazily by the worker thread itself in doRun(), so that
+    // first-touch page placement puts the buffer on the memory node the
+    // (optionally pinned) thread runs on.
     mixxx::SampleBuffer m_sampleBuffer;
 
     TrackPointer m_currentTrack;
 
+    // Number of sample frames fed into the analyzers for the current
+    // track, for the per-thread throughput log.
+    quint64 m_processedFrames;
+
     AnalyzerThreadState m_emittedState;
 
     PerformanceTimer m_lastBusyProgressEmittedTimer;
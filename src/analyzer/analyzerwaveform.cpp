@@ -12,6 +12,28 @@ namespace {
 
 mixxx::Logger kLogger("AnalyzerWaveform");
 
+// Minimum interval between re-publishing the partially filled waveform
+// summary to the track while the analysis is still running.
+const mixxx::Duration kSummaryPublishInterval = mixxx::Duration::fromMillis(500);
+
+// Accumulates the per-channel maximum magnitudes of an interleaved stereo
+// buffer. The loop body is branch-free so compilers can auto-vectorize
+// the reduction without explicit intrinsics.
+inline void collectStereoAbsMax(
+        const CSAMPLE* pBuffer,
+        int numSamples,
+        float* pMaxLeft,
+        float* pMaxRight) {
+    float maxLeft = *pMaxLeft;
+    float maxRight = *pMaxRight;
+    for (int i = 0; i < numSamples; i += 2) {
+        maxLeft = math_max(maxLeft, fabsf(pBuffer[i + Left]));
+        maxRight = math_max(maxRight, fabsf(pBuffer[i + Right]));
+    }
+    *pMaxLeft = maxLeft;
+    *pMaxRight = maxRight;
+}
+
 } // namespace
 
 AnalyzerWaveform::AnalyzerWaveform(
@@ -66,6 +88,8 @@ bool AnalyzerWaveform::initialize(TrackPointer tio, int sampleRate, int totalSam
     // now.
     tio->setWaveform(m_waveform);
     tio->setWaveformSummary(m_waveformSummary);
+    m_pTrack = tio;
+    m_summaryPublishTimer.start();
 
     m_waveformData = m_waveform->data();
     m_waveformSummaryData = m_waveformSummary->data();
@@ -190,6 +214,43 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* buffer, const int bufferLen
     m_waveformSummary->setSaveState(Waveform::SaveState::NotSaved);
 
     for (int i = 0; i < bufferLength; i += 2) {
+        // Fast path: reduce the longest run of frames that cannot cross a
+        // stride boundary with block-wise max loops over each band buffer.
+        // This avoids the per-sample fmod() checks below and lets the
+        // compiler vectorize the reductions. The last frame before a
+        // potential boundary is always handled by the scalar code below,
+        // which keeps the fmod() conditions authoritative for when
+        // strides are stored.
+        const double strideRemaining = m_stride.m_length -
+                fmod(m_stride.m_position, m_stride.m_length);
+        const double summaryStrideRemaining = m_stride.m_averageLength -
+                fmod(m_stride.m_position, m_stride.m_averageLength);
+        int blockSamples = 2 *
+                (static_cast<int>(math_min(
+                         strideRemaining, summaryStrideRemaining)) -
+                        1);
+        blockSamples = math_clamp(blockSamples, 0, bufferLength - i - 2);
+        if (blockSamples > 0) {
+            collectStereoAbsMax(buffer + i,
+                    blockSamples,
+                    &m_stride.m_overallData[Left],
+                    &m_stride.m_overallData[Right]);
+            collectStereoAbsMax(&m_buffers[Low][i],
+                    blockSamples,
+                    &m_stride.m_filteredData[Left][Low],
+                    &m_stride.m_filteredData[Right][Low]);
+            collectStereoAbsMax(&m_buffers[Mid][i],
+                    blockSamples,
+                    &m_stride.m_filteredData[Left][Mid],
+                    &m_stride.m_filteredData[Right][Mid]);
+            collectStereoAbsMax(&m_buffers[High][i],
+                    blockSamples,
+                    &m_stride.m_filteredData[Left][High],
+                    &m_stride.m_filteredData[Right][High]);
+            m_stride.m_position += blockSamples / 2;
+            i += blockSamples;
+        }
+
         // Take max value, not average of data
         CSAMPLE cover[2] = {fabs(buffer[i]), fabs(buffer[i + 1])};
         CSAMPLE clow[2] = {fabs(m_buffers[Low][i]), fabs(m_buffers[Low][i + 1])};
@@ -251,6 +312,14 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* buffer, const int bufferLen
         }
     }
 
+    // Periodically re-publish the partially filled waveform summary so that
+    // overview widgets can refine their display in place while the analysis
+    // is still running, instead of waiting for storeResults().
+    if (m_pTrack && m_summaryPublishTimer.elapsed() > kSummaryPublishInterval) {
+        m_summaryPublishTimer.restart();
+        m_pTrack->setWaveformSummary(m_waveformSummary);
+    }
+
     //kLogger.debug() << "process - m_waveform->getCompletion()" << m_waveform->getCompletion() << "off" << m_waveform->getDataSize();
     //kLogger.debug() << "process - m_waveformSummary->getCompletion()" << m_waveformSummary->getCompletion() << "off" << m_waveformSummary->getDataSize();
     return true;
@@ -261,6 +330,7 @@ void AnalyzerWaveform::cleanup() {
     m_waveformData = nullptr;
     m_waveformSummary.clear();
     m_waveformSummaryData = nullptr;
+    m_pTrack.reset();
 }
 
 void AnalyzerWaveform::storeResults(TrackPointer tio) {
@@ -270,6 +340,9 @@ void AnalyzerWaveform::storeResults(TrackPointer tio) {
         m_waveform->setCompletion(m_waveform->getDataSize());
         m_waveform->setVersion(WaveformFactory::currentWaveformVersion());
         m_waveform->setDescription(WaveformFactory::currentWaveformDescription());
+        // The waveform is complete now, so the renderers can use summary
+        // levels instead of the raw visual samples from here on.
+        m_waveform->buildSummaryPyramid();
     }
     tio->setWaveform(m_waveform);
 
@@ -173,6 +173,11 @@ class AnalyzerWaveform : public Analyzer {
 
     PerformanceTimer m_timer;
 
+    // Track currently being analyzed, kept for publishing partial waveform
+    // summary updates while the analysis is running. Released in cleanup().
+    TrackPointer m_pTrack;
+    PerformanceTimer m_summaryPublishTimer;
+
 #ifdef TEST_HEAT_MAP
     QImage* test_heatMap;
 #endif
@@ -11,8 +11,14 @@ mixxx::Logger kLogger("TrackAnalysisScheduler");
 
 constexpr QThread::Priority kWorkerThreadPriority = QThread::LowPriority;
 
-// Maximum frequency of progress updates
-constexpr std::chrono::milliseconds kProgressInhibitDuration(100);
+// Maximum frequency of progress updates. The workers signal their raw
+// progress much more often; everything beyond this rate is invisible in
+// the GUI and only burns CPU cycles on repainting that are better spent
+// on the decoders.
+constexpr std::chrono::milliseconds kProgressInhibitDuration(250);
+
+// Interval for emitting the batched per-track progress updates.
+constexpr int kTrackProgressUpdateIntervalMillis = 250;
 
 void deleteTrackAnalysisScheduler(TrackAnalysisScheduler* plainPtr) {
     if (plainPtr) {
@@ -65,6 +71,13 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
                 << "worker threads. Priority: "
                 << (modeFlags & AnalyzerModeFlags::LowPriority ? "low" : "normal");
     }
+    m_trackProgressUpdateTimer.setSingleShot(true);
+    m_trackProgressUpdateTimer.setInterval(kTrackProgressUpdateIntervalMillis);
+    connect(&m_trackProgressUpdateTimer,
+            &QTimer::timeout,
+            this,
+            &TrackAnalysisScheduler::flushTrackProgressUpdates);
+
     // 1st pass: Create worker threads
     m_workers.reserve(numWorkerThreads);
     for (int threadId = 0; threadId < numWorkerThreads; ++threadId) {
@@ -87,10 +100,21 @@ TrackAnalysisScheduler::~TrackAnalysisScheduler() {
     kLogger.debug() << "Destroying";
 }
 
+void TrackAnalysisScheduler::flushTrackProgressUpdates() {
+    m_trackProgressUpdateTimer.stop();
+    if (m_pendingTrackProgressUpdates.isEmpty()) {
+        return;
+    }
+    const auto trackProgresses = std::move(m_pendingTrackProgressUpdates);
+    m_pendingTrackProgressUpdates.clear();
+    emit trackProgress(trackProgresses);
+}
+
 void TrackAnalysisScheduler::emitProgressOrFinished() {
     // The finished() signal is emitted regardless of when the last
     // signal has been emitted
     if (allTracksFinished()) {
+        flushTrackProgressUpdates();
         m_currentTrackProgress = kAnalyzerProgressUnknown;
         m_currentTrackNumber = 0;
         m_dequeuedTracksCount = 0;
@@ -194,7 +218,13 @@ void TrackAnalysisScheduler::onWorkerThreadProgress(
         DEBUG_ASSERT(!trackId.isValid());
         DEBUG_ASSERT(analyzerProgress == kAnalyzerProgressUnknown);
         worker.onAnalyzerProgress(analyzerProgress);
-        submitNextTrack(&worker);
+        // Submit a second track in advance if possible to keep the worker's
+        // queue filled. Otherwise the worker thread falls asleep after each
+        // finished track until the queued Idle signal has made its round trip
+        // through the host's event loop.
+        if (submitNextTrack(&worker)) {
+            submitNextTrack(&worker);
+        }
         break;
     case AnalyzerThreadState::Busy:
         DEBUG_ASSERT(trackId.isValid());
@@ -203,7 +233,12 @@ void TrackAnalysisScheduler::onWorkerThreadProgress(
             DEBUG_ASSERT(analyzerProgress != kAnalyzerProgressUnknown);
             DEBUG_ASSERT(analyzerProgress < kAnalyzerProgressDone);
             worker.onAnalyzerProgress(analyzerProgress);
-            emit trackProgress(trackId, analyzerProgress);
+            // Coalesce busy progress across all workers and emit it
+            // batched from the update timer.
+            m_pendingTrackProgressUpdates.insert(trackId, analyzerProgress);
+            if (!m_trackProgressUpdateTimer.isActive()) {
+                m_trackProgressUpdateTimer.start();
+            }
         }
         break;
     case AnalyzerThreadState::Done:
@@ -214,8 +249,15 @@ void TrackAnalysisScheduler::onWorkerThreadProgress(
                     || (analyzerProgress == kAnalyzerProgressUnknown)); // failure
             m_pendingTrackIds.erase(trackId);
             worker.onAnalyzerProgress(analyzerProgress);
-            emit trackProgress(trackId, analyzerProgress);
+            // Completions must not be delayed, flush them together with
+            // any accumulated busy progress.
+            m_pendingTrackProgressUpdates.insert(trackId, analyzerProgress);
+            flushTrackProgressUpdates();
         }
+        // Refill the slot in the worker's queue that is about to become
+        // available, so the worker continues with the next track without
+        // waiting for the host to respond to its Idle signal.
+        submitNextTrack(&worker);
         break;
     case AnalyzerThreadState::Exit:
         DEBUG_ASSERT(!trackId.isValid());
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <QHash>
 #include <QList>
+#include <QTimer>
 
 #include <deque>
 #include <set>
@@ -62,8 +64,11 @@ class TrackAnalysisScheduler : public QObject {
     void stop();
 
   signals:
-    // Progress for individual tracks is passed-through from the workers
-    void trackProgress(TrackId trackId, AnalyzerProgress analyzerProgress);
+    // Progress for individual tracks, batched across all workers. Updates
+    // are coalesced to at most one per track within the update period, so
+    // receivers only repaint once per batch instead of once per worker
+    // signal. Finished tracks are always flushed immediately.
+    void trackProgress(const QHash<TrackId, AnalyzerProgress>& trackProgresses);
     // Current average progress for all scheduled tracks and from all workers
     void progress(AnalyzerProgress currentTrackProgress, int currentTrackNumber, int totalTracksCount);
     void finished();
@@ -140,6 +145,7 @@ class TrackAnalysisScheduler : public QObject {
 
     bool submitNextTrack(Worker* worker);
     void emitProgressOrFinished();
+    void flushTrackProgressUpdates();
 
     bool allTracksFinished() const {
         return m_queuedTrackIds.empty() &&
@@ -164,4 +170,9 @@ class TrackAnalysisScheduler : public QObject {
 
     typedef std::chrono::steady_clock Clock;
     Clock::time_point m_lastProgressEmittedAt;
+
+    // Most recent progress per track, accumulated between batched
+    // emissions of trackProgress().
+    QHash<TrackId, AnalyzerProgress> m_pendingTrackProgressUpdates;
+    QTimer m_trackProgressUpdateTimer;
 };
@@ -1,6 +1,7 @@
 #include "control/control.h"
 
 #include "control/controlobject.h"
+#include "control/controlrecorder.h"
 #include "moc_control.cpp"
 #include "util/stat.h"
 
@@ -8,15 +9,15 @@
 UserSettingsPointer ControlDoublePrivate::s_pUserConfig;
 
 //static
-QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> ControlDoublePrivate::s_qCOHash
-        GUARDED_BY(ControlDoublePrivate::s_qCOHashMutex);
+ControlDoublePrivate::RegistryShard ControlDoublePrivate::s_registryShards
+        [ControlDoublePrivate::kRegistryShardCount];
 
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::s_qCOAliasHash
-        GUARDED_BY(ControlDoublePrivate::s_qCOHashMutex);
+        GUARDED_BY(ControlDoublePrivate::s_qCOAliasHashMutex);
 
 //static
-MMutex ControlDoublePrivate::s_qCOHashMutex;
+MMutex ControlDoublePrivate::s_qCOAliasHashMutex;
 
 ControlDoublePrivate::ControlDoublePrivate(
         const ConfigKey& key,
@@ -60,10 +61,12 @@ void ControlDoublePrivate::initialize(double defaultValue) {
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
-    s_qCOHashMutex.lock();
-    //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
-    s_qCOHash.remove(m_key);
-    s_qCOHashMutex.unlock();
+    const HashedKey hashedKey(m_key);
+    RegistryShard& shard = shardForKey(hashedKey);
+    shard.mutex.lock();
+    //qDebug() << "ControlDoublePrivate registry remove(" << m_key.group << "," << m_key.item << ")";
+    shard.hash.remove(hashedKey);
+    shard.mutex.unlock();
 
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = ControlDoublePrivate::s_pUserConfig;
@@ -75,22 +78,33 @@ ControlDoublePrivate::~ControlDoublePrivate() {
 
 // static
 void ControlDoublePrivate::insertAlias(const ConfigKey& alias, const ConfigKey& key) {
-    MMutexLocker locker(&s_qCOHashMutex);
-
-    auto it = s_qCOHash.constFind(key);
-    if (it == s_qCOHash.constEnd()) {
-        qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for null control" << key;
-        return;
+    QSharedPointer<ControlDoublePrivate> pControl;
+    {
+        const HashedKey hashedKey(key);
+        RegistryShard& shard = shardForKey(hashedKey);
+        const MMutexLocker locker(&shard.mutex);
+        auto it = shard.hash.constFind(hashedKey);
+        if (it == shard.hash.constEnd()) {
+            qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for null control" << key;
+            return;
+        }
+        pControl = it.value();
+        if (pControl.isNull()) {
+            qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for expired control" << key;
+            return;
+        }
     }
 
-    QSharedPointer<ControlDoublePrivate> pControl = it.value();
-    if (pControl.isNull()) {
-        qWarning() << "WARNING: ControlDoublePrivate::insertAlias called for expired control" << key;
-        return;
+    {
+        const MMutexLocker locker(&s_qCOAliasHashMutex);
+        s_qCOAliasHash.insert(key, alias);
     }
-
-    s_qCOAliasHash.insert(key, alias);
-    s_qCOHash.insert(alias, pControl);
+    // The alias may live in a different shard than the original key. The
+    // shard mutexes are never held while acquiring another one.
+    const HashedKey hashedAlias(alias);
+    RegistryShard& aliasShard = shardForKey(hashedAlias);
+    const MMutexLocker locker(&aliasShard.mutex);
+    aliasShard.hash.insert(hashedAlias, pControl);
 }
 
 // static
@@ -109,11 +123,16 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
         return nullptr;
     }
 
+    // The key is hashed exactly once; the interned hash is reused for
+    // shard selection, the lookup below and a subsequent insertion.
+    const HashedKey hashedKey(key);
+    RegistryShard& shard = shardForKey(hashedKey);
+
     // Scope for MMutexLocker.
     {
-        const MMutexLocker locker(&s_qCOHashMutex);
-        const auto it = s_qCOHash.find(key);
-        if (it != s_qCOHash.end()) {
+        const MMutexLocker locker(&shard.mutex);
+        const auto it = shard.hash.find(hashedKey);
+        if (it != shard.hash.end()) {
             auto pControl = it.value().lock();
             if (pControl) {
                 // Control object already exists
@@ -127,7 +146,7 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                 return pControl;
             } else {
                 // The weak pointer has become invalid and can be cleaned up
-                s_qCOHash.erase(it);
+                shard.hash.erase(it);
             }
         }
     }
@@ -140,9 +159,9 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                         bTrack,
                         bPersist,
                         defaultValue));
-        const MMutexLocker locker(&s_qCOHashMutex);
-        //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
-        s_qCOHash.insert(key, pControl);
+        const MMutexLocker locker(&shard.mutex);
+        //qDebug() << "ControlDoublePrivate registry insert(" << key.group << "," << key.item << ")";
+        shard.hash.insert(hashedKey, pControl);
         return pControl;
     }
 
@@ -157,15 +176,17 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
-        } else {
-            // The weak pointer has become invalid and can be cleaned up
-            s_qCOHash.erase(it);
+    for (RegistryShard& shard : s_registryShards) {
+        MMutexLocker locker(&shard.mutex);
+        for (auto it = shard.hash.begin(); it != shard.hash.end();) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+                ++it;
+            } else {
+                // The weak pointer has become invalid and can be cleaned up
+                it = shard.hash.erase(it);
+            }
         }
     }
     return result;
@@ -174,15 +195,16 @@ QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstance
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
-        if (pControl) {
-            result.append(std::move(pControl));
+    for (RegistryShard& shard : s_registryShards) {
+        MMutexLocker locker(&shard.mutex);
+        for (auto it = shard.hash.begin(); it != shard.hash.end(); ++it) {
+            auto pControl = it.value().lock();
+            if (pControl) {
+                result.append(std::move(pControl));
+            }
         }
+        shard.hash.clear();
     }
-    s_qCOHash.clear();
     return result;
 }
 
@@ -222,6 +244,9 @@ void ControlDoublePrivate::setInner(double value, QObject* pSender) {
     m_value.setValue(value);
     emit valueChanged(value, pSender);
 
+    if (ControlRecorder::isRecording()) {
+        ControlRecorder::record(m_key, value);
+    }
     if (m_bTrack) {
         Stat::track(m_trackKey, static_cast<Stat::StatType>(m_trackType),
                     static_cast<Stat::ComputeFlags>(m_trackFlags), value);
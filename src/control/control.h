@@ -214,13 +214,54 @@ class ControlDoublePrivate : public QObject {
     // configuration object would be arduous.
     static UserSettingsPointer s_pUserConfig;
 
-    // Hash of ControlDoublePrivate instantiations.
-    static QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> s_qCOHash;
+    // A ConfigKey bundled with its hash. Hashing a ConfigKey means
+    // hashing both of its strings, which shows up in startup profiles
+    // when skins and controller mappings resolve thousands of keys.
+    // Interning the hash lets a single computation serve shard
+    // selection, bucket lookup and insertion.
+    struct HashedKey {
+        explicit HashedKey(const ConfigKey& key)
+                : key(key),
+                  hash(::qHash(key)) {
+        }
+
+        ConfigKey key;
+        uint hash;
+
+        friend bool operator==(const HashedKey& lhs, const HashedKey& rhs) {
+            // Comparing the interned hashes first rejects almost all
+            // mismatches without touching the strings.
+            return lhs.hash == rhs.hash && lhs.key == rhs.key;
+        }
+        // The per-container seed is deliberately ignored: the interned
+        // hash has to be computed before the target shard (and thereby
+        // the container) is even known.
+        friend uint qHash(const HashedKey& hashedKey, uint seed = 0) {
+            Q_UNUSED(seed);
+            return hashedKey.hash;
+        }
+    };
+
+    // Registry of ControlDoublePrivate instantiations, sharded by the
+    // hash of the ConfigKey. Thousands of controls are created serially
+    // during startup and looked up concurrently from the GUI, engine and
+    // controller threads, so a single registry-wide mutex becomes a
+    // contention point. Each shard is guarded by its own mutex.
+    static constexpr int kRegistryShardCount = 8; // must be a power of two
+    struct RegistryShard {
+        MMutex mutex;
+        QHash<HashedKey, QWeakPointer<ControlDoublePrivate>> hash
+                GUARDED_BY(mutex);
+    };
+    static RegistryShard s_registryShards[kRegistryShardCount];
+    static RegistryShard& shardForKey(const HashedKey& hashedKey) {
+        return s_registryShards[hashedKey.hash & (kRegistryShardCount - 1)];
+    }
 
     // Hash of aliases between ConfigKeys. Solely used for looking up the first
     // alias associated with a key.
     static QHash<ConfigKey, ConfigKey> s_qCOAliasHash;
 
-    // Mutex guarding access to s_qCOHash and s_qCOAliasHash.
-    static MMutex s_qCOHashMutex;
+    // Mutex guarding access to s_qCOAliasHash.
+    static MMutex s_qCOAliasHashMutex;
 };
@@ -0,0 +1,32 @@
+#include "control/controlcoalescer.h"
+
+#include "control/controlproxy.h"
+
+// static
+MMutex ControlCoalescer::s_mutex;
+// static
+QList<ControlProxy*> ControlCoalescer::s_proxies;
+
+// static
+void ControlCoalescer::registerProxy(ControlProxy* pProxy) {
+    MMutexLocker locker(&s_mutex);
+    DEBUG_ASSERT(!s_proxies.contains(pProxy));
+    s_proxies.append(pProxy);
+}
+
+// static
+void ControlCoalescer::unregisterProxy(ControlProxy* pProxy) {
+    MMutexLocker locker(&s_mutex);
+    s_proxies.removeOne(pProxy);
+}
+
+// static
+void ControlCoalescer::flush() {
+    // The mutex only guards registration; it is never taken by the threads
+    // that set values, so holding it while emitting cannot block the engine
+    // or controller threads.
+    MMutexLocker locker(&s_mutex);
+    for (ControlProxy* pProxy : qAsConst(s_proxies)) {
+        pProxy->flushIfDirty();
+    }
+}
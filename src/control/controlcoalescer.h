@@ -0,0 +1,31 @@
+#pragma once
+
+#include <QList>
+
+#include "util/mutex.h"
+
+class ControlProxy;
+
+// Registry of ControlProxys whose GUI updates are coalesced to a single
+// valueChanged() emission per GUI frame. Value changes only mark the proxy
+// dirty via a cheap atomic flag instead of posting one queued Qt event per
+// change, so fast parameter sweeps (e.g. from a MIDI encoder) cannot
+// saturate the GUI event loop. The dirty proxies are flushed with their
+// latest value by GuiTick::process() from the GUI thread once per rendered
+// frame.
+class ControlCoalescer {
+  public:
+    // Called by ControlProxy::connectValueChangedCoalesced() from the GUI
+    // thread.
+    static void registerProxy(ControlProxy* pProxy);
+    // Called by the ControlProxy destructor.
+    static void unregisterProxy(ControlProxy* pProxy);
+
+    // Emits valueChanged() for every dirty proxy with the latest control
+    // value. Called by GuiTick from the GUI thread once per rendered frame.
+    static void flush();
+
+  private:
+    static MMutex s_mutex;
+    static QList<ControlProxy*> s_proxies;
+};
@@ -0,0 +1,251 @@
+#include "control/controloscreceiver.h"
+
+#include <QHostAddress>
+#include <QUdpSocket>
+#include <QtEndian>
+#include <cstring>
+
+#include "control/control.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("ControlOscReceiver");
+
+// "#bundle\0" followed by a 64-bit timetag.
+constexpr int kBundleHeaderSize = 16;
+
+// How long the receiver thread blocks on the socket before checking for
+// a stop request.
+constexpr int kReadTimeoutMillis = 100;
+
+// OSC strings are null-terminated and padded to four-byte boundaries.
+int paddedStringSize(int length) {
+    return (length + 4) & ~3;
+}
+
+qint32 readInt32(const char* data) {
+    return qFromBigEndian<qint32>(reinterpret_cast<const uchar*>(data));
+}
+
+float readFloat32(const char* data) {
+    const qint32 bits = readInt32(data);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+double readFloat64(const char* data) {
+    const qint64 bits = qFromBigEndian<qint64>(reinterpret_cast<const uchar*>(data));
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Reads the OSC string starting at *pPos and advances *pPos past its
+// padding. Returns false if the data is not null-terminated in bounds.
+bool readString(const char* data, int size, int* pPos, QString* pString) {
+    const char* start = data + *pPos;
+    const char* end = static_cast<const char*>(
+            std::memchr(start, '\0', size - *pPos));
+    if (!end) {
+        return false;
+    }
+    const int length = static_cast<int>(end - start);
+    *pString = QString::fromLatin1(start, length);
+    *pPos += paddedStringSize(length);
+    return *pPos <= size;
+}
+
+} // anonymous namespace
+
+ControlOscReceiver::ControlOscReceiver(int port)
+        : m_port(port),
+          m_stop(false) {
+}
+
+ControlOscReceiver::~ControlOscReceiver() {
+    stop();
+    wait();
+}
+
+void ControlOscReceiver::stop() {
+    m_stop.store(true, std::memory_order_relaxed);
+}
+
+void ControlOscReceiver::run() {
+    QThread::currentThread()->setObjectName(QStringLiteral("ControlOscReceiver"));
+    // The socket must be created on the thread that reads it.
+    QUdpSocket socket;
+    if (!socket.bind(QHostAddress::Any, static_cast<quint16>(m_port))) {
+        kLogger.warning() << "Could not bind UDP port" << m_port << "-"
+                          << socket.errorString();
+        return;
+    }
+    kLogger.info() << "Listening for OSC control messages on UDP port" << m_port;
+    QByteArray datagram;
+    while (!m_stop.load(std::memory_order_relaxed)) {
+        // Blocking on the socket instead of the Qt event loop keeps the
+        // dispatch latency down to the parse itself; the timeout bounds
+        // the shutdown latency.
+        if (!socket.waitForReadyRead(kReadTimeoutMillis)) {
+            continue;
+        }
+        while (socket.hasPendingDatagrams()) {
+            datagram.resize(static_cast<int>(socket.pendingDatagramSize()));
+            const qint64 size = socket.readDatagram(datagram.data(), datagram.size());
+            if (size <= 0) {
+                break;
+            }
+            dispatchPacket(datagram.constData(), static_cast<int>(size));
+        }
+    }
+}
+
+void ControlOscReceiver::dispatchPacket(const QByteArray& packet) {
+    dispatchPacket(packet.constData(), packet.size());
+}
+
+void ControlOscReceiver::dispatchPacket(const char* data, int size) {
+    if (size < 4) {
+        return;
+    }
+    if (data[0] == '#') {
+        // A bundle: "#bundle\0", a timetag and length-prefixed
+        // elements. The timetag is ignored, all elements take effect
+        // immediately.
+        if (size < kBundleHeaderSize ||
+                std::memcmp(data, "#bundle\0", 8) != 0) {
+            return;
+        }
+        int pos = kBundleHeaderSize;
+        while (pos + 4 <= size) {
+            const qint32 elementSize = readInt32(data + pos);
+            pos += 4;
+            if (elementSize <= 0 || pos + elementSize > size) {
+                return;
+            }
+            dispatchPacket(data + pos, elementSize);
+            pos += elementSize;
+        }
+        return;
+    }
+    dispatchMessage(data, size);
+}
+
+void ControlOscReceiver::dispatchMessage(const char* data, int size) {
+    int pos = 0;
+    QString address;
+    if (!readString(data, size, &pos, &address) || !address.startsWith(QChar('/'))) {
+        return;
+    }
+    QString typeTags;
+    if (!readString(data, size, &pos, &typeTags) || !typeTags.startsWith(QChar(','))) {
+        return;
+    }
+
+    // Take the first argument that maps to a control value and skip
+    // over everything else.
+    double value = 0.0;
+    bool haveValue = false;
+    for (int i = 1; i < typeTags.size() && !haveValue; ++i) {
+        switch (typeTags.at(i).toLatin1()) {
+        case 'i':
+            if (pos + 4 > size) {
+                return;
+            }
+            value = readInt32(data + pos);
+            haveValue = true;
+            break;
+        case 'f':
+            if (pos + 4 > size) {
+                return;
+            }
+            value = readFloat32(data + pos);
+            haveValue = true;
+            break;
+        case 'd':
+            if (pos + 8 > size) {
+                return;
+            }
+            value = readFloat64(data + pos);
+            haveValue = true;
+            break;
+        case 'T':
+            value = 1.0;
+            haveValue = true;
+            break;
+        case 'F':
+            value = 0.0;
+            haveValue = true;
+            break;
+        case 's': {
+            QString skipped;
+            if (!readString(data, size, &pos, &skipped)) {
+                return;
+            }
+            break;
+        }
+        case 'b': {
+            if (pos + 4 > size) {
+                return;
+            }
+            const qint32 blobSize = readInt32(data + pos);
+            if (blobSize < 0) {
+                return;
+            }
+            pos += 4 + ((blobSize + 3) & ~3);
+            if (pos > size) {
+                return;
+            }
+            break;
+        }
+        case 'h': // int64
+        case 't': // timetag
+            pos += 8;
+            if (pos > size) {
+                return;
+            }
+            break;
+        default:
+            // N, I and unknown tags carry no data.
+            break;
+        }
+    }
+    if (!haveValue) {
+        return;
+    }
+
+    const QSharedPointer<ControlDoublePrivate> pControl = resolveControl(address);
+    if (pControl) {
+        pControl->set(value, nullptr);
+    }
+}
+
+QSharedPointer<ControlDoublePrivate> ControlOscReceiver::resolveControl(
+        const QString& address) {
+    const auto it = m_controls.constFind(address);
+    if (it != m_controls.constEnd()) {
+        return it.value();
+    }
+    const int lastSlash = address.lastIndexOf(QChar('/'));
+    if (lastSlash <= 0 || lastSlash == address.size() - 1) {
+        return nullptr;
+    }
+    QString group = address.mid(1, lastSlash - 1);
+    if (!group.startsWith(QChar('['))) {
+        group = QChar('[') + group + QChar(']');
+    }
+    const ConfigKey key(group, address.mid(lastSlash + 1));
+    const QSharedPointer<ControlDoublePrivate> pControl =
+            ControlDoublePrivate::getControl(key, ControlFlag::NoWarnIfMissing);
+    if (pControl) {
+        // Resolved once; subsequent messages for this address hit the
+        // cache.
+        m_controls.insert(address, pControl);
+    } else if (!m_warnedAddresses.contains(address)) {
+        m_warnedAddresses.insert(address);
+        kLogger.warning() << "No control for OSC address" << address;
+    }
+    return pControl;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QThread>
+#include <atomic>
+
+class ControlDoublePrivate;
+
+// Receives OSC (Open Sound Control) messages over UDP and applies them
+// directly to the control system. Enabled with the --osc-port command
+// line option.
+//
+// Addresses are mapped to controls as /group/item, with the group
+// brackets optional: both /Channel1/play and /[Channel1]/play set
+// [Channel1],play to the first numeric argument of the message
+// (i, f, d, T or F). OSC bundles are dispatched recursively; their
+// timetags are ignored, every element takes effect immediately.
+//
+// The socket is read with a blocking wait on a dedicated thread and the
+// datagrams are parsed in place, so a message reaches
+// ControlDoublePrivate::set() without any event-loop hop or
+// intermediate allocation. Each address is resolved to its control
+// handle once and reused from a lookup cache afterwards.
+class ControlOscReceiver final : public QThread {
+  public:
+    explicit ControlOscReceiver(int port);
+    ~ControlOscReceiver() override;
+
+    void stop();
+
+    // Parses a single OSC packet (message or bundle) and applies the
+    // contained messages to the control system. Public for testing;
+    // only called from the receiver thread otherwise.
+    void dispatchPacket(const QByteArray& packet);
+
+  protected:
+    void run() override;
+
+  private:
+    void dispatchPacket(const char* data, int size);
+    void dispatchMessage(const char* data, int size);
+    QSharedPointer<ControlDoublePrivate> resolveControl(const QString& address);
+
+    const int m_port;
+    std::atomic<bool> m_stop;
+
+    // Address lookup cache, only touched from the receiver thread.
+    QHash<QString, QSharedPointer<ControlDoublePrivate>> m_controls;
+    QSet<QString> m_warnedAddresses;
+};
@@ -40,4 +40,7 @@ void ControlProxy::initialize(ControlFlags flags) {
 
 ControlProxy::~ControlProxy() {
     //qDebug() << "ControlProxy::~ControlProxy()";
+    if (m_coalescing) {
+        ControlCoalescer::unregisterProxy(this);
+    }
 }
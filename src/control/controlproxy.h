@@ -5,6 +5,7 @@
 #include <QString>
 
 #include "control/control.h"
+#include "control/controlcoalescer.h"
 #include "preferences/usersettings.h"
 #include "util/platform.h"
 
@@ -108,6 +109,43 @@ class ControlProxy : public QObject {
         return true;
     }
 
+    // Like connectValueChanged(), but coalesces updates to a single
+    // valueChanged() emission per GUI frame: value changes from other
+    // threads only mark this proxy dirty via a direct connection and the
+    // latest value is emitted when GuiTick flushes the ControlCoalescer
+    // from the GUI thread. Use this for widgets that only display the
+    // value, where intermediate values of a fast parameter sweep carry no
+    // information. Both this proxy and the receiver must live on the GUI
+    // thread.
+    template<typename Receiver, typename Slot>
+    bool connectValueChangedCoalesced(Receiver receiver, Slot func) {
+        if (!m_pControl) {
+            return false;
+        }
+        if (!connect(this, &ControlProxy::valueChanged, receiver, func)) {
+            return false;
+        }
+        connect(m_pControl.data(),
+                &ControlDoublePrivate::valueChanged,
+                this,
+                &ControlProxy::slotMarkDirty,
+                static_cast<Qt::ConnectionType>(
+                        Qt::DirectConnection | Qt::UniqueConnection));
+        if (!m_coalescing) {
+            m_coalescing = true;
+            ControlCoalescer::registerProxy(this);
+        }
+        return true;
+    }
+
+    // Called by ControlCoalescer::flush() from the GUI thread once per
+    // rendered frame.
+    void flushIfDirty() {
+        if (m_dirty.fetchAndStoreAcquire(0) != 0) {
+            emit valueChanged(get());
+        }
+    }
+
     // Called from update();
     virtual void emitValueChanged() {
         emit valueChanged(get());
@@ -201,8 +239,25 @@ class ControlProxy : public QObject {
         }
     }
 
+    // Receives the value from the master control by a unique direct
+    // connection on the setter's thread and only marks this proxy dirty.
+    // The actual valueChanged() emission happens in flushIfDirty(). The
+    // value is deliberately ignored; the flush reads the latest one.
+    void slotMarkDirty(double v, QObject* pSetter) {
+        Q_UNUSED(v);
+        if (pSetter != this) {
+            m_dirty.storeRelease(1);
+        }
+    }
+
   protected:
     ConfigKey m_key;
     // Pointer to connected control.
     QSharedPointer<ControlDoublePrivate> m_pControl;
+
+  private:
+    // Set from any value-setting thread, cleared by the GUI thread flush.
+    QAtomicInt m_dirty;
+    // Whether this proxy is registered with the ControlCoalescer.
+    bool m_coalescing = false;
 };
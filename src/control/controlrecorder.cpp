@@ -0,0 +1,166 @@
+#include "control/controlrecorder.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <QtDebug>
+
+#include "control/controlobject.h"
+#include "util/assert.h"
+
+namespace {
+
+// Preallocated log capacity. A busy 2-hour performance with heavy
+// controller use produces a few hundred thousand changes; growing the
+// log in record() would allocate on the engine callback, so reserve
+// generously up front (one entry is a few dozen bytes).
+constexpr std::size_t kReserveEntries = 1 << 20;
+
+// Sleep granularity of the replay loop. Far enough from the target
+// timestamp the thread sleeps in coarse steps, closer it busy-polls in
+// fine steps to hit the recorded offset as closely as the OS allows.
+constexpr qint64 kCoarseSleepThresholdNanos = 2000000; // 2 ms
+constexpr unsigned long kCoarseSleepUsecs = 1000;
+constexpr unsigned long kFineSleepUsecs = 100;
+
+} // anonymous namespace
+
+//static
+std::atomic<bool> ControlRecorder::s_recording(false);
+//static
+QMutex ControlRecorder::s_mutex;
+//static
+QString ControlRecorder::s_filePath;
+//static
+PerformanceTimer ControlRecorder::s_timer;
+//static
+std::vector<ControlRecorder::Entry> ControlRecorder::s_entries;
+
+//static
+void ControlRecorder::startRecording(const QString& filePath) {
+    QMutexLocker locker(&s_mutex);
+    DEBUG_ASSERT(!isRecording());
+    s_filePath = filePath;
+    s_entries.clear();
+    s_entries.reserve(kReserveEntries);
+    s_timer.start();
+    s_recording.store(true, std::memory_order_release);
+    qInfo() << "Recording control changes to" << filePath;
+}
+
+//static
+void ControlRecorder::stopRecording() {
+    if (!isRecording()) {
+        return;
+    }
+    s_recording.store(false, std::memory_order_release);
+    QMutexLocker locker(&s_mutex);
+
+    QFile file(s_filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "Could not open control record file for writing:"
+                   << s_filePath;
+        return;
+    }
+    QTextStream out(&file);
+    for (const Entry& entry : s_entries) {
+        out << entry.timeNanos << ','
+            << entry.key.group << ','
+            << entry.key.item << ','
+            // Round-trip safe double formatting
+            << QString::number(entry.value, 'g', 17) << '\n';
+    }
+    qInfo() << "Wrote" << s_entries.size() << "control changes to"
+            << s_filePath;
+    s_entries.clear();
+    s_entries.shrink_to_fit();
+}
+
+//static
+void ControlRecorder::record(const ConfigKey& key, double value) {
+    QMutexLocker locker(&s_mutex);
+    // Re-check under the lock, stopRecording() may have won the race.
+    if (!isRecording()) {
+        return;
+    }
+    if (s_entries.size() >= s_entries.capacity()) {
+        // Drop instead of growing, see kReserveEntries.
+        return;
+    }
+    s_entries.push_back(Entry{s_timer.elapsed().toIntegerNanos(), key, value});
+}
+
+ControlReplayer::ControlReplayer(const QString& filePath)
+        : m_filePath(filePath),
+          m_stop(false) {
+    setObjectName(QStringLiteral("ControlReplayer"));
+}
+
+ControlReplayer::~ControlReplayer() {
+    stop();
+    wait();
+}
+
+void ControlReplayer::stop() {
+    m_stop.store(true, std::memory_order_release);
+}
+
+void ControlReplayer::run() {
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Could not open control record file for replay:"
+                   << m_filePath;
+        return;
+    }
+
+    std::vector<Entry> entries;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        const QString line = in.readLine();
+        if (line.isEmpty()) {
+            continue;
+        }
+        const QStringList fields = line.split(QChar(','));
+        if (fields.size() != 4) {
+            qWarning() << "Skipping malformed control record line:" << line;
+            continue;
+        }
+        bool timeOk = false;
+        bool valueOk = false;
+        Entry entry;
+        entry.timeNanos = fields.at(0).toLongLong(&timeOk);
+        entry.key = ConfigKey(fields.at(1), fields.at(2));
+        entry.value = fields.at(3).toDouble(&valueOk);
+        if (!timeOk || !valueOk) {
+            qWarning() << "Skipping malformed control record line:" << line;
+            continue;
+        }
+        entries.push_back(entry);
+    }
+
+    qInfo() << "Replaying" << entries.size() << "control changes from"
+            << m_filePath;
+
+    PerformanceTimer timer;
+    timer.start();
+    for (const Entry& entry : entries) {
+        qint64 remainingNanos = entry.timeNanos - timer.elapsed().toIntegerNanos();
+        while (remainingNanos > 0) {
+            if (m_stop.load(std::memory_order_acquire)) {
+                return;
+            }
+            if (remainingNanos > kCoarseSleepThresholdNanos) {
+                QThread::usleep(kCoarseSleepUsecs);
+            } else {
+                QThread::usleep(kFineSleepUsecs);
+            }
+            remainingNanos = entry.timeNanos - timer.elapsed().toIntegerNanos();
+        }
+        if (m_stop.load(std::memory_order_acquire)) {
+            return;
+        }
+        ControlObject::set(entry.key, entry.value);
+    }
+
+    qInfo() << "Control replay finished after"
+            << timer.elapsed().debugMillisWithUnit();
+}
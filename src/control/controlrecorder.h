@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <atomic>
+#include <vector>
+
+#include "preferences/configobject.h"
+#include "util/performancetimer.h"
+
+// Records every ControlObject value change together with a monotonic
+// nanosecond timestamp into a plain text log, one change per line:
+//
+//     <nanos>,<group>,<item>,<value>
+//
+// The log can be replayed against a later build with ControlReplayer to
+// reproduce a performance deterministically, e.g. for comparing callback
+// timing between builds with --developer --timeline-path. Recording is
+// enabled with the --control-record-path command line option, runs for
+// the entire session and is written to disk on shutdown.
+//
+// The recording hook in ControlDoublePrivate::setInner() is also called
+// from the engine callback, so record() only appends to a preallocated
+// in-memory log under a briefly held mutex. This is not strictly
+// real-time safe, but as a developer diagnostic it is on par with the
+// existing Stat tracking, and when no recording is active the hook costs
+// a single relaxed atomic load.
+class ControlRecorder final {
+  public:
+    ControlRecorder() = delete;
+
+    // Starts recording control changes into memory. The log is written
+    // to filePath by stopRecording().
+    static void startRecording(const QString& filePath);
+    // Stops recording and writes the collected log to disk.
+    static void stopRecording();
+
+    static bool isRecording() {
+        return s_recording.load(std::memory_order_relaxed);
+    }
+
+    // Called from ControlDoublePrivate::setInner() for every value
+    // change while recording is active. Callable from any thread.
+    static void record(const ConfigKey& key, double value);
+
+  private:
+    struct Entry {
+        qint64 timeNanos;
+        ConfigKey key;
+        double value;
+    };
+
+    static std::atomic<bool> s_recording;
+    static QMutex s_mutex;
+    static QString s_filePath;
+    static PerformanceTimer s_timer;
+    static std::vector<Entry> s_entries;
+};
+
+// Replays a log recorded by ControlRecorder on a dedicated thread by
+// setting each control at its recorded offset from the start of the
+// replay. The controls take effect in the engine at the following
+// callback, so the timing accuracy of the replay is bounded by the
+// audio buffer size.
+class ControlReplayer final : public QThread {
+  public:
+    explicit ControlReplayer(const QString& filePath);
+    ~ControlReplayer() override;
+
+    void stop();
+
+  protected:
+    void run() override;
+
+  private:
+    struct Entry {
+        qint64 timeNanos;
+        ConfigKey key;
+        double value;
+    };
+
+    const QString m_filePath;
+    std::atomic<bool> m_stop;
+};
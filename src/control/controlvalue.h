@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
+#include <type_traits>
 
 #include <QAtomicInt>
 #include <QObject>
@@ -11,59 +13,65 @@
 // for lock free access, this value has to be >= the number of value using threads
 // value must be a fraction of an integer
 constexpr int kDefaultRingSize = 8;
-// there are basically unlimited readers allowed at each ring element
-// but we have to count them so max() is just fine.
-// NOTE(rryan): Wrapping max with parentheses avoids conflict with the max macro
-// defined in windows.h.
-constexpr int kMaxReaderSlots = (std::numeric_limits<int>::max)();
-
-// A single instance of a value of type T along with an atomic integer which
-// tracks the current number of readers or writers of the slot. The value
-// m_readerSlots starts at kMaxReaderSlots and counts down to 0. If the value is
-// 0 or less then reads to the value fail because there are either too many
-// readers or a write is occurring. A write to the value will fail if
-// m_readerSlots is not equal to kMaxReaderSlots (e.g. there is an active
-// reader).
+
+// A single instance of a value of type T guarded by a seqlock. The atomic
+// sequence counter is even while the slot is consistent and odd while a
+// writer is updating it. Readers copy the value optimistically and validate
+// the sequence afterwards, so a read is just two atomic loads and a copy:
+// it never writes to shared state, cannot delay the writer or other readers
+// and any number of threads can snapshot the same slot concurrently without
+// bouncing the cache line between cores.
+// This requires that a torn copy of T is safe to produce (and discard), so
+// T has to be trivially copyable; this is enforced in ControlValueAtomicBase.
 template <typename T>
 class ControlRingValue {
   public:
     ControlRingValue()
-      : m_readerSlots(kMaxReaderSlots) {
+            : m_value(T()),
+              m_sequence(0) {
     }
 
-    // Tries to copy the stored value if a reader slot is available.
-    // This operation can be repeated multiple times for the same
-    // slot, because the stored value is preserved.
+    // Tries to copy the stored value. This fails if a writer is currently
+    // updating this slot or has updated it while we were copying. The
+    // operation can be repeated multiple times for the same slot, because
+    // the stored value is preserved.
     bool tryGet(T* value) const {
-        // Read while consuming one readerSlot
-        if (m_readerSlots.fetchAndAddAcquire(-1) > 0) {
-            // Reader slot has been acquired, no writer is active
-            *value = m_value;
-            m_readerSlots.fetchAndAddRelease(1);
-            // We need the early return here to make the compiler
-            // aware that *value is initialised in the true case.
-            return true;
+        const int stamp = m_sequence.loadAcquire();
+        if (stamp % 2 != 0) {
+            // A write to this slot is in progress
+            return false;
         }
-        m_readerSlots.fetchAndAddRelease(1);
-        return false;
+        // This copy may race with a concurrent writer and produce a torn
+        // value. The acquire fence below orders the copy's loads before the
+        // sequence reload (LoadLoad); an acquire *load* alone would not --
+        // it only keeps later operations from moving up, so the copy could
+        // be reordered past it and a torn value validated as consistent.
+        // With the fence, an unchanged sequence proves no write overlapped
+        // the copy and the result is safe to use.
+        *value = m_value;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return atomicLoadRelaxed(m_sequence) == stamp;
     }
 
     bool trySet(const T& value) {
-        // try to lock this element entirely for reading
-        if (m_readerSlots.testAndSetAcquire(kMaxReaderSlots, 0)) {
-            m_value = value;
-            // We need to re-add kMaxReaderSlots instead of storing it
-            // to keep the balance if readers have decreased the number
-            // of slots in the meantime!
-            m_readerSlots.fetchAndAddRelease(kMaxReaderSlots);
-            return true;
+        const int stamp = atomicLoadRelaxed(m_sequence);
+        if (stamp % 2 != 0) {
+            // Another writer is active in this slot
+            return false;
+        }
+        // Acquire the slot by making the sequence odd. This only races with
+        // other writers; readers never modify the sequence.
+        if (!m_sequence.testAndSetAcquire(stamp, stamp + 1)) {
+            return false;
         }
-        return false;
+        m_value = value;
+        m_sequence.storeRelease(stamp + 2);
+        return true;
     }
 
   private:
     T m_value;
-    mutable QAtomicInt m_readerSlots;
+    mutable QAtomicInt m_sequence;
 };
 
 // Ring buffer based implementation for all Types sizeof(T) > sizeof(void*)
@@ -74,19 +82,24 @@ class ControlRingValue {
 // for the benefit of wait-free read/write access to a value.
 template <typename T, int cRingSize, bool ATOMIC = false>
 class ControlValueAtomicBase {
+    static_assert(std::is_trivially_copyable<T>::value,
+            "The seqlock read path in ControlRingValue produces (and "
+            "discards) torn copies, which is only safe for trivially "
+            "copyable types");
+
   public:
     inline T getValue() const {
         T value;
         unsigned int index = static_cast<unsigned int>(atomicLoadRelaxed(m_readIndex)) % cRingSize;
         while (!m_ring[index].tryGet(&value)) {
-            // We are here if
-            // 1) there are more then kMaxReaderSlots reader (get) reading the same value or
-            // 2) the formerly current value is locked by a writer
-            // Case 1 does not happen because we have enough (0x7fffffff) reader slots.
-            // Case 2 happens when the a reader is delayed after reading the
-            // m_currentIndex and in the mean while a reader locks the formally current value
-            // because it has written cRingSize times. Reading the less recent value will fix
-            // it because it is now actually the current value.
+            // We are here if the formerly current value is locked by a
+            // writer or has been rewritten while we were copying it. This
+            // happens when the reader is delayed after reading
+            // m_readIndex and in the mean time a writer locks the formerly
+            // current value because it has written cRingSize times. Reading
+            // the less recent value will fix it because it is now actually
+            // the current value. Readers do not delay each other, so this
+            // cannot loop endlessly.
             index = (index - 1) % cRingSize;
         }
         return value;
@@ -98,10 +111,9 @@ class ControlValueAtomicBase {
         unsigned int index;
         do {
             index = static_cast<unsigned int>(m_writeIndex.fetchAndAddAcquire(1)) % cRingSize;
-            // This will be repeated if the value is locked
-            // 1) by another writer writing at the same time or
-            // 2) a delayed reader is still blocking the formerly current value
-            // In both cases writing to the next value will fix it.
+            // This will be repeated if the slot is locked by another writer
+            // writing at the same time. Readers never lock a slot, so
+            // writing to the next slot will fix it.
         } while (!m_ring[index].trySet(value));
         m_readIndex = index;
     }
@@ -114,8 +126,10 @@ class ControlValueAtomicBase {
     }
 
   private:
-    // In worst case, each reader can consume a reader slot from a different ring element.
-    // In this case there is still one ring element available for writing.
+    // The ring gives the writer a place to go while older slots are still
+    // being snapshotted by delayed readers, and gives delayed readers a
+    // consistent (slightly older) slot to fall back to while the writer is
+    // busy with the current one.
     ControlRingValue<T> m_ring[cRingSize];
     QAtomicInt m_readIndex;
     QAtomicInt m_writeIndex;
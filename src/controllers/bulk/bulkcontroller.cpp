@@ -10,11 +10,34 @@
 #include "util/time.h"
 #include "util/trace.h"
 
-BulkReader::BulkReader(libusb_device_handle *handle, unsigned char in_epaddr)
+namespace {
+
+// Number of asynchronous transfers kept in flight on the IN endpoint. With
+// several outstanding transfers the host controller always has an URB queued
+// when the device produces data, so input latency is bounded by the USB
+// frame time instead of the reader thread's scheduling.
+constexpr int kNumInTransfers = 4;
+
+// Maximum packet size per transfer, matching the buffer size of the old
+// synchronous polling loop.
+constexpr int kInTransferSize = 255;
+
+extern "C" void LIBUSB_CALL bulkReaderCallback(libusb_transfer* transfer) {
+    static_cast<BulkReader*>(transfer->user_data)
+            ->onTransferCompleted(transfer);
+}
+
+} // namespace
+
+BulkReader::BulkReader(libusb_context* context,
+        libusb_device_handle* handle,
+        unsigned char in_epaddr)
         : QThread(),
+          m_context(context),
           m_phandle(handle),
           m_stop(0),
-          m_in_epaddr(in_epaddr) {
+          m_in_epaddr(in_epaddr),
+          m_activeTransfers(0) {
 }
 
 BulkReader::~BulkReader() {
@@ -24,31 +47,80 @@ void BulkReader::stop() {
     m_stop = 1;
 }
 
+void BulkReader::onTransferCompleted(libusb_transfer* transfer) {
+    if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+        Trace process("BulkReader process packet");
+        QByteArray byteArray(reinterpret_cast<char*>(transfer->buffer),
+                transfer->actual_length);
+        emit incomingData(byteArray, mixxx::Time::elapsed());
+    }
+
+    if (atomicLoadAcquire(m_stop) == 0 &&
+            transfer->status != LIBUSB_TRANSFER_CANCELLED &&
+            transfer->status != LIBUSB_TRANSFER_NO_DEVICE) {
+        // Resubmit immediately to keep the queue full; timeouts and
+        // transient errors are not fatal.
+        if (libusb_submit_transfer(transfer) == 0) {
+            return;
+        }
+        qWarning() << "BulkReader failed to resubmit transfer";
+    }
+    --m_activeTransfers;
+}
+
 void BulkReader::run() {
     m_stop = 0;
-    unsigned char data[255];
-
-    while (atomicLoadAcquire(m_stop) == 0) {
-        // Blocked polling: The only problem with this is that we can't close
-        // the device until the block is released, which means the controller
-        // has to send more data
-        //result = hid_read_timeout(m_pHidDevice, data, 255, -1);
-
-        // This relieves that at the cost of higher CPU usage since we only
-        // block for a short while (500ms)
-        int transferred;
-        int result;
-
-        result = libusb_bulk_transfer(m_phandle,
-                                      m_in_epaddr,
-                                      data, sizeof(data),
-                                      &transferred, 500);
-        Trace timeout("BulkReader timeout");
-        if (result >= 0) {
-            Trace process("BulkReader process packet");
-            //qDebug() << "Read" << result << "bytes, pointer:" << data;
-            QByteArray byteArray(reinterpret_cast<char*>(data), transferred);
-            emit incomingData(byteArray, mixxx::Time::elapsed());
+
+    // Queue multiple asynchronous transfers instead of issuing one blocking
+    // transfer per loop iteration. The completions are dispatched from
+    // libusb_handle_events_timeout_completed() below, which invokes
+    // onTransferCompleted() on this thread.
+    unsigned char buffers[kNumInTransfers][kInTransferSize];
+    libusb_transfer* transfers[kNumInTransfers] = {};
+    m_activeTransfers = 0;
+    for (int i = 0; i < kNumInTransfers; ++i) {
+        transfers[i] = libusb_alloc_transfer(0);
+        if (transfers[i] == nullptr) {
+            continue;
+        }
+        libusb_fill_bulk_transfer(transfers[i],
+                m_phandle,
+                m_in_epaddr,
+                buffers[i],
+                sizeof(buffers[i]),
+                bulkReaderCallback,
+                this,
+                0);
+        if (libusb_submit_transfer(transfers[i]) == 0) {
+            ++m_activeTransfers;
+        }
+    }
+
+    if (m_activeTransfers == 0) {
+        qWarning() << "BulkReader unable to submit any transfers";
+    }
+
+    while (atomicLoadAcquire(m_stop) == 0 && m_activeTransfers > 0) {
+        // Wake up regularly so a pending stop() is noticed even if the
+        // device stays silent.
+        timeval tv = {0, 500000};
+        libusb_handle_events_timeout_completed(m_context, &tv, nullptr);
+    }
+
+    // Cancel the outstanding transfers and wait for their final callbacks
+    // before the buffers on this stack frame go away.
+    for (int i = 0; i < kNumInTransfers; ++i) {
+        if (transfers[i] != nullptr) {
+            libusb_cancel_transfer(transfers[i]);
+        }
+    }
+    while (m_activeTransfers > 0) {
+        timeval tv = {0, 100000};
+        libusb_handle_events_timeout_completed(m_context, &tv, nullptr);
+    }
+    for (int i = 0; i < kNumInTransfers; ++i) {
+        if (transfers[i] != nullptr) {
+            libusb_free_transfer(transfers[i]);
         }
     }
     qDebug() << "Stopped Reader";
@@ -175,7 +247,7 @@ int BulkController::open() {
     if (m_pReader != nullptr) {
         qWarning() << "BulkReader already present for" << getName();
     } else {
-        m_pReader = new BulkReader(m_phandle, in_epaddr);
+        m_pReader = new BulkReader(m_context, m_phandle, in_epaddr);
         m_pReader->setObjectName(QString("BulkReader %1").arg(getName()));
 
         connect(m_pReader, &BulkReader::incomingData, this, &BulkController::receive);
@@ -223,12 +295,13 @@ int BulkController::close() {
 
 void BulkController::send(const QList<int>& data, unsigned int length) {
     Q_UNUSED(length);
-    QByteArray temp;
-
+    m_sendBuffer.resize(data.size());
+    char* pBuffer = m_sendBuffer.data();
+    int i = 0;
     foreach (int datum, data) {
-        temp.append(datum);
+        pBuffer[i++] = datum;
     }
-    sendBytes(temp);
+    sendBytes(m_sendBuffer);
 }
 
 void BulkController::sendBytes(const QByteArray& data) {
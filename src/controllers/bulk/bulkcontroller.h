@@ -11,16 +11,23 @@
 struct libusb_device_handle;
 struct libusb_context;
 struct libusb_device_descriptor;
+struct libusb_transfer;
 
 /// USB Bulk controller backend
 class BulkReader : public QThread {
     Q_OBJECT
   public:
-    BulkReader(libusb_device_handle *handle, unsigned char in_epaddr);
+    BulkReader(libusb_context* context,
+            libusb_device_handle* handle,
+            unsigned char in_epaddr);
     virtual ~BulkReader();
 
     void stop();
 
+    // Called from the libusb transfer callback on the reader thread. Not
+    // part of the public API.
+    void onTransferCompleted(libusb_transfer* transfer);
+
   signals:
     void incomingData(const QByteArray& data, mixxx::Duration timestamp);
 
@@ -28,9 +35,14 @@ class BulkReader : public QThread {
     void run();
 
   private:
+    libusb_context* m_context;
     libusb_device_handle* m_phandle;
     QAtomicInt m_stop;
     unsigned char m_in_epaddr;
+    // Number of submitted transfers that have not reached a final
+    // completion yet. Only touched on the reader thread, which is the one
+    // dispatching the libusb callbacks.
+    int m_activeTransfers;
 };
 
 class BulkController : public Controller {
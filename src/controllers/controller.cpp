@@ -7,6 +7,7 @@
 #include "controllers/defs_controllers.h"
 #include "moc_controller.cpp"
 #include "util/screensaver.h"
+#include "util/stat.h"
 
 Controller::Controller()
         : m_pScriptEngineLegacy(nullptr),
@@ -85,11 +86,12 @@ void Controller::send(const QList<int>& data, unsigned int length) {
     // The length parameter is here for backwards compatibility for when scripts
     // were required to specify it.
     length = data.size();
-    QByteArray msg(length, 0);
+    m_sendBuffer.resize(length);
+    char* pBuffer = m_sendBuffer.data();
     for (unsigned int i = 0; i < length; ++i) {
-        msg[i] = data.at(i);
+        pBuffer[i] = data.at(i);
     }
-    sendBytes(msg);
+    sendBytes(m_sendBuffer);
 }
 
 void Controller::triggerActivity()
@@ -109,6 +111,9 @@ void Controller::receive(const QByteArray& data, mixxx::Duration timestamp) {
     }
     triggerActivity();
 
+    // Per-device message rate, collected when running with --developer.
+    Stat::track(messageStatTag(), Stat::EVENT, Stat::COUNT, 1.0);
+
     int length = data.size();
     if (ControllerDebug::isEnabled()) {
         // Formatted packet display
@@ -47,6 +47,16 @@ class Controller : public QObject {
     inline const QString& getName() const {
         return m_sDeviceName;
     }
+
+    // Tags for per-device diagnostics reported via Stat::track in developer
+    // mode. Prebuilt here so the polling and input hot paths do not
+    // concatenate strings for every call.
+    inline const QString& pollStatTag() const {
+        return m_pollStatTag;
+    }
+    inline const QString& messageStatTag() const {
+        return m_messageStatTag;
+    }
     inline const QString& getCategory() const {
         return m_sDeviceCategory;
     }
@@ -104,6 +114,12 @@ class Controller : public QObject {
     // controller.
     virtual void sendBytes(const QByteArray& data) = 0;
 
+    // Reused for converting outgoing messages to raw bytes. Keeping the
+    // buffer between messages avoids a heap allocation per message on the
+    // controller thread, which matters for controllers that receive
+    // thousands of display update messages per minute.
+    QByteArray m_sendBuffer;
+
     // To be called in sub-class' open() functions after opening the device but
     // before starting any input polling/processing.
     virtual void startEngine();
@@ -120,6 +136,8 @@ class Controller : public QObject {
     }
     inline void setDeviceName(const QString& deviceName) {
         m_sDeviceName = deviceName;
+        m_pollStatTag = QStringLiteral("Controller poll ") + deviceName;
+        m_messageStatTag = QStringLiteral("Controller messages received ") + deviceName;
     }
     inline void setDeviceCategory(const QString& deviceCategory) {
         m_sDeviceCategory = deviceCategory;
@@ -154,6 +172,9 @@ class Controller : public QObject {
 
     // Verbose and unique device name suitable for display.
     QString m_sDeviceName;
+    // Derived stat tags, see pollStatTag()/messageStatTag().
+    QString m_pollStatTag;
+    QString m_messageStatTag;
     // Verbose and unique description of device type, defaults to empty
     QString m_sDeviceCategory;
     // Flag indicating if this device supports output (receiving data from
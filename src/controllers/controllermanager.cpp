@@ -5,6 +5,7 @@
 
 #include "controllers/controllerlearningeventfilter.h"
 #include "controllers/defs_controllers.h"
+#include "controllers/midi/midicontroller.h"
 #include "controllers/midi/portmidienumerator.h"
 #include "moc_controllermanager.cpp"
 #include "util/cmdlineargs.h"
@@ -355,7 +356,17 @@ void ControllerManager::pollDevices() {
     mixxx::Duration start = mixxx::Time::elapsed();
     for (Controller* pDevice : qAsConst(m_controllers)) {
         if (pDevice->isOpen() && pDevice->isPolling()) {
+            const mixxx::Duration deviceStart = mixxx::Time::elapsed();
             pDevice->poll();
+            // Track the poll duration per device, so that a misbehaving
+            // mapping script or a saturated bus can be attributed to the
+            // device causing it. Only collected when running with
+            // --developer, otherwise Stat::track returns immediately.
+            Stat::track(pDevice->pollStatTag(),
+                    Stat::DURATION_NANOSEC,
+                    Stat::COUNT | Stat::AVERAGE | Stat::SAMPLE_VARIANCE |
+                            Stat::MAX | Stat::MIN,
+                    (mixxx::Time::elapsed() - deviceStart).toIntegerNanos());
         }
     }
 
@@ -398,6 +409,27 @@ void ControllerManager::closeController(Controller* pController) {
             ConfigKey("[Controller]", sanitizeDeviceName(pController->getName())), 0);
 }
 
+void ControllerManager::slotSendMidiClockTicks(int tickCount,
+        double firstTickOffsetSeconds,
+        double tickIntervalSeconds) {
+    // Runs in the controller thread. The offsets were computed relative to
+    // the engine buffer that triggered the signal, so they are already in
+    // the past by the queued-connection delay; timestamped backends clamp
+    // late ticks to "as soon as possible" which keeps the tick *spacing*
+    // exact even when the first tick fires immediately.
+    QMutexLocker locker(&m_mutex);
+    for (Controller* pController : qAsConst(m_controllers)) {
+        if (!pController->isOpen() || !pController->isOutputDevice()) {
+            continue;
+        }
+        auto* pMidiController = qobject_cast<MidiController*>(pController);
+        if (pMidiController) {
+            pMidiController->sendMidiClockTicks(
+                    tickCount, firstTickOffsetSeconds, tickIntervalSeconds);
+        }
+    }
+}
+
 void ControllerManager::slotApplyMapping(Controller* pController,
         std::shared_ptr<LegacyControllerMapping> pMapping,
         bool bEnabled) {
@@ -56,6 +56,13 @@ class ControllerManager : public QObject {
     void openController(Controller* pController);
     void closeController(Controller* pController);
 
+    /// Forwards MIDI beat clock ticks from the engine's MidiClockTicker to
+    /// all open MIDI output devices. Invoked via a queued connection so the
+    /// sends happen in the controller thread, not the engine callback.
+    void slotSendMidiClockTicks(int tickCount,
+            double firstTickOffsetSeconds,
+            double tickIntervalSeconds);
+
   private slots:
     /// Perform initialization that should be delayed until the ControllerManager
     /// thread is started.
@@ -9,12 +9,13 @@
 
 ControlDelegate::ControlDelegate(QObject* pParent)
         : QStyledItemDelegate(pParent),
-          m_pPicker(new ControlPickerMenu(nullptr)),
+          m_pPicker(nullptr),
           m_iMidiOptionsColumn(-1),
           m_bIsIndexScript(false) {
 }
 
 ControlDelegate::~ControlDelegate() {
+    delete m_pPicker;
 }
 
 QWidget* ControlDelegate::createEditor(QWidget* parent,
@@ -53,6 +54,9 @@ QString ControlDelegate::displayText(const QVariant& value,
         return tr("%1 %2").arg(key.group, key.item);
     }
 
+    if (m_pPicker == nullptr) {
+        m_pPicker = new ControlPickerMenu(nullptr);
+    }
     QString description = m_pPicker->descriptionForConfigKey(key);
     if (!description.isEmpty()) {
         return description;
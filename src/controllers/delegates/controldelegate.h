@@ -28,7 +28,10 @@ class ControlDelegate : public QStyledItemDelegate {
                       const QModelIndex& index) const;
 
   private:
-    ControlPickerMenu* m_pPicker;
+    // Created lazily in displayText(): building the picker menu
+    // generates thousands of translated entries that are only needed
+    // once a mapping table actually displays a control description.
+    mutable ControlPickerMenu* m_pPicker;
     int m_iMidiOptionsColumn;
     // HACK(rryan): Does the last painted index have a script
     // MidiOption. displayText does not give us the current QModelIndex so we
@@ -18,8 +18,7 @@ constexpr int kMaxHidErrorMessageSize = 512;
 HidController::HidController(
         mixxx::hid::DeviceInfo&& deviceInfo)
         : m_deviceInfo(std::move(deviceInfo)),
-          m_pHidDevice(nullptr),
-          m_pollingBufferIndex(0) {
+          m_pHidDevice(nullptr) {
     setDeviceCategory(mixxx::hid::DeviceCategory::guessFromDeviceInfo(m_deviceInfo));
     setDeviceName(m_deviceInfo.formatName());
 
@@ -106,10 +105,8 @@ int HidController::open() {
     }
 
     // This isn't strictly necessary but is good practice.
-    for (int i = 0; i < kNumBuffers; i++) {
-        memset(m_pPollData[i], 0, kBufferSize);
-    }
-    m_lastPollSize = 0;
+    memset(m_pPollData, 0, kBufferSize);
+    m_lastInputReports.clear();
 
     setOpen(true);
     startEngine();
@@ -138,25 +135,26 @@ int HidController::close() {
 
 void HidController::processInputReport(int bytesRead) {
     Trace process("HidController processInputReport");
-    unsigned char* pPreviousBuffer = m_pPollData[(m_pollingBufferIndex + 1) % kNumBuffers];
-    unsigned char* pCurrentBuffer = m_pPollData[m_pollingBufferIndex];
     // Some controllers such as the Gemini GMX continuously send input reports even if it
     // is identical to the previous send input report. If this loop processed all those redundant
     // input report, it would be a big performance problem to run JS code for every  input report and
     // would be unnecessary.
-    // This assumes that the redundant input report all use the same report ID. In practice we
-    // have not encountered any controllers that send redundant input report with different report
-    // IDs. If any such devices exist, this may be changed to use a separate buffer to store
-    // the last input report for each report ID.
-    if (bytesRead == m_lastPollSize &&
-            memcmp(pCurrentBuffer, pPreviousBuffer, bytesRead) == 0) {
+    // The last input report is cached per report ID, so that controllers
+    // which interleave reports with different IDs still have their redundant
+    // reports skipped.
+    const unsigned char reportId = m_pPollData[0];
+    const auto it = m_lastInputReports.constFind(reportId);
+    if (it != m_lastInputReports.constEnd() &&
+            it.value().size() == bytesRead &&
+            memcmp(m_pPollData, it.value().constData(), bytesRead) == 0) {
         return;
     }
-    // Cycle between buffers so the memcmp above does not require deep copying to another buffer.
-    m_pollingBufferIndex = (m_pollingBufferIndex + 1) % kNumBuffers;
-    m_lastPollSize = bytesRead;
-    auto incomingData = QByteArray::fromRawData(
-            reinterpret_cast<char*>(pCurrentBuffer), bytesRead);
+    // Deep copy the report, so that the next hid_read cannot overwrite it
+    // while the mapping JS code is still using it. Only changed reports are
+    // copied, redundant reports are skipped above with a plain memcmp.
+    const QByteArray incomingData(
+            reinterpret_cast<char*>(m_pPollData), bytesRead);
+    m_lastInputReports.insert(reportId, incomingData);
 
     // Execute callback function in JavaScript mapping
     // and print to stdout in case of --controllerDebug
@@ -167,8 +165,8 @@ QList<int> HidController::getInputReport(unsigned int reportID) {
     Trace hidRead("HidController getInputReport");
     int bytesRead;
 
-    m_pPollData[m_pollingBufferIndex][0] = reportID;
-    bytesRead = hid_get_input_report(m_pHidDevice, m_pPollData[m_pollingBufferIndex], kBufferSize);
+    m_pPollData[0] = reportID;
+    bytesRead = hid_get_input_report(m_pHidDevice, m_pPollData, kBufferSize);
 
     controllerDebug(bytesRead
             << "bytes received by hid_get_input_report" << getName()
@@ -192,7 +190,7 @@ QList<int> HidController::getInputReport(unsigned int reportID) {
     QList<int> dataList;
     dataList.reserve(bytesRead);
     for (int i = 0; i < bytesRead; i++) {
-        dataList.append(m_pPollData[m_pollingBufferIndex][i]);
+        dataList.append(m_pPollData[i]);
     }
     return dataList;
 }
@@ -206,7 +204,7 @@ bool HidController::poll() {
     // There is no safety net for this because it has not been demonstrated to be
     // a problem in practice.
     while (true) {
-        int bytesRead = hid_read(m_pHidDevice, m_pPollData[m_pollingBufferIndex], kBufferSize);
+        int bytesRead = hid_read(m_pHidDevice, m_pPollData, kBufferSize);
         if (bytesRead < 0) {
             // -1 is the only error value according to hidapi documentation.
             DEBUG_ASSERT(bytesRead == -1);
@@ -225,22 +223,38 @@ bool HidController::isPolling() const {
 
 void HidController::sendReport(QList<int> data, unsigned int length, unsigned int reportID) {
     Q_UNUSED(length);
-    QByteArray temp;
+    // Fill the reused write buffer directly instead of building a temporary
+    // array that sendBytesReport would copy once more to prepend the report
+    // ID. Screen-equipped controllers send thousands of reports per minute,
+    // so per-message allocations show up as latency spikes on the
+    // controller thread.
+    m_writeBuffer.resize(kReportIdSize + data.size());
+    char* pBuffer = m_writeBuffer.data();
+    // The Report ID goes into the first byte per the API..
+    *pBuffer++ = reportID;
     foreach (int datum, data) {
-        temp.append(datum);
+        *pBuffer++ = datum;
     }
-    sendBytesReport(temp, reportID);
+    writeBufferedReport(reportID);
 }
 
 void HidController::sendBytes(const QByteArray& data) {
     sendBytesReport(data, 0);
 }
 
-void HidController::sendBytesReport(QByteArray data, unsigned int reportID) {
-    // Append the Report ID to the beginning of data[] per the API..
-    data.prepend(reportID);
+void HidController::sendBytesReport(const QByteArray& data, unsigned int reportID) {
+    // Prepend the Report ID to the beginning of data[] per the API..
+    m_writeBuffer.resize(kReportIdSize + data.size());
+    char* pBuffer = m_writeBuffer.data();
+    pBuffer[0] = reportID;
+    memcpy(pBuffer + kReportIdSize, data.constData(), data.size());
+    writeBufferedReport(reportID);
+}
 
-    int result = hid_write(m_pHidDevice, (unsigned char*)data.constData(), data.size());
+void HidController::writeBufferedReport(unsigned int reportID) {
+    int result = hid_write(m_pHidDevice,
+            reinterpret_cast<const unsigned char*>(m_writeBuffer.constData()),
+            m_writeBuffer.size());
     if (result == -1) {
         if (ControllerDebug::isEnabled()) {
             qWarning() << "Unable to send data to" << getName()
@@ -263,19 +277,19 @@ void HidController::sendBytesReport(QByteArray data, unsigned int reportID) {
 
 void HidController::sendFeatureReport(
         const QList<int>& dataList, unsigned int reportID) {
-    QByteArray dataArray;
-    dataArray.reserve(kReportIdSize + dataList.size());
+    m_writeBuffer.resize(kReportIdSize + dataList.size());
+    char* pBuffer = m_writeBuffer.data();
 
-    // Append the Report ID to the beginning of dataArray[] per the API..
-    dataArray.append(reportID);
+    // The Report ID goes into the first byte per the API..
+    *pBuffer++ = reportID;
 
     for (const int datum : dataList) {
-        dataArray.append(datum);
+        *pBuffer++ = datum;
     }
 
     int result = hid_send_feature_report(m_pHidDevice,
-            reinterpret_cast<const unsigned char*>(dataArray.constData()),
-            dataArray.size());
+            reinterpret_cast<const unsigned char*>(m_writeBuffer.constData()),
+            m_writeBuffer.size());
     if (result == -1) {
         qWarning() << "sendFeatureReport is unable to send data to"
                    << getName() << "serial #" << m_deviceInfo.serialNumber()
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QHash>
+
 #include "controllers/controller.h"
 #include "controllers/hid/hiddevice.h"
 #include "controllers/hid/legacyhidcontrollermapping.h"
@@ -45,7 +47,10 @@ class HidController final : public Controller {
     // For devices which only support a single report, reportID must be set to
     // 0x0.
     void sendBytes(const QByteArray& data) override;
-    void sendBytesReport(QByteArray data, unsigned int reportID);
+    void sendBytesReport(const QByteArray& data, unsigned int reportID);
+    // Writes the report assembled in m_writeBuffer to the device. The
+    // reportID is only passed for logging.
+    void writeBufferedReport(unsigned int reportID);
     void sendFeatureReport(const QList<int>& dataList, unsigned int reportID);
 
     // getInputReport receives an input report on request.
@@ -71,11 +76,14 @@ class HidController final : public Controller {
     hid_device* m_pHidDevice;
     std::shared_ptr<LegacyHidControllerMapping> m_pMapping;
 
-    static constexpr int kNumBuffers = 2;
     static constexpr int kBufferSize = 255;
-    unsigned char m_pPollData[kNumBuffers][kBufferSize];
-    int m_lastPollSize;
-    int m_pollingBufferIndex;
+    unsigned char m_pPollData[kBufferSize];
+    // The last input report received for each report ID. Used to skip
+    // redundant reports without running the mapping JS code for them.
+    QHash<unsigned char, QByteArray> m_lastInputReports;
+    // Reused for assembling outgoing reports with their report ID prefix,
+    // see writeBufferedReport().
+    QByteArray m_writeBuffer;
 
     friend class HidControllerJSProxy;
 };
@@ -9,6 +9,13 @@
 #include "moc_keyboardeventfilter.cpp"
 #include "util/cmdlineargs.h"
 
+namespace {
+// The modifiers that take part in key sequences. Other modifiers, e.g. the
+// keypad modifier, are not part of the sequence strings in kbd.cfg.
+constexpr Qt::KeyboardModifiers kKeySequenceModifierMask =
+        Qt::ShiftModifier | Qt::ControlModifier | Qt::AltModifier | Qt::MetaModifier;
+} // anonymous namespace
+
 KeyboardEventFilter::KeyboardEventFilter(ConfigObject<ConfigValueKbd>* pKbdConfigObject,
         QObject* parent,
         const char* name)
@@ -50,12 +57,12 @@ bool KeyboardEventFilter::eventFilter(QObject*, QEvent* e) {
 
         QKeySequence ks = getKeySeq(ke);
         if (!ks.isEmpty()) {
-            ConfigValueKbd ksv(ks);
+            const int chord = ks[0];
             // Check if a shortcut is defined
             bool result = false;
             // using const_iterator here is faster than QMultiHash::values()
-            for (auto it = m_keySequenceToControlHash.constFind(ksv);
-                 it != m_keySequenceToControlHash.constEnd() && it.key() == ksv; ++it) {
+            for (auto it = m_keySequenceToControlHash.constFind(chord);
+                 it != m_keySequenceToControlHash.constEnd() && it.key() == chord; ++it) {
                 const ConfigKey& configKey = it.value();
                 if (configKey.group != "[KeyboardShortcuts]") {
                     ControlObject* control = ControlObject::getControl(configKey);
@@ -127,35 +134,17 @@ bool KeyboardEventFilter::eventFilter(QObject*, QEvent* e) {
 }
 
 QKeySequence KeyboardEventFilter::getKeySeq(QKeyEvent* e) {
-    QString modseq;
-    QKeySequence k;
-
-    // TODO(XXX) check if we may simply return QKeySequence(e->modifiers()+e->key())
-
-    if (e->modifiers() & Qt::ShiftModifier) {
-        modseq += "Shift+";
-    }
-
-    if (e->modifiers() & Qt::ControlModifier) {
-        modseq += "Ctrl+";
-    }
-
-    if (e->modifiers() & Qt::AltModifier) {
-        modseq += "Alt+";
-    }
-
-    if (e->modifiers() & Qt::MetaModifier) {
-        modseq += "Meta+";
-    }
-
     if (e->key() >= 0x01000020 && e->key() <= 0x01000023) {
         // Do not act on Modifier only
         // avoid returning "khmer vowel sign ie (U+17C0)"
-        return k;
+        return QKeySequence();
     }
 
-    QString keyseq = QKeySequence(e->key()).toString();
-    k = QKeySequence(modseq + keyseq);
+    // The chord encoding of a QKeySequence is the Qt::KeyboardModifier mask
+    // plus the key code, so the sequence can be built without the former
+    // round trip through its string representation on every key event.
+    const QKeySequence k(
+            static_cast<int>(e->modifiers() & kKeySequenceModifierMask) + e->key());
 
     if (CmdlineArgs::Instance().getDeveloper()) {
         qDebug() << "keyboard press: " << k.toString();
@@ -168,7 +157,21 @@ void KeyboardEventFilter::setKeyboardConfig(ConfigObject<ConfigValueKbd>* pKbdCo
     // invert the mapping to create an injection from key sequence to
     // ConfigKey. This allows a key sequence to trigger multiple controls in
     // Mixxx.
-    m_keySequenceToControlHash = pKbdConfigObject->transpose();
+    // The sequences are compiled down to their integer chord once here, so
+    // the per-event lookup hashes a plain int instead of uppercasing and
+    // hashing the string form of the sequence for every key press.
+    m_keySequenceToControlHash.clear();
+    const QMultiHash<ConfigValueKbd, ConfigKey> transposed =
+            pKbdConfigObject->transpose();
+    for (auto it = transposed.constBegin(); it != transposed.constEnd(); ++it) {
+        const QKeySequence ks(it.key().value);
+        if (ks.count() != 1) {
+            // Multi-chord sequences cannot be triggered by a single key
+            // event and could never match before either.
+            continue;
+        }
+        m_keySequenceToControlHash.insert(ks[0], it.value());
+    }
     m_pKbdConfigObject = pKbdConfigObject;
 }
 
@@ -37,12 +37,15 @@ class KeyboardEventFilter : public QObject {
         ControlObject* pControl;
     };
 
-    // Returns a valid QString with modifier keys from a QKeyEvent
+    // Returns the key sequence of a QKeyEvent or an empty sequence for
+    // modifier-only events
     QKeySequence getKeySeq(QKeyEvent *e);
     // List containing keys which is currently pressed
     QList<KeyDownInformation> m_qActiveKeyList;
     // Pointer to keyboard config object
     ConfigObject<ConfigValueKbd> *m_pKbdConfigObject;
-    // Multi-hash of key sequence to
-    QMultiHash<ConfigValueKbd, ConfigKey> m_keySequenceToControlHash;
+    // Multi-hash of the integer chord of a key sequence to the mapped
+    // controls. Compiled once in setKeyboardConfig(), so per-event lookups
+    // hash a plain int instead of the string form of the sequence.
+    QMultiHash<int, ConfigKey> m_keySequenceToControlHash;
 };
@@ -1,5 +1,6 @@
 #include "controllers/midi/midicontroller.h"
 
+#include "control/control.h"
 #include "control/controlobject.h"
 #include "controllers/controllerdebug.h"
 #include "controllers/defs_controllers.h"
@@ -10,6 +11,7 @@
 #include "moc_midicontroller.cpp"
 #include "util/math.h"
 #include "util/screensaver.h"
+#include "util/stat.h"
 
 MidiController::MidiController()
         : Controller() {
@@ -52,10 +54,42 @@ bool MidiController::matchMapping(const MappingInfo& mapping) {
     return false;
 }
 
+void MidiController::sendMidiClockTicks(int tickCount,
+        double firstTickOffsetSeconds,
+        double tickIntervalSeconds) {
+    for (int i = 0; i < tickCount; ++i) {
+        sendClockTick(firstTickOffsetSeconds + i * tickIntervalSeconds);
+    }
+}
+
+void MidiController::sendClockTick(double secondsFromNow) {
+    // Without a timestamped send API the best we can do is send the tick
+    // right away and let the driver's own buffering absorb the jitter.
+    Q_UNUSED(secondsFromNow);
+    sendShortMsg(MIDI_TIMING_CLK, 0, 0);
+}
+
 bool MidiController::applyMapping() {
     // Handles the engine
     bool result = Controller::applyMapping();
 
+    // The new mapping may address a different set of controls.
+    m_inputMappingControlCache.clear();
+
+    // Warm up the script handlers of all mapped input messages while the
+    // controller is being connected. Otherwise the first message for each
+    // mapping pays for wrapping and evaluating its handler function, which
+    // is noticeable on the first press of every mapped button with large
+    // mappings.
+    ControllerScriptEngineLegacy* pEngine = getScriptEngine();
+    if (result && pEngine != nullptr && m_pMapping) {
+        for (const MidiInputMapping& mapping : m_pMapping->getInputMappings()) {
+            if (mapping.options.script) {
+                pEngine->wrapFunctionCode(mapping.control.item, 5);
+            }
+        }
+    }
+
     // Only execute this code if this is an output device
     if (isOutputDevice()) {
         if (m_outputs.count() > 0) {
@@ -210,6 +244,9 @@ void MidiController::receivedShortMessage(unsigned char status,
         unsigned char control,
         unsigned char value,
         mixxx::Duration timestamp) {
+    // Per-device message rate, collected when running with --developer.
+    Stat::track(messageStatTag(), Stat::EVENT, Stat::COUNT, 1.0);
+
     // The rest of this function is for legacy mappings
     unsigned char channel = MidiUtils::channelFromStatus(status);
     unsigned char opCode = MidiUtils::opCodeFromStatus(status);
@@ -277,7 +314,7 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
     }
 
     // Only pass values on to valid ControlObjects.
-    ControlObject* pCO = ControlObject::getControl(mapping.control);
+    ControlObject* pCO = resolveInputMappingControl(mapping.control);
     if (pCO == nullptr) {
         return;
     }
@@ -370,14 +407,37 @@ void MidiController::processInputMapping(const MidiInputMapping& mapping,
 
     if (mapping.options.soft_takeover) {
         // This is the only place to enable it if it isn't already.
-        m_st.enable(pCO);
-        if (m_st.ignore(pCO, pCO->getParameterForMidi(newValue))) {
+        if (m_st.enableAndIgnore(pCO, pCO->getParameterForMidi(newValue))) {
             return;
         }
     }
     pCO->setValueFromMidi(static_cast<MidiOpCode>(opCode), newValue);
 }
 
+ControlObject* MidiController::resolveInputMappingControl(const ConfigKey& key) {
+    auto it = m_inputMappingControlCache.find(key);
+    if (it != m_inputMappingControlCache.end()) {
+        ControlObject* pCO = it.value()->getCreatorCO();
+        if (pCO != nullptr) {
+            return pCO;
+        }
+        // The ControlObject has been deleted since the control was
+        // cached. Drop the stale entry and fall through to a fresh
+        // lookup, the control may have been recreated in the meantime.
+        m_inputMappingControlCache.erase(it);
+    }
+    QSharedPointer<ControlDoublePrivate> pControl =
+            ControlDoublePrivate::getControl(key);
+    if (!pControl) {
+        return nullptr;
+    }
+    ControlObject* pCO = pControl->getCreatorCO();
+    if (pCO != nullptr) {
+        m_inputMappingControlCache.insert(key, pControl);
+    }
+    return pCO;
+}
+
 double MidiController::computeValue(
         MidiOptions options, double prevmidivalue, double newmidivalue) {
     double tempval = 0.;
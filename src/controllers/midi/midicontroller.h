@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QHash>
+#include <QSharedPointer>
+
 #include "controllers/controller.h"
 #include "controllers/midi/legacymidicontrollermapping.h"
 #include "controllers/midi/legacymidicontrollermappingfilehandler.h"
@@ -7,6 +10,7 @@
 #include "controllers/midi/midioutputhandler.h"
 #include "controllers/softtakeover.h"
 
+class ControlDoublePrivate;
 class DlgControllerLearning;
 
 /// MIDI Controller base class
@@ -37,6 +41,14 @@ class MidiController : public Controller {
 
     bool matchMapping(const MappingInfo& mapping) override;
 
+    /// Sends tickCount MIDI beat clock ticks (0xF8) as scheduled by the
+    /// engine's MidiClockTicker. The offsets are seconds from now; tick i is
+    /// due at firstTickOffsetSeconds + i * tickIntervalSeconds. Called by
+    /// ControllerManager in the controller thread.
+    void sendMidiClockTicks(int tickCount,
+            double firstTickOffsetSeconds,
+            double tickIntervalSeconds);
+
   signals:
     void messageReceived(unsigned char status, unsigned char control, unsigned char value);
 
@@ -45,6 +57,11 @@ class MidiController : public Controller {
             unsigned char byte1,
             unsigned char byte2) = 0;
 
+    /// Sends a single MIDI beat clock tick due secondsFromNow in the future.
+    /// Backends with timestamped send APIs override this to schedule the byte
+    /// on the wire; the default implementation sends it immediately.
+    virtual void sendClockTick(double secondsFromNow);
+
     /// Alias for send()
     /// The length parameter is here for backwards compatibility for when scripts
     /// were required to specify it.
@@ -82,12 +99,19 @@ class MidiController : public Controller {
             const QByteArray& data,
             mixxx::Duration timestamp);
 
+    // Resolves the ControlObject of a non-script input mapping. The
+    // underlying control is cached so the lock around the global control
+    // hash is only taken once per mapped control instead of once per
+    // incoming message.
+    ControlObject* resolveInputMappingControl(const ConfigKey& key);
+
     double computeValue(MidiOptions options, double _prevmidivalue, double _newmidivalue);
     void createOutputHandlers();
     void updateAllOutputs();
     void destroyOutputHandlers();
 
     QHash<uint16_t, MidiInputMapping> m_temporaryInputMappings;
+    QHash<ConfigKey, QSharedPointer<ControlDoublePrivate>> m_inputMappingControlCache;
     QList<MidiOutputHandler*> m_outputs;
     std::shared_ptr<LegacyMidiControllerMapping> m_pMapping;
     SoftTakeoverCtrl m_st;
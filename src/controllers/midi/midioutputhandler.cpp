@@ -7,6 +7,15 @@
 #include "controllers/midi/midicontroller.h"
 #include "moc_midioutputhandler.cpp"
 
+namespace {
+// Minimum interval between two MIDI messages for one output mapping.
+// Controls that change faster, e.g. a VU meter crossing its threshold on
+// every engine buffer, are coalesced and only the latest on/off state is
+// sent once the interval has elapsed, so LED feedback cannot flood the
+// bus and starve input from the same device.
+constexpr int kMinSendIntervalMillis = 20;
+} // anonymous namespace
+
 MidiOutputHandler::MidiOutputHandler(MidiController* controller,
         const MidiOutputMapping& mapping)
         : m_pController(controller),
@@ -14,6 +23,11 @@ MidiOutputHandler::MidiOutputHandler(MidiController* controller,
           m_cos(mapping.controlKey, this, ControlFlag::NoAssertIfMissing),
           m_lastVal(-1) { // -1 = virgin
     m_cos.connectValueChanged(this, &MidiOutputHandler::controlChanged);
+    m_throttleTimer.setSingleShot(true);
+    connect(&m_throttleTimer,
+            &QTimer::timeout,
+            this,
+            &MidiOutputHandler::sendCurrentState);
 }
 
 MidiOutputHandler::~MidiOutputHandler() {
@@ -27,12 +41,29 @@ bool MidiOutputHandler::validate() {
 }
 
 void MidiOutputHandler::update() {
-    controlChanged(m_cos.get());
+    // Send the initial state immediately, e.g. when the device is connected.
+    m_throttleTimer.stop();
+    sendCurrentState();
 }
 
 void MidiOutputHandler::controlChanged(double value) {
+    Q_UNUSED(value);
+    if (m_throttleTimer.isActive()) {
+        // A send is already scheduled and will pick up the latest state.
+        return;
+    }
+    if (m_sinceLastSend.isValid() &&
+            m_sinceLastSend.elapsed() < kMinSendIntervalMillis) {
+        m_throttleTimer.start(kMinSendIntervalMillis -
+                static_cast<int>(m_sinceLastSend.elapsed()));
+        return;
+    }
+    sendCurrentState();
+}
+
+void MidiOutputHandler::sendCurrentState() {
     // Don't update with out of date messages.
-    value = m_cos.get();
+    const double value = m_cos.get();
 
     unsigned char byte3 = m_mapping.output.off;
     if (value >= m_mapping.output.min && value <= m_mapping.output.max) {
@@ -53,5 +84,6 @@ void MidiOutputHandler::controlChanged(double value) {
         m_pController->sendShortMsg(m_mapping.output.status,
                                     m_mapping.output.control, byte3);
         m_lastVal = static_cast<int>(byte3);
+        m_sinceLastSend.start();
     }
 }
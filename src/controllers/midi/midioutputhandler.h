@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QElapsedTimer>
+#include <QTimer>
+
 #include "control/controlproxy.h"
 #include "controllers/midi/midimessage.h"
 
@@ -23,8 +26,14 @@ class MidiOutputHandler : public QObject {
     void controlChanged(double value);
 
   private:
+    /// Sends the current on/off state of the control to the device if it
+    /// differs from the last sent state.
+    void sendCurrentState();
+
     MidiController* m_pController;
     const MidiOutputMapping m_mapping;
     ControlProxy m_cos;
     int m_lastVal;
+    QElapsedTimer m_sinceLastSend;
+    QTimer m_throttleTimer;
 };
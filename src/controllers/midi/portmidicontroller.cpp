@@ -1,5 +1,7 @@
 #include "controllers/midi/portmidicontroller.h"
 
+#include <porttime.h>
+
 #include "controllers/controllerdebug.h"
 #include "controllers/midi/midiutils.h"
 #include "moc_portmidicontroller.cpp"
@@ -212,6 +214,23 @@ void PortMidiController::sendShortMsg(unsigned char status, unsigned char byte1,
     }
 }
 
+void PortMidiController::sendClockTick(double secondsFromNow) {
+    if (m_pOutputDevice.isNull() || !m_pOutputDevice->isOpen()) {
+        return;
+    }
+
+    // The stream is opened with a 1 ms latency, so PortMidi delivers the
+    // message at the given PortTime timestamp (plus that latency). Ticks
+    // whose timestamp has already passed are sent as soon as possible.
+    PmTimestamp when = Pt_Time() +
+            static_cast<PmTimestamp>(secondsFromNow * 1000.0);
+    PmError err = m_pOutputDevice->writeShortTimestamped(when, MIDI_TIMING_CLK);
+    if (err != pmNoError) {
+        qWarning() << "Error sending MIDI clock tick";
+        qWarning() << "PortMidi error:" << Pm_GetErrorText(err);
+    }
+}
+
 void PortMidiController::sendBytes(const QByteArray& data) {
     // PortMidi does not receive a length argument for the buffer we provide to
     // Pm_WriteSysEx. Instead, it scans for a MIDI_EOX byte to know when the
@@ -65,6 +65,11 @@ class PortMidiController : public MidiController {
     void sendShortMsg(unsigned char status, unsigned char byte1,
                       unsigned char byte2) override;
 
+    // Schedules the tick via PortMidi's timestamped write so the bytes hit
+    // the wire at the engine-computed time instead of whenever the
+    // controller thread got around to this call.
+    void sendClockTick(double secondsFromNow) override;
+
   private:
     // The sysex data must already contain the start byte 0xf0 and the end byte
     // 0xf7.
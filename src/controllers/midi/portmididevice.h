@@ -35,13 +35,18 @@ class PortMidiDevice {
     }
 
     virtual PmError openOutput() {
+        // PortMidi only honors message timestamps when the stream is opened
+        // with a non-zero latency, so use the smallest possible one. This
+        // delays untimestamped messages (timestamp 0 is in the past, so they
+        // are still delivered as soon as possible) by at most 1 ms, which is
+        // well below the 3 byte / 960 microseconds wire rate of MIDI itself.
         return Pm_OpenOutput(&m_pStream,
                              m_deviceIndex,
                              NULL, // No driver hacks
                              0, // No buffering
                              NULL, // Use PortTime for timing
                              NULL, // No time info
-                             0); // No latency compensation.
+                             1); // Minimal latency, enables timestamped sends.
     }
 
     virtual PmError close() {
@@ -62,6 +67,10 @@ class PortMidiDevice {
         return Pm_WriteShort(m_pStream, 0, message);
     }
 
+    virtual PmError writeShortTimestamped(PmTimestamp when, int32_t message) {
+        return Pm_WriteShort(m_pStream, when, message);
+    }
+
     virtual PmError writeSysEx(unsigned char* message) {
         return Pm_WriteSysEx(m_pStream, 0, message);
     }
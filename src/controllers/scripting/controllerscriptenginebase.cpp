@@ -7,6 +7,7 @@
 #include "errordialoghandler.h"
 #include "mixer/playermanager.h"
 #include "moc_controllerscriptenginebase.cpp"
+#include "util/trace.h"
 
 ControllerScriptEngineBase::ControllerScriptEngineBase(Controller* controller)
         : m_bDisplayingExceptionDialog(false),
@@ -80,7 +81,11 @@ bool ControllerScriptEngineBase::executeFunction(
         return false;
     }
 
-    // If it does happen to be a function, call it.
+    // If it does happen to be a function, call it. Time the call in
+    // developer mode, so slow mapping handlers show up in the stats with
+    // average, variance and maximum duration.
+    Trace trace("ControllerScriptEngineBase::executeFunction",
+            m_pController ? m_pController->getName() : QString());
     QJSValue returnValue = functionObject.call(args);
     if (returnValue.isError()) {
         showScriptExceptionDialog(returnValue);
@@ -211,6 +211,85 @@ double ControllerScriptInterfaceLegacy::getDefaultParameter(
     return coScript->getParameterForValue(coScript->getDefault());
 }
 
+int ControllerScriptInterfaceLegacy::registerControlBatch(const QJSValue& controls) {
+    const int length = controls.property(QStringLiteral("length")).toInt();
+    QVector<ControlObjectScript*> batch;
+    batch.reserve(length);
+    for (int i = 0; i < length; ++i) {
+        const QJSValue control = controls.property(i);
+        const QString group = control.property(0).toString();
+        const QString name = control.property(1).toString();
+        ControlObjectScript* coScript = getControlObjectScript(group, name);
+        if (coScript == nullptr) {
+            qWarning() << "Unknown control" << group << name
+                       << ", it will read as 0.0 in this batch.";
+        }
+        batch.append(coScript);
+    }
+    m_controlBatches.append(batch);
+    return m_controlBatches.size() - 1;
+}
+
+QJSValue ControllerScriptInterfaceLegacy::getValueBatch(int batchId) {
+    auto pJsEngine = m_pScriptEngineLegacy->jsEngine();
+    VERIFY_OR_DEBUG_ASSERT(pJsEngine) {
+        return QJSValue();
+    }
+
+    if (batchId < 0 || batchId >= m_controlBatches.size()) {
+        m_pScriptEngineLegacy->throwJSError(
+                QStringLiteral("getValueBatch called with unregistered batch id %1")
+                        .arg(batchId));
+        return QJSValue();
+    }
+
+    const QVector<ControlObjectScript*>& batch = m_controlBatches.at(batchId);
+    QJSValue values = pJsEngine->newArray(batch.size());
+    for (int i = 0; i < batch.size(); ++i) {
+        ControlObjectScript* coScript = batch.at(i);
+        values.setProperty(i, coScript != nullptr ? coScript->get() : 0.0);
+    }
+    return values;
+}
+
+void ControllerScriptInterfaceLegacy::setValueBatch(
+        int batchId, const QJSValue& values) {
+    if (batchId < 0 || batchId >= m_controlBatches.size()) {
+        m_pScriptEngineLegacy->throwJSError(
+                QStringLiteral("setValueBatch called with unregistered batch id %1")
+                        .arg(batchId));
+        return;
+    }
+
+    const QVector<ControlObjectScript*>& batch = m_controlBatches.at(batchId);
+    const int length = qMin(batch.size(),
+            values.property(QStringLiteral("length")).toInt());
+    for (int i = 0; i < length; ++i) {
+        ControlObjectScript* coScript = batch.at(i);
+        if (coScript == nullptr) {
+            continue;
+        }
+        const QJSValue value = values.property(i);
+        if (!value.isNumber()) {
+            continue;
+        }
+        const double newValue = value.toNumber();
+        if (isnan(newValue)) {
+            qWarning() << "script setting [" << coScript->getKey().group << ","
+                       << coScript->getKey().item
+                       << "] to NotANumber, ignoring.";
+            continue;
+        }
+        ControlObject* pControl = ControlObject::getControl(
+                coScript->getKey(), ControllerDebug::controlFlags());
+        if (pControl &&
+                !m_st.ignore(
+                        pControl, coScript->getParameterForValue(newValue))) {
+            coScript->slotSet(newValue);
+        }
+    }
+}
+
 QJSValue ControllerScriptInterfaceLegacy::makeConnection(
         const QString& group, const QString& name, const QJSValue& callback) {
     auto pJsEngine = m_pScriptEngineLegacy->jsEngine();
@@ -2,6 +2,7 @@
 
 #include <QJSValue>
 #include <QObject>
+#include <QVector>
 
 #include "controllers/softtakeover.h"
 #include "util/alphabetafilter.h"
@@ -29,6 +30,20 @@ class ControllerScriptInterfaceLegacy : public QObject {
     Q_INVOKABLE void reset(const QString& group, const QString& name);
     Q_INVOKABLE double getDefaultValue(const QString& group, const QString& name);
     Q_INVOKABLE double getDefaultParameter(const QString& group, const QString& name);
+    /// Registers a list of controls for batched access. The argument is a JS
+    /// array of [group, name] pairs. Returns a batch id to pass to
+    /// getValueBatch()/setValueBatch(). Registering the control list once
+    /// resolves all controls up front, so periodic feedback loops reading
+    /// many controls pay a single C++/JS boundary crossing per tick instead
+    /// of one per control.
+    Q_INVOKABLE int registerControlBatch(const QJSValue& controls);
+    /// Returns the current values of a registered control batch as a JS
+    /// array in registration order. Unknown controls read as 0.0.
+    Q_INVOKABLE QJSValue getValueBatch(int batchId);
+    /// Sets the controls of a registered batch from a JS array of numbers in
+    /// registration order. Entries that are not numbers leave the
+    /// corresponding control untouched.
+    Q_INVOKABLE void setValueBatch(int batchId, const QJSValue& values);
     Q_INVOKABLE QJSValue makeConnection(
             const QString& group, const QString& name, const QJSValue& callback);
     // DEPRECATED: Use makeConnection instead.
@@ -67,6 +82,12 @@ class ControllerScriptInterfaceLegacy : public QObject {
     QHash<ConfigKey, ControlObjectScript*> m_controlCache;
     ControlObjectScript* getControlObjectScript(const QString& group, const QString& name);
 
+    // The ControlObjectScript pointers stay valid for the lifetime of this
+    // object, because m_controlCache owns them and is only emptied in the
+    // destructor. Unknown controls are kept as nullptr entries to preserve
+    // the registration order.
+    QList<QVector<ControlObjectScript*>> m_controlBatches;
+
     SoftTakeoverCtrl m_st;
 
     struct TimerInfo {
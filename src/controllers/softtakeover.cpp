@@ -58,6 +58,22 @@ bool SoftTakeoverCtrl::ignore(ControlObject* control, double newParameter) {
     return ignore;
 }
 
+bool SoftTakeoverCtrl::enableAndIgnore(ControlObject* control, double newParameter) {
+    if (control == nullptr) {
+        return false;
+    }
+    auto it = m_softTakeoverHash.find(control);
+    if (it == m_softTakeoverHash.end()) {
+        ControlPotmeter* cpo = qobject_cast<ControlPotmeter*>(control);
+        if (cpo == nullptr) {
+            // softtakecover works only for continuous ControlPotmeter based COs
+            return false;
+        }
+        it = m_softTakeoverHash.insert(control, new SoftTakeover());
+    }
+    return it.value()->ignore(control, newParameter);
+}
+
 void SoftTakeoverCtrl::ignoreNext(ControlObject* control) {
     if (control == nullptr) {
         return;
@@ -48,6 +48,10 @@ class SoftTakeoverCtrl {
     void disable(ControlObject* control);
     // Check to see if the new value for the Control should be ignored
     bool ignore(ControlObject* control, double newMidiParameter);
+    // Same as calling enable() followed by ignore(), but with a single
+    // hash lookup. Meant for the per-message controller input path, where
+    // the separate calls show up in profiles.
+    bool enableAndIgnore(ControlObject* control, double newMidiParameter);
     // Ignore the next supplied parameter
     void ignoreNext(ControlObject* control);
 
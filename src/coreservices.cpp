@@ -7,6 +7,8 @@
 #ifdef __BROADCAST__
 #include "broadcast/broadcastmanager.h"
 #endif
+#include "control/controloscreceiver.h"
+#include "control/controlrecorder.h"
 #include "controllers/controllermanager.h"
 #include "controllers/keyboard/keyboardeventfilter.h"
 #include "database/mixxxdb.h"
@@ -16,6 +18,8 @@
 #include "effects/lv2/lv2backend.h"
 #endif
 #include "engine/enginemaster.h"
+#include "engine/sync/enginesync.h"
+#include "engine/sync/midiclockticker.h"
 #include "library/coverartcache.h"
 #include "library/library.h"
 #include "library/trackcollection.h"
@@ -27,8 +31,10 @@
 #include "soundio/soundmanager.h"
 #include "sources/soundsourceproxy.h"
 #include "util/db/dbconnectionpooled.h"
+#include "util/db/dbwalcheckpointer.h"
 #include "util/font.h"
 #include "util/logger.h"
+#include "util/performancetimer.h"
 #include "util/screensaver.h"
 #include "util/statsmanager.h"
 #include "util/time.h"
@@ -106,6 +112,8 @@ CoreServices::CoreServices(const CmdlineArgs& args)
           m_cmdlineArgs(args) {
 }
 
+CoreServices::~CoreServices() = default;
+
 void CoreServices::initializeSettings() {
     QString settingsPath = m_cmdlineArgs.getSettingsPath();
 #ifdef __APPLE__
@@ -144,6 +152,12 @@ void CoreServices::initialize(QApplication* pApp) {
         StatsManager::createInstance();
     }
 
+    if (!m_cmdlineArgs.getControlRecordPath().isEmpty()) {
+        // Start before any ControlObject is created so the log captures
+        // the whole session. The log is written in shutdown().
+        ControlRecorder::startRecording(m_cmdlineArgs.getControlRecordPath());
+    }
+
     initializeKeyboard();
 
     mixxx::Translations::initializeTranslations(
@@ -164,9 +178,20 @@ void CoreServices::initialize(QApplication* pApp) {
 
     QString resourcePath = pConfig->getResourcePath();
 
+    // Log the duration of each startup phase to diagnose slow cold
+    // starts in the field, where the developer-mode stats are not
+    // available.
+    PerformanceTimer phaseTimer;
+    phaseTimer.start();
+    const auto logPhaseTime = [&phaseTimer](const char* phase) {
+        kLogger.info() << "Startup phase" << phase << "took"
+                       << phaseTimer.restart().debugMillisWithUnit();
+    };
+
     emit initializationProgressUpdate(0, tr("fonts"));
 
     FontUtils::initializeFonts(resourcePath); // takes a long time
+    logPhaseTime("fonts");
 
     emit initializationProgressUpdate(10, tr("database"));
     m_pDbConnectionPool = MixxxDb(pConfig).connectionPool();
@@ -178,6 +203,11 @@ void CoreServices::initialize(QApplication* pApp) {
     if (!initializeDatabase()) {
         exit(-1);
     }
+    // Periodically transfers the write-ahead log back into the database
+    // file; runs on the main thread connection created above.
+    m_pDbWalCheckpointer =
+            std::make_unique<mixxx::DbWalCheckpointer>(m_pDbConnectionPool);
+    logPhaseTime("database");
 
     auto pChannelHandleFactory = std::make_shared<ChannelHandleFactory>();
 
@@ -204,6 +234,7 @@ void CoreServices::initialize(QApplication* pApp) {
 #endif
 
     m_pEffectsManager->setup();
+    logPhaseTime("effects and engine");
 
     emit initializationProgressUpdate(30, tr("audio interface"));
     // Although m_pSoundManager is created here, m_pSoundManager->setupDevices()
@@ -224,6 +255,7 @@ void CoreServices::initialize(QApplication* pApp) {
 #else
     m_pVCManager = nullptr;
 #endif
+    logPhaseTime("audio interface");
 
     emit initializationProgressUpdate(40, tr("decks"));
     // Create the player manager. (long)
@@ -255,6 +287,7 @@ void CoreServices::initialize(QApplication* pApp) {
 #ifdef __VINYLCONTROL__
     m_pVCManager->init();
 #endif
+    logPhaseTime("decks");
 
     emit initializationProgressUpdate(50, tr("library"));
     CoverArtCache::createInstance();
@@ -299,6 +332,8 @@ void CoreServices::initialize(QApplication* pApp) {
         }
     }
 
+    logPhaseTime("library");
+
     emit initializationProgressUpdate(60, tr("controllers"));
     // Initialize controller sub-system,
     // but do not set up controllers until the end of the application startup
@@ -306,8 +341,17 @@ void CoreServices::initialize(QApplication* pApp) {
     qDebug() << "Creating ControllerManager";
     m_pControllerManager = std::make_shared<ControllerManager>(pConfig);
 
+    // Deliver engine-generated MIDI beat clock ticks to the controller
+    // thread. The queued connection keeps the sends out of the audio
+    // callback.
+    connect(m_pEngine->getEngineSync()->getMidiClockTicker(),
+            &MidiClockTicker::midiClockTicks,
+            m_pControllerManager.get(),
+            &ControllerManager::slotSendMidiClockTicks);
+
     // Wait until all other ControlObjects are set up before initializing
-    // controllers
+    // controllers. Device enumeration itself runs asynchronously on the
+    // controller thread and does not block the remaining startup phases.
     m_pControllerManager->setUpDevices();
 
     // Scan the library for new files and directories
@@ -367,6 +411,25 @@ void CoreServices::initialize(QApplication* pApp) {
             m_pPlayerManager->slotLoadToDeck(musicFiles.at(i), i + 1);
         }
     }
+
+    if (!m_cmdlineArgs.getControlReplayPath().isEmpty()) {
+        // Start after all controls have been created. The replay time
+        // base starts here, matching where a recording session begins
+        // reacting to input.
+        m_pControlReplayer = std::make_unique<ControlReplayer>(
+                m_cmdlineArgs.getControlReplayPath());
+        m_pControlReplayer->start();
+    }
+
+    if (m_cmdlineArgs.getOscPort() > 0) {
+        // Started after all controls have been created so that remote
+        // addresses resolve immediately.
+        m_pOscReceiver = std::make_unique<ControlOscReceiver>(
+                m_cmdlineArgs.getOscPort());
+        m_pOscReceiver->start();
+    }
+
+    logPhaseTime("controllers");
 }
 
 void CoreServices::initializeKeyboard() {
@@ -454,6 +517,12 @@ void CoreServices::shutdown() {
     Timer t("CoreServices::shutdown");
     t.start();
 
+    // Stop the control replay and the OSC receiver before tearing down
+    // the objects they set controls on.
+    m_pControlReplayer.reset();
+    m_pOscReceiver.reset();
+    ControlRecorder::stopRecording();
+
     // Stop all pending library operations
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "stopping pending Library tasks";
     m_pTrackCollectionManager->stopLibraryScan();
@@ -521,6 +590,11 @@ void CoreServices::shutdown() {
     CLEAR_AND_CHECK_DELETED(m_pTrackCollectionManager);
 
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "closing database connection(s)";
+    // Reclaim the space freed by deleted tracks and their waveform
+    // analyses while no other component is using the database anymore.
+    // This only does actual work if the file has become fragmented.
+    m_pDbWalCheckpointer.reset();
+    MixxxDb::compactDatabase(mixxx::DbConnectionPooled(m_pDbConnectionPool));
     m_pDbConnectionPool->destroyThreadLocalConnection();
     m_pDbConnectionPool.reset(); // should drop the last reference
 
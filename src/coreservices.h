@@ -10,6 +10,8 @@
 
 class QApplication;
 class CmdlineArgs;
+class ControlOscReceiver;
+class ControlReplayer;
 class KeyboardEventFilter;
 class EffectsManager;
 class EngineMaster;
@@ -28,13 +30,16 @@ class LV2Backend;
 namespace mixxx {
 
 class DbConnectionPool;
+class DbWalCheckpointer;
 
 class CoreServices : public QObject {
     Q_OBJECT
 
   public:
     CoreServices(const CmdlineArgs& args);
-    ~CoreServices() = default;
+    // Defined in the translation unit to destroy members of types that are
+    // only forward-declared here.
+    ~CoreServices();
 
     void initializeSettings();
     // FIXME: should be private, but WMainMenuBar needs it initialized early
@@ -125,6 +130,7 @@ class CoreServices : public QObject {
     std::shared_ptr<VinylControlManager> m_pVCManager;
 
     std::shared_ptr<DbConnectionPool> m_pDbConnectionPool;
+    std::unique_ptr<DbWalCheckpointer> m_pDbWalCheckpointer;
     std::shared_ptr<TrackCollectionManager> m_pTrackCollectionManager;
     std::shared_ptr<Library> m_pLibrary;
 
@@ -134,6 +140,9 @@ class CoreServices : public QObject {
 
     std::unique_ptr<ControlPushButton> m_pTouchShift;
 
+    std::unique_ptr<ControlReplayer> m_pControlReplayer;
+    std::unique_ptr<ControlOscReceiver> m_pOscReceiver;
+
     Timer m_runtime_timer;
     const CmdlineArgs& m_cmdlineArgs;
 };
@@ -1,11 +1,14 @@
 #include "database/mixxxdb.h"
 
 #include <QDir>
+#include <QSqlQuery>
 
 #include "database/schemamanager.h"
+#include "library/queryutil.h"
 #include "moc_mixxxdb.cpp"
 #include "util/assert.h"
 #include "util/logger.h"
+#include "util/performancetimer.h"
 
 // The schema XML is baked into the binary via Qt resources.
 //static
@@ -61,6 +64,26 @@ mixxx::DbConnection::Params dbConnectionParams(
     return params;
 }
 
+// Compaction thresholds: VACUUM rewrites the whole file and may take
+// a while on large databases, so it only runs when both a substantial
+// fraction and a substantial amount of the file are free pages.
+constexpr double kCompactMinFreePageRatio = 0.1;
+constexpr qint64 kCompactMinFreeBytes = 16 * 1024 * 1024;
+
+qint64 readPragmaValue(
+        const QSqlDatabase& database,
+        const QString& pragma,
+        bool* pOk) {
+    DEBUG_ASSERT(pOk);
+    *pOk = false;
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral("PRAGMA ") + pragma) || !query.next()) {
+        LOG_FAILED_QUERY(query);
+        return 0;
+    }
+    return query.value(0).toLongLong(pOk);
+}
+
 } // anonymous namespace
 
 MixxxDb::MixxxDb(
@@ -117,3 +140,49 @@ bool MixxxDb::initDatabaseSchema(
     DEBUG_ASSERT(!"unhandled switch/case");
     return false;
 }
+
+//static
+void MixxxDb::compactDatabase(
+        const QSqlDatabase& database) {
+    VERIFY_OR_DEBUG_ASSERT(database.isOpen()) {
+        return;
+    }
+
+    bool pageCountOk;
+    const qint64 pageCount = readPragmaValue(database, QStringLiteral("page_count"), &pageCountOk);
+    bool freelistCountOk;
+    const qint64 freelistCount =
+            readPragmaValue(database, QStringLiteral("freelist_count"), &freelistCountOk);
+    bool pageSizeOk;
+    const qint64 pageSize = readPragmaValue(database, QStringLiteral("page_size"), &pageSizeOk);
+    if (!pageCountOk || !freelistCountOk || !pageSizeOk || pageCount <= 0) {
+        return;
+    }
+
+    const qint64 freeBytes = freelistCount * pageSize;
+    const double freePageRatio =
+            static_cast<double>(freelistCount) / static_cast<double>(pageCount);
+    if (freePageRatio < kCompactMinFreePageRatio ||
+            freeBytes < kCompactMinFreeBytes) {
+        kLogger.debug()
+                << "Database file is not fragmented enough for compaction:"
+                << freeBytes
+                << "reclaimable bytes";
+        return;
+    }
+
+    kLogger.info()
+            << "Compacting database file to reclaim"
+            << freeBytes
+            << "bytes";
+    PerformanceTimer timer;
+    timer.start();
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral("VACUUM"))) {
+        LOG_FAILED_QUERY(query);
+        return;
+    }
+    kLogger.info()
+            << "Compacting the database file took"
+            << timer.elapsed().debugMillisWithUnit();
+}
@@ -20,6 +20,14 @@ class MixxxDb : public QObject {
             int schemaVersion = kRequiredSchemaVersion,
             const QString& schemaFile = kDefaultSchemaFile);
 
+    // Reclaims free pages if a substantial part of the database file
+    // consists of them, e.g. after deleting tracks with their waveform
+    // analyses. Fragmented files slow down all queries. VACUUM rewrites
+    // the whole file, so this should only be invoked on shutdown when
+    // no other component is using the database.
+    static void compactDatabase(
+            const QSqlDatabase& database);
+
     explicit MixxxDb(
             const UserSettingsPointer& pConfig,
             bool inMemoryConnection = false);
@@ -19,7 +19,13 @@ class ReverbGroupState : public EffectState {
   public:
     ReverbGroupState(const mixxx::EngineParameters& bufferParameters)
         : EffectState(bufferParameters),
+          sampleRate(bufferParameters.sampleRate()),
           sendPrevious(0) {
+        // Allocate all delay lines up front, outside of the audio thread.
+        // Re-enabling the effect re-initializes the reverb from
+        // processChannel(), which then only zeroes the existing buffers,
+        // see DSP::Delay::init().
+        reverb.init(sampleRate);
     }
 
     void engineParametersChanged(const mixxx::EngineParameters& bufferParameters) {
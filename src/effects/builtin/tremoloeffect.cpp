@@ -35,6 +35,7 @@ EffectManifestPointer TremoloEffect::getManifest() {
     depth->setDefault(1);
     depth->setMinimum(0);
     depth->setMaximum(1);
+    depth->setSmoothingRampSeconds(0.05);
 
     EffectManifestParameterPointer rate = pManifest->addParameter();
     rate->setId("rate");
@@ -65,6 +66,7 @@ EffectManifestPointer TremoloEffect::getManifest() {
     width->setMinimum(0.1);
     width->setDefault(0.5);
     width->setMaximum(0.9);
+    width->setSmoothingRampSeconds(0.05);
 
     EffectManifestParameterPointer waveform = pManifest->addParameter();
     waveform->setId("waveform");
@@ -3,6 +3,7 @@
 #include "effects/effectchainmanager.h"
 #include "effects/effectprocessor.h"
 #include "effects/effectsmanager.h"
+#include "effects/effectstatearena.h"
 #include "effects/effectxmlelements.h"
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffectrack.h"
@@ -187,6 +188,9 @@ void EffectChain::enableForInputChannel(const ChannelHandleAndGroup& handleGroup
           mixxx::audio::SampleRate(96000),
           MAX_BUFFER_LEN / mixxx::kEngineChannelCount);
 
+    // The states of all of the chain's effects for this channel are processed
+    // together in every callback, so co-allocate them contiguously.
+    EffectStateArena::ScopedBatch coallocateStates;
     for (int i = 0; i < m_effects.size(); ++i) {
         auto& statesMap = (*pEffectStatesMapArray)[i];
         if (m_effects[i] != nullptr) {
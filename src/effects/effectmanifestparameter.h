@@ -88,6 +88,7 @@ class EffectManifestParameter {
               m_default(0),
               m_minimum(0),
               m_maximum(1.0),
+              m_smoothingRampSeconds(0.0),
               m_showInParametertSlot(true) {
     }
 
@@ -219,6 +220,17 @@ class EffectManifestParameter {
         m_maximum = maximum;
     }
 
+    // Time constant for smoothing value changes of this parameter in the
+    // engine, see EngineEffectParameter::smooth(). The default of 0 means
+    // that values take effect immediately, which is appropriate for
+    // steppings, toggles and parameters that the effect ramps itself.
+    virtual const double& smoothingRampSeconds() const {
+        return m_smoothingRampSeconds;
+    }
+    virtual void setSmoothingRampSeconds(const double& seconds) {
+        m_smoothingRampSeconds = seconds;
+    }
+
     virtual void appendStep(const QPair<QString, double>& step) {
         m_steps.append(step);
     }
@@ -246,6 +258,7 @@ class EffectManifestParameter {
     double m_default;
     double m_minimum;
     double m_maximum;
+    double m_smoothingRampSeconds;
 
     // Used to describe steps of
     // CONTROL_KNOB_STEPPING and CONTROL_TOGGLE_STEPPING
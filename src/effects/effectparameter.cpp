@@ -15,6 +15,8 @@ EffectParameter::EffectParameter(Effect* pEffect, EffectsManager* pEffectsManage
           m_pEffectsManager(pEffectsManager),
           m_iParameterNumber(iParameterNumber),
           m_pParameter(pParameter),
+          m_modulationBeatPeriod(0.0),
+          m_modulationDepth(0.0),
           m_bAddedToEngine(false) {
     // qDebug() << debugString() << "Constructing new EffectParameter from EffectManifestParameter:"
     //          << m_parameter.id();
@@ -211,6 +213,33 @@ EffectManifestParameter::ControlHint EffectParameter::getControlHint() const {
     return m_pParameter->controlHint();
 }
 
+void EffectParameter::setModulation(double beatPeriod, double depth) {
+    if (beatPeriod < 0.0) {
+        beatPeriod = 0.0;
+    }
+    clampValue(&depth, 0.0, 1.0);
+    if (m_modulationBeatPeriod == beatPeriod && m_modulationDepth == depth) {
+        return;
+    }
+    m_modulationBeatPeriod = beatPeriod;
+    m_modulationDepth = depth;
+    sendModulationUpdate();
+}
+
+void EffectParameter::sendModulationUpdate() {
+    EngineEffect* pEngineEffect = m_pEffect->getEngineEffect();
+    if (!pEngineEffect) {
+        return;
+    }
+    EffectsRequest* pRequest = new EffectsRequest();
+    pRequest->type = EffectsRequest::SET_PARAMETER_MODULATION;
+    pRequest->pTargetEffect = pEngineEffect;
+    pRequest->SetParameterModulation.iParameter = m_iParameterNumber;
+    pRequest->SetParameterModulation.beatPeriod = m_modulationBeatPeriod;
+    pRequest->SetParameterModulation.depth = m_modulationDepth;
+    m_pEffectsManager->writeRequest(pRequest);
+}
+
 void EffectParameter::updateEngineState() {
     EngineEffect* pEngineEffect = m_pEffect->getEngineEffect();
     if (!pEngineEffect) {
@@ -225,4 +254,10 @@ void EffectParameter::updateEngineState() {
     pRequest->maximum = m_maximum;
     pRequest->default_value = m_default;
     m_pEffectsManager->writeRequest(pRequest);
+    // The EngineEffect may have just been (re)created, so restate the
+    // modulation settings along with the parameter values. A disabled
+    // modulation matches the engine default and needs no message.
+    if (m_modulationBeatPeriod > 0.0 && m_modulationDepth > 0.0) {
+        sendModulationUpdate();
+    }
 }
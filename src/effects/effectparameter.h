@@ -57,6 +57,12 @@ class EffectParameter : public QObject {
 
     EffectManifestParameter::ControlHint getControlHint() const;
 
+    // Configures the engine-side beat-synchronous LFO that modulates this
+    // parameter around its knob value. beatPeriod is the LFO period in
+    // beats of the sync master, depth the peak deviation as a fraction of
+    // the parameter range; a period or depth of 0 disables the modulation.
+    void setModulation(double beatPeriod, double depth);
+
     void updateEngineState();
 
   signals:
@@ -73,6 +79,8 @@ class EffectParameter : public QObject {
     bool clampDefault();
     bool clampRanges();
 
+    void sendModulationUpdate();
+
     Effect* m_pEffect;
     EffectsManager* m_pEffectsManager;
     int m_iParameterNumber;
@@ -81,6 +89,8 @@ class EffectParameter : public QObject {
     double m_maximum;
     double m_default;
     double m_value;
+    double m_modulationBeatPeriod;
+    double m_modulationDepth;
     bool m_bAddedToEngine;
 
     DISALLOW_COPY_AND_ASSIGN(EffectParameter);
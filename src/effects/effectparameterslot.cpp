@@ -4,6 +4,7 @@
 
 #include "control/controleffectknob.h"
 #include "control/controlobject.h"
+#include "control/controlpotmeter.h"
 #include "control/controlpushbutton.h"
 #include "controllers/softtakeover.h"
 #include "effects/effectxmlelements.h"
@@ -45,6 +46,22 @@ EffectParameterSlot::EffectParameterSlot(const QString& group, const unsigned in
             this,
             &EffectParameterSlot::slotLinkInverseChanged);
 
+    m_pControlModulationPeriod = new ControlPotmeter(
+            ConfigKey(m_group, itemPrefix + QString("_modulation_period")),
+            0.0, 32.0);
+    connect(m_pControlModulationPeriod,
+            &ControlPotmeter::valueChanged,
+            this,
+            &EffectParameterSlot::slotModulationChanged);
+
+    m_pControlModulationDepth = new ControlPotmeter(
+            ConfigKey(m_group, itemPrefix + QString("_modulation_depth")),
+            0.0, 1.0);
+    connect(m_pControlModulationDepth,
+            &ControlPotmeter::valueChanged,
+            this,
+            &EffectParameterSlot::slotModulationChanged);
+
     m_pSoftTakeover = new SoftTakeover();
 
     clear();
@@ -56,6 +73,8 @@ EffectParameterSlot::~EffectParameterSlot() {
     // m_pControlLoaded and m_pControlType are deleted by ~EffectParameterSlotBase
     delete m_pControlLinkType;
     delete m_pControlLinkInverse;
+    delete m_pControlModulationPeriod;
+    delete m_pControlModulationDepth;
     delete m_pSoftTakeover;
 }
 
@@ -103,6 +122,10 @@ void EffectParameterSlot::loadEffect(EffectPointer pEffect) {
                     &EffectParameter::valueChanged,
                     this,
                     &EffectParameterSlot::slotParameterValueChanged);
+
+            // Apply the modulation settings of this slot to the freshly
+            // loaded parameter.
+            slotModulationChanged(0);
         }
     }
     emit updated();
@@ -123,6 +146,8 @@ void EffectParameterSlot::clear() {
         static_cast<double>(EffectManifestParameter::LinkType::NONE));
     m_pSoftTakeover->setThreshold(SoftTakeover::kDefaultTakeoverThreshold);
     m_pControlLinkInverse->set(0.0);
+    m_pControlModulationPeriod->set(0.0);
+    m_pControlModulationDepth->set(0.0);
     emit updated();
 }
 
@@ -163,6 +188,15 @@ void EffectParameterSlot::slotLinkInverseChanged(double v) {
     m_pSoftTakeover->ignoreNext();
 }
 
+void EffectParameterSlot::slotModulationChanged(double v) {
+    Q_UNUSED(v);
+    if (m_pEffectParameter != nullptr) {
+        m_pEffectParameter->setModulation(
+                m_pControlModulationPeriod->get(),
+                m_pControlModulationDepth->get());
+    }
+}
+
 void EffectParameterSlot::onEffectMetaParameterChanged(double parameter, bool force) {
     m_dChainParameter = parameter;
     if (m_pEffectParameter != nullptr) {
@@ -10,6 +10,7 @@
 #include "util/class.h"
 
 class ControlObject;
+class ControlPotmeter;
 class ControlPushButton;
 class ControlEffectKnob;
 class SoftTakeover;
@@ -48,6 +49,7 @@ class EffectParameterSlot : public EffectParameterSlotBase {
     void slotValueChanged(double v);
     void slotLinkTypeChanging(double v);
     void slotLinkInverseChanged(double v);
+    void slotModulationChanged(double v);
 
   private:
     QString debugString() const {
@@ -60,6 +62,11 @@ class EffectParameterSlot : public EffectParameterSlotBase {
     ControlEffectKnob* m_pControlValue;
     ControlPushButton* m_pControlLinkType;
     ControlPushButton* m_pControlLinkInverse;
+    // Beat-synchronous LFO applied to the parameter by the engine, see
+    // EffectParameter::setModulation. The period is in beats of the sync
+    // master, 0 (the default) disables the modulation.
+    ControlPotmeter* m_pControlModulationPeriod;
+    ControlPotmeter* m_pControlModulationDepth;
 
     DISALLOW_COPY_AND_ASSIGN(EffectParameterSlot);
 };
@@ -8,6 +8,7 @@
 #include "util/types.h"
 #include "engine/engine.h"
 #include "effects/defs.h"
+#include "effects/effectstatearena.h"
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/effects/message.h"
 #include "engine/channelhandle.h"
@@ -43,6 +44,17 @@ class EffectState {
         Q_UNUSED(bufferParameters);
     };
     virtual ~EffectState() {};
+
+    // States that are allocated together (all of a chain's effects for one
+    // input channel) are also accessed together in every audio callback, so
+    // they are co-allocated from contiguous arena blocks. See
+    // EffectStateArena.
+    static void* operator new(std::size_t size) {
+        return EffectStateArena::allocate(size);
+    }
+    static void operator delete(void* ptr) {
+        EffectStateArena::deallocate(ptr);
+    }
 };
 
 // EffectProcessor is an abstract base class for interfacing with the main
@@ -164,6 +176,7 @@ class EffectProcessorImpl : public EffectProcessor {
                 qDebug() << this << "EffectProcessorImpl::initialize allocating "
                             "EffectStates for input" << inputChannel;
             }
+            EffectStateArena::ScopedBatch coallocateStates;
             ChannelHandleMap<EffectSpecificState*> outputChannelMap;
             for (const ChannelHandleAndGroup& outputChannel :
                     pEffectsManager->registeredOutputChannels()) {
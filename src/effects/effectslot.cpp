@@ -6,6 +6,7 @@
 #include "control/controlproxy.h"
 #include "control/controlpushbutton.h"
 #include "effects/effectxmlelements.h"
+#include "engine/effects/engineeffect.h"
 #include "moc_effectslot.cpp"
 #include "util/math.h"
 #include "util/xml.h"
@@ -13,12 +14,18 @@
 // The maximum number of effect parameters we're going to support.
 const unsigned int kDefaultMaxParameters = 16;
 
+// Update the process_time_avg_us control once per second (20 * 50 ms).
+const int kProcessTimeUpdateTicks = 20;
+
 EffectSlot::EffectSlot(const QString& group,
                        const unsigned int iChainNumber,
                        const unsigned int iEffectnumber)
         : m_iChainNumber(iChainNumber),
           m_iEffectNumber(iEffectnumber),
-          m_group(group) {
+          m_group(group),
+          m_guiTickCounter(0),
+          m_lastProcessingTimeNanos(0),
+          m_lastProcessedBuffers(0) {
     m_pControlLoaded = new ControlObject(ConfigKey(m_group, "loaded"));
     m_pControlLoaded->setReadOnly();
 
@@ -74,6 +81,11 @@ EffectSlot::EffectSlot(const QString& group,
     m_pControlMetaParameter->set(0.0);
     m_pControlMetaParameter->setDefaultValue(0.0);
 
+    m_pControlProcessTimeUs = new ControlObject(ConfigKey(m_group, "process_time_avg_us"));
+    m_pControlProcessTimeUs->setReadOnly();
+    m_pCOTGuiTick50ms = new ControlProxy("[Master]", "guiTick50ms", this);
+    m_pCOTGuiTick50ms->connectValueChanged(this, &EffectSlot::slotGuiTick50ms);
+
     m_pSoftTakeover = new SoftTakeover();
 
     clear();
@@ -94,6 +106,7 @@ EffectSlot::~EffectSlot() {
     delete m_pControlClear;
     delete m_pControlEnabled;
     delete m_pControlMetaParameter;
+    delete m_pControlProcessTimeUs;
     delete m_pSoftTakeover;
 }
 
@@ -222,6 +235,9 @@ void EffectSlot::clear() {
         pParameter->clear();
     }
     m_pEffect.clear();
+    m_pControlProcessTimeUs->forceSet(0.0);
+    m_lastProcessingTimeNanos = 0;
+    m_lastProcessedBuffers = 0;
     emit updated();
 }
 
@@ -287,6 +303,35 @@ void EffectSlot::slotEffectMetaParameter(double v, bool force) {
     }
 }
 
+void EffectSlot::slotGuiTick50ms(double v) {
+    Q_UNUSED(v);
+    if (++m_guiTickCounter < kProcessTimeUpdateTicks) {
+        return;
+    }
+    m_guiTickCounter = 0;
+
+    EngineEffect* pEngineEffect = m_pEffect ? m_pEffect->getEngineEffect() : nullptr;
+    if (pEngineEffect == nullptr) {
+        m_pControlProcessTimeUs->forceSet(0.0);
+        m_lastProcessingTimeNanos = 0;
+        m_lastProcessedBuffers = 0;
+        return;
+    }
+
+    const qint64 processingTimeNanos = pEngineEffect->processingTimeNanos();
+    const qint64 processedBuffers = pEngineEffect->processedBuffers();
+    const qint64 bufferDelta = processedBuffers - m_lastProcessedBuffers;
+    double averageUs = 0.0;
+    if (bufferDelta > 0) {
+        averageUs = static_cast<double>(
+                processingTimeNanos - m_lastProcessingTimeNanos) /
+                bufferDelta / 1000.0;
+    }
+    m_pControlProcessTimeUs->forceSet(averageUs);
+    m_lastProcessingTimeNanos = processingTimeNanos;
+    m_lastProcessedBuffers = processedBuffers;
+}
+
 QDomElement EffectSlot::toXml(QDomDocument* doc) const {
     QDomElement effectElement = doc->createElement(EffectXml::Effect);
     if (!m_pEffect) {
@@ -81,6 +81,7 @@ class EffectSlot : public QObject {
     void slotEffectSelector(double v);
     void slotEffectEnabledChanged(bool enabled);
     void slotEffectMetaParameter(double v, bool force);
+    void slotGuiTick50ms(double v);
 
   signals:
     // Indicates that the effect pEffect has been loaded into this
@@ -127,6 +128,14 @@ class EffectSlot : public QObject {
     ControlEncoder* m_pControlEffectSelector;
     ControlObject* m_pControlClear;
     ControlPotmeter* m_pControlMetaParameter;
+    // Average CPU time in microseconds the loaded effect spent per processed
+    // buffer during the last update interval, for the cost display in the
+    // effects rack.
+    ControlObject* m_pControlProcessTimeUs;
+    ControlProxy* m_pCOTGuiTick50ms;
+    int m_guiTickCounter;
+    qint64 m_lastProcessingTimeNanos;
+    qint64 m_lastProcessedBuffers;
     QList<EffectParameterSlotPointer> m_parameters;
     QList<EffectButtonParameterSlotPointer> m_buttonParameters;
 
@@ -28,6 +28,8 @@ EffectsManager::EffectsManager(QObject* pParent,
           m_pChannelHandleFactory(pChannelHandleFactory),
           m_pEffectChainManager(new EffectChainManager(pConfig, this)),
           m_nextRequestId(0),
+          m_requestBatchDepth(0),
+          m_requestPipeHighWaterMark(0),
           m_pLoEqFreq(nullptr),
           m_pHiEqFreq(nullptr),
           m_underDestruction(false) {
@@ -41,6 +43,10 @@ EffectsManager::EffectsManager(QObject* pParent,
 
     m_pNumEffectsAvailable = new ControlObject(ConfigKey("[Master]", "num_effectsavailable"));
     m_pNumEffectsAvailable->setReadOnly();
+
+    m_pRequestPipeHighWaterMark = new ControlObject(
+            ConfigKey("[Master]", "effects_request_pipe_highwater"));
+    m_pRequestPipeHighWaterMark->setReadOnly();
 }
 
 EffectsManager::~EffectsManager() {
@@ -63,6 +69,7 @@ EffectsManager::~EffectsManager() {
     delete m_pHiEqFreq;
     delete m_pLoEqFreq;
     delete m_pNumEffectsAvailable;
+    delete m_pRequestPipeHighWaterMark;
     // Safe because the Engine is deleted before EffectsManager. Also, it holds
     // a bare pointer to m_pRequestPipe so it is critical that it does not
     // outlast us.
@@ -407,12 +414,18 @@ void EffectsManager::setup() {
 }
 
 void EffectsManager::loadEffectChains() {
+    // Restoring the state from effects.xml sends a request per chain, effect
+    // and parameter, so submit them as one batch.
+    beginRequestBatch();
     // populate rack and restore state from effects.xml
     m_pEffectChainManager->loadEffectChains();
+    endRequestBatch();
 }
 
 void EffectsManager::refeshAllRacks() {
+    beginRequestBatch();
     m_pEffectChainManager->refeshAllRacks();
+    endRequestBatch();
 }
 
 bool EffectsManager::writeRequest(EffectsRequest* request) {
@@ -428,19 +441,44 @@ bool EffectsManager::writeRequest(EffectsRequest* request) {
     }
 
     // This is effectively only garbage collection at this point so only deal
-    // with responses when writing new requests.
-    processEffectsResponses();
+    // with responses when writing new requests. Within a batch this is
+    // deferred to the outermost endRequestBatch().
+    if (m_requestBatchDepth == 0) {
+        processEffectsResponses();
+    }
 
     request->request_id = m_nextRequestId++;
     // TODO(XXX) use preallocated requests to avoid delete calls from engine
     if (m_pRequestPipe->writeMessage(request)) {
         m_activeRequests[request->request_id] = request;
+        const int queued = m_pRequestPipe->sendMessageCount();
+        if (queued > m_requestPipeHighWaterMark) {
+            m_requestPipeHighWaterMark = queued;
+            m_pRequestPipeHighWaterMark->forceSet(queued);
+        }
         return true;
     }
+    qWarning() << debugString()
+               << "WARNING: request pipe full, dropped EffectsRequest of type"
+               << static_cast<int>(request->type)
+               << "- high-water mark" << m_requestPipeHighWaterMark;
     delete request;
     return false;
 }
 
+void EffectsManager::beginRequestBatch() {
+    ++m_requestBatchDepth;
+}
+
+void EffectsManager::endRequestBatch() {
+    VERIFY_OR_DEBUG_ASSERT(m_requestBatchDepth > 0) {
+        return;
+    }
+    if (--m_requestBatchDepth == 0) {
+        processEffectsResponses();
+    }
+}
+
 void EffectsManager::processEffectsResponses() {
     if (m_pRequestPipe.isNull()) {
         return;
@@ -106,6 +106,14 @@ class EffectsManager : public QObject {
     // ownership of request and deletes it once a response is received.
     bool writeRequest(EffectsRequest* request);
 
+    // Groups a series of writeRequest() calls into a batch, e.g. when loading
+    // an effect chain preset that sets dozens of parameters at once. Response
+    // garbage collection is deferred to the outermost endRequestBatch()
+    // instead of running once per request. Batches may be nested. Not thread
+    // safe -- use only from the GUI thread.
+    void beginRequestBatch();
+    void endRequestBatch();
+
   signals:
     // TODO() Not connected. Can be used when we implement effect PlugIn loading at runtime
     void availableEffectsUpdated(EffectManifestPointer);
@@ -134,8 +142,13 @@ class EffectsManager : public QObject {
     QScopedPointer<EffectsRequestPipe> m_pRequestPipe;
     qint64 m_nextRequestId;
     QHash<qint64, EffectsRequest*> m_activeRequests;
+    int m_requestBatchDepth;
+    int m_requestPipeHighWaterMark;
 
     ControlObject* m_pNumEffectsAvailable;
+    // Deepest request pipe fill level seen so far, for diagnosing dropped
+    // requests when scripts flip many parameters at once.
+    ControlObject* m_pRequestPipeHighWaterMark;
     // We need to create Control Objects for Equalizers' frequencies
     ControlPotmeter* m_pLoEqFreq;
     ControlPotmeter* m_pHiEqFreq;
@@ -0,0 +1,131 @@
+#include "effects/effectstatearena.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "util/assert.h"
+
+namespace {
+
+// One block comfortably holds the states of a fully loaded chain for one
+// input channel; oversized states simply get a block of their own.
+constexpr std::size_t kBlockSize = 16 * 1024;
+
+constexpr std::size_t alignUp(std::size_t size) {
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// An arena block is freed when the batch scope that filled it has closed
+// and the last state allocated from it has been deleted. The count is
+// atomic because states are allocated on the main thread but the audio
+// engine hands them back for deletion asynchronously.
+struct Block {
+    std::atomic<int> refCount;
+    std::size_t used;
+};
+
+// Prepended to every allocation handed out through EffectState::operator
+// new. A null block marks a plain heap allocation.
+struct AllocHeader {
+    Block* pBlock;
+};
+
+// Both rounded up so every allocation starts at max_align_t alignment
+// relative to the malloc'ed block start.
+constexpr std::size_t kHeaderSize = alignUp(sizeof(AllocHeader));
+constexpr std::size_t kBlockHeaderSize = alignUp(sizeof(Block));
+
+// The currently open batch block of this thread, holding one reference
+// while open so it outlives states deleted before the scope closes.
+thread_local Block* t_pCurrentBlock = nullptr;
+thread_local bool t_batchOpen = false;
+
+void releaseBlock(Block* pBlock) {
+    if (pBlock->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        pBlock->~Block();
+        std::free(pBlock);
+    }
+}
+
+Block* newBlock(std::size_t minPayload) {
+    std::size_t blockSize = kBlockSize;
+    if (kBlockHeaderSize + minPayload > blockSize) {
+        blockSize = kBlockHeaderSize + minPayload;
+    }
+    void* pMemory = std::malloc(blockSize);
+    if (pMemory == nullptr) {
+        throw std::bad_alloc();
+    }
+    Block* pBlock = new (pMemory) Block;
+    // One reference for the open batch scope
+    pBlock->refCount.store(1, std::memory_order_relaxed);
+    pBlock->used = kBlockHeaderSize;
+    return pBlock;
+}
+
+} // anonymous namespace
+
+// static
+void EffectStateArena::beginBatch() {
+    VERIFY_OR_DEBUG_ASSERT(!t_batchOpen) {
+        return;
+    }
+    t_batchOpen = true;
+}
+
+// static
+void EffectStateArena::endBatch() {
+    VERIFY_OR_DEBUG_ASSERT(t_batchOpen) {
+        return;
+    }
+    t_batchOpen = false;
+    if (t_pCurrentBlock != nullptr) {
+        releaseBlock(t_pCurrentBlock);
+        t_pCurrentBlock = nullptr;
+    }
+}
+
+// static
+void* EffectStateArena::allocate(std::size_t size) {
+    const std::size_t payload = kHeaderSize + alignUp(size);
+    if (!t_batchOpen) {
+        // Outside a batch scope: plain heap allocation with a null-block
+        // header so deallocate can tell the two kinds apart.
+        void* pMemory = std::malloc(payload);
+        if (pMemory == nullptr) {
+            throw std::bad_alloc();
+        }
+        static_cast<AllocHeader*>(pMemory)->pBlock = nullptr;
+        return static_cast<char*>(pMemory) + kHeaderSize;
+    }
+    if (t_pCurrentBlock == nullptr ||
+            t_pCurrentBlock->used + payload > kBlockSize) {
+        if (t_pCurrentBlock != nullptr) {
+            releaseBlock(t_pCurrentBlock);
+        }
+        t_pCurrentBlock = newBlock(payload);
+    }
+    Block* pBlock = t_pCurrentBlock;
+    char* pMemory = reinterpret_cast<char*>(pBlock) + pBlock->used;
+    pBlock->used += payload;
+    pBlock->refCount.fetch_add(1, std::memory_order_relaxed);
+    reinterpret_cast<AllocHeader*>(pMemory)->pBlock = pBlock;
+    return pMemory + kHeaderSize;
+}
+
+// static
+void EffectStateArena::deallocate(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    AllocHeader* pHeader = reinterpret_cast<AllocHeader*>(
+            static_cast<char*>(ptr) - kHeaderSize);
+    Block* pBlock = pHeader->pBlock;
+    if (pBlock == nullptr) {
+        std::free(pHeader);
+        return;
+    }
+    releaseBlock(pBlock);
+}
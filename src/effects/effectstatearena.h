@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+
+// Co-allocates batches of EffectState instances in contiguous arena blocks.
+//
+// When an input channel is enabled for an effect chain, the states for all
+// of the chain's effects are allocated together on the main thread (see
+// EffectChain::enableForInputChannel) and then accessed together in every
+// audio callback. Allocated individually they end up scattered across the
+// heap and EngineEffectChain::process pays a cache miss per pointer chase.
+//
+// EffectState overrides operator new/delete to route through this arena.
+// Inside a batch scope, allocations are bumped out of one shared block, so
+// a chain's states for a channel end up back to back in memory. Outside a
+// scope (e.g. the late-allocation fallback in EffectProcessorImpl::process)
+// allocations fall through to the global heap. Either way, every state
+// carries a hidden header so a plain `delete` works unchanged: arena blocks
+// are reference-counted and freed when their last state is deleted.
+//
+// Batch scopes are per-thread and must not be nested. All EffectState
+// allocation happens on the main thread, so in practice there is only ever
+// one scope at a time.
+class EffectStateArena {
+  public:
+    // RAII batch scope for co-allocating a group of EffectStates.
+    class ScopedBatch {
+      public:
+        ScopedBatch() {
+            beginBatch();
+        }
+        ~ScopedBatch() {
+            endBatch();
+        }
+        ScopedBatch(const ScopedBatch&) = delete;
+        ScopedBatch& operator=(const ScopedBatch&) = delete;
+    };
+
+    // Called by EffectState::operator new/delete. allocate never returns
+    // nullptr (it throws std::bad_alloc like operator new).
+    static void* allocate(std::size_t size);
+    static void deallocate(void* ptr);
+
+  private:
+    static void beginBatch();
+    static void endBatch();
+
+    EffectStateArena() = delete;
+};
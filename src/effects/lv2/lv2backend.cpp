@@ -1,17 +1,32 @@
 #include "effects/lv2/lv2backend.h"
 
+#include <QtConcurrentRun>
+
 #include "effects/lv2/lv2manifest.h"
 #include "moc_lv2backend.cpp"
 
 LV2Backend::LV2Backend(QObject* pParent)
-        : EffectsBackend(pParent, EffectBackendType::LV2) {
+        : EffectsBackend(pParent, EffectBackendType::LV2),
+          m_discoveryPublished(false) {
     m_pWorld = lilv_world_new();
     initializeProperties();
-    lilv_world_load_all(m_pWorld);
-    enumeratePlugins();
+    // Loading all plugin manifests takes multiple seconds on machines
+    // with large LV2 collections, so the discovery runs on a worker
+    // thread instead of blocking startup. The lilv world is used
+    // exclusively by the worker until the future has finished.
+    connect(&m_discoveryWatcher,
+            &QFutureWatcher<void>::finished,
+            this,
+            &LV2Backend::slotDiscoveryFinished);
+    m_discoveryFuture = QtConcurrent::run([this] {
+        lilv_world_load_all(m_pWorld);
+        enumeratePlugins();
+    });
+    m_discoveryWatcher.setFuture(m_discoveryFuture);
 }
 
 LV2Backend::~LV2Backend() {
+    ensureDiscoveryFinished();
     foreach(LilvNode* node, m_properties) {
         lilv_node_free(node);
     }
@@ -30,11 +45,32 @@ void LV2Backend::enumeratePlugins() {
         }
         LV2Manifest* lv2Manifest = new LV2Manifest(plug, m_properties);
         lv2Manifest->getEffectManifest()->setBackendType(m_type);
-        m_registeredEffects.insert(lv2Manifest->getEffectManifest()->id(),
+        m_discoveredEffects.insert(lv2Manifest->getEffectManifest()->id(),
                                    lv2Manifest);
     }
 }
 
+void LV2Backend::ensureDiscoveryFinished() const {
+    if (m_discoveryPublished) {
+        return;
+    }
+    m_discoveryFuture.waitForFinished();
+    m_registeredEffects = m_discoveredEffects;
+    m_discoveryPublished = true;
+}
+
+void LV2Backend::slotDiscoveryFinished() {
+    ensureDiscoveryFinished();
+    // Announce the discovered effects. The backend was added to the
+    // EffectsManager while its effect list was still empty, so every
+    // effect is new to it.
+    foreach(LV2Manifest* lv2Manifest, m_registeredEffects) {
+        if (lv2Manifest->isValid()) {
+            emit effectRegistered(lv2Manifest->getEffectManifest());
+        }
+    }
+}
+
 void LV2Backend::initializeProperties() {
     m_properties["audio_port"] = lilv_new_uri(m_pWorld, LV2_CORE__AudioPort);
     m_properties["input_port"] = lilv_new_uri(m_pWorld, LV2_CORE__InputPort);
@@ -56,6 +92,7 @@ const QList<QString> LV2Backend::getEffectIds() const {
 }
 
 const QSet<QString> LV2Backend::getDiscoveredPluginIds() const {
+    ensureDiscoveryFinished();
     QSet<QString> pluginIds;
     for (auto it = m_registeredEffects.constBegin();
          it != m_registeredEffects.constEnd(); ++it) {
@@ -65,6 +102,7 @@ const QSet<QString> LV2Backend::getDiscoveredPluginIds() const {
 }
 
 bool LV2Backend::canInstantiateEffect(const QString& effectId) const {
+    ensureDiscoveryFinished();
     if (m_registeredEffects.contains(effectId) &&
         m_registeredEffects[effectId]->isValid()) {
         return true;
@@ -81,6 +119,7 @@ EffectManifestPointer LV2Backend::getManifest(const QString& effectId) const {
 }
 
 LV2Manifest* LV2Backend::getLV2Manifest(const QString& effectId) const {
+    ensureDiscoveryFinished();
     return m_registeredEffects[effectId];
 }
 
@@ -2,6 +2,9 @@
 
 #include <lilv/lilv.h>
 
+#include <QFuture>
+#include <QFutureWatcher>
+
 #include "effects/defs.h"
 #include "effects/effectsbackend.h"
 #include "effects/lv2/lv2manifest.h"
@@ -13,8 +16,14 @@ class LV2Backend : public EffectsBackend {
     LV2Backend(QObject* pParent);
     virtual ~LV2Backend();
 
-    void enumeratePlugins();
+    // Returns the effects discovered so far without blocking. Directly
+    // after construction the background discovery is still running and
+    // the list is empty; the effects are announced incrementally via
+    // effectRegistered() once the discovery has finished.
     const QList<QString> getEffectIds() const;
+    // The remaining accessors wait for the background discovery to
+    // finish before answering, so saved effect chains referencing LV2
+    // plugins and the preferences page always see the complete set.
     const QSet<QString> getDiscoveredPluginIds() const;
     EffectManifestPointer getManifest(const QString& effectId) const;
     LV2Manifest* getLV2Manifest(const QString& effectId) const;
@@ -22,11 +31,30 @@ class LV2Backend : public EffectsBackend {
     EffectPointer instantiateEffect(EffectsManager* pEffectsManager,
                                     const QString& effectId);
 
+  private slots:
+    void slotDiscoveryFinished();
+
   private:
     void initializeProperties();
+    // Runs on a worker thread and fills m_discoveredEffects. The lilv
+    // world is used exclusively by the worker until the future has
+    // finished.
+    void enumeratePlugins();
+    // Waits for the background discovery and publishes its results
+    // into m_registeredEffects. Idempotent.
+    void ensureDiscoveryFinished() const;
+
     LilvWorld* m_pWorld;
     QHash<QString, LilvNode*> m_properties;
-    QHash<QString, LV2Manifest*> m_registeredEffects;
+
+    // Filled by the worker thread during discovery.
+    QHash<QString, LV2Manifest*> m_discoveredEffects;
+    // Published results, only touched on the main thread after the
+    // discovery has finished.
+    mutable QHash<QString, LV2Manifest*> m_registeredEffects;
+    mutable bool m_discoveryPublished;
+    QFuture<void> m_discoveryFuture;
+    QFutureWatcher<void> m_discoveryWatcher;
 
     QString debugString() const {
         return "LV2Backend";
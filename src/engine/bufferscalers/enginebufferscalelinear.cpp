@@ -236,11 +236,59 @@ SINT EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
     const double rate_delta_abs =
             rate_old < 0 || rate_new < 0 ? -rate_delta : rate_delta;
 
+    // The rate is constant for the whole buffer if it is not ramped
+    // between two different rates (see below).
+    const bool constant_rate = rate_delta_abs == 0.0;
+
     // Hot frame loop
     while (i < buf_size) {
         // shift indices
         m_dCurrentFrame = m_dNextFrame;
 
+        // Fast path for the common case: a constant rate in forward or
+        // backward direction without a pending direction change. As long
+        // as the interpolation windows of consecutive output frames are
+        // completely inside the read-ahead buffer, the per-frame bounds
+        // checks and buffer refills of the generic loop below are
+        // redundant. Interpolate those frames in a tight single-precision
+        // block loop that the compiler is able to unroll and vectorize;
+        // the generic loop below takes over for rate ramps and at buffer
+        // boundaries.
+        if (constant_rate && (rate_add > 0.0) && (m_dCurrentFrame >= 0.0)) {
+            // Highest frame index that still has a complete
+            // interpolation window in the buffer
+            const double maxFramePos =
+                    getOutputSignal().samples2frames(m_bufferIntSize) - 2;
+            const double headroomFrames = (maxFramePos + 1.0) - m_dCurrentFrame;
+            if (headroomFrames > rate_add) {
+                const SINT remainingFrames =
+                        getOutputSignal().samples2frames(buf_size - i);
+                const SINT blockFrames = math_min<SINT>(remainingFrames,
+                        static_cast<SINT>(headroomFrames / rate_add));
+                DEBUG_ASSERT(blockFrames > 0);
+                const double frameBase = m_dCurrentFrame;
+                for (SINT k = 0; k < blockFrames; ++k) {
+                    const double framePos = frameBase + k * rate_add;
+                    const SINT frameFloor = static_cast<SINT>(framePos);
+                    const CSAMPLE frac =
+                            static_cast<CSAMPLE>(framePos) - frameFloor;
+                    const CSAMPLE* pFloorSample =
+                            &m_bufferInt[getOutputSignal().frames2samples(frameFloor)];
+                    buf[i] = pFloorSample[0] + frac * (pFloorSample[2] - pFloorSample[0]);
+                    buf[i + 1] = pFloorSample[1] + frac * (pFloorSample[3] - pFloorSample[1]);
+                    i += getOutputSignal().getChannelCount();
+                }
+                m_dCurrentFrame = frameBase + (blockFrames - 1) * rate_add;
+                const SINT lastFrameFloor = static_cast<SINT>(m_dCurrentFrame);
+                m_floorSampleOld[0] =
+                        m_bufferInt[getOutputSignal().frames2samples(lastFrameFloor)];
+                m_floorSampleOld[1] =
+                        m_bufferInt[getOutputSignal().frames2samples(lastFrameFloor) + 1];
+                m_dNextFrame = m_dCurrentFrame + rate_add;
+                continue;
+            }
+        }
+
         // Because our index is a float value, we're going to be interpolating
         // between two samples, a lower (prev) and upper (cur) sample.
         // If the lower sample is off the end of the buffer (values between
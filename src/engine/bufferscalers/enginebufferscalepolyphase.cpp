@@ -0,0 +1,344 @@
+#include "engine/bufferscalers/enginebufferscalepolyphase.h"
+
+#include <cstring>
+
+#include <QtDebug>
+
+#include "util/assert.h"
+#include "util/math.h"
+#include "util/sample.h"
+
+namespace {
+
+// Filter geometry. The table stores one wing of a symmetric Kaiser-windowed
+// sinc, sampled at kPhasesPerFrame fractional positions per input frame;
+// the other wing follows by symmetry. For downsampling the impulse response
+// is stretched to keep the cutoff below the lower Nyquist frequency, which
+// widens the wing up to kMaxWingFrames (enough for rates up to 2.0; the
+// selection logic in EngineBuffer never sends faster rates here without
+// scratching, which uses the linear scaler anyway).
+constexpr SINT kWingFrames = 8;
+constexpr SINT kMaxWingFrames = 16;
+constexpr SINT kPhasesPerFrame = 256;
+// One extra entry as guard for the interpolation between phases.
+constexpr SINT kTableLength = kWingFrames * kPhasesPerFrame + 1;
+// Fraction of the Nyquist frequency; the transition band extends from here
+// up to Nyquist.
+constexpr double kCutoff = 0.92;
+// Kaiser beta of 9 gives roughly 90 dB of stopband attenuation.
+constexpr double kKaiserBeta = 9.0;
+
+// Zeroth-order modified Bessel function of the first kind, used to
+// evaluate the Kaiser window. The power series converges quickly for the
+// argument range we use.
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k <= 32; ++k) {
+        const double factor = x / (2.0 * k);
+        term *= factor * factor;
+        sum += term;
+        if (term < 1e-12 * sum) {
+            break;
+        }
+    }
+    return sum;
+}
+
+class SincTable {
+  public:
+    SincTable() {
+        const double i0Beta = besselI0(kKaiserBeta);
+        for (SINT i = 0; i < kTableLength; ++i) {
+            // Distance from the center tap in input frames.
+            const double x = static_cast<double>(i) / kPhasesPerFrame;
+            double sinc;
+            if (i == 0) {
+                sinc = kCutoff;
+            } else {
+                const double pix = M_PI * kCutoff * x;
+                sinc = kCutoff * sin(pix) / pix;
+            }
+            const double t = x / kWingFrames;
+            const double window = t < 1.0
+                    ? besselI0(kKaiserBeta * sqrt(1.0 - t * t)) / i0Beta
+                    : 0.0;
+            m_wing[i] = static_cast<CSAMPLE>(sinc * window);
+        }
+    }
+
+    // Filter coefficient at a distance of x input frames from the center
+    // tap, with the impulse response stretched by 1 / scale (scale < 1
+    // widens the filter for downsampling). Interpolates linearly between
+    // the tabulated phases.
+    inline CSAMPLE at(double x, double scale) const {
+        const double pos = x * scale * kPhasesPerFrame;
+        const SINT index = static_cast<SINT>(pos);
+        if (index >= kTableLength - 1) {
+            return 0.0f;
+        }
+        const CSAMPLE frac = static_cast<CSAMPLE>(pos - index);
+        return m_wing[index] + frac * (m_wing[index + 1] - m_wing[index]);
+    }
+
+  private:
+    CSAMPLE m_wing[kTableLength];
+};
+
+const SincTable kSincTable;
+
+// Stretch factor applied to the filter for a given playback rate. For
+// upsampling (rate <= 1) the filter is used as designed; for downsampling
+// it is widened by 1/rate, capped at 2x which is all the wing headroom we
+// have. Rates above 2 alias slightly in the topmost octave.
+inline double filterScale(double rate) {
+    if (rate <= 1.0) {
+        return 1.0;
+    }
+    return math_max(0.5, 1.0 / rate);
+}
+
+} // namespace
+
+EngineBufferScalePolyphase::EngineBufferScalePolyphase(
+        ReadAheadManager* pReadAheadManager)
+        : m_pReadAheadManager(pReadAheadManager),
+          m_buffer(SampleUtil::alloc(kiPolyphaseScaleReadAheadLength)),
+          m_bufferSize(0),
+          m_bClear(false),
+          m_dRate(1.0),
+          m_dOldRate(1.0),
+          m_dPlayposFrames(0.0),
+          m_dGainFilterScale(0.0),
+          m_gain(1.0f) {
+    SampleUtil::clear(m_buffer, kiPolyphaseScaleReadAheadLength);
+    clear();
+}
+
+EngineBufferScalePolyphase::~EngineBufferScalePolyphase() {
+    SampleUtil::free(m_buffer);
+}
+
+void EngineBufferScalePolyphase::setScaleParameters(double base_rate,
+                                                    double* pTempoRatio,
+                                                    double* pPitchRatio) {
+    Q_UNUSED(pPitchRatio);
+
+    m_dOldRate = m_dRate;
+    m_dRate = base_rate * *pTempoRatio;
+}
+
+void EngineBufferScalePolyphase::clear() {
+    m_bClear = true;
+    // Prime the filter with a silent history so the left wing has valid
+    // taps from the first output frame on.
+    const SINT historySamples = getOutputSignal().frames2samples(kMaxWingFrames);
+    SampleUtil::clear(m_buffer, historySamples);
+    m_bufferSize = historySamples;
+    m_dPlayposFrames = kMaxWingFrames;
+}
+
+double EngineBufferScalePolyphase::scaleBuffer(
+        CSAMPLE* pOutputBuffer,
+        SINT iOutputBufferSize) {
+    if (iOutputBufferSize == 0) {
+        return 0.0;
+    }
+
+    if (m_bClear) {
+        m_dOldRate = m_dRate; // If cleared, don't interpolate rate.
+        m_bClear = false;
+    }
+
+    return do_scale(pOutputBuffer, iOutputBufferSize);
+}
+
+SINT EngineBufferScalePolyphase::refillBuffer(double rate) {
+    const SINT frameFloor = static_cast<SINT>(m_dPlayposFrames);
+    // Keep the left wing history; everything before it has been consumed.
+    SINT keepStartFrame = frameFloor - kMaxWingFrames;
+    if (keepStartFrame < 0) {
+        keepStartFrame = 0;
+    }
+    const SINT keepStartSample = getOutputSignal().frames2samples(keepStartFrame);
+    const SINT keepSamples = m_bufferSize - keepStartSample;
+    if (keepStartSample > 0 && keepSamples > 0) {
+        // Regions may overlap, the source is always ahead of the
+        // destination.
+        memmove(m_buffer, &m_buffer[keepStartSample],
+                keepSamples * sizeof(CSAMPLE));
+        m_bufferSize = keepSamples;
+        m_dPlayposFrames -= keepStartFrame;
+    }
+
+    SINT samples_needed = kiPolyphaseScaleReadAheadLength - m_bufferSize;
+    const SINT samples_requested = samples_needed;
+    CSAMPLE* write_buf = &m_buffer[m_bufferSize];
+    // Protection against infinite read loops when (for example) we are
+    // reading from a broken file.
+    int read_failed_count = 0;
+    while (samples_needed > 0) {
+        const SINT read_size = m_pReadAheadManager->getNextSamples(
+                rate, write_buf, samples_needed);
+        if (read_size == 0) {
+            if (++read_failed_count > 1) {
+                break;
+            } else {
+                continue;
+            }
+        }
+        samples_needed -= read_size;
+        write_buf += read_size;
+        m_bufferSize += read_size;
+    }
+    return getOutputSignal().samples2frames(samples_requested - samples_needed);
+}
+
+SINT EngineBufferScalePolyphase::do_copy(CSAMPLE* buf, SINT buf_size) {
+    // Consume whole frames from the internal buffer first, then read the
+    // rest straight from the ReadAheadManager. Like the linear scaler's
+    // do_copy this blows away the fractional sample position.
+    SINT samples_needed = buf_size;
+    CSAMPLE* write_buf = buf;
+    const SINT nextFrame = static_cast<SINT>(ceil(m_dPlayposFrames));
+    const SINT nextSample = math_max<SINT>(
+            getOutputSignal().frames2samples(nextFrame), 0);
+    const SINT readSize = math_min<SINT>(m_bufferSize - nextSample, samples_needed);
+    if (readSize > 0) {
+        SampleUtil::copy(write_buf, &m_buffer[nextSample], readSize);
+        samples_needed -= readSize;
+        write_buf += readSize;
+    }
+    int read_failed_count = 0;
+    while (samples_needed > 0) {
+        const SINT read_size = m_pReadAheadManager->getNextSamples(
+                m_dRate, write_buf, samples_needed);
+        if (read_size == 0) {
+            if (++read_failed_count > 1) {
+                break;
+            } else {
+                continue;
+            }
+        }
+        samples_needed -= read_size;
+        write_buf += read_size;
+    }
+    const SINT read_samples = buf_size - samples_needed;
+    // Zero the remaining samples if we didn't fill them.
+    SampleUtil::clear(write_buf, samples_needed);
+
+    // Keep the tail of the output as history, so a following rate change
+    // starts with a primed filter instead of a zero window.
+    const SINT historySamples = getOutputSignal().frames2samples(kMaxWingFrames);
+    if (read_samples >= historySamples) {
+        SampleUtil::copy(m_buffer, &buf[read_samples - historySamples],
+                historySamples);
+    } else {
+        SampleUtil::clear(m_buffer, historySamples);
+    }
+    m_bufferSize = historySamples;
+    m_dPlayposFrames = kMaxWingFrames;
+    return getOutputSignal().samples2frames(read_samples);
+}
+
+SINT EngineBufferScalePolyphase::do_scale(CSAMPLE* buf, SINT buf_size) {
+    double rate_old = m_dOldRate;
+    double rate_new = m_dRate;
+
+    // Update the old base rate because we only need to
+    // interpolate/ramp up the pitch changes once.
+    m_dOldRate = m_dRate;
+
+    // Reverse playback is the linear scaler's job; EngineBuffer never
+    // routes backward rates here.
+    VERIFY_OR_DEBUG_ASSERT(rate_old >= 0 && rate_new >= 0) {
+        rate_old = fabs(rate_old);
+        rate_new = fabs(rate_new);
+    }
+
+    // Special case -- unity playback needs no filtering at all.
+    if (rate_old == rate_new && rate_new == 1.0) {
+        return do_copy(buf, buf_size);
+    }
+
+    const SINT bufferSizeFrames = getOutputSignal().samples2frames(buf_size);
+    // Smooth any change in the playback rate over the buffer to prevent
+    // discontinuities.
+    const double rate_delta = (rate_new - rate_old) / bufferSizeFrames;
+    double rate_add = rate_old;
+
+    const int channelCount = getOutputSignal().getChannelCount();
+    SINT frames_read = 0;
+    SINT i = 0;
+
+    while (i < buf_size) {
+        SINT frameFloor = static_cast<SINT>(m_dPlayposFrames);
+
+        // Make sure the whole filter window around the current position is
+        // buffered before synthesizing the next output frame.
+        if (getOutputSignal().frames2samples(frameFloor + kMaxWingFrames) + 1 >=
+                m_bufferSize) {
+            frames_read += refillBuffer(rate_new == 0 ? rate_old : rate_new);
+            frameFloor = static_cast<SINT>(m_dPlayposFrames);
+            if (getOutputSignal().frames2samples(frameFloor + kMaxWingFrames) + 1 >=
+                    m_bufferSize) {
+                // Read failure, bail out and zero the rest of the output.
+                break;
+            }
+            continue;
+        }
+
+        const double scale = filterScale(rate_add);
+        if (scale != m_dGainFilterScale) {
+            // Normalize the DC gain of the (possibly stretched) filter.
+            // Evaluated at phase zero; the residual gain ripple across
+            // phases is below the passband ripple of the filter itself.
+            double sum = kSincTable.at(0.0, scale);
+            for (double x = 1.0; x * scale < kWingFrames; x += 1.0) {
+                sum += 2.0 * kSincTable.at(x, scale);
+            }
+            m_gain = static_cast<CSAMPLE>(1.0 / sum);
+            m_dGainFilterScale = scale;
+        }
+
+        const double frac = m_dPlayposFrames - frameFloor;
+        CSAMPLE sumL = 0.0f;
+        CSAMPLE sumR = 0.0f;
+
+        // Left wing, including the floor frame itself.
+        {
+            double x = frac;
+            SINT tapSample = getOutputSignal().frames2samples(frameFloor);
+            while (x * scale < kWingFrames && tapSample >= 0) {
+                const CSAMPLE coeff = kSincTable.at(x, scale);
+                sumL += coeff * m_buffer[tapSample];
+                sumR += coeff * m_buffer[tapSample + 1];
+                x += 1.0;
+                tapSample -= channelCount;
+            }
+        }
+        // Right wing.
+        {
+            double x = 1.0 - frac;
+            SINT tapSample = getOutputSignal().frames2samples(frameFloor + 1);
+            while (x * scale < kWingFrames && tapSample + 1 < m_bufferSize) {
+                const CSAMPLE coeff = kSincTable.at(x, scale);
+                sumL += coeff * m_buffer[tapSample];
+                sumR += coeff * m_buffer[tapSample + 1];
+                x += 1.0;
+                tapSample += channelCount;
+            }
+        }
+
+        buf[i] = m_gain * sumL;
+        buf[i + 1] = m_gain * sumR;
+
+        m_dPlayposFrames += rate_add;
+        rate_add += rate_delta;
+        i += channelCount;
+    }
+
+    SampleUtil::clear(&buf[i], buf_size - i);
+
+    return frames_read;
+}
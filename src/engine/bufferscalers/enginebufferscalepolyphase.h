@@ -0,0 +1,58 @@
+#pragma once
+
+#include "engine/bufferscalers/enginebufferscale.h"
+#include "engine/readaheadmanager.h"
+
+/** Number of samples to read ahead, matches the linear scaler */
+const int kiPolyphaseScaleReadAheadLength = 10240;
+
+// Polyphase windowed-sinc resampler for transparent sample rate conversion
+// during ordinary forward playback, e.g. a 44.1 kHz track on a 96 kHz
+// engine. Interpolates between precomputed filter phases, so the per-frame
+// cost is a short FIR dot product instead of the keylock scalers' full
+// time-stretch machinery. Unlike EngineBufferScaleLinear it does not
+// support reverse playback or ramping through zero; EngineBuffer falls
+// back to the linear scaler for scratching and reverse.
+class EngineBufferScalePolyphase : public EngineBufferScale {
+  public:
+    explicit EngineBufferScalePolyphase(
+            ReadAheadManager* pReadAheadManager);
+    ~EngineBufferScalePolyphase() override;
+
+    double scaleBuffer(
+            CSAMPLE* pOutputBuffer,
+            SINT iOutputBufferSize) override;
+    void clear() override;
+
+    void setScaleParameters(double base_rate,
+                            double* pTempoRatio,
+                            double* pPitchRatio) override;
+
+  private:
+    void onSampleRateChanged() override {}
+
+    SINT do_scale(CSAMPLE* buf, SINT buf_size);
+    SINT do_copy(CSAMPLE* buf, SINT buf_size);
+    // Discards consumed frames (keeping enough history for the left filter
+    // wing) and tops the internal buffer up from the ReadAheadManager.
+    // Returns the number of frames read.
+    SINT refillBuffer(double rate);
+
+    // The read-ahead manager that we use to fetch samples
+    ReadAheadManager* m_pReadAheadManager;
+
+    // Buffer for handling calls to ReadAheadManager
+    CSAMPLE* m_buffer;
+    SINT m_bufferSize;
+
+    bool m_bClear;
+    double m_dRate;
+    double m_dOldRate;
+
+    // Fractional frame position of the next output frame within m_buffer.
+    double m_dPlayposFrames;
+
+    // Cached DC gain normalization for the current filter stretch factor.
+    double m_dGainFilterScale;
+    CSAMPLE m_gain;
+};
@@ -8,8 +8,10 @@
 #include "engine/readaheadmanager.h"
 #include "moc_enginebufferscalerubberband.cpp"
 #include "track/keyutils.h"
+#include "util/compatibility.h"
 #include "util/counter.h"
 #include "util/defs.h"
+#include "util/denormalsarezero.h"
 #include "util/math.h"
 #include "util/sample.h"
 
@@ -20,13 +22,28 @@ namespace {
 // This is the default increment from RubberBand 1.8.1.
 size_t kRubberBandBlockSize = 256;
 
+// Safety margin of unscaled input frames kept in the input FIFO in
+// addition to the estimated consumption for one output buffer. The
+// stretcher pulls input in increments of up to one block, so a few
+// blocks of slack prevent the prefetch worker from running dry when
+// the estimate is slightly off.
+const SINT kInputFifoMarginFrames = 4 * SINT(kRubberBandBlockSize);
+
 }  // namespace
 
 EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
         ReadAheadManager* pReadAheadManager)
         : m_pReadAheadManager(pReadAheadManager),
           m_buffer_back(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_bBackwards(false) {
+          m_bBackwards(false),
+          m_inputFifo(MAX_BUFFER_LEN),
+          m_pPrefetchOutput(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_prefetchOutputSize(0),
+          m_prefetchFramesRead(0.0),
+          m_prefetchInFlight(false),
+          m_prefetchValid(false),
+          m_prefetchWorker(this),
+          m_workerBound(false) {
     m_retrieve_buffer[0] = SampleUtil::alloc(MAX_BUFFER_LEN);
     m_retrieve_buffer[1] = SampleUtil::alloc(MAX_BUFFER_LEN);
     // Initialize the internal buffers to prevent re-allocations
@@ -35,14 +52,48 @@ EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
 }
 
 EngineBufferScaleRubberBand::~EngineBufferScaleRubberBand() {
+    m_prefetchWorker.quitWait();
     SampleUtil::free(m_buffer_back);
+    SampleUtil::free(m_pPrefetchOutput);
     SampleUtil::free(m_retrieve_buffer[0]);
     SampleUtil::free(m_retrieve_buffer[1]);
 }
 
+void EngineBufferScaleRubberBand::bindWorker(
+        EngineWorkerScheduler* pWorkerScheduler) {
+    DEBUG_ASSERT(!m_workerBound);
+    m_prefetchWorker.setScheduler(pWorkerScheduler);
+    m_prefetchWorker.start(QThread::HighPriority);
+    m_workerBound = true;
+}
+
+void EngineBufferScaleRubberBand::PrefetchWorker::run() {
+    QThread::currentThread()->setObjectName("RubberBandPrefetchWorker");
+    // Rubber Band's windowed processing produces denormals in quiet
+    // passages; flush them to zero on this thread like in the callback.
+    const mixxx::DenormalsAreZeroScope denormalsAreZeroScope;
+    while (!atomicLoadAcquire(m_stop)) {
+        m_semaRun.acquire();
+        if (atomicLoadAcquire(m_stop)) {
+            break;
+        }
+        m_pScaler->processPrefetch();
+    }
+}
+
+void EngineBufferScaleRubberBand::PrefetchWorker::quitWait() {
+    m_stop = 1;
+    m_semaRun.release();
+    wait();
+}
+
 void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
                                                      double* pTempoRatio,
                                                      double* pPitchRatio) {
+    // The stretcher must not be reconfigured while the prefetch
+    // worker is processing.
+    syncPrefetchWorker();
+
     // Negative speed means we are going backwards. pitch does not affect
     // the playback direction.
     m_bBackwards = *pTempoRatio < 0;
@@ -102,6 +153,9 @@ void EngineBufferScaleRubberBand::setScaleParameters(double base_rate,
 }
 
 void EngineBufferScaleRubberBand::onSampleRateChanged() {
+    syncPrefetchWorker();
+    m_prefetchValid = false;
+    m_inputFifo.flushReadData(m_inputFifo.readAvailable());
     // TODO: Resetting the sample rate will cause internal
     // memory allocations that may block the real-time thread.
     // When is this function actually invoked??
@@ -122,12 +176,60 @@ void EngineBufferScaleRubberBand::onSampleRateChanged() {
 }
 
 void EngineBufferScaleRubberBand::clear() {
+    syncPrefetchWorker();
+    // Discard the buffer prefetched before the seek as well as any
+    // input read ahead of it.
+    m_prefetchValid = false;
+    m_inputFifo.flushReadData(m_inputFifo.readAvailable());
     VERIFY_OR_DEBUG_ASSERT(m_pRubberBand) {
         return;
     }
     m_pRubberBand->reset();
 }
 
+void EngineBufferScaleRubberBand::syncPrefetchWorker() {
+    if (m_prefetchInFlight) {
+        m_prefetchDone.acquire();
+        m_prefetchInFlight = false;
+        m_prefetchValid = true;
+    }
+}
+
+void EngineBufferScaleRubberBand::processPrefetch() {
+    m_prefetchFramesRead = stretchBuffer(
+            m_pPrefetchOutput, m_prefetchOutputSize, false);
+    m_prefetchDone.release();
+}
+
+void EngineBufferScaleRubberBand::fillInputFifo(SINT iOutputBufferSize) {
+    // Frames the stretcher is expected to consume for one output
+    // buffer plus a safety margin
+    const SINT targetFrames = static_cast<SINT>(ceil(
+            getOutputSignal().samples2frames(iOutputBufferSize) *
+            m_dBaseRate * m_dTempoRatio)) +
+            kInputFifoMarginFrames;
+    SINT fillSamples = math_min<SINT>(
+            getOutputSignal().frames2samples(targetFrames) -
+                    m_inputFifo.readAvailable(),
+            m_inputFifo.writeAvailable());
+    int read_failed_count = 0;
+    while (fillSamples > 0) {
+        const SINT readSamples = m_pReadAheadManager->getNextSamples(
+                (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
+                m_buffer_back,
+                fillSamples);
+        if (readSamples == 0) {
+            if (++read_failed_count > 1) {
+                break; // EOF
+            } else {
+                continue;
+            }
+        }
+        m_inputFifo.write(m_buffer_back, readSamples);
+        fillSamples -= readSamples;
+    }
+}
+
 SINT EngineBufferScaleRubberBand::retrieveAndDeinterleave(
         CSAMPLE* pBuffer,
         SINT frames) {
@@ -163,18 +265,51 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         return 0.0;
     }
 
+    syncPrefetchWorker();
+
+    double framesRead;
+    if (m_prefetchValid && (m_prefetchOutputSize == iOutputBufferSize)) {
+        // Hand out the buffer that has been stretched by the worker
+        // between the callbacks.
+        SampleUtil::copy(pOutputBuffer, m_pPrefetchOutput, iOutputBufferSize);
+        framesRead = m_prefetchFramesRead;
+        m_prefetchValid = false;
+    } else {
+        // First buffer after a seek, clear() or buffer size change:
+        // stretch synchronously to avoid an audible gap.
+        fillInputFifo(iOutputBufferSize);
+        framesRead = stretchBuffer(pOutputBuffer, iOutputBufferSize, true);
+    }
+
+    if (m_workerBound) {
+        // Stock the input FIFO and schedule the stretch of the next
+        // buffer off the callback.
+        fillInputFifo(iOutputBufferSize);
+        m_prefetchOutputSize = iOutputBufferSize;
+        m_prefetchInFlight = true;
+        m_prefetchWorker.workReady();
+    }
+
+    return framesRead;
+}
+
+double EngineBufferScaleRubberBand::stretchBuffer(
+        CSAMPLE* pOutputBuffer,
+        SINT iOutputBufferSize,
+        bool allowSourceReads) {
     SINT total_received_frames = 0;
-    SINT total_read_frames = 0;
 
     SINT remaining_frames = getOutputSignal().samples2frames(iOutputBufferSize);
     CSAMPLE* read = pOutputBuffer;
     bool last_read_failed = false;
     bool break_out_after_retrieve_and_reset_rubberband = false;
     while (remaining_frames > 0) {
-        // ReadAheadManager will eventually read the requested frames with
-        // enough calls to retrieveAndDeinterleave because CachingReader returns
-        // zeros for reads that are not in cache. So it's safe to loop here
-        // without any checks for failure in retrieveAndDeinterleave.
+        // The input FIFO (and on the callback thread the
+        // ReadAheadManager) will eventually provide the requested
+        // frames with enough calls to retrieveAndDeinterleave because
+        // CachingReader returns zeros for reads that are not in cache.
+        // So it's safe to loop here without any checks for failure in
+        // retrieveAndDeinterleave.
         SINT received_frames = retrieveAndDeinterleave(
                 read, remaining_frames);
         remaining_frames -= received_frames;
@@ -204,17 +339,24 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         //qDebug() << "iLenFramesRequired" << iLenFramesRequired;
 
         if (remaining_frames > 0 && iLenFramesRequired > 0) {
-            SINT iAvailSamples = m_pReadAheadManager->getNextSamples(
+            SINT requiredSamples =
+                    getOutputSignal().frames2samples(SINT(iLenFramesRequired));
+            SINT iAvailSamples = m_inputFifo.read(m_buffer_back,
+                    math_min<SINT>(requiredSamples, m_inputFifo.readAvailable()));
+            if ((iAvailSamples < requiredSamples) && allowSourceReads) {
+                // The FIFO did not hold enough read-ahead input. Only
+                // safe on the callback thread.
+                iAvailSamples += m_pReadAheadManager->getNextSamples(
                         // The value doesn't matter here. All that matters is we
                         // are going forward or backward.
                         (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
-                        m_buffer_back,
-                        getOutputSignal().frames2samples(iLenFramesRequired));
+                        m_buffer_back + iAvailSamples,
+                        requiredSamples - iAvailSamples);
+            }
             SINT iAvailFrames = getOutputSignal().samples2frames(iAvailSamples);
 
             if (iAvailFrames > 0) {
                 last_read_failed = false;
-                total_read_frames += iAvailFrames;
                 deinterleaveAndProcess(m_buffer_back, iAvailFrames, false);
             } else {
                 if (last_read_failed) {
@@ -243,7 +385,5 @@ double EngineBufferScaleRubberBand::scaleBuffer(
     // time. So, if we used total_received_frames in stretched time, then
     // multiplying that by the ratio of unstretched time to stretched time
     // will get us the unstretched sample frames read.
-    double framesRead = m_dBaseRate * m_dTempoRatio * total_received_frames;
-
-    return framesRead;
+    return m_dBaseRate * m_dTempoRatio * total_received_frames;
 }
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <QAtomicInt>
+#include <QSemaphore>
+
 #include "engine/bufferscalers/enginebufferscale.h"
+#include "engine/engineworker.h"
+#include "util/fifo.h"
 #include "util/memory.h"
 
 namespace RubberBand {
@@ -8,8 +13,18 @@ class RubberBandStretcher;
 }  // namespace RubberBand
 
 class ReadAheadManager;
+class EngineWorkerScheduler;
 
 // Uses librubberband to scale audio.  This class is not thread safe.
+//
+// When bound to an EngineWorkerScheduler via bindWorker() the stretcher
+// runs asynchronously one buffer ahead of the audio callback: each call
+// to scaleBuffer() hands out the buffer that has been prefetched by the
+// worker between the callbacks, stocks the input FIFO from the
+// ReadAheadManager and schedules the stretch of the next buffer. The
+// actual Rubber Band processing then happens entirely off the callback
+// at the price of one buffer of parameter latency. Without a bound
+// worker (e.g. in tests) scaling is performed synchronously.
 class EngineBufferScaleRubberBand : public EngineBufferScale {
     Q_OBJECT
   public:
@@ -28,6 +43,9 @@ class EngineBufferScaleRubberBand : public EngineBufferScale {
     // Flush buffer.
     void clear() override;
 
+    // Bind the prefetch worker to the given scheduler and start it.
+    void bindWorker(EngineWorkerScheduler* pWorkerScheduler);
+
   private:
     // Reset RubberBand library with new audio signal
     void onSampleRateChanged() override;
@@ -35,6 +53,48 @@ class EngineBufferScaleRubberBand : public EngineBufferScale {
     void deinterleaveAndProcess(const CSAMPLE* pBuffer, SINT frames, bool flush);
     SINT retrieveAndDeinterleave(CSAMPLE* pBuffer, SINT frames);
 
+    // Stretches one output buffer worth of audio, reading unscaled
+    // input frames from the input FIFO. If allowSourceReads is true
+    // (only safe on the callback thread) the ReadAheadManager is
+    // queried directly when the FIFO runs dry.
+    double stretchBuffer(
+            CSAMPLE* pOutputBuffer,
+            SINT iOutputBufferSize,
+            bool allowSourceReads);
+
+    // Tops up the input FIFO from the ReadAheadManager with the frames
+    // the stretcher will consume for one output buffer plus a safety
+    // margin. Must only be called from the callback thread while the
+    // worker is idle.
+    void fillInputFifo(SINT iOutputBufferSize);
+
+    // Waits until a scheduled prefetch (if any) has finished. Must be
+    // called before touching the stretcher or its buffers from the
+    // callback thread.
+    void syncPrefetchWorker();
+
+    // Runs on the worker thread: stretches the next output buffer
+    // into the prefetch buffer.
+    void processPrefetch();
+
+    // Stretches the next buffer ahead of the audio callback on a
+    // worker thread scheduled by the EngineWorkerScheduler.
+    class PrefetchWorker : public EngineWorker {
+      public:
+        explicit PrefetchWorker(EngineBufferScaleRubberBand* pScaler)
+                : EngineWorker(PRIORITY_HIGH),
+                  m_pScaler(pScaler),
+                  m_stop(0) {
+        }
+        void run() override;
+        void quitWait();
+
+      private:
+        EngineBufferScaleRubberBand* const m_pScaler;
+        QAtomicInt m_stop;
+    };
+    friend class PrefetchWorker;
+
     // The read-ahead manager that we use to fetch samples
     ReadAheadManager* m_pReadAheadManager;
 
@@ -45,4 +105,22 @@ class EngineBufferScaleRubberBand : public EngineBufferScale {
 
     // Holds the playback direction
     bool m_bBackwards;
+
+    // Unscaled input frames read ahead on the callback thread and
+    // consumed by the stretcher.
+    FIFO<CSAMPLE> m_inputFifo;
+
+    // Output buffer stretched ahead by the worker together with the
+    // frames that have been consumed to produce it.
+    CSAMPLE* m_pPrefetchOutput;
+    SINT m_prefetchOutputSize;
+    double m_prefetchFramesRead;
+    // Released by the worker after each prefetch.
+    QSemaphore m_prefetchDone;
+    // Only touched on the callback thread.
+    bool m_prefetchInFlight;
+    bool m_prefetchValid;
+
+    PrefetchWorker m_prefetchWorker;
+    bool m_workerBound;
 };
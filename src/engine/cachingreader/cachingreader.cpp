@@ -4,6 +4,7 @@
 #include <QtDebug>
 
 #include "control/controlobject.h"
+#include "mixer/playermanager.h"
 #include "moc_cachingreader.cpp"
 #include "track/track.h"
 #include "util/assert.h"
@@ -17,10 +18,20 @@ namespace {
 
 mixxx::Logger kLogger("CachingReader");
 
-// This is the default hint frameCount that is adopted in case of Hint::kFrameCountForward and
-// Hint::kFrameCountBackward count is provided. It matches 23 ms @ 44.1 kHz
-// TODO() Do we suffer cache misses if we use an audio buffer of above 23 ms?
-const SINT kDefaultHintFrames = 1024;
+// This is the minimum hint frameCount that is adopted in case of
+// Hint::kFrameCountForward and Hint::kFrameCountBackward count is provided.
+// It matches 23 ms @ 44.1 kHz
+const SINT kMinHintFrames = 1024;
+
+// Upper bound for the adaptive hint frameCount (4 chunks with
+// CachingReaderChunk::kFrames = 8192). During sustained linear playback the
+// hinted readahead is doubled on every consecutive read up to this limit so
+// that the worker keeps several chunks ahead of the playhead decoded.
+// During scratching (direction reversals and position jumps) it collapses
+// back to kMinHintFrames, because decoding far ahead is wasted work then
+// and evicts the chunks around the scratch position that are actually
+// needed to avoid ReadResult::UNAVAILABLE dropouts.
+const SINT kMaxHintFrames = 32768;
 
 // With CachingReaderChunk::kFrames = 8192 each chunk consumes
 // 8192 frames * 2 channels/frame * 4-bytes per sample = 65 kB.
@@ -39,6 +50,13 @@ const SINT kDefaultHintFrames = 1024;
 // massive drop outs are expected to occur Mixxx should run reliably!
 const SINT kNumberOfCachedChunksInMemory = 80;
 
+// Default upper bound of the memory-mapped decoded PCM cache file
+// per deck in MiB. After the first play-through of a track every
+// seek becomes a page-cache hit instead of a re-decode of the
+// compressed audio stream. An hour of stereo audio at 48 kHz
+// decodes to ~1.3 GiB.
+const int kDefaultPcmCacheFileMiB = 2048;
+
 } // anonymous namespace
 
 CachingReader::CachingReader(const QString& group,
@@ -62,7 +80,24 @@ CachingReader::CachingReader(const QString& group,
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
           m_sampleBuffer(CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory),
-          m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
+          m_lastReadStartFrame(0),
+          m_lastReadEndFrame(0),
+          m_lastReadReverse(false),
+          m_adaptiveHintFrames(kMinHintFrames),
+          m_worker(group,
+                  &m_chunkReadRequestFIFO,
+                  &m_readerStatusUpdateFIFO,
+                  static_cast<SINT>(config->getValue(
+                          ConfigKey("[Engine]", "DecodedPcmCacheFileMiB"),
+                          kDefaultPcmCacheFileMiB)) *
+                          1024 * 1024,
+                  // Prelistening is not mission critical. Skipping through
+                  // the library on the preview deck triggers bursts of disk
+                  // I/O that must not delay the chunk decodes of the playing
+                  // decks.
+                  PlayerManager::isPreviewDeckGroup(group)
+                          ? EngineWorker::PRIORITY_NORMAL
+                          : EngineWorker::PRIORITY_HIGH) {
     m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
@@ -89,7 +124,11 @@ CachingReader::CachingReader(const QString& group,
             this, &CachingReader::trackLoadFailed,
             Qt::DirectConnection);
 
-    m_worker.start(QThread::HighPriority);
+    // The preview deck's worker also runs on a lower OS thread priority
+    // so that its file reads yield to the playing decks' readers.
+    m_worker.start(PlayerManager::isPreviewDeckGroup(group)
+                    ? QThread::NormalPriority
+                    : QThread::HighPriority);
 }
 
 CachingReader::~CachingReader() {
@@ -328,6 +367,24 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
 
     SINT samplesRemaining = numSamples;
 
+    // Classify the access pattern to adapt the hinted readahead length
+    // (see hintAndMaybeWake). A read that seamlessly continues the
+    // previous one in the same direction indicates linear playback, a
+    // position jump or direction reversal indicates seeking/scratching.
+    const SINT startFrame = CachingReaderChunk::samples2frames(sample);
+    const SINT endFrame = startFrame + CachingReaderChunk::samples2frames(numSamples);
+    const bool linearRead = (reverse == m_lastReadReverse) &&
+            (reverse ? (endFrame == m_lastReadStartFrame)
+                     : (startFrame == m_lastReadEndFrame));
+    if (linearRead) {
+        m_adaptiveHintFrames = math_min(m_adaptiveHintFrames * 2, kMaxHintFrames);
+    } else {
+        m_adaptiveHintFrames = kMinHintFrames;
+    }
+    m_lastReadStartFrame = startFrame;
+    m_lastReadEndFrame = endFrame;
+    m_lastReadReverse = reverse;
+
     // Process new messages from the reader thread before looking up
     // the first chunk and to update m_readableFrameIndexRange
     process();
@@ -519,12 +576,13 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
         SINT hintFrame = hint.frame;
         SINT hintFrameCount = hint.frameCount;
 
-        // Handle some special length values
+        // Handle some special length values. The adaptive frame count grows
+        // during linear playback and shrinks while scratching, see read().
         if (hintFrameCount == Hint::kFrameCountForward) {
-        	hintFrameCount = kDefaultHintFrames;
+            hintFrameCount = m_adaptiveHintFrames;
         } else if (hintFrameCount == Hint::kFrameCountBackward) {
-        	hintFrame -= kDefaultHintFrames;
-        	hintFrameCount = kDefaultHintFrames;
+            hintFrame -= m_adaptiveHintFrames;
+            hintFrameCount = m_adaptiveHintFrames;
             if (hintFrame < 0) {
             	hintFrameCount += hintFrame;
                 hintFrame = 0;
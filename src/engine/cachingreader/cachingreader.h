@@ -176,5 +176,14 @@ class CachingReader : public QObject {
     // The readable frame index range as reported by the worker.
     mixxx::IndexRange m_readableFrameIndexRange;
 
+    // Access pattern tracking for the adaptive hint readahead, only
+    // touched from the engine callback in read().
+    SINT m_lastReadStartFrame;
+    SINT m_lastReadEndFrame;
+    bool m_lastReadReverse;
+    // Current frame count used for Hint::kFrameCountForward/Backward,
+    // between kMinHintFrames and kMaxHintFrames.
+    SINT m_adaptiveHintFrames;
+
     CachingReaderWorker m_worker;
 };
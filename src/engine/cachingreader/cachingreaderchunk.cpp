@@ -79,6 +79,25 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+mixxx::IndexRange CachingReaderChunk::bufferCachedSampleFrames(
+        const mixxx::ReadableSampleFrames& cachedSampleFrames) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const SINT sampleCount =
+            frames2samples(cachedSampleFrames.frameIndexRange().length());
+    DEBUG_ASSERT(sampleCount <= m_sampleBuffer.length());
+    DEBUG_ASSERT(sampleCount <= cachedSampleFrames.readableLength());
+    SampleUtil::copy(
+            m_sampleBuffer.data(),
+            cachedSampleFrames.readableData(),
+            sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            cachedSampleFrames.frameIndexRange(),
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(),
+                    sampleCount));
+    return m_bufferedSampleFrames.frameIndexRange();
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         const mixxx::IndexRange& frameIndexRange) const {
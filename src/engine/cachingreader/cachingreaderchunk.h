@@ -56,6 +56,12 @@ public:
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
 
+    // Copy previously decoded sample frames of this chunk from the
+    // decoded PCM cache and return the range of frames that have
+    // been copied.
+    mixxx::IndexRange bufferCachedSampleFrames(
+            const mixxx::ReadableSampleFrames& cachedSampleFrames);
+
     mixxx::IndexRange readBufferedSampleFrames(
             CSAMPLE* sampleBuffer,
             const mixxx::IndexRange& frameIndexRange) const;
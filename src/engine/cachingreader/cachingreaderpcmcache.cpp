@@ -0,0 +1,120 @@
+#include "engine/cachingreader/cachingreaderpcmcache.h"
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderPcmCache");
+
+} // anonymous namespace
+
+CachingReaderPcmCache::CachingReaderPcmCache(SINT maxFileSizeBytes)
+        : m_maxFileSizeBytes(maxFileSizeBytes),
+          m_pMappedData(nullptr) {
+}
+
+CachingReaderPcmCache::~CachingReaderPcmCache() {
+    close();
+}
+
+bool CachingReaderPcmCache::open(const mixxx::IndexRange& frameIndexRange) {
+    close();
+    if (m_maxFileSizeBytes <= 0) {
+        // Disabled
+        return false;
+    }
+    DEBUG_ASSERT(!frameIndexRange.empty());
+    const SINT numChunkSlots =
+            CachingReaderChunk::indexForFrame(frameIndexRange.end() - 1) + 1;
+    const qint64 fileSizeBytes =
+            static_cast<qint64>(numChunkSlots) *
+            CachingReaderChunk::kSamples * sizeof(CSAMPLE);
+    if (fileSizeBytes > m_maxFileSizeBytes) {
+        if (kLogger.debugEnabled()) {
+            kLogger.debug()
+                    << "Decoded track size"
+                    << fileSizeBytes
+                    << "exceeds the cache file size limit"
+                    << m_maxFileSizeBytes;
+        }
+        return false;
+    }
+    auto pFile = std::make_unique<QTemporaryFile>();
+    if (!pFile->open() || !pFile->resize(fileSizeBytes)) {
+        kLogger.warning()
+                << "Failed to create cache file of size"
+                << fileSizeBytes;
+        return false;
+    }
+    m_pMappedData = pFile->map(0, fileSizeBytes);
+    if (!m_pMappedData) {
+        kLogger.warning()
+                << "Failed to map cache file"
+                << pFile->fileName();
+        return false;
+    }
+    m_pFile = std::move(pFile);
+    m_chunkSlots.resize(numChunkSlots);
+    return true;
+}
+
+void CachingReaderPcmCache::close() {
+    m_chunkSlots.clear();
+    if (m_pMappedData) {
+        DEBUG_ASSERT(m_pFile);
+        m_pFile->unmap(m_pMappedData);
+        m_pMappedData = nullptr;
+    }
+    // Deleting the temporary file removes it from disk
+    m_pFile.reset();
+}
+
+CSAMPLE* CachingReaderPcmCache::chunkSlotData(SINT chunkIndex) const {
+    DEBUG_ASSERT(m_pMappedData);
+    DEBUG_ASSERT(isValidChunkIndex(chunkIndex));
+    return reinterpret_cast<CSAMPLE*>(m_pMappedData) +
+            chunkIndex * CachingReaderChunk::kSamples;
+}
+
+mixxx::ReadableSampleFrames CachingReaderPcmCache::readCachedChunk(
+        SINT chunkIndex) const {
+    if (!isOpen() || !isValidChunkIndex(chunkIndex)) {
+        return mixxx::ReadableSampleFrames();
+    }
+    const ChunkSlot& chunkSlot = m_chunkSlots[chunkIndex];
+    if (!chunkSlot.committed.loadAcquire()) {
+        return mixxx::ReadableSampleFrames();
+    }
+    const auto frameIndexRange = mixxx::IndexRange::between(
+            chunkSlot.frameIndexRangeStart,
+            chunkSlot.frameIndexRangeEnd);
+    return mixxx::ReadableSampleFrames(
+            frameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    chunkSlotData(chunkIndex),
+                    CachingReaderChunk::frames2samples(frameIndexRange.length())));
+}
+
+mixxx::SampleBuffer::WritableSlice CachingReaderPcmCache::writableChunkSlice(
+        SINT chunkIndex,
+        SINT sampleLength) {
+    if (!isOpen() || !isValidChunkIndex(chunkIndex)) {
+        return mixxx::SampleBuffer::WritableSlice();
+    }
+    DEBUG_ASSERT(sampleLength <= CachingReaderChunk::kSamples);
+    return mixxx::SampleBuffer::WritableSlice(
+            chunkSlotData(chunkIndex), sampleLength);
+}
+
+void CachingReaderPcmCache::commitChunk(
+        SINT chunkIndex,
+        const mixxx::IndexRange& frameIndexRange) {
+    VERIFY_OR_DEBUG_ASSERT(isOpen() && isValidChunkIndex(chunkIndex)) {
+        return;
+    }
+    ChunkSlot& chunkSlot = m_chunkSlots[chunkIndex];
+    chunkSlot.frameIndexRangeStart = frameIndexRange.start();
+    chunkSlot.frameIndexRangeEnd = frameIndexRange.end();
+    chunkSlot.committed.storeRelease(1);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QTemporaryFile>
+#include <memory>
+#include <vector>
+
+#include "sources/audiosource.h"
+#include "util/types.h"
+
+// A memory-mapped spillover cache of decoded PCM for the currently
+// loaded track, backed by a temporary file that is filled progressively
+// by the CachingReaderWorker. Once a chunk has been decoded and
+// committed, subsequent read requests for the same chunk are served
+// from the mapping (a page-cache hit) instead of seeking and
+// re-decoding the compressed audio stream. This makes hot-cue juggling
+// and reverse-scratching on long files cheap after the first
+// play-through, especially for formats with expensive seek paths
+// like MP3.
+//
+// The chunk slots of the mapping are disjoint, so concurrent reads and
+// writes of different chunks are safe. The per-chunk committed flags
+// are synchronized with acquire/release semantics.
+class CachingReaderPcmCache {
+  public:
+    // The cache is disabled if maxFileSizeBytes <= 0 or if the decoded
+    // size of a track would exceed this bound.
+    explicit CachingReaderPcmCache(SINT maxFileSizeBytes);
+    ~CachingReaderPcmCache();
+
+    CachingReaderPcmCache(const CachingReaderPcmCache&) = delete;
+    CachingReaderPcmCache& operator=(const CachingReaderPcmCache&) = delete;
+
+    // Creates and maps the backing file for a track with the given
+    // frame index range. Returns false if the cache is disabled, the
+    // decoded track exceeds the configured size bound, or the mapping
+    // failed. All previously cached contents are discarded.
+    bool open(const mixxx::IndexRange& frameIndexRange);
+
+    // Unmaps and removes the backing file.
+    void close();
+
+    bool isOpen() const {
+        return m_pMappedData != nullptr;
+    }
+
+    // Readable sample frames of a cached chunk, backed by the mapping.
+    // The result is empty if the chunk has not been committed (yet).
+    // The returned memory remains valid until close() is called.
+    mixxx::ReadableSampleFrames readCachedChunk(SINT chunkIndex) const;
+
+    // Writable slice of the slot for the given chunk or an empty slice
+    // if the cache is closed or the chunk is out of range. The written
+    // contents only become readable after committing the chunk.
+    mixxx::SampleBuffer::WritableSlice writableChunkSlice(
+            SINT chunkIndex,
+            SINT sampleLength);
+
+    // Publishes the previously written contents of a chunk slot for
+    // reading. The frame index range must start at the first frame
+    // of the chunk.
+    void commitChunk(
+            SINT chunkIndex,
+            const mixxx::IndexRange& frameIndexRange);
+
+  private:
+    bool isValidChunkIndex(SINT chunkIndex) const {
+        return (chunkIndex >= 0) &&
+                (chunkIndex < static_cast<SINT>(m_chunkSlots.size()));
+    }
+
+    CSAMPLE* chunkSlotData(SINT chunkIndex) const;
+
+    // Commit state of a single chunk slot. The frame index range is
+    // written before and read after the atomic committed flag.
+    struct ChunkSlot {
+        QAtomicInt committed;
+        SINT frameIndexRangeStart;
+        SINT frameIndexRangeEnd;
+    };
+
+    const SINT m_maxFileSizeBytes;
+
+    // Recreated by open() for each track to ensure that the previous
+    // backing file has been removed from disk.
+    std::unique_ptr<QTemporaryFile> m_pFile;
+    uchar* m_pMappedData;
+
+    std::vector<ChunkSlot> m_chunkSlots;
+};
@@ -1,7 +1,10 @@
 #include "engine/cachingreader/cachingreaderworker.h"
 
+#include <QFile>
 #include <QFileInfo>
 #include <QMutexLocker>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QtDebug>
 
 #include "control/controlobject.h"
@@ -9,59 +12,82 @@
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
 #include "util/compatibility.h"
+#include "util/denormalsarezero.h"
 #include "util/event.h"
 #include "util/logger.h"
+#include "util/math.h"
+
+#ifdef __LINUX__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace {
 
 mixxx::Logger kLogger("CachingReaderWorker");
 
-} // anonymous namespace
+// Maximum number of chunk requests that are decoded concurrently per deck.
+// The decode tasks run on the shared QThreadPool::globalInstance(), which
+// is sized to the number of cores (see MixxxApplication), so seek storms
+// from multiple decks share the available cores instead of each deck
+// queueing behind its own single worker thread.
+constexpr int kMaxParallelDecodeTasks = 4;
 
-CachingReaderWorker::CachingReaderWorker(
+// Reads the audio data required for one chunk from the decoded PCM
+// cache or the given audio source. Called concurrently for the chunks
+// of a batch, each invocation with a distinct chunk, audio source and
+// temporary buffer. The chunk slots of the PCM cache are disjoint, so
+// sharing the cache between the concurrent invocations is safe.
+ReaderStatusUpdate readChunkFromSource(
         const QString& group,
-        FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
-        : m_group(group),
-          m_tag(QString("CachingReaderWorker %1").arg(m_group)),
-          m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
-          m_pReaderStatusFIFO(pReaderStatusFIFO),
-          m_newTrackAvailable(false),
-          m_stop(0) {
-}
-
-ReaderStatusUpdate CachingReaderWorker::processReadRequest(
-        const CachingReaderChunkReadRequest& request) {
+        const CachingReaderChunkReadRequest& request,
+        const mixxx::AudioSourcePointer& pAudioSource,
+        mixxx::SampleBuffer* pTempReadBuffer,
+        CachingReaderPcmCache* pPcmCache) {
     CachingReaderChunk* pChunk = request.chunk;
     DEBUG_ASSERT(pChunk);
 
     // Before trying to read any data we need to check if the audio source
     // is available and if any audio data that is needed by the chunk is
     // actually available.
-    auto chunkFrameIndexRange = pChunk->frameIndexRange(m_pAudioSource);
-    DEBUG_ASSERT(!m_pAudioSource ||
-            chunkFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
+    auto chunkFrameIndexRange = pChunk->frameIndexRange(pAudioSource);
+    DEBUG_ASSERT(!pAudioSource ||
+            chunkFrameIndexRange.isSubrangeOf(pAudioSource->frameIndexRange()));
     if (chunkFrameIndexRange.empty()) {
         ReaderStatusUpdate result;
-        result.init(CHUNK_READ_INVALID, pChunk, m_pAudioSource ? m_pAudioSource->frameIndexRange() : mixxx::IndexRange());
+        result.init(CHUNK_READ_INVALID, pChunk, pAudioSource ? pAudioSource->frameIndexRange() : mixxx::IndexRange());
         return result;
     }
 
+    // Serve the chunk from the decoded PCM cache if it has already
+    // been decoded before, avoiding a seek and re-decode of the
+    // compressed audio stream.
+    if (pPcmCache) {
+        const auto cachedSampleFrames =
+                pPcmCache->readCachedChunk(pChunk->getIndex());
+        if (cachedSampleFrames.frameIndexRange() == chunkFrameIndexRange) {
+            pChunk->bufferCachedSampleFrames(cachedSampleFrames);
+            ReaderStatusUpdate result;
+            result.init(CHUNK_READ_SUCCESS, pChunk, pAudioSource->frameIndexRange());
+            return result;
+        }
+    }
+
     // Try to read the data required for the chunk from the audio source
     const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
-    DEBUG_ASSERT(!m_pAudioSource ||
-            bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
+            pAudioSource,
+            mixxx::SampleBuffer::WritableSlice(*pTempReadBuffer));
+    DEBUG_ASSERT(!pAudioSource ||
+            bufferedFrameIndexRange.isSubrangeOf(pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
-    chunkFrameIndexRange = intersect(chunkFrameIndexRange, m_pAudioSource->frameIndexRange());
+    chunkFrameIndexRange = intersect(chunkFrameIndexRange, pAudioSource->frameIndexRange());
     DEBUG_ASSERT(bufferedFrameIndexRange.empty() ||
             bufferedFrameIndexRange.isSubrangeOf(chunkFrameIndexRange));
 
     ReaderStatus status = bufferedFrameIndexRange.empty() ? CHUNK_READ_EOF : CHUNK_READ_SUCCESS;
     if (bufferedFrameIndexRange != chunkFrameIndexRange) {
         kLogger.warning()
-                << m_group
+                << group
                 << "Failed to read chunk samples for frame index range:"
                 << "expected =" << chunkFrameIndexRange
                 << ", actual =" << bufferedFrameIndexRange;
@@ -70,11 +96,148 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         }
     }
 
+    // Spill completely decoded chunks into the PCM cache for
+    // subsequent read requests.
+    if (pPcmCache &&
+            (status == CHUNK_READ_SUCCESS) &&
+            (bufferedFrameIndexRange == chunkFrameIndexRange)) {
+        const auto writableSlice = pPcmCache->writableChunkSlice(
+                pChunk->getIndex(),
+                CachingReaderChunk::frames2samples(bufferedFrameIndexRange.length()));
+        if (!writableSlice.empty()) {
+            pChunk->readBufferedSampleFrames(
+                    writableSlice.data(), bufferedFrameIndexRange);
+            pPcmCache->commitChunk(pChunk->getIndex(), bufferedFrameIndexRange);
+        }
+    }
+
     ReaderStatusUpdate result;
-    result.init(status, pChunk, m_pAudioSource ? m_pAudioSource->frameIndexRange() : mixxx::IndexRange());
+    result.init(status, pChunk, pAudioSource ? pAudioSource->frameIndexRange() : mixxx::IndexRange());
     return result;
 }
 
+// Decodes one chunk of a batch on the shared thread pool and signals
+// completion through the semaphore.
+class ChunkDecodeTask : public QRunnable {
+  public:
+    ChunkDecodeTask(
+            const QString& group,
+            CachingReaderChunkReadRequest request,
+            mixxx::AudioSourcePointer pAudioSource,
+            mixxx::SampleBuffer* pTempReadBuffer,
+            CachingReaderPcmCache* pPcmCache,
+            ReaderStatusUpdate* pUpdate,
+            QSemaphore* pDoneSemaphore)
+            : m_group(group),
+              m_request(request),
+              m_pAudioSource(std::move(pAudioSource)),
+              m_pTempReadBuffer(pTempReadBuffer),
+              m_pPcmCache(pPcmCache),
+              m_pUpdate(pUpdate),
+              m_pDoneSemaphore(pDoneSemaphore) {
+    }
+
+    void run() override {
+        *m_pUpdate = readChunkFromSource(
+                m_group, m_request, m_pAudioSource, m_pTempReadBuffer, m_pPcmCache);
+        m_pDoneSemaphore->release();
+    }
+
+  private:
+    const QString m_group;
+    const CachingReaderChunkReadRequest m_request;
+    const mixxx::AudioSourcePointer m_pAudioSource;
+    mixxx::SampleBuffer* const m_pTempReadBuffer;
+    CachingReaderPcmCache* const m_pPcmCache;
+    ReaderStatusUpdate* const m_pUpdate;
+    QSemaphore* const m_pDoneSemaphore;
+};
+
+// Advise the kernel to start reading the track file into the page cache
+// ahead of the decoder. The advice outlives the temporary file descriptor,
+// so subsequent reads by the SoundSource do not have to wait for disk I/O.
+// This is a best-effort optimization; failures are silently ignored.
+void adviseTrackFileWillBeNeeded(const QString& fileName) {
+#ifdef __LINUX__
+    const QByteArray localFileName = QFile::encodeName(fileName);
+    const int fd = open(localFileName.constData(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+#else
+    Q_UNUSED(fileName);
+#endif
+}
+
+} // anonymous namespace
+
+CachingReaderWorker::CachingReaderWorker(
+        const QString& group,
+        FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
+        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+        SINT maxPcmCacheFileSizeBytes,
+        EngineWorker::Priority workerPriority)
+        // Chunk decodes for the playing decks produce audio the engine is
+        // about to consume and must not wait behind other workers. The
+        // preview deck passes a lower priority (see CachingReader).
+        : EngineWorker(workerPriority),
+          m_group(group),
+          m_tag(QString("CachingReaderWorker %1").arg(m_group)),
+          m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
+          m_pReaderStatusFIFO(pReaderStatusFIFO),
+          m_newTrackAvailable(false),
+          m_pcmCache(maxPcmCacheFileSizeBytes),
+          m_stop(0) {
+}
+
+ReaderStatusUpdate CachingReaderWorker::processReadRequest(
+        const CachingReaderChunkReadRequest& request) {
+    return readChunkFromSource(
+            m_group, request, m_pAudioSource, &m_tempReadBuffer, &m_pcmCache);
+}
+
+void CachingReaderWorker::processReadRequestBatch(
+        const CachingReaderChunkReadRequest& firstRequest) {
+    CachingReaderChunkReadRequest requests[kMaxParallelDecodeTasks];
+    ReaderStatusUpdate updates[kMaxParallelDecodeTasks];
+    requests[0] = firstRequest;
+    int batchSize = 1;
+    const int maxBatchSize =
+            static_cast<int>(m_parallelAudioSources.size()) + 1;
+    while (batchSize < maxBatchSize &&
+            m_pChunkReadRequestFIFO->read(&requests[batchSize], 1) == 1) {
+        ++batchSize;
+    }
+
+    if (batchSize == 1) {
+        // The common case during linear playback: one request at a time,
+        // decoded synchronously without involving the thread pool.
+        updates[0] = processReadRequest(requests[0]);
+        m_pReaderStatusFIFO->writeBlocking(&updates[0], 1);
+        return;
+    }
+
+    // A seek storm: decode the remaining requests of the batch on the
+    // shared thread pool while this thread decodes the first one.
+    QSemaphore doneSemaphore;
+    for (int i = 1; i < batchSize; ++i) {
+        QThreadPool::globalInstance()->start(
+                new ChunkDecodeTask(m_group,
+                        requests[i],
+                        m_parallelAudioSources[i - 1],
+                        &m_parallelTempReadBuffers[i - 1],
+                        &m_pcmCache,
+                        &updates[i],
+                        &doneSemaphore));
+    }
+    updates[0] = processReadRequest(requests[0]);
+    doneSemaphore.acquire(batchSize - 1);
+
+    // Publish the results in request order
+    m_pReaderStatusFIFO->writeBlocking(updates, batchSize);
+}
+
 // WARNING: Always called from a different thread (GUI)
 void CachingReaderWorker::newTrack(TrackPointer pTrack) {
     {
@@ -89,6 +252,10 @@ void CachingReaderWorker::run() {
     unsigned static id = 0; //the id of this thread, for debugging purposes
     QThread::currentThread()->setObjectName(QString("CachingReaderWorker %1").arg(++id));
 
+    // The FTZ/DAZ modes are per-thread, so the sample rate conversion
+    // running on this thread needs its own scope.
+    const mixxx::DenormalsAreZeroScope denormalsAreZeroScope;
+
     Event::start(m_tag);
     while (!atomicLoadAcquire(m_stop)) {
         // Request is initialized by reading from FIFO
@@ -103,9 +270,8 @@ void CachingReaderWorker::run() {
             } // implicitly unlocks the mutex
             loadTrack(pLoadTrack);
         } else if (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
-            // Read the requested chunk and send the result
-            const ReaderStatusUpdate update(processReadRequest(request));
-            m_pReaderStatusFIFO->writeBlocking(&update, 1);
+            // Read the requested chunk(s) and send the result(s)
+            processReadRequestBatch(request);
         } else {
             Event::end(m_tag);
             m_semaRun.acquire();
@@ -124,6 +290,9 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
 
     // Unload the track
     m_pAudioSource.reset(); // Close open file handles
+    m_parallelAudioSources.clear();
+    m_parallelTempReadBuffers.clear();
+    m_pcmCache.close(); // Discard cached PCM and remove the backing file
 
     if (!pTrack) {
         // If no new track is available then we are done
@@ -148,6 +317,8 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
+    adviseTrackFileWillBeNeeded(pTrack->getLocation());
+
     mixxx::AudioSource::OpenParams config;
     config.setChannelCount(CachingReaderChunk::kChannels);
     m_pAudioSource = SoundSourceProxy(pTrack).openAudioSource(config);
@@ -189,6 +360,30 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         mixxx::SampleBuffer(tempReadBufferSize).swap(m_tempReadBuffer);
     }
 
+    // Open additional decoder instances for parallel chunk decoding during
+    // seek storms. This is best-effort: if a source cannot be opened twice
+    // the worker simply decodes with less (or no) parallelism.
+    DEBUG_ASSERT(m_parallelAudioSources.empty());
+    DEBUG_ASSERT(m_parallelTempReadBuffers.empty());
+    const int parallelSourceCount = math_min(
+            kMaxParallelDecodeTasks - 1, QThread::idealThreadCount() - 1);
+    for (int i = 0; i < parallelSourceCount; ++i) {
+        auto pParallelAudioSource =
+                SoundSourceProxy(pTrack).openAudioSource(config);
+        if (!pParallelAudioSource ||
+                pParallelAudioSource->frameIndexRange() !=
+                        m_pAudioSource->frameIndexRange()) {
+            break;
+        }
+        m_parallelAudioSources.push_back(std::move(pParallelAudioSource));
+        m_parallelTempReadBuffers.emplace_back(tempReadBufferSize);
+    }
+
+    // Back the track with a memory-mapped file of decoded PCM that is
+    // filled progressively while reading. This is best-effort: without
+    // the cache every chunk is simply re-decoded from the audio source.
+    m_pcmCache.open(m_pAudioSource->frameIndexRange());
+
     const auto update =
             ReaderStatusUpdate::trackLoaded(
                     m_pAudioSource->frameIndexRange());
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <QMutex>
 #include <QSemaphore>
 #include <QString>
@@ -7,6 +9,7 @@
 #include <QtDebug>
 
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/cachingreaderpcmcache.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
@@ -95,10 +98,14 @@ class CachingReaderWorker : public EngineWorker {
     Q_OBJECT
 
   public:
-    // Construct a CachingReader with the given group.
+    // Construct a CachingReader with the given group. The worker
+    // priority determines when the scheduler wakes this worker
+    // relative to other ready workers.
     CachingReaderWorker(const QString& group,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO);
+            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+            SINT maxPcmCacheFileSizeBytes,
+            EngineWorker::Priority workerPriority);
     ~CachingReaderWorker() override = default;
 
     // Request to load a new track. wake() must be called afterwards.
@@ -137,6 +144,14 @@ class CachingReaderWorker : public EngineWorker {
     ReaderStatusUpdate processReadRequest(
             const CachingReaderChunkReadRequest& request);
 
+    // Drains up to one request per available decoder from the request FIFO
+    // and decodes them in parallel on the shared global thread pool. The
+    // first request has already been read by the caller. Status updates are
+    // written to the status FIFO in request order after all chunks of the
+    // batch have been decoded.
+    void processReadRequestBatch(
+            const CachingReaderChunkReadRequest& firstRequest);
+
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
@@ -144,5 +159,16 @@ class CachingReaderWorker : public EngineWorker {
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
 
+    // Additional, independently seekable decoder instances for the loaded
+    // track together with their temporary read buffers. A single decoder
+    // is stateful and must not be shared between threads, so each parallel
+    // decode task of a batch gets its own instance.
+    std::vector<mixxx::AudioSourcePointer> m_parallelAudioSources;
+    std::vector<mixxx::SampleBuffer> m_parallelTempReadBuffers;
+
+    // Memory-mapped spillover cache of decoded PCM for the loaded
+    // track, filled progressively while reading.
+    CachingReaderPcmCache m_pcmCache;
+
     QAtomicInt m_stop;
 };
@@ -0,0 +1,125 @@
+#include "engine/channelmixer.h"
+
+#include "util/sample.h"
+
+namespace {
+
+// Fetches the ramp gains for one channel from the gain cache and updates
+// the cache for the next callback. Fading out channels are ramped to zero
+// once and then deactivated by EngineMaster.
+inline void updateChannelGain(
+        const EngineMaster::GainCalculator& gainCalculator,
+        QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
+        EngineMaster::ChannelInfo* pChannelInfo,
+        CSAMPLE_GAIN* pOldGain,
+        CSAMPLE_GAIN* pNewGain) {
+    EngineMaster::GainCache& gainCache =
+            (*channelGainCache)[pChannelInfo->m_index];
+    *pOldGain = gainCache.m_gain;
+    if (gainCache.m_fadeout) {
+        *pNewGain = 0;
+        gainCache.m_fadeout = false;
+    } else {
+        *pNewGain = gainCalculator.getGain(pChannelInfo);
+    }
+    gainCache.m_gain = *pNewGain;
+}
+
+} // anonymous namespace
+
+// static
+void ChannelMixer::applyEffectsAndMixChannels(
+        const EngineMaster::GainCalculator& gainCalculator,
+        QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels,
+        QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
+        CSAMPLE* pOutput,
+        const ChannelHandle& outputHandle,
+        unsigned int iBufferSize,
+        unsigned int iSampleRate,
+        EngineEffectsManager* pEngineEffectsManager) {
+    // Signal flow overview:
+    // 1. Clear pOutput buffer
+    // 2. Calculate gains for each channel
+    // 3. Pass each channel's calculated gain and input buffer to pEngineEffectsManager, which then:
+    //     A) Copies each channel input buffer to a temporary buffer
+    //     B) Applies gain to the temporary buffer
+    //     C) Processes effects on the temporary buffer
+    //     D) Mixes the temporary buffer into pOutput
+    // The original channel input buffers are not modified.
+    SampleUtil::clear(pOutput, iBufferSize);
+    for (int i = 0; i < activeChannels->size(); ++i) {
+        EngineMaster::ChannelInfo* pChannelInfo = activeChannels->at(i);
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+        updateChannelGain(gainCalculator,
+                channelGainCache,
+                pChannelInfo,
+                &oldGain,
+                &newGain);
+        pEngineEffectsManager->processPostFaderAndMix(pChannelInfo->m_handle,
+                outputHandle,
+                pChannelInfo->m_pBuffer,
+                pOutput,
+                iBufferSize,
+                iSampleRate,
+                pChannelInfo->m_features,
+                oldGain,
+                newGain);
+    }
+}
+
+// static
+void ChannelMixer::applyEffectsInPlaceAndMixChannels(
+        const EngineMaster::GainCalculator& gainCalculator,
+        QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels,
+        QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
+        CSAMPLE* pOutput,
+        const ChannelHandle& outputHandle,
+        unsigned int iBufferSize,
+        unsigned int iSampleRate,
+        EngineEffectsManager* pEngineEffectsManager) {
+    // Signal flow overview:
+    // 1. Calculate gains for each channel
+    // 2. Pass each channel's calculated gain and input buffer to pEngineEffectsManager, which then:
+    //    A) Applies the calculated gain to the channel buffer, modifying the original input buffer
+    //    B) Applies effects to the buffer, modifying the original input buffer
+    // 3. Mix each channel buffer into pOutput, overwriting the pOutput
+    //    buffer from the last engine callback
+    const int totalActive = activeChannels->size();
+    if (totalActive == 0) {
+        SampleUtil::clear(pOutput, iBufferSize);
+        return;
+    }
+
+    // Process effects for each channel in place and immediately accumulate
+    // it into pOutput, while the channel buffer is still cache-resident
+    // from the effects pass. Doing the effects stage for all channels first
+    // and mixing afterwards (stage-major) re-reads every channel buffer
+    // from a cold cache at large buffer sizes; see the ChannelPipeline
+    // benchmarks in sampleutiltest.cpp for a comparison of both orders.
+    // The accumulation order per output sample is the same as a separate
+    // mixdown pass, so the result is bit-identical.
+    for (int i = 0; i < totalActive; ++i) {
+        EngineMaster::ChannelInfo* pChannelInfo = activeChannels->at(i);
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+        updateChannelGain(gainCalculator,
+                channelGainCache,
+                pChannelInfo,
+                &oldGain,
+                &newGain);
+        pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle,
+                outputHandle,
+                pChannelInfo->m_pBuffer,
+                iBufferSize,
+                iSampleRate,
+                pChannelInfo->m_features,
+                oldGain,
+                newGain);
+        if (i == 0) {
+            SampleUtil::copy(pOutput, pChannelInfo->m_pBuffer, iBufferSize);
+        } else {
+            SampleUtil::add(pOutput, pChannelInfo->m_pBuffer, iBufferSize);
+        }
+    }
+}
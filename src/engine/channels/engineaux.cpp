@@ -51,6 +51,7 @@ void EngineAux::onInputConfigured(const AudioInput& input) {
     }
     m_sampleBuffer = nullptr;
     m_pInputConfigured->forceSet(1.0);
+    markActiveStateDirty();
 }
 
 void EngineAux::onInputUnconfigured(const AudioInput& input) {
@@ -61,6 +62,7 @@ void EngineAux::onInputUnconfigured(const AudioInput& input) {
     }
     m_sampleBuffer = nullptr;
     m_pInputConfigured->forceSet(0.0);
+    markActiveStateDirty();
 }
 
 void EngineAux::receiveBuffer(
@@ -68,6 +70,7 @@ void EngineAux::receiveBuffer(
     Q_UNUSED(input);
     Q_UNUSED(nFrames);
     m_sampleBuffer = pBuffer;
+    markActiveStateDirty();
 }
 
 void EngineAux::process(CSAMPLE* pOut, const int iBufferSize) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QAtomicInt>
+
 #include "control/controlproxy.h"
 #include "effects/effectsmanager.h"
 #include "engine/engineobject.h"
@@ -56,6 +58,14 @@ class EngineChannel : public EngineObject {
         m_channelIndex = channelIndex;
     }
 
+    // Registered by EngineMaster when the channel is added. The channel
+    // sets the flag whenever an event may have changed the result of
+    // isActive(), signalling the engine callback to rebuild its compact
+    // set of active channels. May be called from any thread.
+    void setActiveStateDirtyFlag(QAtomicInt* pActiveStateDirtyFlag) {
+        m_pActiveStateDirtyFlag = pActiveStateDirtyFlag;
+    }
+
     virtual void process(CSAMPLE* pOut, const int iBufferSize) = 0;
     virtual void collectFeatures(GroupFeatureState* pGroupFeatures) const = 0;
     virtual void postProcess(const int iBuffersize) = 0;
@@ -66,6 +76,12 @@ class EngineChannel : public EngineObject {
     }
 
   protected:
+    void markActiveStateDirty() {
+        if (m_pActiveStateDirtyFlag) {
+            m_pActiveStateDirtyFlag->storeRelease(1);
+        }
+    }
+
     const ChannelHandleAndGroup m_group;
     EffectsManager* m_pEffectsManager;
 
@@ -92,4 +108,5 @@ class EngineChannel : public EngineObject {
     ControlPushButton* m_pTalkover;
     bool m_bIsTalkoverChannel;
     int m_channelIndex;
+    QAtomicInt* m_pActiveStateDirtyFlag;
 };
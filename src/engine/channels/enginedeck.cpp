@@ -10,6 +10,14 @@
 #include "util/sample.h"
 #include "waveform/waveformwidgetfactory.h"
 
+namespace {
+// How long the deck output must stay digitally silent before its
+// per-channel DSP stages are skipped. Long enough that pre-fader effect
+// tails fed by the silent input (delays, reverbs) have decayed below
+// audibility before we stop processing them.
+constexpr int kSilenceHoldSeconds = 5;
+} // anonymous namespace
+
 EngineDeck::EngineDeck(
         const ChannelHandleAndGroup& handleGroup,
         UserSettingsPointer pConfig,
@@ -25,7 +33,9 @@ EngineDeck::EngineDeck(
           m_pPassing(new ControlPushButton(ConfigKey(getGroup(), "passthrough"))),
           // Need a +1 here because the CircularBuffer only allows its size-1
           // items to be held at once (it keeps a blank spot open persistently)
-          m_wasActive(false) {
+          m_wasActive(false),
+          m_silentFrames(0),
+          m_bSilenceGated(false) {
     m_pInputConfigured->setReadOnly();
     // Set up passthrough utilities and fields
     m_pPassing->setButtonMode(ControlPushButton::POWERWINDOW);
@@ -40,6 +50,17 @@ EngineDeck::EngineDeck(
 
     m_pPregain = new EnginePregain(getGroup());
     m_pBuffer = new EngineBuffer(getGroup(), pConfig, this, pMixingEngine);
+
+    // Loading or ejecting a track changes the result of isActive().
+    // Connected directly so the flag is set synchronously from whatever
+    // thread completes the load.
+    connect(m_pBuffer,
+            &EngineBuffer::trackLoaded,
+            this,
+            [this](TrackPointer, TrackPointer) {
+                markActiveStateDirty();
+            },
+            Qt::DirectConnection);
 }
 
 EngineDeck::~EngineDeck() {
@@ -68,6 +89,30 @@ void EngineDeck::process(CSAMPLE* pOut, const int iBufferSize) {
         m_pBuffer->process(pOut, iBufferSize);
         m_pPregain->setSpeedAndScratching(m_pBuffer->getSpeed(), m_pBuffer->getScratching());
         m_bPassthroughWasActive = false;
+
+        // Silence gate: a stopped deck or an empty sampler produces digital
+        // silence every callback but still pays for the pregain, pre-fader
+        // effects and VU stages below. Once the output has been silent for
+        // the hold time, skip them and hand the mixer the zero buffer as-is.
+        // The check runs on the engine buffer output, so the gate re-arms in
+        // the same callback that the transport starts producing samples.
+        if (SampleUtil::isSilence(pOut, iBufferSize)) {
+            const int holdFrames = static_cast<int>(m_pSampleRate->get()) *
+                    kSilenceHoldSeconds;
+            if (m_silentFrames < holdFrames) {
+                m_silentFrames += iBufferSize / 2;
+            }
+            if (m_silentFrames >= holdFrames && holdFrames > 0) {
+                if (!m_bSilenceGated) {
+                    m_bSilenceGated = true;
+                    m_vuMeter.reset();
+                }
+                return;
+            }
+        } else {
+            m_silentFrames = 0;
+            m_bSilenceGated = false;
+        }
     }
 
     // Apply pregain
@@ -126,6 +171,7 @@ void EngineDeck::receiveBuffer(
         return;
     } else {
         m_sampleBuffer = pBuffer;
+        markActiveStateDirty();
     }
 }
 
@@ -137,6 +183,7 @@ void EngineDeck::onInputConfigured(const AudioInput& input) {
     }
     m_pInputConfigured->forceSet(1.0);
     m_sampleBuffer = nullptr;
+    markActiveStateDirty();
 }
 
 void EngineDeck::onInputUnconfigured(const AudioInput& input) {
@@ -147,6 +194,7 @@ void EngineDeck::onInputUnconfigured(const AudioInput& input) {
     }
     m_pInputConfigured->forceSet(0.0);
     m_sampleBuffer = nullptr;
+    markActiveStateDirty();
 }
 
 bool EngineDeck::isPassthroughActive() const {
@@ -155,6 +203,7 @@ bool EngineDeck::isPassthroughActive() const {
 
 void EngineDeck::slotPassingToggle(double v) {
     m_bPassthroughIsActive = v > 0;
+    markActiveStateDirty();
 }
 
 void EngineDeck::slotPassthroughChangeRequest(double v) {
@@ -78,4 +78,10 @@ class EngineDeck : public EngineChannel, public AudioDestination {
     bool m_bPassthroughIsActive;
     bool m_bPassthroughWasActive;
     bool m_wasActive;
+
+    // Silence gate: counts frames of consecutive digital silence from the
+    // deck output. Once the hold time has passed, the pregain, pre-fader
+    // effects and VU stages are skipped until the output is audible again.
+    int m_silentFrames;
+    bool m_bSilenceGated;
 };
@@ -49,6 +49,7 @@ void EngineMicrophone::onInputConfigured(const AudioInput& input) {
     }
     m_sampleBuffer = nullptr;
     m_pInputConfigured->forceSet(1.0);
+    markActiveStateDirty();
 }
 
 void EngineMicrophone::onInputUnconfigured(const AudioInput& input) {
@@ -59,6 +60,7 @@ void EngineMicrophone::onInputUnconfigured(const AudioInput& input) {
     }
     m_sampleBuffer = nullptr;
     m_pInputConfigured->forceSet(0.0);
+    markActiveStateDirty();
 }
 
 void EngineMicrophone::receiveBuffer(
@@ -66,6 +68,7 @@ void EngineMicrophone::receiveBuffer(
     Q_UNUSED(input);
     Q_UNUSED(nFrames);
     m_sampleBuffer = pBuffer;
+    markActiveStateDirty();
 }
 
 void EngineMicrophone::process(CSAMPLE* pOut, const int iBufferSize) {
@@ -16,6 +16,7 @@
 #include "util/duration.h"
 #include "util/logger.h"
 #include "util/math.h"
+#include "util/time.h"
 #include "waveform/visualplayposition.h"
 
 namespace {
@@ -53,7 +54,9 @@ BpmControl::BpmControl(const QString& group,
         : EngineControl(group, pConfig),
           m_tapFilter(this, kBpmTapFilterLength, kBpmTapMaxInterval),
           m_dSyncInstantaneousBpm(0.0),
-          m_dLastSyncAdjustment(1.0) {
+          m_dLastSyncAdjustment(1.0),
+          m_dLocalBpmCachedPrevBeat(-1),
+          m_dLocalBpmCachedNextBeat(-1) {
     m_dSyncTargetBeatDistance.setValue(0.0);
     m_dUserOffset.setValue(0.0);
 
@@ -230,7 +233,12 @@ void BpmControl::slotTranslateBeatsLater(double v) {
 
 void BpmControl::slotBpmTap(double v) {
     if (v > 0) {
-        m_tapFilter.tap();
+        // This slot runs via a direct connection on the thread that produced
+        // the input event (the controller thread for MIDI/HID taps), so the
+        // timestamp taken here is free of GUI event loop latency. Hardware
+        // receive timestamps are not usable instead because PortMidi reports
+        // them against its own epoch, not mixxx::Time.
+        m_tapFilter.tapAt(mixxx::Time::elapsed());
     }
 }
 
@@ -1067,11 +1075,28 @@ double BpmControl::updateLocalBpm() {
     double local_bpm = 0;
     const mixxx::BeatsPointer pBeats = m_pBeats;
     if (pBeats) {
+        // getBpmAroundPosition() is an expensive beatmap query, but its
+        // result only changes when playback crosses into another beat
+        // interval or the beatgrid is replaced. QuantizeControl keeps
+        // beat_prev/beat_next up to date per callback, so they identify the
+        // current interval without another lookup.
+        const double dPrevBeat = m_pPrevBeat->get();
+        const double dNextBeat = m_pNextBeat->get();
+        if (pBeats == m_pLocalBpmCachedBeats &&
+                dPrevBeat == m_dLocalBpmCachedPrevBeat &&
+                dNextBeat == m_dLocalBpmCachedNextBeat) {
+            return prev_local_bpm;
+        }
         local_bpm = pBeats->getBpmAroundPosition(
                 getSampleOfTrack().current, kLocalBpmSpan);
         if (local_bpm == -1) {
             local_bpm = pBeats->getBpm();
         }
+        m_pLocalBpmCachedBeats = pBeats;
+        m_dLocalBpmCachedPrevBeat = dPrevBeat;
+        m_dLocalBpmCachedNextBeat = dNextBeat;
+    } else {
+        m_pLocalBpmCachedBeats.clear();
     }
     if (local_bpm != prev_local_bpm) {
         if (kLogger.traceEnabled()) {
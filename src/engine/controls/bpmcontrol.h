@@ -172,6 +172,15 @@ class BpmControl : public EngineControl {
     // m_pBeats is written from an engine worker thread
     mixxx::BeatsPointer m_pBeats;
 
+    // Cache for updateLocalBpm(), which is called on every engine callback
+    // but runs an expensive beatmap query. The local bpm can only change
+    // when playback crosses into another beat interval or the beatgrid is
+    // replaced, so the last result is reused while both are unchanged.
+    // Used in the engine thread only.
+    mixxx::BeatsPointer m_pLocalBpmCachedBeats;
+    double m_dLocalBpmCachedPrevBeat;
+    double m_dLocalBpmCachedNextBeat;
+
     FRIEND_TEST(EngineSyncTest, UserTweakPreservedInSeek);
     FRIEND_TEST(EngineSyncTest, FollowerUserTweakPreservedInMasterChange);
 };
@@ -1,7 +1,10 @@
 #include "engine/controls/cuecontrol.h"
 
+#include <QHash>
 #include <QMutexLocker>
 
+#include <algorithm>
+
 #include "control/controlindicator.h"
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
@@ -441,6 +444,7 @@ void CueControl::trackLoaded(TrackPointer pNewTrack) {
         m_pOutroEndEnabled->forceSet(0.0);
         setHotcueFocusIndex(Cue::kNoHotCue);
         m_pLoadedTrack.reset();
+        std::atomic_store(&m_pCueSnapshot, std::shared_ptr<const CueSnapshot>());
         m_usedSeekOnLoadPosition.setValue(kDefaultLoadPosition);
     }
 
@@ -533,18 +537,32 @@ void CueControl::cueUpdated() {
 }
 
 void CueControl::loadCuesFromTrack() {
-    QMutexLocker lock(&m_trackMutex);
-    if (!m_pLoadedTrack) {
+    // Take a reference on the loaded track under a short lock; the cue
+    // scan below must not hold m_trackMutex, because the hotcue handlers
+    // on the engine callback block on that mutex while the GUI updates
+    // cues.
+    TrackPointer pTrack;
+    {
+        QMutexLocker lock(&m_trackMutex);
+        pTrack = m_pLoadedTrack;
+    }
+    if (!pTrack) {
         return;
     }
 
-    QSet<int> active_hotcues;
     CuePointer pMainCue;
     CuePointer pIntroCue;
     CuePointer pOutroCue;
 
-    const QList<CuePointer> cues = m_pLoadedTrack->getCuePoints();
+    const QList<CuePointer> cues = pTrack->getCuePoints();
+    auto pSnapshot = std::make_shared<CueSnapshot>();
+    pSnapshot->reserve(cues.size());
     for (const auto& pCue : cues) {
+        const Cue::StartAndEndPositions pos = pCue->getStartAndEndPosition();
+        pSnapshot->push_back(CueSnapshotEntry{pos.startPosition,
+                pos.endPosition,
+                pCue->getType(),
+                pCue->getHotCue()});
         switch (pCue->getType()) {
         case mixxx::CueType::MainCue:
             DEBUG_ASSERT(!pMainCue); // There should be only one MainCue cue
@@ -558,6 +576,28 @@ void CueControl::loadCuesFromTrack() {
             DEBUG_ASSERT(!pOutroCue); // There should be only one Outro cue
             pOutroCue = pCue;
             break;
+        default:
+            break;
+        }
+    }
+    std::sort(pSnapshot->begin(),
+            pSnapshot->end(),
+            [](const CueSnapshotEntry& lhs, const CueSnapshotEntry& rhs) {
+                return lhs.startPosition < rhs.startPosition;
+            });
+    std::atomic_store(&m_pCueSnapshot,
+            std::shared_ptr<const CueSnapshot>(std::move(pSnapshot)));
+
+    QMutexLocker lock(&m_trackMutex);
+    if (m_pLoadedTrack != pTrack) {
+        // The track was changed while scanning the cues; the snapshot and
+        // control updates will be redone by the pending trackLoaded() call.
+        return;
+    }
+
+    QSet<int> active_hotcues;
+    for (const auto& pCue : cues) {
+        switch (pCue->getType()) {
         case mixxx::CueType::HotCue:
         case mixxx::CueType::Loop: {
             if (pCue->getHotCue() == Cue::kNoHotCue) {
@@ -1122,15 +1162,48 @@ void CueControl::hintReader(HintVector* pHintList) {
         pHintList->append(cue_hint);
     }
 
-    // this is called from the engine thread
-    // it is no locking required, because m_hotcueControl is filled during the
-    // constructor and getPosition()->get() is a ControlObject
-    for (const auto& pControl : qAsConst(m_hotcueControls)) {
-        double position = pControl->getPosition();
-        if (position != Cue::kNoPosition) {
-            cue_hint.frame = SampleUtil::floorPlayPosToFrame(position);
+    // This is called from the engine thread. The snapshot is an immutable
+    // view of the track's cues, already sorted by position, so no locking
+    // is required here.
+    const std::shared_ptr<const CueSnapshot> pSnapshot = getCueSnapshot();
+    if (!pSnapshot) {
+        return;
+    }
+    for (const CueSnapshotEntry& entry : *pSnapshot) {
+        if (entry.startPosition == Cue::kNoPosition) {
+            continue;
+        }
+        // Hotcues are jump targets that must be audible immediately.
+        // The intro/outro cues delimit the AutoDJ transition regions;
+        // keeping them resident in the CachingReader avoids a cold
+        // start when AutoDJ seeks this deck to the intro and starts
+        // the crossfade.
+        if (entry.hotcueIndex == Cue::kNoHotCue &&
+                entry.type != mixxx::CueType::Intro &&
+                entry.type != mixxx::CueType::Outro) {
+            continue;
+        }
+        cue_hint.frame = SampleUtil::floorPlayPosToFrame(entry.startPosition);
+        cue_hint.frameCount = Hint::kFrameCountForward;
+        cue_hint.priority = 10;
+        pHintList->append(cue_hint);
+    }
+
+    // While a hotcue is previewed the engine seeks back to the cached
+    // previewing position as soon as the pad is released. Re-hint that
+    // region on every callback so its chunks stay pinned in the reader for
+    // the whole press/release cycle, even under cache pressure or if the
+    // cue itself is deleted during the preview. Without this the release
+    // seek of a pad drummed on a cold region intermittently hits an
+    // evicted chunk and produces silence.
+    const int previewingIndex = m_currentlyPreviewingIndex;
+    if (previewingIndex >= 0 && previewingIndex < m_iNumHotCues) {
+        HotcueControl* pControl = m_hotcueControls.at(previewingIndex);
+        const double previewingPosition = pControl->getPreviewingPosition();
+        if (previewingPosition != Cue::kNoPosition) {
+            cue_hint.frame = SampleUtil::floorPlayPosToFrame(previewingPosition);
             cue_hint.frameCount = Hint::kFrameCountForward;
-            cue_hint.priority = 10;
+            cue_hint.priority = 1;
             pHintList->append(cue_hint);
         }
     }
@@ -2158,12 +2231,23 @@ int CueControl::getHotcueFocusIndex() const {
 }
 
 ConfigKey HotcueControl::keyForControl(const QString& name) {
+    // Every deck and sampler instantiates the same hotcue item names, so
+    // each composed name is built once and afterwards shared between all
+    // groups through QString's implicit sharing. Only called from the
+    // main thread while the engine controls of a deck are created, so
+    // the cache needs no locking.
+    static QHash<QPair<int, QString>, QString> s_itemNames;
     ConfigKey key;
     key.group = m_group;
     // Add one to hotcue so that we don't have a hotcue_0
-    key.item = QStringLiteral("hotcue_") +
-            QString::number(hotcueIndexToHotcueNumber(m_hotcueIndex)) +
-            QChar('_') + name;
+    const int hotcueNumber = hotcueIndexToHotcueNumber(m_hotcueIndex);
+    QString& item = s_itemNames[qMakePair(hotcueNumber, name)];
+    if (item.isNull()) {
+        item = QStringLiteral("hotcue_") +
+                QString::number(hotcueNumber) +
+                QChar('_') + name;
+    }
+    key.item = item;
     return key;
 }
 
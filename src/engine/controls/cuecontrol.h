@@ -5,6 +5,9 @@
 #include <QList>
 #include <QMutex>
 
+#include <memory>
+#include <vector>
+
 #include "control/controlproxy.h"
 #include "engine/controls/enginecontrol.h"
 #include "preferences/colorpalettesettings.h"
@@ -185,6 +188,18 @@ class HotcueControl : public QObject {
     ControlValueAtomic<double> m_previewingPosition;
 };
 
+/// Immutable, position-sorted snapshot of the loaded track's cue points.
+/// Rebuilt by CueControl::loadCuesFromTrack() whenever the track's cues
+/// change and swapped in atomically, so the engine side can inspect cue
+/// positions without taking a mutex that the GUI contends on.
+struct CueSnapshotEntry {
+    double startPosition;
+    double endPosition;
+    mixxx::CueType type;
+    int hotcueIndex;
+};
+typedef std::vector<CueSnapshotEntry> CueSnapshot;
+
 class CueControl : public EngineControl {
     Q_OBJECT
   public:
@@ -203,6 +218,12 @@ class CueControl : public EngineControl {
     void trackLoaded(TrackPointer pNewTrack) override;
     void trackBeatsUpdated(mixxx::BeatsPointer pBeats) override;
 
+    /// Returns the current cue snapshot. Wait-free, safe to call from the
+    /// engine callback; may return nullptr if no track is loaded.
+    std::shared_ptr<const CueSnapshot> getCueSnapshot() const {
+        return std::atomic_load(&m_pCueSnapshot);
+    }
+
   public slots:
     void slotLoopReset();
     void slotLoopEnabledChanged(bool enabled);
@@ -355,5 +376,9 @@ class CueControl : public EngineControl {
 #endif
     TrackPointer m_pLoadedTrack; // is written from an engine worker thread
 
+    // Lock-free view of the loaded track's cues for the engine side,
+    // accessed with std::atomic_load/std::atomic_store.
+    std::shared_ptr<const CueSnapshot> m_pCueSnapshot;
+
     friend class HotcueControlTest;
 };
@@ -1,5 +1,6 @@
 #include "engine/controls/loopingcontrol.h"
 
+#include <QHash>
 #include <QtDebug>
 
 #include "control/controlobject.h"
@@ -18,11 +19,19 @@ double LoopingControl::s_dBeatSizes[] = { 0.03125, 0.0625, 0.125, 0.25, 0.5,
                                           1, 2, 4, 8, 16, 32, 64, 128, 256, 512 };
 
 // Used to generate the beatloop_%SIZE, beatjump_%SIZE, and loop_move_%SIZE CO
-// ConfigKeys.
+// ConfigKeys. The composed item names are identical for every deck and
+// sampler, so they are built once and shared across all groups through
+// QString's implicit sharing. Only called from the main thread while the
+// engine controls of a deck are created, so the cache needs no locking.
 ConfigKey keyForControl(const QString& group, const QString& ctrlName, double num) {
+    static QHash<QPair<QString, double>, QString> s_itemNames;
     ConfigKey key;
     key.group = group;
-    key.item = ctrlName.arg(num);
+    QString& item = s_itemNames[qMakePair(ctrlName, num)];
+    if (item.isNull()) {
+        item = ctrlName.arg(num);
+    }
+    key.item = item;
     return key;
 }
 
@@ -476,6 +485,33 @@ void LoopingControl::hintReader(HintVector* pHintList) {
             pHintList->append(loop_hint);
         }
     }
+
+    // Hint the quantized beatjump targets in both directions so that a
+    // beatjump press never reads from a cold region of the cache. The
+    // targets are speculative, so they get normal priority.
+    const mixxx::BeatsPointer pBeats = m_pBeats;
+    if (pBeats) {
+        const double currentSample = m_currentSample.getValue();
+        const double jumpBeats = m_pCOBeatJumpSize->get();
+        if (jumpBeats > 0) {
+            const double forwardTarget =
+                    pBeats->findNBeatsFromSample(currentSample, jumpBeats);
+            if (forwardTarget != currentSample && forwardTarget >= 0) {
+                loop_hint.priority = 10;
+                loop_hint.frame = SampleUtil::floorPlayPosToFrame(forwardTarget);
+                loop_hint.frameCount = Hint::kFrameCountForward;
+                pHintList->append(loop_hint);
+            }
+            const double backwardTarget =
+                    pBeats->findNBeatsFromSample(currentSample, -jumpBeats);
+            if (backwardTarget != currentSample && backwardTarget >= 0) {
+                loop_hint.priority = 10;
+                loop_hint.frame = SampleUtil::floorPlayPosToFrame(backwardTarget);
+                loop_hint.frameCount = Hint::kFrameCountForward;
+                pHintList->append(loop_hint);
+            }
+        }
+    }
 }
 
 double LoopingControl::getSyncPositionInsideLoop(double dRequestedPlaypos, double dSyncedPlayPos) {
@@ -541,7 +577,7 @@ void LoopingControl::setBeatLoop(double startPosition, bool enabled) {
 
     // TODO(XXX): This is not realtime safe. See this Zulip discussion for details:
     // https://mixxx.zulipchat.com/#narrow/stream/109171-development/topic/getting.20locks.20out.20of.20Beats
-    double endPosition = pBeats->findNBeatsFromSample(startPosition, beatloopSize);
+    double endPosition = findBeatLoopEndPoint(pBeats, startPosition, beatloopSize);
 
     setLoop(startPosition, endPosition, enabled);
 }
@@ -1013,6 +1049,8 @@ void LoopingControl::trackLoaded(TrackPointer pNewTrack) {
 
 void LoopingControl::trackBeatsUpdated(mixxx::BeatsPointer pBeats) {
     clearActiveBeatLoop();
+    // The cached end point was resolved against the old beat grid.
+    m_beatLoopEndPointCache.pBeats = nullptr;
     m_pBeats = pBeats;
     if (m_pBeats) {
         LoopSamples loopSamples = m_loopSamples.getValue();
@@ -1097,13 +1135,33 @@ bool LoopingControl::currentLoopMatchesBeatloopSize() {
     LoopSamples loopSamples = m_loopSamples.getValue();
 
     // Calculate where the loop out point would be if it is a beatloop
-    double beatLoopOutPoint =
-        pBeats->findNBeatsFromSample(loopSamples.start, m_pCOBeatLoopSize->get());
+    double beatLoopOutPoint = findBeatLoopEndPoint(
+            pBeats, loopSamples.start, m_pCOBeatLoopSize->get());
 
     return loopSamples.end > beatLoopOutPoint - 2 &&
             loopSamples.end < beatLoopOutPoint + 2;
 }
 
+double LoopingControl::findBeatLoopEndPoint(const mixxx::BeatsPointer& pBeats,
+        double startSample,
+        double beats) {
+    // The Beats objects are immutable, so the identity of the object
+    // together with the start position and loop size determines the end
+    // point. Beatloop rolls re-activate the same loop at a high rate and
+    // would otherwise repeat the same beat searches for every wrap.
+    if (m_beatLoopEndPointCache.pBeats == pBeats.get() &&
+            m_beatLoopEndPointCache.startSample == startSample &&
+            m_beatLoopEndPointCache.beats == beats) {
+        return m_beatLoopEndPointCache.endSample;
+    }
+    const double endSample = pBeats->findNBeatsFromSample(startSample, beats);
+    m_beatLoopEndPointCache.pBeats = pBeats.get();
+    m_beatLoopEndPointCache.startSample = startSample;
+    m_beatLoopEndPointCache.beats = beats;
+    m_beatLoopEndPointCache.endSample = endSample;
+    return endSample;
+}
+
 double LoopingControl::findBeatloopSizeForLoop(double start, double end) const {
     const mixxx::BeatsPointer pBeats = m_pBeats;
     if (!pBeats) {
@@ -1200,7 +1258,13 @@ void LoopingControl::slotBeatLoop(double beats, bool keepStartPoint, bool enable
             double beatLength = nextBeat - prevBeat;
             double loopLength = beatLength * beats;
 
-            double closestBeat = pBeats->findClosestBeat(currentSample);
+            // The closest beat follows from the prev/next pair we already
+            // looked up above; don't repeat the search.
+            double closestBeat = (nextBeat == -1)
+                    ? prevBeat
+                    : ((nextBeat - currentSample > currentSample - prevBeat)
+                                    ? prevBeat
+                                    : nextBeat);
             if (beats >= 1.0) {
                 newloopSamples.start = closestBeat;
             } else {
@@ -1239,7 +1303,7 @@ void LoopingControl::slotBeatLoop(double beats, bool keepStartPoint, bool enable
         }
     }
 
-    newloopSamples.end = pBeats->findNBeatsFromSample(newloopSamples.start, beats);
+    newloopSamples.end = findBeatLoopEndPoint(pBeats, newloopSamples.start, beats);
     if (newloopSamples.start >= newloopSamples.end // happens when the call above fails
             || newloopSamples.end > samples) { // Do not allow beat loops to go beyond the end of the track
         // If a track is loaded with beatloop_size larger than
@@ -42,7 +42,8 @@ class LoopingControl : public EngineControl {
                        double *pTarget);
 
     // hintReader will add to hintList hints both the loop in and loop out
-    // sample, if set.
+    // sample, if set, as well as the quantized beatjump targets in both
+    // directions so beatjumps do not read from cold cache regions.
     void hintReader(HintVector* pHintList) override;
     double getSyncPositionInsideLoop(double dRequestedPlaypos, double dSyncedPlayPos);
 
@@ -121,6 +122,14 @@ class LoopingControl : public EngineControl {
     // Given loop in and out points, determine if this is a beatloop of a particular
     // size.
     double findBeatloopSizeForLoop(double start, double end) const;
+    // Resolve the end point of a beatloop of the given size starting at
+    // startSample. The result is cached as a plain sample position keyed
+    // on the beat grid, start position and size, so repeated activations
+    // of the same loop (e.g. short beatloop rolls) do not redo the beat
+    // searches. The cache is invalidated in trackBeatsUpdated().
+    double findBeatLoopEndPoint(const mixxx::BeatsPointer& pBeats,
+            double startSample,
+            double beats);
     // When a loop changes size such that the playposition is outside of the loop,
     // we can figure out the best place in the new loop to seek to maintain
     // the beat.  It will even keep multi-bar phrasing correct with 4/4 tracks.
@@ -181,6 +190,16 @@ class LoopingControl : public EngineControl {
     ControlObject* m_pCOLoopMove;
     QList<LoopMoveControl*> m_loopMoves;
 
+    // Cached result of the last findBeatLoopEndPoint() lookup. Only
+    // touched from the engine callback.
+    struct BeatLoopEndPointCache {
+        const mixxx::Beats* pBeats{nullptr};
+        double startSample{0.0};
+        double beats{0.0};
+        double endSample{0.0};
+    };
+    BeatLoopEndPointCache m_beatLoopEndPointCache;
+
     // objects below are written from an engine worker thread
     TrackPointer m_pTrack;
     mixxx::BeatsPointer m_pBeats;
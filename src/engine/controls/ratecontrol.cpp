@@ -13,11 +13,16 @@
 #include "moc_ratecontrol.cpp"
 #include "util/math.h"
 #include "util/rotary.h"
+#include "util/time.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 
 namespace {
 constexpr int kRateSensitivityMin = 100;
 constexpr int kRateSensitivityMax = 2500;
+// Upper bound for the press-to-callback head start credited to a temp rate
+// button press. Covers a buffer period plus scheduling jitter; anything
+// longer indicates a stale timestamp.
+constexpr double kTempRateHeadStartMaxSeconds = 0.2;
 } // namespace
 
 // Static default values for rate buttons (percents)
@@ -124,15 +129,31 @@ RateControl::RateControl(const QString& group,
             this, &RateControl::slotControlRatePermUpSmall,
             Qt::DirectConnection);
 
-    // Temporary rate-change buttons
+    // Temporary rate-change buttons. The buttons themselves are polled from
+    // processTempRate(), but the press time is captured here on the setting
+    // thread so the first ramp buffer can credit the time that passed until
+    // the engine callback noticed the press.
     m_pButtonRateTempDown =
         new ControlPushButton(ConfigKey(group,"rate_temp_down"));
+    connect(m_pButtonRateTempDown, &ControlObject::valueChanged,
+            this, &RateControl::slotRateTempButtonPressed,
+            Qt::DirectConnection);
     m_pButtonRateTempDownSmall =
         new ControlPushButton(ConfigKey(group,"rate_temp_down_small"));
+    connect(m_pButtonRateTempDownSmall, &ControlObject::valueChanged,
+            this, &RateControl::slotRateTempButtonPressed,
+            Qt::DirectConnection);
     m_pButtonRateTempUp =
         new ControlPushButton(ConfigKey(group,"rate_temp_up"));
+    connect(m_pButtonRateTempUp, &ControlObject::valueChanged,
+            this, &RateControl::slotRateTempButtonPressed,
+            Qt::DirectConnection);
     m_pButtonRateTempUpSmall =
         new ControlPushButton(ConfigKey(group,"rate_temp_up_small"));
+    connect(m_pButtonRateTempUpSmall, &ControlObject::valueChanged,
+            this, &RateControl::slotRateTempButtonPressed,
+            Qt::DirectConnection);
+    m_tempPressTimeSeconds.setValue(0.0);
 
     // We need the sample rate so we can guesstimate something close
     // what latency is.
@@ -323,6 +344,15 @@ void RateControl::slotControlFastBack(double v) {
     }
 }
 
+void RateControl::slotRateTempButtonPressed(double v) {
+    if (v > 0) {
+        // Runs via a direct connection on the thread that set the button
+        // (the controller thread for MIDI/HID input), so this timestamp is
+        // not quantized to the GUI timer or the engine buffer period.
+        m_tempPressTimeSeconds.setValue(mixxx::Time::elapsed().toDoubleSeconds());
+    }
+}
+
 void RateControl::slotControlRatePermDown(double v) {
     // Adjusts temp rate down if button pressed
     if (v > 0.0) {
@@ -537,20 +567,35 @@ void RateControl::processTempRate(const int bufferSamples) {
             }
         } else if (m_eRateRampMode == RampMode::Linear) {
             if (rampDirection != RampDirection::None) {
+                double rampChange = m_dRateTempRampChange;
                 if (!m_bTempStarted) {
                     m_bTempStarted = true;
                     double latrate = ((double)bufferSamples / (double)m_pSampleRate->get());
                     m_dRateTempRampChange = (latrate / ((double)m_iRateRampSensitivity / 100.));
+                    rampChange = m_dRateTempRampChange;
+                    // Credit the time between the button press and this
+                    // callback, so the ramp does not lose up to a buffer
+                    // period depending on where within the period the press
+                    // happened.
+                    const double pressTime = m_tempPressTimeSeconds.getValue();
+                    if (pressTime > 0.0) {
+                        m_tempPressTimeSeconds.setValue(0.0);
+                        const double headStart = math_clamp(
+                                mixxx::Time::elapsed().toDoubleSeconds() - pressTime,
+                                0.0,
+                                kTempRateHeadStartMaxSeconds);
+                        rampChange += headStart / ((double)m_iRateRampSensitivity / 100.);
+                    }
                 }
 
                 switch (rampDirection) {
                 case RampDirection::Up:
                 case RampDirection::UpSmall:
-                    addRateTemp(m_dRateTempRampChange * m_pRateRange->get());
+                    addRateTemp(rampChange * m_pRateRange->get());
                     break;
                 case RampDirection::Down:
                 case RampDirection::DownSmall:
-                    subRateTemp(m_dRateTempRampChange * m_pRateRange->get());
+                    subRateTemp(rampChange * m_pRateRange->get());
                     break;
                 case RampDirection::None:
                 default:
@@ -79,6 +79,7 @@ public slots:
   void slotRateSliderChanged(double);
   void slotRateRatioChanged(double);
   void slotReverseRollActivate(double);
+  void slotRateTempButtonPressed(double);
   void slotControlRatePermDown(double);
   void slotControlRatePermDownSmall(double);
   void slotControlRatePermUp(double);
@@ -163,4 +164,7 @@ private:
   double m_tempRateRatio;
   // Speed for temporary rate change
   double m_dRateTempRampChange;
+  // Time (seconds since app start) a temp rate button was last pressed,
+  // captured on the pressing thread and consumed by processTempRate().
+  ControlValueAtomic<double> m_tempPressTimeSeconds;
 };
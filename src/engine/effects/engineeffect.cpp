@@ -2,6 +2,7 @@
 
 #include "engine/engine.h"
 #include "util/defs.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
 
 EngineEffect::EngineEffect(EffectManifestPointer pManifest,
@@ -10,7 +11,9 @@ EngineEffect::EngineEffect(EffectManifestPointer pManifest,
                            EffectInstantiatorPointer pInstantiator)
         : m_pManifest(pManifest),
           m_parameters(pManifest->parameters().size()),
-          m_pEffectsManager(pEffectsManager) {
+          m_pEffectsManager(pEffectsManager),
+          m_processingTimeNanos(0),
+          m_processedBuffers(0) {
     const QList<EffectManifestParameterPointer>& parameters = m_pManifest->parameters();
     for (int i = 0; i < parameters.size(); ++i) {
         EffectManifestParameterPointer param = parameters.at(i);
@@ -130,12 +133,45 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
             }
             pResponsePipe->writeMessage(response);
             return true;
+        case EffectsRequest::SET_PARAMETER_MODULATION:
+            if (kEffectDebugOutput) {
+                qDebug() << debugString() << "SET_PARAMETER_MODULATION"
+                         << "parameter" << message.SetParameterModulation.iParameter
+                         << "beatPeriod" << message.SetParameterModulation.beatPeriod
+                         << "depth" << message.SetParameterModulation.depth;
+            }
+            pParameter = m_parameters.value(
+                message.SetParameterModulation.iParameter, NULL);
+            if (pParameter) {
+                pParameter->setModulation(
+                        message.SetParameterModulation.beatPeriod,
+                        message.SetParameterModulation.depth);
+                response.success = true;
+            } else {
+                response.success = false;
+                response.status = EffectsResponse::NO_SUCH_PARAMETER;
+            }
+            pResponsePipe->writeMessage(response);
+            return true;
         default:
             break;
     }
     return false;
 }
 
+void EngineEffect::smoothParameters(const unsigned int bufferFrames,
+        const unsigned int sampleRate) {
+    for (EngineEffectParameter* pParameter : qAsConst(m_parameters)) {
+        pParameter->smooth(bufferFrames, sampleRate);
+    }
+}
+
+void EngineEffect::modulateParameters(double beatPosition) {
+    for (EngineEffectParameter* pParameter : qAsConst(m_parameters)) {
+        pParameter->modulate(beatPosition);
+    }
+}
+
 bool EngineEffect::process(const ChannelHandle& inputHandle,
                            const ChannelHandle& outputHandle,
                            const CSAMPLE* pInput, CSAMPLE* pOutput,
@@ -194,9 +230,14 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
               mixxx::audio::SampleRate(sampleRate),
               numSamples / mixxx::kEngineChannelCount);
 
+        PerformanceTimer processorTimer;
+        processorTimer.start();
         m_pProcessor->process(inputHandle, outputHandle, pInput, pOutput,
                               bufferParameters,
                               effectiveEffectEnableState, groupFeatures);
+        m_processingTimeNanos.fetch_add(processorTimer.elapsed().toIntegerNanos(),
+                std::memory_order_relaxed);
+        m_processedBuffers.fetch_add(1, std::memory_order_relaxed);
 
         processingOccured = true;
 
@@ -7,6 +7,8 @@
 #include <QSet>
 #include <QtDebug>
 
+#include <atomic>
+
 #include "effects/effectsmanager.h"
 #include "effects/effectmanifest.h"
 #include "effects/effectprocessor.h"
@@ -42,6 +44,17 @@ class EngineEffect : public EffectsRequestHandler {
         EffectsRequest& message,
         EffectsResponsePipe* pResponsePipe);
 
+    // Advances all parameters with a smoothing ramp configured in the
+    // manifest one block towards their target values. Called once per
+    // engine callback, before the effect processes any channel.
+    void smoothParameters(const unsigned int bufferFrames,
+            const unsigned int sampleRate);
+
+    // Applies the beat-synchronous parameter modulation for this block.
+    // beatPosition is the continuous position of the sync master in beats.
+    // Called once per engine callback, after smoothParameters().
+    void modulateParameters(double beatPosition);
+
     bool process(const ChannelHandle& inputHandle, const ChannelHandle& outputHandle,
                  const CSAMPLE* pInput, CSAMPLE* pOutput,
                  const unsigned int numSamples,
@@ -53,6 +66,17 @@ class EngineEffect : public EffectsRequestHandler {
         return m_pManifest;
     }
 
+    // Total CPU time spent in the effect processor and the number of buffers
+    // processed since construction. Monotonic counters written from the
+    // engine thread; safe to read from any thread. Readers diff successive
+    // snapshots to compute the recent per-buffer cost.
+    qint64 processingTimeNanos() const {
+        return m_processingTimeNanos.load(std::memory_order_relaxed);
+    }
+    qint64 processedBuffers() const {
+        return m_processedBuffers.load(std::memory_order_relaxed);
+    }
+
   private:
     QString debugString() const {
         return QString("EngineEffect(%1)").arg(m_pManifest->name());
@@ -68,5 +92,10 @@ class EngineEffect : public EffectsRequestHandler {
 
     const EffectsManager* m_pEffectsManager;
 
+    // Updated by process() on the engine thread, read by the GUI thread for
+    // the per-effect cost display.
+    std::atomic<qint64> m_processingTimeNanos;
+    std::atomic<qint64> m_processedBuffers;
+
     DISALLOW_COPY_AND_ASSIGN(EngineEffect);
 };
@@ -3,7 +3,9 @@
 #include <QString>
 #include <QVariant>
 
+#include "util/assert.h"
 #include "util/class.h"
+#include "util/math.h"
 #include "effects/effectmanifestparameter.h"
 
 class EngineEffectParameter {
@@ -20,6 +22,11 @@ class EngineEffectParameter {
         m_maximum = m_pParameter->getMaximum();
         m_defaultValue = m_pParameter->getDefault();
         m_value = m_defaultValue;
+        m_targetValue = m_defaultValue;
+        m_modulatedValue = m_defaultValue;
+        m_smoothingRampSeconds = m_pParameter->smoothingRampSeconds();
+        m_modulationBeatPeriod = 0.0;
+        m_modulationDepth = 0.0;
     }
     virtual ~EngineEffectParameter() { }
 
@@ -42,16 +49,69 @@ class EngineEffectParameter {
     ///////////////////////////////////////////////////////////////////////////
 
     inline double value() const {
-        return m_value;
+        return m_modulatedValue;
     }
     inline void setValue(const double value) {
-        m_value = value;
+        m_targetValue = value;
+        if (m_smoothingRampSeconds <= 0.0) {
+            // No smoothing configured in the manifest; the new value
+            // takes effect with the next buffer as before.
+            m_value = value;
+        }
+    }
+
+    // Advances the current value one block towards the target value.
+    // Called once per engine callback from the engine thread, so effects
+    // read a single, already interpolated coefficient per block through
+    // value() instead of smoothing per sample themselves.
+    void smooth(const unsigned int bufferFrames, const unsigned int sampleRate) {
+        if (m_value != m_targetValue && sampleRate != 0) {
+            DEBUG_ASSERT(m_smoothingRampSeconds > 0.0);
+            const double blockSeconds =
+                    static_cast<double>(bufferFrames) / sampleRate;
+            const double coefficient =
+                    1.0 - exp(-blockSeconds / m_smoothingRampSeconds);
+            m_value += coefficient * (m_targetValue - m_value);
+            // Snap to the target when the residual has become inaudible to
+            // guarantee that the target value is reached exactly.
+            if (fabs(m_targetValue - m_value) <=
+                    (m_maximum - m_minimum) * 1.0e-4) {
+                m_value = m_targetValue;
+            }
+        }
+        // The modulation, if any, is applied on top of the smoothed value
+        // by modulate() below.
+        m_modulatedValue = m_value;
+    }
+
+    // Configures a beat-synchronous LFO on top of the knob value.
+    // Called from the engine thread via SET_PARAMETER_MODULATION.
+    void setModulation(double beatPeriod, double depth) {
+        m_modulationBeatPeriod = beatPeriod;
+        m_modulationDepth = depth;
+    }
+
+    // Applies the beat-synchronous modulation for this block. beatPosition
+    // is the continuous position of the sync master in beats; the LFO phase
+    // is derived from it directly so it stays locked to the beat grid
+    // instead of drifting like a free-running oscillator would. Called once
+    // per engine callback, after smooth().
+    void modulate(double beatPosition) {
+        if (m_modulationBeatPeriod <= 0.0 || m_modulationDepth <= 0.0) {
+            return;
+        }
+        const double phase = beatPosition / m_modulationBeatPeriod;
+        const double lfo = sin((phase - floor(phase)) * 2.0 * M_PI);
+        m_modulatedValue = math_clamp(
+                m_value + 0.5 * m_modulationDepth * (m_maximum - m_minimum) * lfo,
+                m_minimum,
+                m_maximum);
     }
     inline int toInt() const {
-        return static_cast<int>(m_value);
+        return static_cast<int>(m_modulatedValue);
     }
     inline int toBool() const {
-        return m_value > 0.0;
+        return m_modulatedValue > 0.0;
     }
 
     inline double defaultValue() const {
@@ -78,6 +138,13 @@ class EngineEffectParameter {
   private:
     EffectManifestParameterPointer m_pParameter;
     double m_value;
+    double m_targetValue;
+    // The smoothed value with the beat-synchronous modulation applied;
+    // what the effect processors actually read through value().
+    double m_modulatedValue;
+    double m_smoothingRampSeconds;
+    double m_modulationBeatPeriod;
+    double m_modulationDepth;
     double m_defaultValue;
     double m_minimum;
     double m_maximum;
@@ -1,12 +1,9 @@
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
 #include "util/defs.h"
-#include "util/sample.h"
 
 EngineEffectRack::EngineEffectRack(int iRackNumber)
-        : m_iRackNumber(iRackNumber),
-          m_buffer1(MAX_BUFFER_LEN),
-          m_buffer2(MAX_BUFFER_LEN) {
+        : m_iRackNumber(iRackNumber) {
     // Try to prevent memory allocation.
     m_chains.reserve(256);
 }
@@ -64,32 +61,23 @@ bool EngineEffectRack::process(const ChannelHandle& inputHandle,
         }
     } else {
         // Do not modify the input buffer; only fill the output buffer.
+        // The first chain that processes writes its dry/wet mix directly
+        // into pOut, and subsequent chains process pOut in place like the
+        // branch above. EngineEffectChain::process overwrites every output
+        // sample after reading the corresponding input sample, so no
+        // intermediate buffer or final copy into pOut is required.
         CSAMPLE* pIntermediateInput = pIn;
-        CSAMPLE* pIntermediateOutput;
-
         for (EngineEffectChain* pChain : qAsConst(m_chains)) {
             if (pChain != nullptr) {
-                // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
-                } else {
-                    pIntermediateOutput = m_buffer1.data();
-                }
-
                 if (pChain->process(inputHandle, outputHandle,
-                                    pIntermediateInput, pIntermediateOutput,
+                                    pIntermediateInput, pOut,
                                     numSamples, sampleRate, groupFeatures)) {
                     processingOccured = true;
                     // Output of this chain becomes the input of the next chain.
-                    pIntermediateInput = pIntermediateOutput;
+                    pIntermediateInput = pOut;
                 }
             }
         }
-        // pIntermediateInput is the output of the last processed chain. It would be the
-        // intermediate input of the next chain if there was one.
-        if (processingOccured) {
-            SampleUtil::copy(pOut, pIntermediateInput, numSamples);
-        }
     }
     return processingOccured;
 }
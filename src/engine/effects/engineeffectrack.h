@@ -5,7 +5,6 @@
 #include "engine/channelhandle.h"
 #include "engine/effects/message.h"
 #include "engine/effects/groupfeaturestate.h"
-#include "util/samplebuffer.h"
 
 class EngineEffectChain;
 
@@ -41,8 +40,5 @@ class EngineEffectRack : public EffectsRequestHandler {
     int m_iRackNumber;
     QList<EngineEffectChain*> m_chains;
 
-    mixxx::SampleBuffer m_buffer1;
-    mixxx::SampleBuffer m_buffer2;
-
     DISALLOW_COPY_AND_ASSIGN(EngineEffectRack);
 };
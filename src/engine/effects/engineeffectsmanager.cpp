@@ -3,6 +3,7 @@
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffect.h"
+#include "engine/engine.h"
 
 #include "util/defs.h"
 #include "util/sample.h"
@@ -10,7 +11,9 @@
 EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe* pResponsePipe)
         : m_pResponsePipe(pResponsePipe),
           m_buffer1(MAX_BUFFER_LEN),
-          m_buffer2(MAX_BUFFER_LEN) {
+          m_buffer2(MAX_BUFFER_LEN),
+          m_beatCount(0.0),
+          m_lastBeatDistance(0.0) {
     // Try to prevent memory allocation.
     m_chains.reserve(256);
     m_effects.reserve(256);
@@ -19,7 +22,10 @@ EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe* pResponsePipe)
 EngineEffectsManager::~EngineEffectsManager() {
 }
 
-void EngineEffectsManager::onCallbackStart() {
+void EngineEffectsManager::onCallbackStart(const unsigned int sampleRate,
+        const unsigned int bufferSize,
+        const double masterBpm,
+        const double masterBeatDistance) {
     EffectsRequest* request = nullptr;
     while (m_pResponsePipe->readMessage(&request)) {
         EffectsResponse response(*request);
@@ -91,6 +97,7 @@ void EngineEffectsManager::onCallbackStart() {
                 break;
             case EffectsRequest::SET_EFFECT_PARAMETERS:
             case EffectsRequest::SET_PARAMETER_PARAMETERS:
+            case EffectsRequest::SET_PARAMETER_MODULATION:
                 VERIFY_OR_DEBUG_ASSERT(m_effects.contains(request->pTargetEffect)) {
                     response.success = false;
                     response.status = EffectsResponse::NO_SUCH_EFFECT;
@@ -117,6 +124,29 @@ void EngineEffectsManager::onCallbackStart() {
             m_pResponsePipe->writeMessage(response);
         }
     }
+
+    // With the new target values from the messages above in place, advance
+    // the parameter smoothing of all effects by one block. This happens
+    // once per callback, not once per processed channel, so every channel
+    // sees the same interpolated parameter values.
+    const unsigned int bufferFrames = bufferSize / mixxx::kEngineChannelCount;
+    for (EngineEffect* pEffect : qAsConst(m_effects)) {
+        pEffect->smoothParameters(bufferFrames, sampleRate);
+    }
+
+    // Advance the beat-synchronous parameter modulation. The beat distance
+    // alone only covers a single beat, so count its wrap-arounds to get a
+    // continuous beat position that multi-beat LFO periods can lock onto.
+    if (masterBpm > 0.0) {
+        if (masterBeatDistance < m_lastBeatDistance) {
+            m_beatCount += 1.0;
+        }
+        m_lastBeatDistance = masterBeatDistance;
+        const double beatPosition = m_beatCount + masterBeatDistance;
+        for (EngineEffect* pEffect : qAsConst(m_effects)) {
+            pEffect->modulateParameters(beatPosition);
+        }
+    }
 }
 
 void EngineEffectsManager::processPreFaderInPlace(const ChannelHandle& inputHandle,
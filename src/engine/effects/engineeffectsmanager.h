@@ -18,7 +18,14 @@ class EngineEffectsManager : public EffectsRequestHandler {
     EngineEffectsManager(EffectsResponsePipe* pResponsePipe);
     virtual ~EngineEffectsManager();
 
-    void onCallbackStart();
+    // Called once at the top of every engine callback. masterBpm and
+    // masterBeatDistance describe the current sync master (EngineSync) and
+    // drive the beat-synchronous parameter modulation; a BPM of 0 disables
+    // it for this block.
+    void onCallbackStart(const unsigned int sampleRate,
+            const unsigned int bufferSize,
+            const double masterBpm,
+            const double masterBeatDistance);
 
     // Take a buffer of numSamples samples of audio from a channel, provided as
     // pInput, and apply each EffectChain enabled for this channel to it,
@@ -89,4 +96,12 @@ class EngineEffectsManager : public EffectsRequestHandler {
 
     mixxx::SampleBuffer m_buffer1;
     mixxx::SampleBuffer m_buffer2;
+
+    // Continuous beat position of the sync master, used as the phase
+    // reference for beat-synchronous parameter modulation. The integer part
+    // counts beats since the first callback, the fractional part is the
+    // master beat distance, so multi-beat LFO periods stay phase-locked
+    // across beat boundaries.
+    double m_beatCount;
+    double m_lastBeatDistance;
 };
@@ -35,6 +35,7 @@ struct EffectsRequest {
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
         SET_PARAMETER_PARAMETERS,
+        SET_PARAMETER_MODULATION,
 
         // Must come last.
         NUM_REQUEST_TYPES
@@ -62,6 +63,7 @@ struct EffectsRequest {
         CLEAR_STRUCT(SetEffectChainParameters);
         CLEAR_STRUCT(SetEffectParameters);
         CLEAR_STRUCT(SetParameterParameters);
+        CLEAR_STRUCT(SetParameterModulation);
 #undef CLEAR_STRUCT
     }
 
@@ -144,6 +146,15 @@ struct EffectsRequest {
         struct {
             int iParameter;
         } SetParameterParameters;
+        struct {
+            int iParameter;
+            // LFO period in beats of the sync master, <= 0 disables the
+            // modulation.
+            double beatPeriod;
+            // Peak deviation from the knob value as a fraction (0.0 to 1.0)
+            // of the parameter range.
+            double depth;
+        } SetParameterModulation;
     };
 
     // Used by SET_EFFECT_PARAMETER.
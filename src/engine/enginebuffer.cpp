@@ -8,6 +8,7 @@
 #include "control/controlproxy.h"
 #include "control/controlpushbutton.h"
 #include "engine/bufferscalers/enginebufferscalelinear.h"
+#include "engine/bufferscalers/enginebufferscalepolyphase.h"
 #include "engine/bufferscalers/enginebufferscalerubberband.h"
 #include "engine/bufferscalers/enginebufferscalest.h"
 #include "engine/cachingreader/cachingreader.h"
@@ -55,6 +56,9 @@ constexpr SINT kSamplesPerFrame = 2; // Engine buffer uses Stereo frames only
 // Rate at which the playpos slider is updated
 constexpr int kPlaypositionUpdateRate = 15; // updates per second
 
+// Capacity of the scheduled control action queue. Must be a power of 2.
+constexpr int kScheduledActionFifoSize = 32;
+
 } // anonymous namespace
 
 EngineBuffer::EngineBuffer(const QString& group,
@@ -72,6 +76,9 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_pReadAheadManager(nullptr),
           m_pReader(nullptr),
           m_filepos_play(kInitalSamplePosition),
+          m_scheduledActionFifo(kScheduledActionFifoSize),
+          m_scheduledActionsLastPlaypos(kInitalSamplePosition),
+          m_iScheduledActionsClear(0),
           m_speed_old(0),
           m_tempo_ratio_old(1.),
           m_scratching_old(false),
@@ -84,6 +91,7 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_dSlipPosition(0.),
           m_dSlipRate(1.0),
           m_bSlipEnabledProcessing(false),
+          m_iLastBufferUnderruns(0),
           m_pRepeat(nullptr),
           m_startButton(nullptr),
           m_endButton(nullptr),
@@ -98,6 +106,7 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_bCrossfadeReady(false),
           m_iLastBufferSize(0) {
     m_queuedSeek.setValue(kNoQueuedSeek);
+    m_pendingScheduledActions.reserve(kScheduledActionFifoSize);
 
     // zero out crossfade buffer
     SampleUtil::clear(m_pCrossfadeBuffer, MAX_BUFFER_LEN);
@@ -175,6 +184,9 @@ EngineBuffer::EngineBuffer(const QString& group,
     m_pTrackSamples = new ControlObject(ConfigKey(m_group, "track_samples"));
     m_pTrackSampleRate = new ControlObject(ConfigKey(m_group, "track_samplerate"));
 
+    m_pBufferUnderruns = new ControlObject(ConfigKey(m_group, "buffer_underruns"));
+    m_pBufferUnderruns->setReadOnly();
+
     m_pKeylock = new ControlPushButton(ConfigKey(m_group, "keylock"), true);
     m_pKeylock->setButtonMode(ControlPushButton::TOGGLE);
 
@@ -259,6 +271,14 @@ EngineBuffer::EngineBuffer(const QString& group,
 
     // Construct scaling objects
     m_pScaleLinear = new EngineBufferScaleLinear(m_pReadAheadManager);
+    // Primary decks get the polyphase windowed-sinc scaler for transparent
+    // sample rate conversion; preview decks and samplers automatically stay
+    // on the cheaper linear path.
+    if (pChannel->isPrimaryDeck()) {
+        m_pScalePolyphase = new EngineBufferScalePolyphase(m_pReadAheadManager);
+    } else {
+        m_pScalePolyphase = nullptr;
+    }
     m_pScaleST = new EngineBufferScaleST(m_pReadAheadManager);
     m_pScaleRB = new EngineBufferScaleRubberBand(m_pReadAheadManager);
     if (m_pKeylockEngine->get() == SOUNDTOUCH) {
@@ -312,8 +332,10 @@ EngineBuffer::~EngineBuffer() {
     delete m_pTrackLoaded;
     delete m_pTrackSamples;
     delete m_pTrackSampleRate;
+    delete m_pBufferUnderruns;
 
     delete m_pScaleLinear;
+    delete m_pScalePolyphase;
     delete m_pScaleST;
     delete m_pScaleRB;
 
@@ -327,6 +349,7 @@ EngineBuffer::~EngineBuffer() {
 
 void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
     m_pReader->setScheduler(pWorkerScheduler);
+    m_pScaleRB->bindWorker(pWorkerScheduler);
 }
 
 void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
@@ -398,6 +421,63 @@ void EngineBuffer::queueNewPlaypos(double newpos, enum SeekRequest seekType) {
     m_queuedSeek.setValue({newpos, seekType});
 }
 
+bool EngineBuffer::scheduleControlAction(
+        double position, ControlObject* pControl, double value) {
+    VERIFY_OR_DEBUG_ASSERT(pControl) {
+        return false;
+    }
+    ScheduledControlAction action = {position, pControl, value};
+    return m_scheduledActionFifo.write(&action, 1) == 1;
+}
+
+void EngineBuffer::processScheduledActions() {
+    if (m_iScheduledActionsClear.fetchAndStoreAcquire(0)) {
+        m_pendingScheduledActions.clear();
+        // Also discard actions still sitting in the FIFO: they were
+        // scheduled against the track that has since been unloaded.
+        ScheduledControlAction discarded;
+        while (m_scheduledActionFifo.read(&discarded, 1) == 1) {
+        }
+    }
+
+    // Collect newly scheduled actions. The pending list is preallocated
+    // to the FIFO capacity, so this does not allocate.
+    ScheduledControlAction action;
+    while (m_scheduledActionFifo.read(&action, 1) == 1) {
+        if (m_pendingScheduledActions.size() <
+                m_pendingScheduledActions.capacity()) {
+            m_pendingScheduledActions.push_back(action);
+        }
+    }
+
+    if (m_pendingScheduledActions.empty()) {
+        m_scheduledActionsLastPlaypos = m_filepos_play;
+        return;
+    }
+
+    const double prevPosition = m_scheduledActionsLastPlaypos;
+    const double currentPosition = m_filepos_play;
+    m_scheduledActionsLastPlaypos = currentPosition;
+    if (prevPosition == kInitalSamplePosition) {
+        // Don't fire actions against the artificial pre-seek position.
+        return;
+    }
+
+    for (auto it = m_pendingScheduledActions.begin();
+            it != m_pendingScheduledActions.end();) {
+        // Fire when the playposition has reached or crossed the scheduled
+        // position during this callback, regardless of the playback
+        // direction. A seek across the position counts as a crossing.
+        if ((prevPosition <= it->position && it->position <= currentPosition) ||
+                (currentPosition <= it->position && it->position <= prevPosition)) {
+            it->pControl->set(it->value);
+            it = m_pendingScheduledActions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void EngineBuffer::requestSyncPhase() {
     // Don't overwrite m_iSeekQueued
     m_iSeekPhaseQueued = 1;
@@ -460,7 +540,25 @@ void EngineBuffer::readToCrossfadeBuffer(const int iBufferSize) {
 }
 
 void EngineBuffer::seekCloneBuffer(EngineBuffer* pOtherBuffer) {
-    doSeekPlayPos(pOtherBuffer->getExactPlayPos(), SEEK_EXACT);
+    const double playPos = pOtherBuffer->getExactPlayPos();
+
+    // Each deck has its own chunk cache, so a clone cannot reuse the chunks
+    // that the source deck has already decoded. Wake the reader for the
+    // region around the cloned play position with top priority before the
+    // seek is executed, so the worker starts decoding it while this callback
+    // is still running. The backward window matters for the instant-double
+    // workflow where the clone is immediately scratched against the source.
+    Hint hint;
+    hint.frame = SampleUtil::floorPlayPosToFrame(playPos);
+    hint.priority = 1;
+    m_hintList.clear();
+    hint.frameCount = Hint::kFrameCountForward;
+    m_hintList.append(hint);
+    hint.frameCount = Hint::kFrameCountBackward;
+    m_hintList.append(hint);
+    m_pReader->hintAndMaybeWake(m_hintList);
+
+    doSeekPlayPos(playPos, SEEK_EXACT);
 }
 
 // WARNING: This method is not thread safe and must not be called from outside
@@ -546,6 +644,8 @@ void EngineBuffer::slotTrackLoaded(TrackPointer pTrack,
 
     m_visualPlayPos->setInvalid();
     m_filepos_play = kInitalSamplePosition; // for execute seeks to 0.0
+    m_scheduledActionsLastPlaypos = kInitalSamplePosition;
+    m_iScheduledActionsClear = 1;
     m_pCurrentTrack = pTrack;
     m_pTrackSamples->set(iTrackNumSamples);
     m_pTrackSampleRate->set(iTrackSampleRate);
@@ -586,10 +686,11 @@ void EngineBuffer::ejectTrack() {
     TrackPointer pOldTrack = m_pCurrentTrack;
     m_pause.lock();
 
-    m_visualPlayPos->set(0.0, 0.0, 0.0, 0.0, 0.0);
+    m_visualPlayPos->set(0.0, 0.0, 0.0, 0.0, 0.0, 0);
     doSeekPlayPos(0.0, SEEK_EXACT);
 
     m_pCurrentTrack.reset();
+    m_iScheduledActionsClear = 1;
     m_pTrackSamples->set(0);
     m_pTrackSampleRate->set(0);
     m_pTrackLoaded->forceSet(0);
@@ -887,6 +988,20 @@ void EngineBuffer::processTrackLocked(
         }
     }
 
+    // Select the scaler for the vinyl (non-keylock) path. Primary decks use
+    // the polyphase scaler for clean sample rate conversion during ordinary
+    // forward playback; scratching, reverse playback and ramps through zero
+    // are handed back to the linear scaler which is built for them. The
+    // switch is picked up by enableIndependentPitchTempoScaling() below,
+    // which crossfades between the scalers.
+    if (m_pScalePolyphase && !m_bScalerOverride) {
+        if (is_scratching || is_reverse || speed < 0.0 || m_speed_old < 0.0) {
+            m_pScaleVinyl = m_pScaleLinear;
+        } else {
+            m_pScaleVinyl = m_pScalePolyphase;
+        }
+    }
+
     if (speed != 0.0) {
         // Do not switch scaler when we have no transport
         enableIndependentPitchTempoScaling(useIndependentPitchAndTempoScaling,
@@ -1066,6 +1181,14 @@ void EngineBuffer::processTrackLocked(
         }
     }
 
+    // Publish reader cache misses, which are concealed by the
+    // ReadAheadManager but should still be visible per deck.
+    const int underruns = m_pReadAheadManager->underrunCount();
+    if (underruns != m_iLastBufferUnderruns) {
+        m_iLastBufferUnderruns = underruns;
+        m_pBufferUnderruns->forceSet(underruns);
+    }
+
     for (const auto& pControl: qAsConst(m_engineControls)) {
         pControl->setCurrentSample(m_filepos_play, m_trackSamplesOld, m_trackSampleRateOld);
         pControl->process(rate, m_filepos_play, iBufferSize);
@@ -1121,6 +1244,9 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
     // We do this even if rubberband is not active.
     const auto sampleRate = mixxx::audio::SampleRate(m_iSampleRate);
     m_pScaleLinear->setSampleRate(sampleRate);
+    if (m_pScalePolyphase) {
+        m_pScalePolyphase->setSampleRate(sampleRate);
+    }
     m_pScaleST->setSampleRate(sampleRate);
     m_pScaleRB->setSampleRate(sampleRate);
 
@@ -1153,6 +1279,10 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
         m_scratching_old = false;
     }
 
+    // Execute control actions whose scheduled position was reached or
+    // crossed while producing this buffer.
+    processScheduledActions();
+
 #ifdef __SCALER_DEBUG__
     for (int i=0; i<iBufferSize; i+=2) {
         writer << pOutput[i] << "\n";
@@ -1346,14 +1476,29 @@ void EngineBuffer::updateIndicators(double speed, int iBufferSize) {
                     kPlaypositionUpdateRate)) {
         m_playposSlider->set(fFractionalPlaypos);
         m_pCueControl->updateIndicators();
-    }
+        // Restart the interval. Without this the update above would fire on
+        // every engine callback once the first interval has elapsed, fanning
+        // out queued control updates to the GUI thread at callback rate.
+        m_iSamplesSinceLastIndicatorUpdate = 0;
+    }
+
+    // The duration of the buffer just processed, derived from the actual
+    // callback buffer size and output sample rate. The waveform render
+    // thread scales its extrapolation to the next display frame with this
+    // instead of the configured latency, which may differ from the real
+    // device period.
+    const double sampleRate = m_pSampleRate->get();
+    const int audioBufferMicros = sampleRate > 0
+            ? static_cast<int>(1000000.0 * iBufferSize / kSamplesPerFrame / sampleRate)
+            : 0;
 
     // Update visual control object, this needs to be done more often than the
     // playpos slider
     m_visualPlayPos->set(fFractionalPlaypos, speed * m_baserate_old,
             (double)iBufferSize / m_trackSamplesOld,
             fractionalPlayposFromAbsolute(m_dSlipPosition),
-            tempoTrackSeconds);
+            tempoTrackSeconds,
+            audioBufferMicros);
 
     // TODO: Especially with long audio buffers, jitter is visible. This can be fixed by moving the
     // ClockControl::updateIndicators into the waveform update loop which is synced with the display refresh rate.
@@ -5,6 +5,7 @@
 #include <QAtomicInt>
 #include <QMutex>
 #include <cfloat>
+#include <vector>
 
 #include "control/controlvalue.h"
 #include "engine/cachingreader/cachingreader.h"
@@ -12,6 +13,7 @@
 #include "engine/sync/syncable.h"
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
+#include "util/fifo.h"
 #include "util/rotary.h"
 #include "util/types.h"
 
@@ -41,6 +43,7 @@ class ControlTTRotary;
 class ControlPotmeter;
 class EngineBufferScale;
 class EngineBufferScaleLinear;
+class EngineBufferScalePolyphase;
 class EngineBufferScaleST;
 class EngineBufferScaleRubberBand;
 class EngineSync;
@@ -110,6 +113,15 @@ class EngineBuffer : public EngineObject {
 
     // Queues a new seek position. Use SEEK_EXACT or SEEK_STANDARD as seekType
     void queueNewPlaypos(double newpos, enum SeekRequest seekType);
+
+    /// Schedule pControl->set(value) to be executed inside process() in
+    /// the callback during which the playposition reaches or crosses
+    /// position (in track samples). This avoids the latency of firing
+    /// actions from a GUI timer; the action lands within one audio buffer
+    /// of the requested position. Scheduled actions are dropped when a
+    /// new track is loaded. Returns false if the queue is full. May be
+    /// called from a single producer thread at a time.
+    bool scheduleControlAction(double position, ControlObject* pControl, double value);
     void requestSyncPhase();
     void requestEnableSync(bool enabled);
     void requestSyncMode(SyncMode mode);
@@ -229,6 +241,7 @@ class EngineBuffer : public EngineObject {
 
     void processSyncRequests();
     void processSeek(bool paused);
+    void processScheduledActions();
 
     bool updateIndicatorsAndModifyPlay(bool newPlay, bool oldPlay);
     void verifyPlay();
@@ -282,6 +295,22 @@ class EngineBuffer : public EngineObject {
     // The current sample to play in the file.
     double m_filepos_play;
 
+    // Control actions scheduled at an exact track sample position,
+    // passed from the producer thread to the callback via a FIFO and
+    // executed by processScheduledActions().
+    struct ScheduledControlAction {
+        double position;
+        ControlObject* pControl;
+        double value;
+    };
+    FIFO<ScheduledControlAction> m_scheduledActionFifo;
+    // Actions awaiting their position; only touched in the callback.
+    std::vector<ScheduledControlAction> m_pendingScheduledActions;
+    // Playposition of the previous processScheduledActions() call.
+    double m_scheduledActionsLastPlaypos;
+    // Set to request dropping all scheduled actions (e.g. on track load).
+    QAtomicInt m_iScheduledActionsClear;
+
     // The previous callback's speed. Used to check if the scaler parameters
     // need updating.
     double m_speed_old;
@@ -327,6 +356,10 @@ class EngineBuffer : public EngineObject {
 
     ControlObject* m_pTrackSamples;
     ControlObject* m_pTrackSampleRate;
+    // Number of reader cache misses encountered while scaling, mirrored from
+    // the ReadAheadManager so under-runs are visible per deck.
+    ControlObject* m_pBufferUnderruns;
+    int m_iLastBufferUnderruns;
 
     ControlPushButton* m_playButton;
     ControlPushButton* m_playStartButton;
@@ -375,6 +408,10 @@ class EngineBuffer : public EngineObject {
 
     // Object used for vinyl-style interpolation scaling of the audio
     EngineBufferScaleLinear* m_pScaleLinear;
+    // Polyphase windowed-sinc scaler for transparent sample rate conversion
+    // during forward playback. Only constructed for primary decks; preview
+    // decks and samplers stay on the cheaper linear code path.
+    EngineBufferScalePolyphase* m_pScalePolyphase;
     // Objects used for pitch-indep time stretch (key lock) scaling of the audio
     EngineBufferScaleST* m_pScaleST;
     EngineBufferScaleRubberBand* m_pScaleRB;
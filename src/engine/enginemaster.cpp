@@ -15,6 +15,7 @@
 #include "engine/enginebuffer.h"
 #include "engine/enginedelay.h"
 #include "engine/enginetalkoverducking.h"
+#include "engine/enginetimingmonitor.h"
 #include "engine/enginevumeter.h"
 #include "engine/engineworkerscheduler.h"
 #include "engine/enginexfader.h"
@@ -24,6 +25,7 @@
 #include "moc_enginemaster.cpp"
 #include "preferences/usersettings.h"
 #include "util/defs.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
 #include "util/timer.h"
 #include "util/trace.h"
@@ -77,6 +79,9 @@ EngineMaster::EngineMaster(
     m_pAudioLatencyUsage = new ControlPotmeter(ConfigKey(group, "audio_latency_usage"), 0.0, 0.25);
     m_pAudioLatencyOverload  = new ControlPotmeter(ConfigKey(group, "audio_latency_overload"), 0.0, 1.0);
 
+    // Per-section callback timing percentiles
+    m_pTimingMonitor = new EngineTimingMonitor(group);
+
     // Master sync controller
     m_pMasterSync = new EngineSync(pConfig);
 
@@ -224,6 +229,7 @@ EngineMaster::~EngineMaster() {
     delete m_pAudioLatencyOverloadCount;
     delete m_pAudioLatencyUsage;
     delete m_pAudioLatencyOverload;
+    delete m_pTimingMonitor;
 
     delete m_pMasterEnabled;
     delete m_pBoothEnabled;
@@ -286,12 +292,30 @@ void EngineMaster::processChannels(int iBufferSize) {
     // should be processed first
     m_activeChannels.append(NULL);
     int activeChannelsStartIndex = 1; // Nothing at 0 yet
-    for (int i = 0; i < m_channels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_channels[i];
+
+    // Rebuild the compact scan set if any channel flagged an event since the
+    // last callback that may have changed its activation state. This keeps
+    // the per-callback loop proportional to the number of channels actually
+    // in use instead of the number of configured slots.
+    if (m_channelActivationDirty.fetchAndStoreAcquire(0)) {
+        m_scanChannels.clear();
+        for (ChannelInfo* pChannelInfo : m_channels) {
+            EngineChannel* pChannel = pChannelInfo->m_pChannel;
+            if (pChannel && pChannel->isActive()) {
+                m_scanChannels.append(pChannelInfo);
+            }
+        }
+    }
+
+    for (int i = 0; i < m_scanChannels.size(); ++i) {
+        ChannelInfo* pChannelInfo = m_scanChannels[i];
         EngineChannel* pChannel = pChannelInfo->m_pChannel;
 
-        // Skip inactive channels.
-        if (!pChannel || !pChannel->isActive()) {
+        // A channel may go inactive without flagging an event (e.g. end of a
+        // passthrough fadeout). Re-check here and request a rebuild so it is
+        // dropped from the scan set on the next callback.
+        if (!pChannel->isActive()) {
+            m_channelActivationDirty.storeRelease(1);
             continue;
         }
 
@@ -303,14 +327,14 @@ void EngineMaster::processChannels(int iBufferSize) {
             m_activeTalkoverChannels.append(pChannelInfo);
 
             // Check if we need to fade out the master channel
-            GainCache& gainCache = m_channelMasterGainCache[i];
+            GainCache& gainCache = m_channelMasterGainCache[pChannelInfo->m_index];
             if (gainCache.m_gain != 0) {
                 gainCache.m_fadeout = true;
                 m_activeBusChannels[pChannel->getOrientation()].append(pChannelInfo);
             }
         } else {
             // Check if we need to fade out the channel
-            GainCache& gainCache = m_channelTalkoverGainCache[i];
+            GainCache& gainCache = m_channelTalkoverGainCache[pChannelInfo->m_index];
             if (gainCache.m_gain != 0) {
                 gainCache.m_fadeout = true;
                 m_activeTalkoverChannels.append(pChannelInfo);
@@ -321,7 +345,7 @@ void EngineMaster::processChannels(int iBufferSize) {
                 m_activeBusChannels[pChannel->getOrientation()].append(pChannelInfo);
             } else {
                 // Check if we need to fade out the channel
-                GainCache& gainCache = m_channelMasterGainCache[i];
+                GainCache& gainCache = m_channelMasterGainCache[pChannelInfo->m_index];
                 if (gainCache.m_gain != 0) {
                     gainCache.m_fadeout = true;
                     m_activeBusChannels[pChannel->getOrientation()].append(pChannelInfo);
@@ -335,9 +359,9 @@ void EngineMaster::processChannels(int iBufferSize) {
             m_activeHeadphoneChannels.append(pChannelInfo);
         } else {
             // Check if we need to fade out the channel
-            GainCache& gainCache = m_channelHeadphoneGainCache[i];
+            GainCache& gainCache = m_channelHeadphoneGainCache[pChannelInfo->m_index];
             if (gainCache.m_gain != 0) {
-                m_channelHeadphoneGainCache[i].m_fadeout = true;
+                gainCache.m_fadeout = true;
                 m_activeHeadphoneChannels.append(pChannelInfo);
             }
         }
@@ -387,7 +411,14 @@ void EngineMaster::process(const int iBufferSize) {
         QThread::currentThread()->setObjectName("Engine");
         haveSetName = true;
     }
-    //Trace t("EngineMaster::process");
+    // No-op unless the stats manager is running (--developer), in which
+    // case the span shows up on the recorded timeline.
+    Trace t("EngineMaster::process");
+
+    PerformanceTimer callbackTimer;
+    callbackTimer.start();
+    PerformanceTimer sectionTimer;
+    sectionTimer.start();
 
     bool masterEnabled = m_pMasterEnabled->toBool();
     bool boothEnabled = m_pBoothEnabled->toBool();
@@ -400,11 +431,16 @@ void EngineMaster::process(const int iBufferSize) {
     const unsigned int iFrames = iBufferSize / kChannels;
 
     if (m_pEngineEffectsManager) {
-        m_pEngineEffectsManager->onCallbackStart();
+        m_pEngineEffectsManager->onCallbackStart(m_iSampleRate,
+                m_iBufferSize,
+                m_pMasterSync->masterBpm(),
+                m_pMasterSync->masterBeatDistance());
     }
 
     // Prepare all channels for output
     processChannels(m_iBufferSize);
+    m_pTimingMonitor->recordSectionTime(
+            EngineTimingMonitor::SECTION_CHANNELS, sectionTimer.restart());
 
     // Compute headphone mix
     // Head phone left/right mix
@@ -490,13 +526,18 @@ void EngineMaster::process(const int iBufferSize) {
         break;
     }
 
-    // Calculate the crossfader gains for left and right side of the crossfader
+    // Calculate the crossfader gains for left and right side of the
+    // crossfader from the precomputed curve table. The table is only
+    // rebuilt when the mixer profile parameters change, so the common
+    // case is a table lookup without transcendental math.
     CSAMPLE_GAIN crossfaderLeftGain, crossfaderRightGain;
-    EngineXfader::getXfadeGains(m_pCrossfader->get(), m_pXFaderCurve->get(),
-                                m_pXFaderCalibration->get(),
-                                m_pXFaderMode->get(),
-                                m_pXFaderReverse->toBool(),
-                                &crossfaderLeftGain, &crossfaderRightGain);
+    m_xfaderGainTable.update(m_pXFaderCurve->get(),
+            m_pXFaderCalibration->get(),
+            m_pXFaderMode->get());
+    m_xfaderGainTable.getGains(m_pCrossfader->get(),
+            m_pXFaderReverse->toBool(),
+            &crossfaderLeftGain,
+            &crossfaderRightGain);
 
     // Make the mix for each crossfader orientation output bus.
     // m_masterGain takes care of applying the attenuation from
@@ -535,6 +576,9 @@ void EngineMaster::process(const int iBufferSize) {
             m_iBufferSize, m_iSampleRate, busFeatures);
     }
 
+    m_pTimingMonitor->recordSectionTime(
+            EngineTimingMonitor::SECTION_MIXING, sectionTimer.restart());
+
     if (masterEnabled) {
         // Mix the crossfader orientation buffers together into the master mix
         SampleUtil::copy3WithGain(m_pMaster,
@@ -547,140 +591,116 @@ void EngineMaster::process(const int iBufferSize) {
             static_cast<int>(m_pMicMonitorMode->get()));
 
         // Process master, booth, and record/broadcast buffers according to the
-        // MicMonitorMode configured in DlgPrefSound
+        // MicMonitorMode configured in DlgPrefSound. The modes only differ in
+        // how talkover and the booth tap are routed around the master gain
+        // stage, so those routing decisions are made up front and the mix is
+        // executed as one straight-line sequence of fused mixing passes
+        // instead of duplicating the whole signal flow per mode.
         // TODO(Be): make SampleUtil ramping functions update the old gain variable
-        if (configuredMicMonitorMode == MicMonitorMode::MASTER) {
-            // Process master channel effects
-            // TODO(Be): Move this after mixing in talkover. To apply master effects
-            // to both the master and booth in that case will require refactoring
-            // the effects system to be able to process the same effects on multiple
-            // buffers within the same callback.
-            applyMasterEffects();
-
-            if (headphoneEnabled) {
-                processHeadphones(masterMixGainInHeadphones);
-            }
-
-            // Copy master mix to booth output with booth gain before mixing
-            // talkover with master mix
-            if (boothEnabled) {
-                CSAMPLE_GAIN boothGain = static_cast<CSAMPLE_GAIN>(m_pBoothGain->get());
-                SampleUtil::copyWithRampingGain(m_pBooth, m_pMaster,
-                                                m_boothGainOld, boothGain,
-                                                m_iBufferSize);
-                m_boothGainOld = boothGain;
-            }
-
-            // Mix talkover into master mix
-            if (m_pNumMicsConfigured->get() > 0) {
-                SampleUtil::add(m_pMaster, m_pTalkover, m_iBufferSize);
-            }
-
-            // Apply master gain
-            CSAMPLE_GAIN master_gain = static_cast<CSAMPLE_GAIN>(m_pMasterGain->get());
-            SampleUtil::applyRampingGain(m_pMaster, m_masterGainOld,
-                                         master_gain, m_iBufferSize);
-            m_masterGainOld = master_gain;
-
-            // Record/broadcast signal is the same as the master output
-            if (sidechainMixRequired()) {
-                SampleUtil::copy(m_pSidechainMix, m_pMaster, m_iBufferSize);
-            }
-        } else if (configuredMicMonitorMode == MicMonitorMode::MASTER_AND_BOOTH) {
-            // Process master channel effects
-            // TODO(Be): Move this after mixing in talkover. For the MASTER only
-            // MicMonitorMode above, that will require refactoring the effects system
-            // to be able to process the same effects on different buffers
-            // within the same callback. For consistency between the MicMonitorModes,
-            // process master effects here before mixing in talkover.
-            applyMasterEffects();
-
-            if (headphoneEnabled) {
-                processHeadphones(masterMixGainInHeadphones);
-            }
-
-            // Mix talkover with master
-            if (m_pNumMicsConfigured->get() > 0) {
-                SampleUtil::add(m_pMaster, m_pTalkover, m_iBufferSize);
-            }
 
-            // Copy master mix (with talkover mixed in) to booth output with booth gain
-            if (boothEnabled) {
-                CSAMPLE_GAIN boothGain = static_cast<CSAMPLE_GAIN>(m_pBoothGain->get());
-                SampleUtil::copyWithRampingGain(m_pBooth, m_pMaster,
-                                                m_boothGainOld, boothGain,
-                                                m_iBufferSize);
-                m_boothGainOld = boothGain;
-            }
+        // Skip mixing talkover with the master and booth outputs
+        // if using direct monitoring because it is being mixed in hardware
+        // without the latency of sending the signal into Mixxx for processing.
+        // However, include the talkover mix in the record/broadcast signal.
+        const bool mixTalkoverIntoMaster =
+                configuredMicMonitorMode != MicMonitorMode::DIRECT_MONITOR &&
+                m_pNumMicsConfigured->get() > 0;
+
+        if (configuredMicMonitorMode == MicMonitorMode::DIRECT_MONITOR &&
+                boothEnabled) {
+            // Copy master mix to booth output with booth gain. With direct
+            // monitoring the booth output is tapped before the master channel
+            // effects are processed.
+            CSAMPLE_GAIN boothGain = static_cast<CSAMPLE_GAIN>(m_pBoothGain->get());
+            SampleUtil::copyWithRampingGain(m_pBooth, m_pMaster,
+                                            m_boothGainOld, boothGain,
+                                            m_iBufferSize);
+            m_boothGainOld = boothGain;
+        }
 
-            // Apply master gain
-            CSAMPLE_GAIN master_gain = static_cast<CSAMPLE_GAIN>(m_pMasterGain->get());
-            SampleUtil::applyRampingGain(m_pMaster, m_masterGainOld,
-                                         master_gain, m_iBufferSize);
-            m_masterGainOld = master_gain;
+        // Process master channel effects
+        // TODO(Be): Move this after mixing in talkover. To apply master effects
+        // to both the master and booth in the MASTER MicMonitorMode will
+        // require refactoring the effects system to be able to process the
+        // same effects on multiple buffers within the same callback.
+        // NOTE(Be): For the record/broadcast signal this must occur before
+        // mixing in talkover so the record/broadcast signal is the same as
+        // what is heard on the master & booth outputs.
+        applyMasterEffects();
+
+        if (headphoneEnabled) {
+            processHeadphones(masterMixGainInHeadphones);
+        }
 
-            // Record/broadcast signal is the same as the master output
-            if (sidechainMixRequired()) {
-                SampleUtil::copy(m_pSidechainMix, m_pMaster, m_iBufferSize);
-            }
-        } else if (configuredMicMonitorMode == MicMonitorMode::DIRECT_MONITOR) {
-            // Skip mixing talkover with the master and booth outputs
-            // if using direct monitoring because it is being mixed in hardware
-            // without the latency of sending the signal into Mixxx for processing.
-            // However, include the talkover mix in the record/broadcast signal.
-
-            // Copy master mix to booth output with booth gain
-            if (boothEnabled) {
-                CSAMPLE_GAIN boothGain = static_cast<CSAMPLE_GAIN>(m_pBoothGain->get());
+        if (configuredMicMonitorMode != MicMonitorMode::DIRECT_MONITOR &&
+                boothEnabled) {
+            CSAMPLE_GAIN boothGain = static_cast<CSAMPLE_GAIN>(m_pBoothGain->get());
+            if (mixTalkoverIntoMaster &&
+                    configuredMicMonitorMode == MicMonitorMode::MASTER_AND_BOOTH) {
+                // The booth output monitors the master mix with talkover
+                // mixed in. Talkover is not mixed into m_pMaster until the
+                // master gain stage below, so gather both buffers into the
+                // booth buffer in a single pass.
+                SampleUtil::copy2WithRampingGain(m_pBooth,
+                        m_pMaster, m_boothGainOld, boothGain,
+                        m_pTalkover, m_boothGainOld, boothGain,
+                        m_iBufferSize);
+            } else {
+                // Copy master mix to booth output with booth gain before
+                // talkover is mixed into the master mix
                 SampleUtil::copyWithRampingGain(m_pBooth, m_pMaster,
                                                 m_boothGainOld, boothGain,
                                                 m_iBufferSize);
-                m_boothGainOld = boothGain;
-            }
-
-            // Process master channel effects
-            // NOTE(Be): This should occur before mixing in talkover for the
-            // record/broadcast signal so the record/broadcast signal is the same
-            // as what is heard on the master & booth outputs.
-            applyMasterEffects();
-
-            if (headphoneEnabled) {
-                processHeadphones(masterMixGainInHeadphones);
             }
+            m_boothGainOld = boothGain;
+        }
 
-            // Apply master gain
-            CSAMPLE_GAIN master_gain = static_cast<CSAMPLE_GAIN>(m_pMasterGain->get());
+        // Mix talkover into the master mix and apply master gain. Both steps
+        // touch every sample of the master buffer, so they are fused into a
+        // single pass when talkover is present.
+        CSAMPLE_GAIN master_gain = static_cast<CSAMPLE_GAIN>(m_pMasterGain->get());
+        if (mixTalkoverIntoMaster) {
+            SampleUtil::addAndApplyRampingGain(m_pMaster, m_pTalkover,
+                                               m_masterGainOld, master_gain,
+                                               m_iBufferSize);
+        } else {
             SampleUtil::applyRampingGain(m_pMaster, m_masterGainOld,
                                          master_gain, m_iBufferSize);
-            m_masterGainOld = master_gain;
-            if (sidechainMixRequired()) {
-                SampleUtil::copy(m_pSidechainMix, m_pMaster, m_iBufferSize);
-
-                if (m_pNumMicsConfigured->get() > 0) {
-                    // The talkover signal Mixxx receives is delayed by the round trip latency.
-                    // There is an output latency between the time Mixxx processes the audio
-                    // and the user hears it. So if the microphone user plays on beat with
-                    // what they hear, they will be playing out of sync with the engine's
-                    // processing by the output latency. Additionally, Mixxx gets input signals
-                    // delayed by the input latency. By the time Mixxx receives the input signal,
-                    // a full round trip through the signal chain has elapsed since Mixxx
-                    // processed the output signal.
-                    // Although Mixxx receives the input signal delayed, the user hears it mixed
-                    // in hardware with the master & booth outputs without that
-                    // latency, so to record/broadcast the same signal that is heard
-                    // on the master & booth outputs, the master mix must be delayed before
-                    // mixing the talkover signal for the record/broadcast mix.
-                    // If not using microphone inputs or recording/broadcasting from
-                    // a sound card input, skip unnecessary processing here.
-
-                    // Copy the master mix to a separate buffer before delaying it
-                    // to avoid delaying the master output.
-                    m_pLatencyCompensationDelay->process(m_pSidechainMix, m_iBufferSize);
-                    SampleUtil::add(m_pSidechainMix, m_pTalkover, m_iBufferSize);
-                }
+        }
+        m_masterGainOld = master_gain;
+
+        // Record/broadcast signal is the same as the master output
+        if (sidechainMixRequired()) {
+            SampleUtil::copy(m_pSidechainMix, m_pMaster, m_iBufferSize);
+
+            if (configuredMicMonitorMode == MicMonitorMode::DIRECT_MONITOR &&
+                    m_pNumMicsConfigured->get() > 0) {
+                // The talkover signal Mixxx receives is delayed by the round trip latency.
+                // There is an output latency between the time Mixxx processes the audio
+                // and the user hears it. So if the microphone user plays on beat with
+                // what they hear, they will be playing out of sync with the engine's
+                // processing by the output latency. Additionally, Mixxx gets input signals
+                // delayed by the input latency. By the time Mixxx receives the input signal,
+                // a full round trip through the signal chain has elapsed since Mixxx
+                // processed the output signal.
+                // Although Mixxx receives the input signal delayed, the user hears it mixed
+                // in hardware with the master & booth outputs without that
+                // latency, so to record/broadcast the same signal that is heard
+                // on the master & booth outputs, the master mix must be delayed before
+                // mixing the talkover signal for the record/broadcast mix.
+                // If not using microphone inputs or recording/broadcasting from
+                // a sound card input, skip unnecessary processing here.
+
+                // Copy the master mix to a separate buffer before delaying it
+                // to avoid delaying the master output.
+                m_pLatencyCompensationDelay->process(m_pSidechainMix, m_iBufferSize);
+                SampleUtil::add(m_pSidechainMix, m_pTalkover, m_iBufferSize);
             }
         }
 
+        m_pTimingMonitor->recordSectionTime(
+                EngineTimingMonitor::SECTION_EFFECTS, sectionTimer.restart());
+
         // Submit buffer to the side chain to do CPU intensive non-realtime
         // tasks like recording. The SoundDeviceNetwork, responsible for
         // passing samples to the network reads directly from m_pSidechainMix,
@@ -716,18 +736,29 @@ void EngineMaster::process(const int iBufferSize) {
             balright += bal;
         }
 
-        // Perform balancing on main out
-        SampleUtil::applyRampingAlternatingGain(m_pMaster, balleft, balright,
-                m_balleftOld, m_balrightOld, iBufferSize);
+        // Perform balancing on main out. The VU meter needs to be fed here so
+        // that master balance and talkover is reflected in it, so both are
+        // computed in a single pass over the master buffer.
+        if (m_pVumeter != nullptr) {
+            CSAMPLE volSumL, volSumR;
+            SampleUtil::CLIP_STATUS clipped =
+                    SampleUtil::applyRampingAlternatingGainAndSumAbsPerChannel(
+                            m_pMaster,
+                            balleft,
+                            balright,
+                            m_balleftOld,
+                            m_balrightOld,
+                            &volSumL,
+                            &volSumR,
+                            iBufferSize);
+            m_pVumeter->processMeasured(volSumL, volSumR, clipped, m_iBufferSize);
+        } else {
+            SampleUtil::applyRampingAlternatingGain(m_pMaster, balleft, balright,
+                    m_balleftOld, m_balrightOld, iBufferSize);
+        }
 
         m_balleftOld = balleft;
         m_balrightOld = balright;
-
-        // Update VU meter (it does not return anything). Needs to be here so that
-        // master balance and talkover is reflected in the VU meter.
-        if (m_pVumeter != nullptr) {
-            m_pVumeter->process(m_pMaster, m_iBufferSize);
-        }
     }
 
     if (m_pMasterMonoMixdown->toBool()) {
@@ -746,6 +777,10 @@ void EngineMaster::process(const int iBufferSize) {
         m_pBoothDelay->process(m_pBooth, m_iBufferSize);
     }
 
+    m_pTimingMonitor->recordSectionTime(
+            EngineTimingMonitor::SECTION_OUTPUT, sectionTimer.restart());
+    m_pTimingMonitor->recordCallbackTime(callbackTimer.elapsed());
+
     // We're close to the end of the callback. Wake up the engine worker
     // scheduler so that it runs the workers.
     m_pWorkerScheduler->runWorkers();
@@ -793,6 +828,7 @@ void EngineMaster::processHeadphones(const CSAMPLE_GAIN masterMixGainInHeadphone
 void EngineMaster::addChannel(EngineChannel* pChannel) {
     ChannelInfo* pChannelInfo = new ChannelInfo(m_channels.size());
     pChannel->setChannelIndex(pChannelInfo->m_index);
+    pChannel->setActiveStateDirtyFlag(&m_channelActivationDirty);
     pChannelInfo->m_pChannel = pChannel;
     const QString& group = pChannel->getGroup();
     pChannelInfo->m_handle = m_pChannelHandleFactory->getOrCreateHandle(group);
@@ -815,6 +851,7 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     // callback. QVarLengthArray does nothing if reserve is called with a size
     // smaller than its pre-allocation.
     m_activeChannels.reserve(m_channels.size());
+    m_scanChannels.reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::LEFT].reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::CENTER].reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::RIGHT].reserve(m_channels.size());
@@ -825,6 +862,9 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     if (pBuffer != nullptr) {
         pBuffer->bindWorkers(m_pWorkerScheduler);
     }
+
+    // Make sure the new channel is considered on the next callback.
+    m_channelActivationDirty.storeRelease(1);
 }
 
 EngineChannel* EngineMaster::getChannel(const QString& group) {
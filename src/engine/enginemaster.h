@@ -7,6 +7,7 @@
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
 #include "engine/engineobject.h"
+#include "engine/enginexfader.h"
 #include "engine/channels/enginechannel.h"
 #include "engine/channelhandle.h"
 #include "soundio/soundmanager.h"
@@ -28,6 +29,7 @@ class SyncWorker;
 class GuiTick;
 class EngineSync;
 class EngineTalkoverDucking;
+class EngineTimingMonitor;
 class EngineDelay;
 
 // The number of channels to pre-allocate in various structures in the
@@ -271,6 +273,14 @@ class EngineMaster : public QObject, public AudioSource {
     // List of channels added to the engine.
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_channels;
 
+    // Compact subset of m_channels that was active the last time a channel
+    // flagged an activation change. processChannels() only scans this set so
+    // that unused sampler and preview deck slots do not cost anything in the
+    // callback. Rebuilt from m_channels whenever m_channelActivationDirty is
+    // set; channels set the flag via EngineChannel::markActiveStateDirty().
+    QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_scanChannels;
+    QAtomicInt m_channelActivationDirty;
+
     // The previous gain of each channel for each mixing output (master,
     // headphone, talkover).
     QVarLengthArray<GainCache, kPreallocatedChannels> m_channelMasterGainCache;
@@ -307,6 +317,7 @@ class EngineMaster : public QObject, public AudioSource {
     ControlObject* m_pNumMicsConfigured;
     ControlPotmeter* m_pAudioLatencyUsage;
     ControlPotmeter* m_pAudioLatencyOverload;
+    EngineTimingMonitor* m_pTimingMonitor;
     EngineTalkoverDucking* m_pTalkoverDucking;
     EngineDelay* m_pMasterDelay;
     EngineDelay* m_pHeadDelay;
@@ -323,6 +334,7 @@ class EngineMaster : public QObject, public AudioSource {
     ControlPotmeter* m_pXFaderCurve;
     ControlPotmeter* m_pXFaderCalibration;
     ControlPushButton* m_pXFaderReverse;
+    EngineXfaderGainTable m_xfaderGainTable;
     ControlPushButton* m_pHeadSplitEnabled;
     ControlObject* m_pKeylockEngine;
 
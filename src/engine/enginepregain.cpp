@@ -30,6 +30,8 @@ EnginePregain::EnginePregain(const QString& group)
           m_dNonScratchSpeed(1.0),
           m_scratching(false),
           m_fPrevGain(1.0),
+          m_prevGainInputs{},
+          m_gainSettled(false),
           m_bSmoothFade(false) {
     m_pPotmeterPregain = new ControlAudioTaperPot(ConfigKey(group, "pregain"), -12, 12, 0.5);
     //Replay Gain things
@@ -67,9 +69,40 @@ void EnginePregain::setSpeedAndScratching(double speed, bool scratching) {
 }
 
 void EnginePregain::process(CSAMPLE* pInOut, const int iBufferSize) {
-    const auto fReplayGain = static_cast<CSAMPLE_GAIN>(m_pCOReplayGain->get());
+    // Fetch every gain input exactly once per buffer.
+    const GainInputs gainInputs = {
+            m_pCOReplayGain->get(),
+            m_pPotmeterPregain->get(),
+            s_pReplayGainBoost->get(),
+            s_pDefaultBoost->get(),
+            s_pEnableReplayGain->toBool(),
+            m_pPassthroughEnabled->toBool(),
+    };
+
+    // Settled fast path: if all inputs are unchanged since the previous
+    // buffer, no fade is in progress and the speed is steady, the gain
+    // computed below would come out as m_fPrevGain again. Skip the whole
+    // state machine and apply the cached steady gain. With several decks
+    // and samplers this stage runs once per channel per callback and this
+    // path covers almost every invocation.
+    if (m_gainSettled &&
+            !m_bSmoothFade &&
+            !m_scratching &&
+            m_dSpeed == m_dOldSpeed &&
+            gainInputs.replayGain == m_prevGainInputs.replayGain &&
+            gainInputs.pregain == m_prevGainInputs.pregain &&
+            gainInputs.replayGainBoost == m_prevGainInputs.replayGainBoost &&
+            gainInputs.defaultBoost == m_prevGainInputs.defaultBoost &&
+            gainInputs.replayGainEnabled == m_prevGainInputs.replayGainEnabled &&
+            gainInputs.passthroughEnabled == m_prevGainInputs.passthroughEnabled) {
+        // SampleUtil deals with aliased buffers and gains of 1 or 0.
+        SampleUtil::applyGain(pInOut, m_fPrevGain, iBufferSize);
+        return;
+    }
+
+    const auto fReplayGain = static_cast<CSAMPLE_GAIN>(gainInputs.replayGain);
     CSAMPLE_GAIN fReplayGainCorrection;
-    if (!s_pEnableReplayGain->toBool() || m_pPassthroughEnabled->toBool()) {
+    if (!gainInputs.replayGainEnabled || gainInputs.passthroughEnabled) {
         // Override replaygain value if passing through
         // TODO(XXX): consider a good default.
         // Do we expect an replaygain leveled input or
@@ -77,7 +110,7 @@ void EnginePregain::process(CSAMPLE* pInOut, const int iBufferSize) {
         fReplayGainCorrection = 1; // We expect a replaygain leveled input
     } else if (fReplayGain == 0) {
         // use predicted replaygain
-        fReplayGainCorrection = (float)s_pDefaultBoost->get();
+        fReplayGainCorrection = static_cast<float>(gainInputs.defaultBoost);
         // We prepare for smoothfading to ReplayGain suggested gain
         // if ReplayGain value changes or ReplayGain is enabled
         m_bSmoothFade = true;
@@ -91,7 +124,7 @@ void EnginePregain::process(CSAMPLE* pInOut, const int iBufferSize) {
         // So we need to alter gain each time ::process is called.
 
         const float fullReplayGainBoost =
-                fReplayGain * static_cast<float>(s_pReplayGainBoost->get());
+                fReplayGain * static_cast<float>(gainInputs.replayGainBoost);
 
         // This means that a ReplayGain value has been calculated after the
         // track has been loaded
@@ -117,7 +150,7 @@ void EnginePregain::process(CSAMPLE* pInOut, const int iBufferSize) {
     // Clamp gain to within [0, 10.0] to prevent insane gains. This can happen
     // (some corrupt files get really high replay gain values).
     // 10 allows a maximum replay Gain Boost * calculated replay gain of ~2
-    CSAMPLE_GAIN totalGain = (CSAMPLE_GAIN)m_pPotmeterPregain->get() *
+    CSAMPLE_GAIN totalGain = static_cast<CSAMPLE_GAIN>(gainInputs.pregain) *
             math_clamp(fReplayGainCorrection, 0.0f, 10.0f);
 
     m_pTotalGain->set(totalGain);
@@ -160,6 +193,8 @@ void EnginePregain::process(CSAMPLE* pInOut, const int iBufferSize) {
         SampleUtil::applyGain(pInOut, totalGain, iBufferSize);
     }
     m_fPrevGain = totalGain;
+    m_prevGainInputs = gainInputs;
+    m_gainSettled = true;
 }
 
 void EnginePregain::collectFeatures(GroupFeatureState* pGroupFeatures) const {
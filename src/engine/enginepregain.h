@@ -28,11 +28,26 @@ class EnginePregain : public EngineObject {
     void collectFeatures(GroupFeatureState* pGroupFeatures) const override;
 
   private:
+    // Inputs of the most recently computed total gain. While they are all
+    // unchanged and no fade is in progress the gain is settled, and
+    // process() skips the whole gain-state machine and applies the cached
+    // steady gain directly.
+    struct GainInputs {
+        double replayGain;
+        double pregain;
+        double replayGainBoost;
+        double defaultBoost;
+        bool replayGainEnabled;
+        bool passthroughEnabled;
+    };
+
     double m_dSpeed;
     double m_dOldSpeed;
     double m_dNonScratchSpeed;
     bool m_scratching;
     CSAMPLE_GAIN m_fPrevGain;
+    GainInputs m_prevGainInputs;
+    bool m_gainSettled;
     ControlAudioTaperPot* m_pPotmeterPregain;
     ControlObject* m_pTotalGain;
     ControlObject* m_pCOReplayGain;
@@ -0,0 +1,103 @@
+#include "engine/enginetimingmonitor.h"
+
+#include "control/controlobject.h"
+#include "util/assert.h"
+
+namespace {
+
+// Publish interval in callbacks. At a typical 23 ms callback period the
+// controls update about every 6 seconds, which also gives the p99 a
+// reasonable sample count to work with.
+constexpr int kPublishIntervalCallbacks = 256;
+
+const char* kSectionNames[EngineTimingMonitor::NUM_SECTIONS] = {
+        "channels",
+        "mixing",
+        "effects",
+        "output",
+        "callback",
+};
+
+} // namespace
+
+EngineTimingMonitor::EngineTimingMonitor(const QString& group)
+        : m_callbacksUntilPublish(kPublishIntervalCallbacks) {
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        SectionHistogram& histogram = m_histograms[section];
+        for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+            histogram.buckets[bucket] = 0;
+        }
+        histogram.numSamples = 0;
+        const QString name = QString("timing_%1").arg(kSectionNames[section]);
+        histogram.pPercentile50 = new ControlObject(
+                ConfigKey(group, name + "_p50_us"), true, true);
+        histogram.pPercentile99 = new ControlObject(
+                ConfigKey(group, name + "_p99_us"), true, true);
+    }
+}
+
+EngineTimingMonitor::~EngineTimingMonitor() {
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        delete m_histograms[section].pPercentile50;
+        delete m_histograms[section].pPercentile99;
+    }
+}
+
+// static
+int EngineTimingMonitor::bucketIndex(qint64 microseconds) {
+    int index = 0;
+    while (microseconds > 1 && index < kNumBuckets - 1) {
+        microseconds >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+void EngineTimingMonitor::recordSectionTime(
+        Section section, mixxx::Duration elapsed) {
+    DEBUG_ASSERT(section >= 0 && section < NUM_SECTIONS);
+    SectionHistogram& histogram = m_histograms[section];
+    ++histogram.buckets[bucketIndex(elapsed.toIntegerMicros())];
+    ++histogram.numSamples;
+}
+
+void EngineTimingMonitor::recordCallbackTime(mixxx::Duration elapsed) {
+    recordSectionTime(SECTION_CALLBACK, elapsed);
+    if (--m_callbacksUntilPublish <= 0) {
+        publishPercentiles();
+        m_callbacksUntilPublish = kPublishIntervalCallbacks;
+    }
+}
+
+// static
+double EngineTimingMonitor::percentileUpperEdgeUs(
+        const SectionHistogram& histogram, double percentile) {
+    const int rank = static_cast<int>(percentile * histogram.numSamples);
+    int cumulativeCount = 0;
+    for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+        cumulativeCount += histogram.buckets[bucket];
+        if (cumulativeCount > rank) {
+            return static_cast<double>(qint64(1) << (bucket + 1));
+        }
+    }
+    return static_cast<double>(qint64(1) << kNumBuckets);
+}
+
+void EngineTimingMonitor::publishPercentiles() {
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        SectionHistogram& histogram = m_histograms[section];
+        if (histogram.numSamples == 0) {
+            continue;
+        }
+        histogram.pPercentile50->set(
+                percentileUpperEdgeUs(histogram, 0.50));
+        histogram.pPercentile99->set(
+                percentileUpperEdgeUs(histogram, 0.99));
+        // Start a fresh window so the controls track recent behavior
+        // instead of averaging over the whole session.
+        for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+            histogram.buckets[bucket] = 0;
+        }
+        histogram.numSamples = 0;
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "util/duration.h"
+#include "util/types.h"
+
+class ControlObject;
+
+// Collects per-section timings of EngineMaster::process() into fixed
+// power-of-two bucket histograms and periodically publishes the observed
+// 50th and 99th percentile durations (in microseconds) as ControlObjects:
+//
+//   [Master],timing_<section>_p50_us
+//   [Master],timing_<section>_p99_us
+//
+// for the sections "channels" (per-channel processing including the
+// buffer scalers), "mixing" (headphone/talkover mixes and the crossfader
+// orientation busses), "effects" (master effects), "output" (sidechain,
+// balance, vu meter and output delays) and "callback" (the whole
+// process() call). Skins and controller scripts can read these controls
+// to pin down which part of the engine caused an xrun.
+//
+// All methods are called from the engine callback only; recording a
+// sample is a single array increment, the percentile calculation runs
+// once per publish interval.
+class EngineTimingMonitor {
+  public:
+    enum Section {
+        SECTION_CHANNELS = 0,
+        SECTION_MIXING,
+        SECTION_EFFECTS,
+        SECTION_OUTPUT,
+        SECTION_CALLBACK,
+        NUM_SECTIONS,
+    };
+
+    explicit EngineTimingMonitor(const QString& group);
+    ~EngineTimingMonitor();
+
+    // Add one measured duration to the histogram of the given section.
+    void recordSectionTime(Section section, mixxx::Duration elapsed);
+
+    // Finish one callback: records the total duration and publishes the
+    // percentiles once enough callbacks have been collected.
+    void recordCallbackTime(mixxx::Duration elapsed);
+
+  private:
+    // Buckets cover [2^i, 2^(i+1)) microseconds; the last bucket
+    // collects everything above. 2^20 us is roughly one second, far
+    // beyond any survivable callback time.
+    static constexpr int kNumBuckets = 21;
+
+    static int bucketIndex(qint64 microseconds);
+
+    void publishPercentiles();
+
+    struct SectionHistogram {
+        int buckets[kNumBuckets];
+        int numSamples;
+        ControlObject* pPercentile50;
+        ControlObject* pPercentile99;
+    };
+
+    // Upper bucket edge (in microseconds) of the given percentile.
+    static double percentileUpperEdgeUs(
+            const SectionHistogram& histogram, double percentile);
+
+    SectionHistogram m_histograms[NUM_SECTIONS];
+    int m_callbacksUntilPublish;
+};
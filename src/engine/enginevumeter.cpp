@@ -56,12 +56,17 @@ EngineVuMeter::~EngineVuMeter()
 void EngineVuMeter::process(CSAMPLE* pIn, const int iBufferSize) {
     CSAMPLE fVolSumL, fVolSumR;
 
-    int sampleRate = (int)m_pSampleRate->get();
-
     SampleUtil::CLIP_STATUS clipped = SampleUtil::sumAbsPerChannel(&fVolSumL,
             &fVolSumR, pIn, iBufferSize);
-    m_fRMSvolumeSumL += fVolSumL;
-    m_fRMSvolumeSumR += fVolSumR;
+    processMeasured(fVolSumL, fVolSumR, clipped, iBufferSize);
+}
+
+void EngineVuMeter::processMeasured(CSAMPLE volSumL, CSAMPLE volSumR,
+        SampleUtil::CLIP_STATUS clipped, const int iBufferSize) {
+    int sampleRate = (int)m_pSampleRate->get();
+
+    m_fRMSvolumeSumL += volSumL;
+    m_fRMSvolumeSumR += volSumR;
 
     m_iSamplesCalculated += iBufferSize / 2;
 
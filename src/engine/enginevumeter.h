@@ -1,6 +1,7 @@
 #pragma once
 
 #include "engine/engineobject.h"
+#include "util/sample.h"
 
 class ControlPotmeter;
 class ControlProxy;
@@ -13,6 +14,13 @@ class EngineVuMeter : public EngineObject {
 
     virtual void process(CSAMPLE* pInOut, const int iBufferSize);
 
+    // Updates the meters from per-channel absolute value sums and clip
+    // status measured elsewhere, when the caller has already traversed the
+    // buffer anyway (e.g. while applying the master balance) and the
+    // buffer does not need to be scanned a second time.
+    void processMeasured(CSAMPLE volSumL, CSAMPLE volSumR,
+            SampleUtil::CLIP_STATUS clipped, const int iBufferSize);
+
     void reset();
 
   private:
@@ -3,8 +3,9 @@
 #include "engine/engineworkerscheduler.h"
 #include "moc_engineworker.cpp"
 
-EngineWorker::EngineWorker()
-    : m_pScheduler(nullptr) {
+EngineWorker::EngineWorker(Priority priority)
+    : m_priority(priority),
+      m_pScheduler(nullptr) {
     m_notReady.test_and_set();
 }
 
@@ -15,11 +15,25 @@ class EngineWorkerScheduler;
 class EngineWorker : public QThread {
     Q_OBJECT
   public:
-    EngineWorker();
+    // Wake-up tier of a worker. Workers that produce audio the engine
+    // will consume within the next few callbacks (e.g. chunk decodes)
+    // must never wait behind bookkeeping or encoding work, so the
+    // scheduler wakes ready workers in descending priority order.
+    enum Priority {
+        PRIORITY_LOW = 0,
+        PRIORITY_NORMAL,
+        PRIORITY_HIGH,
+    };
+
+    explicit EngineWorker(Priority priority = PRIORITY_NORMAL);
     virtual ~EngineWorker();
 
     virtual void run();
 
+    Priority workPriority() const {
+        return m_priority;
+    }
+
     void setScheduler(EngineWorkerScheduler* pScheduler);
     void workReady();
     void wakeIfReady();
@@ -28,6 +42,7 @@ class EngineWorker : public QThread {
     QSemaphore m_semaRun;
 
   private:
+    const Priority m_priority;
     EngineWorkerScheduler* m_pScheduler;
     std::atomic_flag m_notReady;
 };
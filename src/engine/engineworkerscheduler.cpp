@@ -25,7 +25,17 @@ void EngineWorkerScheduler::workerReady() {
 void EngineWorkerScheduler::addWorker(EngineWorker* pWorker) {
     DEBUG_ASSERT(pWorker);
     QMutexLocker locker(&m_mutex);
-    m_workers.push_back(pWorker);
+    // Keep the list sorted by descending priority so that run() releases
+    // high-priority workers (chunk decodes) before low-priority ones
+    // (e.g. encoders) when several are ready in the same round. The
+    // insertion is stable: workers of equal priority stay in
+    // registration order.
+    auto it = m_workers.begin();
+    while (it != m_workers.end() &&
+            (*it)->workPriority() >= pWorker->workPriority()) {
+        ++it;
+    }
+    m_workers.insert(it, pWorker);
 }
 
 void EngineWorkerScheduler::runWorkers() {
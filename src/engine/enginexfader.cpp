@@ -82,3 +82,59 @@ void EngineXfader::getXfadeGains(double xfadePosition,
         *gain2 = gain_temp;
     }
 }
+
+EngineXfaderGainTable::EngineXfaderGainTable()
+        // Initialize with parameters outside their valid ranges so that
+        // the first update() always builds the table.
+        : m_transform(-1.0),
+          m_powerCalibration(-1.0),
+          m_curve(-1.0) {
+}
+
+void EngineXfaderGainTable::update(
+        double transform, double powerCalibration, double curve) {
+    if (transform == m_transform &&
+            powerCalibration == m_powerCalibration &&
+            curve == m_curve) {
+        return;
+    }
+    m_transform = transform;
+    m_powerCalibration = powerCalibration;
+    m_curve = curve;
+    for (int i = 0; i <= kTableSize; ++i) {
+        const double xfadePosition = -1.0 + 2.0 * i / kTableSize;
+        EngineXfader::getXfadeGains(xfadePosition,
+                transform,
+                powerCalibration,
+                curve,
+                false,
+                &m_gain1[i],
+                &m_gain2[i]);
+    }
+}
+
+void EngineXfaderGainTable::getGains(double xfadePosition,
+        bool reverse,
+        CSAMPLE_GAIN* gain1,
+        CSAMPLE_GAIN* gain2) const {
+    const double tablePosition = math_clamp(
+            (xfadePosition + 1.0) / 2.0 * kTableSize,
+            0.0,
+            static_cast<double>(kTableSize));
+    const int index = math_min(static_cast<int>(tablePosition), kTableSize - 1);
+    const CSAMPLE_GAIN fraction =
+            static_cast<CSAMPLE_GAIN>(tablePosition - index);
+    const CSAMPLE_GAIN interpolatedGain1 = m_gain1[index] +
+            (m_gain1[index + 1] - m_gain1[index]) * fraction;
+    const CSAMPLE_GAIN interpolatedGain2 = m_gain2[index] +
+            (m_gain2[index + 1] - m_gain2[index]) * fraction;
+    // Handle reverse at lookup time so that toggling it does not
+    // trigger a rebuild.
+    if (reverse) {
+        *gain1 = interpolatedGain2;
+        *gain2 = interpolatedGain1;
+    } else {
+        *gain1 = interpolatedGain1;
+        *gain2 = interpolatedGain2;
+    }
+}
@@ -22,3 +22,38 @@ class EngineXfader {
     static const double kTransformMax;
     static const double kTransformMin;
 };
+
+// Caches the crossfade gain curve sampled over the whole crossfader
+// range so the per-callback lookup is a linear interpolation instead of
+// the pow() calls in EngineXfader::getXfadeGains(). The table is only
+// rebuilt when one of the curve parameters changes, i.e. while the user
+// adjusts the mixer profile preferences.
+class EngineXfaderGainTable {
+  public:
+    EngineXfaderGainTable();
+
+    // Rebuilds the table if the curve parameters differ from the ones
+    // the table was computed for.
+    void update(double transform, double powerCalibration, double curve);
+
+    // Looks up the gain pair for xfadePosition in [-1, 1] with linear
+    // interpolation between the precomputed samples.
+    void getGains(double xfadePosition,
+            bool reverse,
+            CSAMPLE_GAIN* gain1,
+            CSAMPLE_GAIN* gain2) const;
+
+  private:
+    // Number of table intervals. The limiting case is the minimum
+    // transform of 0.6, where pow(x, transform) has unbounded slope at
+    // the crossover point; 1024 intervals keep the interpolation error
+    // below 0.005 (less than 0.05 dB) even there, while the rebuild
+    // stays cheap enough for the rare parameter change.
+    static constexpr int kTableSize = 1024;
+
+    double m_transform;
+    double m_powerCalibration;
+    double m_curve;
+    CSAMPLE_GAIN m_gain1[kTableSize + 1];
+    CSAMPLE_GAIN m_gain2[kTableSize + 1];
+};
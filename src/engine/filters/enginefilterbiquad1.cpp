@@ -1,9 +1,23 @@
 #include "engine/filters/enginefilterbiquad1.h"
 
+#include <cmath>
 #include <stdio.h>
 
 #include "moc_enginefilterbiquad1.cpp"
 
+namespace {
+
+// Quantize the gain to 1/20 dB steps before it is baked into the fidlib
+// spec. The steps are well below audibility (and smoothed further by the
+// coefficient ramping), but they collapse the continuous knob values of
+// an EQ sweep onto a small set of designs that hit the coefficient cache
+// in EngineFilterIIR::designCoefs().
+double quantizeGainDb(double dBgain) {
+    return std::round(dBgain * 20.0) / 20.0;
+}
+
+} // anonymous namespace
+
 EngineFilterBiquad1LowShelving::EngineFilterBiquad1LowShelving(int sampleRate,
                                                                double centerFreq,
                                                                double Q) {
@@ -15,7 +29,7 @@ void EngineFilterBiquad1LowShelving::setFrequencyCorners(int sampleRate,
                                                          double centerFreq,
                                                          double Q,
                                                          double dBgain) {
-    format_fidspec(m_spec, sizeof(m_spec), "LsBq/%.10f/%.10f", Q, dBgain);
+    format_fidspec(m_spec, sizeof(m_spec), "LsBq/%.10f/%.10f", Q, quantizeGainDb(dBgain));
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
@@ -29,7 +43,7 @@ void EngineFilterBiquad1Peaking::setFrequencyCorners(int sampleRate,
                                                      double centerFreq,
                                                      double Q,
                                                      double dBgain) {
-    format_fidspec(m_spec, sizeof(m_spec), "PkBq/%.10f/%.10f", Q, dBgain);
+    format_fidspec(m_spec, sizeof(m_spec), "PkBq/%.10f/%.10f", Q, quantizeGainDb(dBgain));
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
@@ -44,7 +58,7 @@ void EngineFilterBiquad1HighShelving::setFrequencyCorners(int sampleRate,
                                                           double centerFreq,
                                                           double Q,
                                                           double dBgain) {
-    format_fidspec(m_spec, sizeof(m_spec), "HsBq/%.10f/%.10f", Q, dBgain);
+    format_fidspec(m_spec, sizeof(m_spec), "HsBq/%.10f/%.10f", Q, quantizeGainDb(dBgain));
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
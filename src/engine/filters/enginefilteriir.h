@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 
@@ -7,6 +8,7 @@
 #include <fidlib.h>
 
 #include "engine/engineobject.h"
+#include "util/platform.h"
 #include "util/sample.h"
 
 // set to 1 to print some analysis data using qDebug()
@@ -107,7 +109,7 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         // Copy the old coefficients into m_oldCoef
         memcpy(m_oldCoef, m_coef, sizeof(m_coef));
 
-        m_coef[0] = fid_design_coef(m_coef + 1, SIZE, spec_d, sampleRate, freq0, freq1, adj);
+        designCoefs(spec_d, sampleRate, freq0, freq1, adj);
 
         initBuffers();
 
@@ -231,10 +233,7 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput,
                          const int iBufferSize) {
         if (!m_doRamping) {
-            for (int i = 0; i < iBufferSize; i += 2) {
-                pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
-            }
+            processBlock(pIn, pOutput, iBufferSize, m_coef, m_buf1, m_buf2);
         } else {
             double cross_mix = 0.0;
             double cross_inc = 4.0 / static_cast<double>(iBufferSize);
@@ -284,7 +283,89 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     }
 
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    // Runs a whole buffer through one pair of filter states. The two
+    // channel recurrences are independent, and the restrict-qualified
+    // pointers guarantee the states and coefficients do not alias, so
+    // the compiler can execute both channels in lockstep as a two-wide
+    // SIMD lane pair, like the scalar kernels in util/sample.cpp.
+    inline void processBlock(const CSAMPLE* pIn,
+            CSAMPLE* pOutput,
+            const int iBufferSize,
+            const double* M_RESTRICT coef,
+            double* M_RESTRICT buf1,
+            double* M_RESTRICT buf2) {
+        for (int i = 0; i < iBufferSize; i += 2) {
+            pOutput[i] = static_cast<CSAMPLE>(processSample(coef, buf1, pIn[i]));
+            pOutput[i + 1] = static_cast<CSAMPLE>(processSample(coef, buf2, pIn[i + 1]));
+        }
+    }
+
+    inline double processSample(const double* M_RESTRICT coef,
+            double* M_RESTRICT buf,
+            double val);
+
+    // Fills m_coef with the design for the given spec. fid_design_coef()
+    // parses the spec string and runs transcendental-heavy filter design
+    // on every call, which dominates the cost of EQ sweeps where the
+    // same designs are requested hundreds of times per second across
+    // decks. Recently computed designs are therefore served from a
+    // small direct-mapped cache shared by all filters of this
+    // specialization. The cache is thread-local, so lookups need no
+    // locking and never block the engine callback.
+    void designCoefs(const char* spec,
+            double sampleRate,
+            double freq0,
+            double freq1,
+            int adj) {
+        struct CacheEntry {
+            bool valid;
+            char spec[FIDSPEC_LENGTH];
+            double sampleRate;
+            double freq0;
+            double freq1;
+            int adj;
+            double coef[SIZE + 1];
+        };
+        constexpr unsigned int kCacheSize = 1024; // must be a power of two
+        static thread_local CacheEntry s_cache[kCacheSize];
+
+        // FNV-1a over the design inputs
+        std::uint64_t hash = 14695981039346656037ULL;
+        const auto hashBytes = [&hash](const void* data, size_t len) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < len; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ULL;
+            }
+        };
+        hashBytes(spec, std::strlen(spec));
+        hashBytes(&sampleRate, sizeof(sampleRate));
+        hashBytes(&freq0, sizeof(freq0));
+        hashBytes(&freq1, sizeof(freq1));
+        hashBytes(&adj, sizeof(adj));
+
+        CacheEntry& entry = s_cache[hash & (kCacheSize - 1)];
+        if (entry.valid &&
+                entry.sampleRate == sampleRate &&
+                entry.freq0 == freq0 &&
+                entry.freq1 == freq1 &&
+                entry.adj == adj &&
+                std::strcmp(entry.spec, spec) == 0) {
+            memcpy(m_coef, entry.coef, sizeof(m_coef));
+            return;
+        }
+
+        m_coef[0] = fid_design_coef(m_coef + 1, SIZE, spec, sampleRate, freq0, freq1, adj);
+
+        std::strncpy(entry.spec, spec, sizeof(entry.spec));
+        entry.spec[sizeof(entry.spec) - 1] = '\0';
+        entry.sampleRate = sampleRate;
+        entry.freq0 = freq0;
+        entry.freq1 = freq1;
+        entry.adj = adj;
+        memcpy(entry.coef, m_coef, sizeof(m_coef));
+        entry.valid = true;
+    }
+
     inline void pauseFilterInner() {
         // Set the current buffers to 0
         memset(m_buf1, 0, sizeof(m_buf1));
@@ -316,8 +397,8 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 };
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<2, IIR_LP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
@@ -330,8 +411,8 @@ inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<2, IIR_BP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
@@ -344,8 +425,8 @@ inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<2, IIR_HP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
@@ -358,8 +439,8 @@ inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<4, IIR_LP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -377,8 +458,8 @@ inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<8, IIR_BP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -407,8 +488,8 @@ inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<4, IIR_HP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -426,8 +507,8 @@ inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<8, IIR_LP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -456,8 +537,8 @@ inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
-                                                         double* buf,
+inline double EngineFilterIIR<16, IIR_BP>::processSample(const double* M_RESTRICT coef,
+                                                         double* M_RESTRICT buf,
                                                          double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -508,8 +589,8 @@ inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<8, IIR_HP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
@@ -539,8 +620,8 @@ inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
 
 // IIR_LP and IIR_HP use the same processSample routine
 template<>
-inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
+inline double EngineFilterIIR<5, IIR_BP>::processSample(const double* M_RESTRICT coef,
+                                                        double* M_RESTRICT buf,
                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0]; buf[0] = buf[1];
@@ -553,9 +634,9 @@ inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
+inline double EngineFilterIIR<4, IIR_LPMO>::processSample(const double* M_RESTRICT coef,
+                                                          double* M_RESTRICT buf,
+                                                          double val) {
    double tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
@@ -579,9 +660,9 @@ inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
+inline double EngineFilterIIR<4, IIR_HPMO>::processSample(const double* M_RESTRICT coef,
+                                                          double* M_RESTRICT buf,
+                                                          double val) {
    double tmp, fir, iir;
    tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
    iir= val * coef[0];
@@ -604,9 +685,9 @@ inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
+inline double EngineFilterIIR<2, IIR_LP2>::processSample(const double* M_RESTRICT coef,
+                                                         double* M_RESTRICT buf,
+                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0];
     iir = val * coef[0];
@@ -625,9 +706,9 @@ inline double EngineFilterIIR<2, IIR_LP2>::processSample(double* coef,
 
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP2>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
+inline double EngineFilterIIR<2, IIR_HP2>::processSample(const double* M_RESTRICT coef,
+                                                         double* M_RESTRICT buf,
+                                                         double val) {
     double tmp, fir, iir;
     tmp = buf[0];
     iir = val * -coef[0]; // swap gain to be in phase with LP2
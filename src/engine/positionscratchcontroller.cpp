@@ -72,7 +72,8 @@ PositionScratchController::PositionScratchController(const QString& group)
           m_dStartScratchPosition(0),
           m_dRate(0),
           m_dMoveDelay(0),
-          m_dMouseSampeTime(0) {
+          m_dMouseSampeTime(0),
+          m_dLastSampleInterval(0) {
     m_pScratchEnable = new ControlObject(ConfigKey(group, "scratch_position_enable"));
     m_pScratchPosition = new ControlObject(ConfigKey(group, "scratch_position"));
     m_pMasterSampleRate = ControlObject::getControl(ConfigKey("[Master]", "samplerate"));
@@ -113,10 +114,21 @@ void PositionScratchController::process(double currentSample, double releaseRate
     const double m_dMouseSampeIntervall = 0.016;
     const auto callsPerDt = static_cast<int>(ceil(m_dMouseSampeIntervall / dt));
     double scratchPosition = 0;
+    bool newScratchPosition = false;
     m_dMouseSampeTime += dt;
     if (m_dMouseSampeTime >= m_dMouseSampeIntervall || !m_bScratching) {
         scratchPosition = m_pScratchPosition->get();
-        m_dMouseSampeTime = 0;
+        newScratchPosition = true;
+        m_dLastSampleInterval = math_max(m_dMouseSampeTime, dt);
+        if (m_bScratching) {
+            // Keep the remainder of the sampling window instead of starting
+            // at zero again. Otherwise the effective sampling period jitters
+            // by up to one engine buffer, which excites the velocity
+            // controller and becomes audible as ringing with small buffers.
+            m_dMouseSampeTime = fmod(m_dMouseSampeTime, m_dMouseSampeIntervall);
+        } else {
+            m_dMouseSampeTime = 0;
+        }
     }
 
     // Tweak PD controller for different latencies
@@ -181,7 +193,7 @@ void PositionScratchController::process(double currentSample, double releaseRate
 
             // Continue with the last rate if we do not have a new
             // Mouse position
-            if (m_dMouseSampeTime ==  0) {
+            if (newScratchPosition) {
 
                 // Set the scratch target to the current set position
                 // and normalize to one buffer
@@ -194,7 +206,7 @@ void PositionScratchController::process(double currentSample, double releaseRate
                     // we get here, if the next mouse position is delayed
                     // the mouse is stopped or moves slow. Since we don't know the case
                     // we assume delayed mouse updates for 40 ms
-                    m_dMoveDelay += dt * callsPerDt;
+                    m_dMoveDelay += m_dLastSampleInterval;
                     if (m_dMoveDelay < 0.04) {
                         // Assume a missing Mouse Update and continue with the
                         // previously calculated rate.
@@ -219,7 +231,12 @@ void PositionScratchController::process(double currentSample, double releaseRate
                 if (calcRate) {
                     double ctrlError = m_pRateIIFilter->filter(targetDelta - m_dPositionDeltaSum);
                     m_dRate = m_pVelocityController->observation(ctrlError);
-                    m_dRate /= ceil(m_dMouseSampeIntervall/dt);
+                    // Normalize to the number of engine callbacks that have
+                    // actually passed since the last accepted sample, not to
+                    // the nominal sampling interval rounded up to whole
+                    // buffers. With small buffers the rounding error used to
+                    // modulate the rate from sample to sample.
+                    m_dRate /= m_dLastSampleInterval / dt;
                     // Note: The following SoundTouch changes the also rate by a ramp
                     // This looks like average of the new and the old rate independent
                     // from dt. Ramping is disabled when direction changes or rate = 0;
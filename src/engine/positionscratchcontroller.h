@@ -35,4 +35,8 @@ class PositionScratchController : public QObject {
     double m_dRate;
     double m_dMoveDelay;
     double m_dMouseSampeTime;
+    // Time that actually passed between the last two accepted scratch
+    // position samples. Slightly longer than the nominal sampling interval
+    // because sampling happens on engine buffer boundaries.
+    double m_dLastSampleInterval;
 };
@@ -8,6 +8,11 @@
 #include "util/sample.h"
 
 static const int kNumChannels = 2;
+// Gain decay per buffer when repeating the last good samples during a reader
+// cache miss. After three missed buffers in a row the repeated material has
+// faded below -18 dB and is cut to silence.
+static const CSAMPLE_GAIN kConcealDecayPerBuffer = 0.5f;
+static const CSAMPLE_GAIN kConcealMinGain = 0.125f;
 
 ReadAheadManager::ReadAheadManager()
         : m_pLoopingControl(nullptr),
@@ -15,7 +20,11 @@ ReadAheadManager::ReadAheadManager()
           m_currentPosition(0),
           m_pReader(nullptr),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_cacheMissHappened(false) {
+          m_cacheMissHappened(false),
+          m_pConcealBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_concealSamples(0),
+          m_concealGain(CSAMPLE_GAIN_ONE),
+          m_underrunCount(0) {
     // For testing only: ReadAheadManagerMock
 }
 
@@ -26,13 +35,18 @@ ReadAheadManager::ReadAheadManager(CachingReader* pReader,
           m_currentPosition(0),
           m_pReader(pReader),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_cacheMissHappened(false) {
+          m_cacheMissHappened(false),
+          m_pConcealBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_concealSamples(0),
+          m_concealGain(CSAMPLE_GAIN_ONE),
+          m_underrunCount(0) {
     DEBUG_ASSERT(m_pLoopingControl != nullptr);
     DEBUG_ASSERT(m_pReader != nullptr);
 }
 
 ReadAheadManager::~ReadAheadManager() {
     SampleUtil::free(m_pCrossFadeBuffer);
+    SampleUtil::free(m_pConcealBuffer);
 }
 
 SINT ReadAheadManager::getNextSamples(double dRate, CSAMPLE* pOutput,
@@ -86,8 +100,27 @@ SINT ReadAheadManager::getNextSamples(double dRate, CSAMPLE* pOutput,
     const auto readResult = m_pReader->read(
             start_sample, samples_from_reader, in_reverse, pOutput);
     if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
-        // Cache miss - no samples written
-        SampleUtil::clear(pOutput, samples_from_reader);
+        // Cache miss - no samples written. Cutting to hard silence is audible
+        // as a click, so conceal the miss by repeating the last good samples
+        // with decaying energy until the reader catches up.
+        m_underrunCount++;
+        const SINT concealSamples = math_min(m_concealSamples, samples_from_reader);
+        if (concealSamples > 0 && m_concealGain > kConcealMinGain) {
+            const CSAMPLE_GAIN newGain = m_concealGain * kConcealDecayPerBuffer;
+            SampleUtil::copyWithRampingGain(pOutput,
+                    m_pConcealBuffer,
+                    m_concealGain,
+                    newGain,
+                    concealSamples);
+            m_concealGain = newGain;
+            if (concealSamples < samples_from_reader) {
+                SampleUtil::clear(&pOutput[concealSamples],
+                        samples_from_reader - concealSamples);
+            }
+        } else {
+            // Nothing to repeat or already faded out.
+            SampleUtil::clear(pOutput, samples_from_reader);
+        }
         // Set the cache miss flag to decide when to apply ramping
         // after the following read attempts.
         m_cacheMissHappened = true;
@@ -99,6 +132,13 @@ SINT ReadAheadManager::getNextSamples(double dRate, CSAMPLE* pOutput,
         // Reset the cache miss flag, because we are now back on track.
         m_cacheMissHappened = false;
     }
+    if (readResult != CachingReader::ReadResult::UNAVAILABLE &&
+            samples_from_reader > 0) {
+        // Remember the last good samples for under-run concealment above.
+        SampleUtil::copy(m_pConcealBuffer, pOutput, samples_from_reader);
+        m_concealSamples = samples_from_reader;
+        m_concealGain = CSAMPLE_GAIN_ONE;
+    }
 
     // Increment or decrement current read-ahead position
     // Mixing int and double here is desired, because the fractional frame should
@@ -172,6 +212,9 @@ void ReadAheadManager::addRateControl(RateControl* pRateControl) {
 void ReadAheadManager::notifySeek(double seekPosition) {
     m_currentPosition = seekPosition;
     m_cacheMissHappened = false;
+    // Do not conceal misses with material from before the seek.
+    m_concealSamples = 0;
+    m_concealGain = CSAMPLE_GAIN_ONE;
     m_readAheadLog.clear();
 
     // TODO(XXX) notifySeek on the engine controls. EngineBuffer currently does
@@ -55,6 +55,13 @@ class ReadAheadManager {
             double currentFilePlayposition,
             double numConsumedSamples);
 
+    /// Total number of reader cache misses encountered since construction.
+    /// Misses are concealed by repeating the last good samples with decaying
+    /// energy, see getNextSamples().
+    int underrunCount() const {
+        return m_underrunCount;
+    }
+
   private:
     /// An entry in the read log indicates the virtual playposition the read
     /// began at and the virtual playposition it ended at.
@@ -118,4 +125,10 @@ class ReadAheadManager {
     CachingReader* m_pReader;
     CSAMPLE* m_pCrossFadeBuffer;
     bool m_cacheMissHappened;
+    // The last good samples handed out, repeated with decaying gain to
+    // conceal cache misses.
+    CSAMPLE* m_pConcealBuffer;
+    SINT m_concealSamples;
+    CSAMPLE_GAIN m_concealGain;
+    int m_underrunCount;
 };
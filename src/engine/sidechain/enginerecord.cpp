@@ -8,17 +8,31 @@
 #include "preferences/usersettings.h"
 #include "recording/defs_recording.h"
 #include "track/track.h"
+#include "util/compatibility.h"
 #include "util/event.h"
 
 const int kMetaDataLifeTimeout = 16;
 
+// Encoded data is collected until a whole block can be written to the file
+// at once. Per-frame small writes are the worst possible I/O pattern for
+// slow, especially FAT formatted, USB media.
+const int kWriteBlockSize = 1 << 20; // 1 MiB
+// 4 MiB ring buffer towards the write thread, roughly 3 minutes of
+// 192 kbit/s mp3 or 23 s of 44.1 kHz stereo WAV. If the disk stalls for
+// longer than that, encoded data is dropped instead of blocking the
+// sidechain thread.
+const int kWriteFifoSize = 1 << 22;
+
 EngineRecord::EngineRecord(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_frames(0),
           m_recordedDuration(0),
           m_iMetaDataLife(0),
           m_cueTrack(0),
-          m_bCueIsEnabled(false) {
+          m_bCueIsEnabled(false),
+          m_writeFifo(kWriteFifoSize),
+          m_flushRequested(false),
+          m_bytesDropped(0) {
 
     m_pRecReady = new ControlProxy(RECORDING_PREF_KEY, "status", this);
     m_pSamplerate = new ControlProxy("[Master]", "samplerate", this);
@@ -28,11 +42,12 @@ EngineRecord::EngineRecord(UserSettingsPointer pConfig)
 EngineRecord::~EngineRecord() {
     closeCueFile();
     closeFile();
+    discardNextSegment();
     delete m_pRecReady;
     delete m_pSamplerate;
 }
 
-int EngineRecord::updateFromPreferences() {
+void EngineRecord::updateFromPreferences() {
     m_fileName = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Path"));
     m_baTitle = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Title"));
     m_baAuthor = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Author"));
@@ -40,36 +55,6 @@ int EngineRecord::updateFromPreferences() {
     m_cueFileName = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "CuePath"));
     m_bCueIsEnabled = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "CueEnabled")).toInt();
     m_sampleRate = static_cast<mixxx::audio::SampleRate::value_t>(m_pSamplerate->get());
-
-    // Delete m_pEncoder if it has been initialized (with maybe) different bitrate.
-    if (m_pEncoder) {
-        m_pEncoder.reset();
-    }
-    Encoder::Format format = EncoderFactory::getFactory().getSelectedFormat(m_pConfig);
-    m_encoding = format.internalName;
-    m_pEncoder = EncoderFactory::getFactory().createRecordingEncoder(
-            format, m_pConfig, this);
-
-    QString userErrorMsg;
-    int ret = -1;
-    if (m_pEncoder) {
-        m_pEncoder->updateMetaData(m_baAuthor, m_baTitle, m_baAlbum);
-        ret = m_pEncoder->initEncoder(m_sampleRate, &userErrorMsg);
-    }
-
-    if (ret < 0) {
-        ErrorDialogProperties* props = ErrorDialogHandler::instance()->newDialogProperties();
-        props->setType(DLG_WARNING);
-        props->setTitle(format.label + QChar(' ') + QObject::tr(" encoder failure"));
-        if (userErrorMsg.isEmpty()) {
-            userErrorMsg = QObject::tr(
-                    "Failed to apply the selected settings.");
-        }
-        props->setText(userErrorMsg);
-        ErrorDialogHandler::instance()->requestErrorDialog(props);
-        m_pEncoder.reset();
-    }
-    return ret;
 }
 
 bool EngineRecord::metaDataHasChanged()
@@ -124,19 +109,17 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
             }
             emit isRecording(false, false);
         }
+        // A segment prepared for an upcoming split that never happened
+        // is of no use anymore.
+        discardNextSegment();
     } else if (recordingStatus == RECORD_READY) {
         // If we are ready for recording, i.e, the output file has been selected, we
         // open a new file.
 
         // Update file location from preferences.
-        if (updateFromPreferences() < 0) {
-            // Maybe the encoder could not be initialized
-            qDebug() << "Setting record flag to: OFF";
-            m_pRecReady->slotSet(RECORD_OFF);
-            // Just report that we don't record
-            // There was already a message Box
-            emit isRecording(false, false);
-        } else if (openFile()) {
+        updateFromPreferences();
+        const RecordingSegment::OpenResult openResult = openFile();
+        if (openResult == RecordingSegment::OpenResult::Succeeded) {
             Event::start(tag);
             qDebug("Setting record flag to: ON");
             m_pRecReady->set(RECORD_ON);
@@ -154,6 +137,13 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
                 openCueFile();
                 m_cueTrack = 0;
             }
+        } else if (openResult == RecordingSegment::OpenResult::EncoderError) {
+            // The encoder could not be initialized
+            qDebug() << "Setting record flag to: OFF";
+            m_pRecReady->slotSet(RECORD_OFF);
+            // Just report that we don't record
+            // There was already a message Box
+            emit isRecording(false, false);
         } else {
             qDebug() << "Could not open" << m_fileName << "for writing.";
             qDebug("Setting record flag to: OFF");
@@ -162,14 +152,35 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
             emit isRecording(false, true);
         }
     } else if (recordingStatus == RECORD_SPLIT_CONTINUE) {
-        if (fileOpen()) {
-            closeFile();  // Close file and free encoder.
-            if (m_bCueIsEnabled) {
-                closeCueFile();
-            }
+        if (m_bCueIsEnabled && fileOpen()) {
+            closeCueFile();
         }
         updateFromPreferences();  // Update file location from preferences.
-        if (openFile()) {
+        bool newSegmentOpen = false;
+        std::unique_ptr<RecordingSegment> pNextSegment = takeNextSegment();
+        if (pNextSegment) {
+            if (fileOpen() && pNextSegment->fileName() == m_fileName) {
+                // Seamless splice: the next segment was opened and its
+                // encoder initialized ahead of the cut, so no samples
+                // are lost and the finished file is finalized on the
+                // write thread.
+                switchToSegment(std::move(pNextSegment));
+                newSegmentOpen = true;
+            } else {
+                // Prepared for a different target or recording already
+                // stopped in the meantime.
+                pNextSegment->abort();
+            }
+        }
+        if (!newSegmentOpen) {
+            // No prepared segment available, splice synchronously.
+            if (fileOpen()) {
+                closeFile();  // Close file and free encoder.
+            }
+            newSegmentOpen =
+                    openFile() == RecordingSegment::OpenResult::Succeeded;
+        }
+        if (newSegmentOpen) {
             qDebug() << "Splitting to a new file: "<< m_fileName;
             m_pRecReady->set(RECORD_ON);
             emit isRecording(true, false);  // will notify the RecordingManager
@@ -200,9 +211,10 @@ void EngineRecord::process(const CSAMPLE* pBuffer, const int iBufferSize) {
     // Checking again from m_pRecReady since its status might have changed
     // in the previous "if" blocks.
     if (m_pRecReady->get() == RECORD_ON) {
-        // Compress audio. Encoder will call method 'write()' below to
-        // write a file stream and emit bytesRecorded.
-        m_pEncoder->encodeBuffer(pBuffer, iBufferSize);
+        // Compress audio. The encoder calls the segment's write()
+        // callback, which queues the data for the write thread and
+        // emits bytesRecorded.
+        m_pActiveSegment->encodeBuffer(pBuffer, iBufferSize);
 
         //Writing cueLine before updating the time counter since we prefer to be ahead
         //rather than late.
@@ -261,63 +273,190 @@ void EngineRecord::writeCueLine() {
                             .toUtf8());
 }
 
-// Encoder calls this method to write compressed audio
-void EngineRecord::write(const unsigned char *header, const unsigned char *body,
-                         int headerLen, int bodyLen) {
+// The active segment calls this method with encoded audio
+void EngineRecord::queueEncodedData(const unsigned char* header,
+        const unsigned char* body,
+        int headerLen,
+        int bodyLen) {
     if (!fileOpen()) {
         return;
     }
+    // Queue the data for the write thread, which coalesces the small
+    // encoded frames into large block writes.
+    if (m_writeFifo.writeAvailable() < headerLen + bodyLen) {
+        // The disk stalled for longer than the ring buffer can absorb. Drop
+        // the frames instead of blocking the sidechain thread.
+        if (m_bytesDropped == 0) {
+            qWarning() << "EngineRecord: recording disk cannot keep up,"
+                       << "dropping encoded audio";
+        }
+        m_bytesDropped += headerLen + bodyLen;
+        return;
+    }
     // Relevant for OGG
     if (headerLen > 0) {
-        m_dataStream.writeRawData((const char*) header, headerLen);
+        m_writeFifo.write(header, headerLen);
     }
     // Always write body
-    m_dataStream.writeRawData((const char*) body, bodyLen);
+    m_writeFifo.write(body, bodyLen);
+    m_writeSema.release();
     emit bytesRecorded((headerLen+bodyLen));
+}
 
+void EngineRecord::processWriteQueue() {
+    // Segments finished by a split are finalized here so that their
+    // encoder trailer, header rewrite and close never happen on the
+    // sidechain thread.
+    finalizeSegments();
+    if (!m_writeSema.tryAcquire(1, 1000)) {
+        return;
+    }
+    int readAvailable = m_writeFifo.readAvailable();
+    if (atomicLoadRelaxed(m_flushRequested)) {
+        // Write everything including the trailing partial block, then tell
+        // the flushing thread that the file is up to date.
+        if (readAvailable > 0) {
+            drainWriteFifo(readAvailable);
+        }
+        m_flushMutex.lock();
+        m_flushDone.wakeAll();
+        m_flushMutex.unlock();
+        return;
+    }
+    while (readAvailable >= kWriteBlockSize) {
+        drainWriteFifo(kWriteBlockSize);
+        readAvailable -= kWriteBlockSize;
+    }
 }
-// Encoder calls this method to write compressed audio
-int EngineRecord::tell() {
-    if (!fileOpen()) {
-        return -1;
+
+void EngineRecord::drainWriteFifo(int writeCount) {
+    unsigned char* dataPtr1;
+    ring_buffer_size_t size1;
+    unsigned char* dataPtr2;
+    ring_buffer_size_t size2;
+    // We use size1 and size2, so we can ignore the return value
+    (void)m_writeFifo.aquireReadRegions(writeCount, &dataPtr1, &size1,
+            &dataPtr2, &size2);
+    m_pActiveSegment->writeRawBlock((const char*)dataPtr1, size1);
+    if (size2 > 0) {
+        m_pActiveSegment->writeRawBlock((const char*)dataPtr2, size2);
     }
-    return m_dataStream.device()->pos();
+    m_writeFifo.releaseReadRegions(writeCount);
 }
-// Encoder calls this method to write compressed audio
-void EngineRecord::seek(int pos) {
-    if (!fileOpen()) {
+
+void EngineRecord::flushWriteQueue() {
+    if (!m_pWriteThread) {
+        // No write thread running, drain the FIFO right here.
+        const int readAvailable = m_writeFifo.readAvailable();
+        if (readAvailable > 0) {
+            drainWriteFifo(readAvailable);
+        }
         return;
     }
-    m_dataStream.device()->seek(static_cast<qint64>(pos));
-}
-// These are not used for streaming, but the interface requires them
-int EngineRecord::filelen() {
-    if (!fileOpen()) {
-        return 0;
+    m_flushRequested = 1;
+    m_flushMutex.lock();
+    while (m_writeFifo.readAvailable() > 0) {
+        m_writeSema.release();
+        m_flushDone.wait(&m_flushMutex, 100);
     }
-    return m_dataStream.device()->size();
+    m_flushMutex.unlock();
+    m_flushRequested = 0;
 }
 
 bool EngineRecord::fileOpen() {
-    return (m_file.handle() != -1);
+    return m_pActiveSegment && m_pActiveSegment->isOpen();
 }
 
-bool EngineRecord::openFile() {
-    // We can use a QFile to write compressed audio.
-    if (m_pEncoder) {
-        m_file.setFileName(m_fileName);
-        if (!m_file.open(QIODevice::WriteOnly)) {
-            return false;
-        }
-        if (m_file.handle() != -1) {
-            m_dataStream.setDevice(&m_file);
+RecordingSegment::OpenResult EngineRecord::openFile() {
+    auto pSegment = std::make_unique<RecordingSegment>();
+    QString userErrorMsg;
+    const RecordingSegment::OpenResult openResult = pSegment->open(
+            m_pConfig, m_fileName, m_sampleRate, &userErrorMsg);
+    if (openResult != RecordingSegment::OpenResult::Succeeded) {
+        if (openResult == RecordingSegment::OpenResult::EncoderError) {
+            ErrorDialogProperties* props = ErrorDialogHandler::instance()->newDialogProperties();
+            props->setType(DLG_WARNING);
+            props->setTitle(pSegment->formatLabel() + QChar(' ') + QObject::tr(" encoder failure"));
+            if (userErrorMsg.isEmpty()) {
+                userErrorMsg = QObject::tr(
+                        "Failed to apply the selected settings.");
+            }
+            props->setText(userErrorMsg);
+            ErrorDialogHandler::instance()->requestErrorDialog(props);
         }
-    } else {
-        return false;
+        return openResult;
+    }
+    m_pActiveSegment = std::move(pSegment);
+    m_pActiveSegment->activate(this);
+    m_encoding = m_pActiveSegment->encoding();
+    m_bytesDropped = 0;
+    m_pWriteThread = std::make_unique<EngineRecordWriteThread>(this);
+    m_pWriteThread->start(QThread::LowPriority);
+    return RecordingSegment::OpenResult::Succeeded;
+}
+
+void EngineRecord::prepareNextSegment(const QString& fileName) {
+    auto pSegment = std::make_unique<RecordingSegment>();
+    QString userErrorMsg;
+    const auto sampleRate = mixxx::audio::SampleRate(
+            static_cast<mixxx::audio::SampleRate::value_t>(m_pSamplerate->get()));
+    if (pSegment->open(m_pConfig, fileName, sampleRate, &userErrorMsg) !=
+            RecordingSegment::OpenResult::Succeeded) {
+        qWarning() << "EngineRecord: could not prepare next recording segment"
+                   << fileName << "- the split will splice synchronously";
+        return;
+    }
+    const QMutexLocker locker(&m_nextSegmentMutex);
+    if (m_pNextSegment) {
+        // A stale segment from an earlier prepare that never got used.
+        m_pNextSegment->abort();
+    }
+    m_pNextSegment = std::move(pSegment);
+}
+
+std::unique_ptr<RecordingSegment> EngineRecord::takeNextSegment() {
+    const QMutexLocker locker(&m_nextSegmentMutex);
+    return std::move(m_pNextSegment);
+}
+
+void EngineRecord::discardNextSegment() {
+    const QMutexLocker locker(&m_nextSegmentMutex);
+    if (m_pNextSegment) {
+        m_pNextSegment->abort();
+        m_pNextSegment.reset();
+    }
+}
+
+void EngineRecord::switchToSegment(std::unique_ptr<RecordingSegment> pNextSegment) {
+    DEBUG_ASSERT(m_pActiveSegment);
+    // Everything queued so far belongs to the finished segment; get it
+    // into that file while the write thread still targets it.
+    flushWriteQueue();
+    // From here on the finished segment's callback I/O goes directly to
+    // its own file. Hand it to the write thread for finalization so
+    // that the encoder trailer, header rewrite and close do not stall
+    // the sidechain thread.
+    m_pActiveSegment->deactivate();
+    {
+        const QMutexLocker locker(&m_finalizeMutex);
+        m_finalizeQueue.push_back(std::move(m_pActiveSegment));
     }
+    m_pActiveSegment = std::move(pNextSegment);
+    m_pActiveSegment->activate(this);
+    m_encoding = m_pActiveSegment->encoding();
+    // Wake the write thread so the finished segment is finalized promptly.
+    m_writeSema.release();
+}
 
-    // Return whether the file is really open.
-    return fileOpen();
+void EngineRecord::finalizeSegments() {
+    std::vector<std::unique_ptr<RecordingSegment>> segments;
+    {
+        const QMutexLocker locker(&m_finalizeMutex);
+        segments.swap(m_finalizeQueue);
+    }
+    for (const auto& pSegment : segments) {
+        pSegment->finalize();
+    }
 }
 
 bool EngineRecord::openCueFile() {
@@ -363,13 +502,28 @@ bool EngineRecord::openCueFile() {
 }
 
 void EngineRecord::closeFile() {
-    if (m_file.handle() != -1) {
-        // Close QFile and encoder, if open.
-        if (m_pEncoder) {
-            m_pEncoder->flush();
-            m_pEncoder.reset();
+    if (fileOpen()) {
+        // Write the trailing partial block and stop the write thread before
+        // the file goes away underneath it.
+        flushWriteQueue();
+        if (m_pWriteThread) {
+            m_pWriteThread->stop();
+            m_writeSema.release();
+            m_pWriteThread->wait();
+            m_pWriteThread.reset();
+        }
+        // Finalize any segment still pending from a recent split, then
+        // the active one. With the write thread stopped and the queue
+        // drained, the callback I/O goes directly to the files.
+        finalizeSegments();
+        m_pActiveSegment->deactivate();
+        m_pActiveSegment->finalize();
+        m_pActiveSegment.reset();
+        if (m_bytesDropped > 0) {
+            qWarning() << "EngineRecord: dropped" << m_bytesDropped
+                       << "bytes of encoded audio, the recording is incomplete";
+            m_bytesDropped = 0;
         }
-        m_file.close();
     }
 }
 
@@ -378,3 +532,116 @@ void EngineRecord::closeCueFile() {
         m_cueFile.close();
     }
 }
+
+RecordingSegment::~RecordingSegment() {
+    DEBUG_ASSERT(!m_pSink);
+    finalize();
+}
+
+RecordingSegment::OpenResult RecordingSegment::open(
+        UserSettingsPointer pConfig,
+        const QString& fileName,
+        mixxx::audio::SampleRate sampleRate,
+        QString* pUserErrorMessage) {
+    DEBUG_ASSERT(!isOpen());
+    // We can use a QFile to write compressed audio.
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::WriteOnly)) {
+        return OpenResult::FileError;
+    }
+    m_dataStream.setDevice(&m_file);
+
+    const Encoder::Format format =
+            EncoderFactory::getFactory().getSelectedFormat(pConfig);
+    m_encoding = format.internalName;
+    m_formatLabel = format.label;
+    m_pEncoder = EncoderFactory::getFactory().createRecordingEncoder(
+            format, pConfig, this);
+    if (!m_pEncoder) {
+        abort();
+        return OpenResult::EncoderError;
+    }
+    m_pEncoder->updateMetaData(
+            pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Author")),
+            pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Title")),
+            pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Album")));
+    // Header bytes produced during initialization are written directly
+    // to the file through the callback methods below.
+    if (m_pEncoder->initEncoder(sampleRate, pUserErrorMessage) < 0) {
+        abort();
+        return OpenResult::EncoderError;
+    }
+    return OpenResult::Succeeded;
+}
+
+void RecordingSegment::activate(EngineRecord* pSink) {
+    DEBUG_ASSERT(pSink);
+    m_pSink = pSink;
+}
+
+void RecordingSegment::deactivate() {
+    m_pSink = nullptr;
+}
+
+void RecordingSegment::finalize() {
+    DEBUG_ASSERT(!m_pSink);
+    if (m_pEncoder) {
+        // Trailing frames and header rewrites go directly to the file.
+        m_pEncoder->flush();
+        m_pEncoder.reset();
+    }
+    if (isOpen()) {
+        m_file.close();
+    }
+}
+
+void RecordingSegment::abort() {
+    DEBUG_ASSERT(!m_pSink);
+    // Drop the encoder without flushing, nothing of this segment is
+    // worth keeping.
+    m_pEncoder.reset();
+    if (isOpen()) {
+        m_file.close();
+        m_file.remove();
+    }
+}
+
+void RecordingSegment::write(const unsigned char* header,
+        const unsigned char* body,
+        int headerLen,
+        int bodyLen) {
+    if (m_pSink) {
+        m_pSink->queueEncodedData(header, body, headerLen, bodyLen);
+        return;
+    }
+    // Warm-up and finalization write directly to the file.
+    if (headerLen > 0) {
+        m_dataStream.writeRawData(
+                reinterpret_cast<const char*>(header), headerLen);
+    }
+    m_dataStream.writeRawData(reinterpret_cast<const char*>(body), bodyLen);
+}
+
+int RecordingSegment::tell() {
+    // The device position is only meaningful once all queued data has
+    // reached the file. Rare, the WAV encoder opens its file non-seekable.
+    if (m_pSink) {
+        m_pSink->flushWriteQueue();
+    }
+    return m_dataStream.device()->pos();
+}
+
+void RecordingSegment::seek(int pos) {
+    // Pending sequential data has to land before the position changes.
+    if (m_pSink) {
+        m_pSink->flushWriteQueue();
+    }
+    m_dataStream.device()->seek(static_cast<qint64>(pos));
+}
+
+int RecordingSegment::filelen() {
+    if (m_pSink) {
+        m_pSink->flushWriteQueue();
+    }
+    return m_dataStream.device()->size();
+}
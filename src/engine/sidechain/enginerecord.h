@@ -1,7 +1,13 @@
 #pragma once
 
+#include <QAtomicInt>
 #include <QDataStream>
 #include <QFile>
+#include <QMutex>
+#include <QSemaphore>
+#include <QThread>
+#include <QWaitCondition>
+#include <vector>
 
 #include "audio/types.h"
 #include "encoder/encoder.h"
@@ -9,11 +15,100 @@
 #include "engine/sidechain/sidechainworker.h"
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
+#include "util/fifo.h"
+#include "util/memory.h"
 
 class ConfigKey;
 class ControlProxy;
+class EngineRecord;
+class EngineRecordWriteThread;
 
-class EngineRecord : public QObject, public EncoderCallback, public SideChainWorker {
+// One recording file together with the encoder that writes into it.
+// Owning both keeps encoder finalization (trailing frames, header
+// rewrites via seek()) targeted at the file the data was encoded into,
+// even when another segment has become the active recording target in
+// the meantime. This is what makes gapless file splitting possible: the
+// next segment is opened and its encoder initialized ahead of the cut,
+// and the finished segment is finalized on the write thread afterwards.
+class RecordingSegment : public EncoderCallback {
+  public:
+    RecordingSegment() = default;
+    ~RecordingSegment() override;
+
+    enum class OpenResult {
+        Succeeded,
+        FileError,
+        EncoderError,
+    };
+
+    // Opens the file and creates and initializes the encoder for it.
+    // Header bytes produced during encoder initialization are written
+    // directly to the file, so this may be called from any thread.
+    OpenResult open(UserSettingsPointer pConfig,
+            const QString& fileName,
+            mixxx::audio::SampleRate sampleRate,
+            QString* pUserErrorMessage);
+
+    // Routes encoded data produced from now on into the sink's write
+    // queue. Called when this segment becomes the active recording
+    // target.
+    void activate(EngineRecord* pSink);
+    // Stops routing encoded data into the sink; subsequent callback I/O
+    // goes directly to the file again. All queued data of this segment
+    // must have reached the file before the encoder is finalized.
+    void deactivate();
+
+    // Encodes the buffer; the encoder emits the encoded data through
+    // this segment's callback methods.
+    void encodeBuffer(const CSAMPLE* pBuffer, int iBufferSize) {
+        m_pEncoder->encodeBuffer(pBuffer, iBufferSize);
+    }
+
+    // Flushes and closes the encoder and closes the file. Must not be
+    // called while the segment is active.
+    void finalize();
+    // Closes the encoder and removes the file. For prepared segments
+    // that never became active.
+    void abort();
+
+    bool isOpen() const {
+        return m_file.handle() != -1;
+    }
+    QString fileName() const {
+        return m_file.fileName();
+    }
+    const QString& encoding() const {
+        return m_encoding;
+    }
+    const QString& formatLabel() const {
+        return m_formatLabel;
+    }
+
+    // Called by the write thread to append a drained block of encoded
+    // data to the file.
+    void writeRawBlock(const char* data, int size) {
+        m_dataStream.writeRawData(data, size);
+    }
+
+    // EncoderCallback
+    void write(const unsigned char* header, const unsigned char* body,
+            int headerLen, int bodyLen) override;
+    int tell() override;
+    void seek(int pos) override;
+    int filelen() override;
+
+  private:
+    QFile m_file;
+    QDataStream m_dataStream;
+    EncoderPointer m_pEncoder;
+    QString m_encoding;
+    QString m_formatLabel;
+    // The active sink, or nullptr while the segment is warmed up or
+    // finalized with direct file I/O.
+    EngineRecord* m_pSink = nullptr;
+};
+
+class EngineRecord : public QObject, public SideChainWorker {
     Q_OBJECT
   public:
     EngineRecord(UserSettingsPointer pConfig);
@@ -22,24 +117,21 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     void process(const CSAMPLE* pBuffer, const int iBufferSize) override;
     void shutdown() override {}
 
-    // writes compressed audio to file
-    void write(const unsigned char *header, const unsigned char *body, int headerLen, int bodyLen) override;
-    // gets stream position
-    int tell() override;
-    // sets stream position
-    void seek(int pos) override;
-    // gets stream length
-    int filelen()  override;
-
     // creates or opens an audio file
-    bool openFile();
+    RecordingSegment::OpenResult openFile();
     // closes the audio file
     void closeFile();
-    int updateFromPreferences();
+    void updateFromPreferences();
     bool fileOpen();
     bool openCueFile();
     void closeCueFile();
 
+    // Opens and warms up the next split segment so that the cut itself
+    // is a simple handoff without any file or encoder I/O on the
+    // sidechain thread. Called from the GUI thread by RecordingManager
+    // shortly before the split cap is reached.
+    void prepareNextSegment(const QString& fileName);
+
   signals:
     // emitted to notify RecordingManager
     void bytesRecorded(int bytes);
@@ -52,6 +144,9 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     void durationRecorded(quint64 durationInt);
 
   private:
+    friend class EngineRecordWriteThread;
+    friend class RecordingSegment;
+
     int getActiveTracks();
     // Check if the metadata has changed since the previous check. We also check
     // when was the last check performed to avoid using too much CPU and as well
@@ -60,17 +155,38 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
 
     void writeCueLine();
 
+    // Queues encoded audio of the active segment for the write thread,
+    // which coalesces the small encoded frames into large block writes.
+    void queueEncodedData(const unsigned char* header,
+            const unsigned char* body,
+            int headerLen,
+            int bodyLen);
+
+    // Hands the finished active segment to the write thread for
+    // finalization and starts encoding into the prepared one.
+    void switchToSegment(std::unique_ptr<RecordingSegment> pNextSegment);
+    std::unique_ptr<RecordingSegment> takeNextSegment();
+    void discardNextSegment();
+    // Runs on the write thread (and during shutdown on the sidechain
+    // thread): finalizes segments finished by a split.
+    void finalizeSegments();
+
+    // Runs on the write thread: waits for a whole block of encoded data and
+    // writes it to the file in one go.
+    void processWriteQueue();
+    // Blocks until all queued encoded data has reached the file. Called
+    // before any operation that depends on the file position or size.
+    void flushWriteQueue();
+    void drainWriteFifo(int writeCount);
+
     UserSettingsPointer m_pConfig;
-    EncoderPointer m_pEncoder;
     QString m_encoding;
     QString m_fileName;
     QString m_baTitle;
     QString m_baAuthor;
     QString m_baAlbum;
 
-    QFile m_file;
     QFile m_cueFile;
-    QDataStream m_dataStream;
 
     ControlProxy* m_pRecReady;
     ControlProxy* m_pSamplerate;
@@ -85,4 +201,56 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     QString m_cueFileName;
     quint64 m_cueTrack;
     bool m_bCueIsEnabled;
+
+    // The segment currently being recorded into. Swapped on the
+    // sidechain thread; the write thread only dereferences it while
+    // draining data that was queued after the swap.
+    std::unique_ptr<RecordingSegment> m_pActiveSegment;
+    // The pre-opened segment for the upcoming split, if any. Prepared
+    // on the GUI thread and taken on the sidechain thread.
+    std::unique_ptr<RecordingSegment> m_pNextSegment;
+    QMutex m_nextSegmentMutex;
+    // Segments finished by a split, awaiting finalization on the write
+    // thread.
+    std::vector<std::unique_ptr<RecordingSegment>> m_finalizeQueue;
+    QMutex m_finalizeMutex;
+
+    // Encoded bytes on their way to disk. Written on the sidechain thread by
+    // the encoder callback write() and drained in large coalesced blocks by
+    // m_pWriteThread, so a stalling disk fills this buffer instead of
+    // blocking the sidechain thread and the other workers it services.
+    FIFO<unsigned char> m_writeFifo;
+    QSemaphore m_writeSema;
+    std::unique_ptr<EngineRecordWriteThread> m_pWriteThread;
+    QAtomicInt m_flushRequested;
+    QMutex m_flushMutex;
+    QWaitCondition m_flushDone;
+    // Bytes dropped because the disk stalled for longer than the FIFO can
+    // absorb. Only touched on the sidechain thread.
+    qint64 m_bytesDropped;
+};
+
+// Writes the recording in large blocks on its own thread. Per-frame small
+// writes are a poor I/O pattern especially for FAT formatted USB media, and
+// a write stall on the recording disk must not hold up the sidechain thread.
+class EngineRecordWriteThread : public QThread {
+    Q_OBJECT
+  public:
+    EngineRecordWriteThread(EngineRecord* pRecord)
+            : m_pRecord(pRecord),
+              m_stop(false) {
+    }
+
+    void stop() {
+        m_stop = true;
+    }
+
+  private:
+    void run() override {
+        while (!m_stop) {
+            m_pRecord->processWriteQueue();
+        }
+    }
+    EngineRecord* m_pRecord;
+    bool m_stop;
 };
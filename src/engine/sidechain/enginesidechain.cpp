@@ -13,8 +13,10 @@
 
 #include "engine/engine.h"
 #include "engine/sidechain/sidechainworker.h"
+#include "engine/sidechain/sidechainworkerchannel.h"
 #include "moc_enginesidechain.cpp"
 #include "util/counter.h"
+#include "util/denormalsarezero.h"
 #include "util/event.h"
 #include "util/sample.h"
 #include "util/timer.h"
@@ -49,19 +51,21 @@ EngineSideChain::~EngineSideChain() {
     wait();
 
     MMutexLocker locker(&m_workerLock);
-    while (!m_workers.empty()) {
-        SideChainWorker* pWorker = m_workers.takeLast();
-        pWorker->shutdown();
-        delete pWorker;
+    while (!m_workerChannels.empty()) {
+        // Stops the channel's thread and shuts down and deletes the
+        // worker it owns.
+        delete m_workerChannels.takeLast();
     }
     locker.unlock();
 
     SampleUtil::free(m_pWorkBuffer);
 }
 
-void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker) {
+void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker,
+        const QString& name,
+        int ringSize) {
     MMutexLocker locker(&m_workerLock);
-    m_workers.append(pWorker);
+    m_workerChannels.append(new SideChainWorkerChannel(pWorker, name, ringSize));
 }
 
 void EngineSideChain::receiveBuffer(const AudioInput& input,
@@ -99,6 +103,9 @@ void EngineSideChain::run() {
     // factor this out somehow), -kousu 2/2009
     unsigned static id = 0;
     QThread::currentThread()->setObjectName(QString("EngineSideChain %1").arg(++id));
+    // Sidechain workers (encoders, recording) process float samples on
+    // this thread, so flush denormals to zero here as well.
+    const mixxx::DenormalsAreZeroScope denormalsAreZeroScope;
     static const QString tag("EngineSideChain");
     Event::start(tag);
     while (!m_bStopThread) {
@@ -115,8 +122,10 @@ void EngineSideChain::run() {
                                                  SIDECHAIN_BUFFER_SIZE))) {
             Trace process("EngineSideChain::process");
             MMutexLocker locker(&m_workerLock);
-            foreach (SideChainWorker* pWorker, m_workers) {
-                pWorker->process(m_pWorkBuffer, samples_read);
+            // Fan the samples out into the per-worker rings; the actual
+            // processing happens on the channels' own threads.
+            foreach (SideChainWorkerChannel* pChannel, m_workerChannels) {
+                pChannel->submitSamples(m_pWorkBuffer, samples_read);
             }
         }
 
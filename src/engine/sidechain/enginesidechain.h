@@ -12,6 +12,8 @@
 #include "util/mutex.h"
 #include "util/types.h"
 
+class SideChainWorkerChannel;
+
 class EngineSideChain : public QThread, public AudioDestination {
     Q_OBJECT
   public:
@@ -29,8 +31,14 @@ class EngineSideChain : public QThread, public AudioDestination {
             const CSAMPLE* pBuffer,
             unsigned int iFrames) override;
 
-    // Thread-safe, blocking.
-    void addSideChainWorker(SideChainWorker* pWorker);
+    // Thread-safe, blocking. Takes ownership of pWorker and gives it a
+    // channel with its own ring and drain thread, so a stalling worker
+    // only drops its own samples and never delays the other workers.
+    // The name labels the channel's thread and drop counter; ringSize
+    // is the depth of the channel's ring in samples.
+    void addSideChainWorker(SideChainWorker* pWorker,
+            const QString& name,
+            int ringSize = SIDECHAIN_BUFFER_SIZE);
 
     static const int SIDECHAIN_BUFFER_SIZE = 65536;
 
@@ -50,7 +58,8 @@ class EngineSideChain : public QThread, public AudioDestination {
     // Allows sleeping until we have samples to process.
     QWaitCondition m_waitForSamples;
 
-    // Sidechain workers registered with EngineSideChain.
+    // One channel per registered sidechain worker. This thread only
+    // fans the master mix out into the channels' rings.
     MMutex m_workerLock;
-    QList<SideChainWorker*> m_workers GUARDED_BY(m_workerLock);
+    QList<SideChainWorkerChannel*> m_workerChannels GUARDED_BY(m_workerLock);
 };
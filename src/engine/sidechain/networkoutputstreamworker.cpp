@@ -17,7 +17,7 @@ NetworkOutputStreamWorker::NetworkOutputStreamWorker()
       m_streamStartTimeUs(-1),
       m_streamFramesWritten(0),
       m_writeOverflowCount(0),
-      m_outputDrift(false) {
+      m_outputDriftChunks(0) {
 }
 
 void NetworkOutputStreamWorker::outputAvailable() {
@@ -82,12 +82,16 @@ int NetworkOutputStreamWorker::overflowCount() {
     return m_writeOverflowCount;
 }
 
-void NetworkOutputStreamWorker::setOutputDrift(bool drift) {
-    m_outputDrift = drift;
+void NetworkOutputStreamWorker::incOutputDriftChunks() {
+    m_outputDriftChunks++;
 }
 
-bool NetworkOutputStreamWorker::outputDrift() {
-    return m_outputDrift;
+void NetworkOutputStreamWorker::resetOutputDriftChunks() {
+    m_outputDriftChunks = 0;
+}
+
+int NetworkOutputStreamWorker::outputDriftChunks() const {
+    return m_outputDriftChunks;
 }
 
 int NetworkOutputStreamWorker::getState() {
@@ -68,8 +68,13 @@ class NetworkOutputStreamWorker {
     void incOverflowCount();
     int overflowCount();
 
-    void setOutputDrift(bool drift);
-    bool outputDrift();
+    // Counts the consecutive callback chunks in which the worker's buffer
+    // fill deviated from the target. Frame corrections only start once the
+    // deviation has persisted for several chunks, see
+    // SoundDeviceNetwork::workerWriteProcess().
+    void incOutputDriftChunks();
+    void resetOutputDriftChunks();
+    int outputDriftChunks() const;
 
     int getState();
     int getFunctionCode();
@@ -93,7 +98,7 @@ private:
     qint64 m_streamStartTimeUs;
     qint64 m_streamFramesWritten;
     int m_writeOverflowCount;
-    bool m_outputDrift;
+    int m_outputDriftChunks;
 };
 
 typedef QSharedPointer<NetworkOutputStreamWorker> NetworkOutputStreamWorkerPtr;
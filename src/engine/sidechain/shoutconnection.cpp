@@ -37,6 +37,16 @@ const int kMaxNetworkCache = 491520;  // 10 s mp3 @ 192 kbit/s
 // Shoutcast default receive buffer 1048576 and autodumpsourcetime 30 s
 // http://wiki.shoutcast.com/wiki/SHOUTcast_DNAS_Server_2
 const int kMaxShoutFailures = 3;
+// 128 kB of encoded data waiting for the server, ~5 s mp3 @ 192 kbit/s.
+// Encoded frames are dropped when the send thread cannot empty the FIFO
+// fast enough; blocking the encoder instead would back up into the
+// sidechain FIFO and eventually stall the engine callback.
+const int kEncodedFifoSize = 131072;
+
+// Minimum interval between two metadata requests to the server. The
+// metadata dict always holds the latest values, so rapid track changes
+// collapse into one update per interval.
+const mixxx::Duration kMetaDataMinInterval = mixxx::Duration::fromSeconds(2);
 
 const mixxx::Logger kLogger("ShoutConnection");
 
@@ -67,6 +77,10 @@ ShoutConnection::ShoutConnection(BroadcastProfilePtr profile,
           m_protocol_is_shoutcast(false),
           m_ogg_dynamic_update(false),
           m_threadWaiting(false),
+          m_encodedFifo(kEncodedFifoSize),
+          m_reconnecting(false),
+          m_metaDataPending(false),
+          m_metaDataEverSent(false),
           m_retryCount(0),
           m_reconnectFirstDelay(0.0),
           m_reconnectPeriod(5.0),
@@ -594,8 +608,18 @@ bool ShoutConnection::processConnect() {
 
             m_retryCount = 0;
 
-            if(m_pOutputFifo->readAvailable()) {
-            	m_pOutputFifo->flushReadData(m_pOutputFifo->readAvailable());
+            if (QThread::currentThread() == this &&
+                    m_pOutputFifo->readAvailable()) {
+                // Drop stale input samples. Only safe on the connection
+                // thread, which is the FIFO's reader; when reconnecting from
+                // the send thread the connection thread keeps draining the
+                // FIFO itself.
+                m_pOutputFifo->flushReadData(m_pOutputFifo->readAvailable());
+            }
+            if (m_encodedFifo.readAvailable()) {
+                // Encoded data from before the (re)connect would corrupt the
+                // fresh stream.
+                m_encodedFifo.flushReadData(m_encodedFifo.readAvailable());
             }
             m_threadWaiting = true;
 
@@ -659,14 +683,56 @@ void ShoutConnection::write(const unsigned char* header, const unsigned char* bo
         return;
     }
 
-    // Send header if there is one
-    if (headerLen > 0) {
-        if(!writeSingle(header, headerLen)) {
-            return;
+    // Hand the encoded bytes over to the send thread instead of writing to
+    // the socket from here. The socket can stall or trigger a reconnect for
+    // minutes, and the encoder must keep consuming the sidechain FIFO
+    // during that time.
+    if (m_encodedFifo.writeAvailable() < headerLen + bodyLen) {
+        // The server does not consume the stream fast enough. Drop the
+        // frames instead of blocking the encoder; the stream is interrupted
+        // either way.
+        if (overflowCount() == 0) {
+            kLogger.warning() << "write() send queue full, dropping encoded data";
         }
+        incOverflowCount();
+        return;
     }
+    if (headerLen > 0) {
+        m_encodedFifo.write(header, headerLen);
+    }
+    m_encodedFifo.write(body, bodyLen);
+    m_sendSema.release();
+}
 
-    if(!writeSingle(body, bodyLen)) {
+void ShoutConnection::processSendQueue() {
+    if (!m_sendSema.tryAcquire(1, 1000)) {
+        return;
+    }
+    sendPendingMetaData();
+    const int readAvailable = m_encodedFifo.readAvailable();
+    if (readAvailable <= 0) {
+        return;
+    }
+    if (!m_pShout || m_iShoutStatus != SHOUTERR_CONNECTED) {
+        // The connection went away with data still queued. Drop it, the
+        // stream restarts with fresh encoder headers after a reconnect.
+        m_encodedFifo.flushReadData(readAvailable);
+        return;
+    }
+
+    unsigned char* dataPtr1;
+    ring_buffer_size_t size1;
+    unsigned char* dataPtr2;
+    ring_buffer_size_t size2;
+    // We use size1 and size2, so we can ignore the return value
+    (void)m_encodedFifo.aquireReadRegions(readAvailable, &dataPtr1, &size1,
+            &dataPtr2, &size2);
+    bool sent = writeSingle(dataPtr1, size1);
+    if (sent && size2 > 0) {
+        sent = writeSingle(dataPtr2, size2);
+    }
+    m_encodedFifo.releaseReadRegions(readAvailable);
+    if (!sent) {
         return;
     }
 
@@ -679,6 +745,34 @@ void ShoutConnection::write(const unsigned char* header, const unsigned char* bo
         }
     }
 }
+
+void ShoutConnection::sendPendingMetaData() {
+    if (!m_metaDataPending.loadAcquire()) {
+        return;
+    }
+    if (!m_pShout || m_iShoutStatus != SHOUTERR_CONNECTED) {
+        // Keep the update pending until the connection is back; the dict
+        // holds the latest values either way.
+        return;
+    }
+    if (m_metaDataEverSent &&
+            m_lastMetaDataSentTimer.elapsed() < kMetaDataMinInterval) {
+        // Rate limited; retried on one of the next passes, which happen
+        // at least once per encoded frame batch.
+        return;
+    }
+
+    QMutexLocker locker(&m_shoutMutex);
+    m_metaDataPending.storeRelease(0);
+    int ret = shout_set_metadata(m_pShout, m_pShoutMetaData);
+    locker.unlock();
+
+    m_metaDataEverSent = true;
+    m_lastMetaDataSentTimer.start();
+    if (ret != SHOUTERR_SUCCESS) {
+        kLogger.warning() << "shout_set_metadata fails with error code" << ret;
+    }
+}
 // These are not used for streaming, but the interface requires them
 int ShoutConnection::tell() {
     if (!m_pShout) {
@@ -698,6 +792,7 @@ int ShoutConnection::filelen() {
 
 bool ShoutConnection::writeSingle(const unsigned char* data, size_t len) {
     setFunctionCode(8);
+    m_shoutMutex.lock();
     int ret = shout_send_raw(m_pShout, data, len);
     if (ret == SHOUTERR_BUSY) {
         // in case of busy, frames are queued
@@ -706,7 +801,9 @@ bool ShoutConnection::writeSingle(const unsigned char* data, size_t len) {
         usleep(10000); // wait 10 ms until "busy" is over. TODO() tweak for an optimum.
         // if this fails, the queue is transmitted after the next regular shout_send_raw()
         (void)shout_send_raw(m_pShout, nullptr, 0);
+        m_shoutMutex.unlock();
     } else if (ret < SHOUTERR_SUCCESS) {
+        m_shoutMutex.unlock();
         m_lastErrorStr = shout_get_error(m_pShout);
         kLogger.warning()
                 << "writeSingle() error:"
@@ -716,6 +813,7 @@ bool ShoutConnection::writeSingle(const unsigned char* data, size_t len) {
         }
         return false;
     } else {
+        m_shoutMutex.unlock();
         m_iShoutFailures = 0;
     }
     return true;
@@ -795,6 +893,9 @@ void ShoutConnection::updateMetaData() {
         return;
     }
 
+    // Do not update the metadata while the send thread is inside libshout.
+    QMutexLocker shoutLocker(&m_shoutMutex);
+
     /**
      * If track has changed and static metadata is disabled
      * Send new metadata to broadcast!
@@ -865,10 +966,12 @@ void ShoutConnection::updateMetaData() {
                 insertMetaData("song",  baSong.constData());
             }
             setFunctionCode(11);
-            int ret = shout_set_metadata(m_pShout, m_pShoutMetaData);
-            if (ret != SHOUTERR_SUCCESS) {
-                kLogger.warning() << "shout_set_metadata fails with error code" << ret;
-            }
+            // Queue the update for the send thread. shout_set_metadata()
+            // performs a blocking HTTP request that can stall for seconds
+            // on a slow server -- and a track change is exactly when this
+            // thread can least afford it.
+            m_metaDataPending.storeRelease(1);
+            m_sendSema.release();
         }
     } else {
         // Otherwise we might use static metadata
@@ -886,7 +989,8 @@ void ShoutConnection::updateMetaData() {
             }
 
             setFunctionCode(13);
-            shout_set_metadata(m_pShout, m_pShoutMetaData);
+            m_metaDataPending.storeRelease(1);
+            m_sendSema.release();
             m_firstCall = true;
         }
     }
@@ -952,12 +1056,16 @@ void ShoutConnection::tryReconnect() {
     QString originalErrorStr = m_lastErrorStr;
     setStatus(BroadcastProfile::STATUS_FAILURE);
 
+    // Tell the connection thread that the failure status is transient, so
+    // it keeps draining the sidechain FIFO instead of shutting down.
+    m_reconnecting = true;
     processDisconnect();
     while (waitForRetry()) {
         if (processConnect()) {
             break;
         }
     }
+    m_reconnecting = false;
 
     if (getStatus() == BroadcastProfile::STATUS_FAILURE) {
         QString errorText;
@@ -1015,14 +1123,26 @@ void ShoutConnection::run() {
 
     setStatus(BroadcastProfile::STATUS_CONNECTED);
 
+    // The server socket is serviced by its own, lower priority thread so
+    // that a stalled server or a running reconnect never blocks encoding.
+    m_pSendThread = std::make_unique<ShoutSendThread>(this);
+    m_pSendThread->start(QThread::LowPriority);
+
     while(true) {
-        // Stop the thread if broadcasting is turned off
+        // Stop the thread if broadcasting is turned off. A failure status is
+        // ignored while the send thread runs its reconnect loop.
         if (!m_pProfile->getEnabled()
                 || !m_pBroadcastEnabled->toBool()
-                || getStatus() == BroadcastProfile::STATUS_FAILURE
+                || (getStatus() == BroadcastProfile::STATUS_FAILURE
+                        && !atomicLoadRelaxed(m_reconnecting))
                 || getStatus() == BroadcastProfile::STATUS_UNCONNECTED) {
             m_threadWaiting = false;
             kLogger.debug() << "run: Connection disabled or failed. Disconnecting";
+            // Stop the send thread before closing the connection, it may
+            // still be inside a send or reconnect.
+            m_pSendThread->stop();
+            m_pSendThread->wait();
+            m_pSendThread.reset();
             if(processDisconnect()) {
                 setStatus(BroadcastProfile::STATUS_UNCONNECTED);
             }
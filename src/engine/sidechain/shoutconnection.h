@@ -21,6 +21,8 @@
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
 #include "util/fifo.h"
+#include "util/memory.h"
+#include "util/performancetimer.h"
 
 // Forward declare libshout structures to prevent leaking shout.h definitions
 // beyond where they are needed.
@@ -29,6 +31,8 @@ typedef struct shout shout_t;
 struct _util_dict;
 typedef struct _util_dict shout_metadata_t;
 
+class ShoutSendThread;
+
 class ShoutConnection
         : public QThread, public EncoderCallback, public NetworkOutputStreamWorker {
     Q_OBJECT
@@ -81,9 +85,15 @@ class ShoutConnection
     void broadcastConnected();
 
   private:
+    friend class ShoutSendThread;
+
     bool processConnect();
     bool processDisconnect();
 
+    // Runs on the send thread: drains the encoded stream FIFO and sends it
+    // to the server, triggering a reconnect if the server went away.
+    void processSendQueue();
+
     // Update the libshout struct with info from the current broadcast profile.
     void updateFromPreferences();
     int getActiveTracks();
@@ -93,7 +103,12 @@ class ShoutConnection
     bool metaDataHasChanged();
     // Update broadcast metadata. This does not work for OGG/Vorbis and Icecast,
     // since the actual OGG/Vorbis stream contains the metadata.
+    // Builds the metadata dict and queues it; the blocking
+    // shout_set_metadata() call happens on the send thread.
     void updateMetaData();
+    // Runs on the send thread: performs a queued metadata update, rate
+    // limited to avoid hammering the server during track skipping.
+    void sendPendingMetaData();
     // Common error dialog creation code for run-time exceptions. Notify user
     // when connected or disconnected and so on
     void errorDialog(const QString& text, const QString& detailedError);
@@ -149,6 +164,27 @@ class ShoutConnection
     QSemaphore m_readSema;
     QSharedPointer<FIFO<CSAMPLE>> m_pOutputFifo;
 
+    // Encoded stream bytes on their way to the server. Written by the
+    // encoder callback write() on the connection thread and drained by
+    // m_pSendThread, so a stalled or reconnecting socket fills this buffer
+    // instead of backing up through the encoder into the sidechain FIFO.
+    FIFO<unsigned char> m_encodedFifo;
+    QSemaphore m_sendSema;
+    std::unique_ptr<ShoutSendThread> m_pSendThread;
+    // Serializes libshout access between the send thread and metadata
+    // updates from the connection thread.
+    QMutex m_shoutMutex;
+    // Set while the send thread runs the reconnect loop, so the connection
+    // thread does not treat the transient failure status as a reason to
+    // shut down.
+    QAtomicInt m_reconnecting;
+    // Set when m_pShoutMetaData holds an update that still has to be sent
+    // by the send thread. Intermediate updates are coalesced: the dict
+    // always holds the latest values.
+    QAtomicInt m_metaDataPending;
+    PerformanceTimer m_lastMetaDataSentTimer;
+    bool m_metaDataEverSent;
+
     QString m_lastErrorStr;
     int m_retryCount;
 
@@ -162,4 +198,30 @@ class ShoutConnection
     QWaitCondition m_waitEnabled;
 };
 
+// Services the server socket of a ShoutConnection so that a slow or stalled
+// server never blocks the encoder. Started with a lower priority than the
+// connection thread, the network transfer is not time critical as long as
+// the encoded FIFO does not overflow.
+class ShoutSendThread : public QThread {
+    Q_OBJECT
+  public:
+    ShoutSendThread(ShoutConnection* pConnection)
+            : m_pConnection(pConnection),
+              m_stop(false) {
+    }
+
+    void stop() {
+        m_stop = true;
+    }
+
+  private:
+    void run() override {
+        while (!m_stop) {
+            m_pConnection->processSendQueue();
+        }
+    }
+    ShoutConnection* m_pConnection;
+    bool m_stop;
+};
+
 typedef QSharedPointer<ShoutConnection> ShoutConnectionPtr;
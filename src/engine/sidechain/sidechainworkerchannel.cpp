@@ -0,0 +1,79 @@
+#include "engine/sidechain/sidechainworkerchannel.h"
+
+#include "engine/sidechain/sidechainworker.h"
+#include "moc_sidechainworkerchannel.cpp"
+#include "util/counter.h"
+#include "util/denormalsarezero.h"
+#include "util/sample.h"
+#include "util/trace.h"
+
+SideChainWorkerChannel::SideChainWorkerChannel(SideChainWorker* pWorker,
+        const QString& name,
+        int ringSize)
+        : m_pWorker(pWorker),
+          m_name(name),
+          m_bufferSize(ringSize),
+          m_bStopThread(false),
+          m_sampleFifo(ringSize),
+          m_pWorkBuffer(SampleUtil::alloc(ringSize)) {
+    // Same rationale as for the distributing sidechain thread: the
+    // workers do semi-realtime tasks and must not be starved by the GUI
+    // or non-realtime tasks.
+    start(QThread::HighPriority);
+}
+
+SideChainWorkerChannel::~SideChainWorkerChannel() {
+    m_waitLock.lock();
+    m_bStopThread = true;
+    m_waitForSamples.wakeAll();
+    m_waitLock.unlock();
+
+    // Wait until the thread has finished.
+    wait();
+
+    m_pWorker->shutdown();
+    delete m_pWorker;
+    SampleUtil::free(m_pWorkBuffer);
+}
+
+void SideChainWorkerChannel::submitSamples(const CSAMPLE* pBuffer, int iSamples) {
+    const int samplesWritten = m_sampleFifo.write(pBuffer, iSamples);
+    if (samplesWritten != iSamples) {
+        // The worker has fallen further behind than its ring can
+        // absorb; drop the overflow here instead of stalling the other
+        // workers.
+        Counter(QStringLiteral("SideChainWorkerChannel %1 buffer overrun")
+                        .arg(m_name))
+                .increment();
+    }
+
+    if (m_sampleFifo.writeAvailable() < m_bufferSize / 5) {
+        // Signal to the worker thread that samples are available.
+        m_waitForSamples.wakeAll();
+    }
+}
+
+void SideChainWorkerChannel::run() {
+    QThread::currentThread()->setObjectName(
+            QStringLiteral("SideChainWorkerChannel %1").arg(m_name));
+    // The worker processes float samples on this thread, so flush
+    // denormals to zero here as well.
+    const mixxx::DenormalsAreZeroScope denormalsAreZeroScope;
+    while (!m_bStopThread) {
+        // Sleep until samples are available.
+        m_waitLock.lock();
+        m_waitForSamples.wait(&m_waitLock);
+        m_waitLock.unlock();
+
+        int samplesRead;
+        while ((samplesRead = m_sampleFifo.read(m_pWorkBuffer, m_bufferSize))) {
+            Trace process("SideChainWorkerChannel::process");
+            m_pWorker->process(m_pWorkBuffer, samplesRead);
+        }
+
+        // Check to see if we're supposed to exit/stop this thread.
+        if (m_bStopThread) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+
+#include "util/fifo.h"
+#include "util/types.h"
+
+class SideChainWorker;
+
+// Decouples one sidechain worker from the others: each worker drains its
+// own SPSC ring on its own thread, so a stalling consumer (e.g. an
+// encoder blocked on I/O) only fills its own ring and starts dropping
+// its own samples instead of delaying the workers behind it in the
+// chain.
+class SideChainWorkerChannel : public QThread {
+    Q_OBJECT
+  public:
+    // Takes ownership of pWorker. The ring holds ringSize samples; a
+    // worker that falls further behind than that loses the overflowing
+    // samples, counted under the given name.
+    SideChainWorkerChannel(SideChainWorker* pWorker,
+            const QString& name,
+            int ringSize);
+    ~SideChainWorkerChannel() override;
+
+    // Wait-free. Called by the distributing sidechain thread; samples
+    // that do not fit into the ring are dropped.
+    void submitSamples(const CSAMPLE* pBuffer, int iSamples);
+
+  private:
+    void run() override;
+
+    SideChainWorker* m_pWorker;
+    const QString m_name;
+    const int m_bufferSize;
+    // Indicates that the thread should exit.
+    volatile bool m_bStopThread;
+
+    FIFO<CSAMPLE> m_sampleFifo;
+    CSAMPLE* m_pWorkBuffer;
+
+    // Provides thread safety around the wait condition below.
+    QMutex m_waitLock;
+    // Allows sleeping until we have samples to process.
+    QWaitCondition m_waitForSamples;
+};
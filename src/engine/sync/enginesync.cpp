@@ -6,6 +6,7 @@
 #include "engine/channels/enginechannel.h"
 #include "engine/enginebuffer.h"
 #include "engine/sync/internalclock.h"
+#include "engine/sync/midiclockticker.h"
 #include "util/assert.h"
 #include "util/logger.h"
 
@@ -17,6 +18,7 @@ const QString kInternalClockGroup = QStringLiteral("[InternalClock]");
 EngineSync::EngineSync(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_pInternalClock(new InternalClock(kInternalClockGroup, this)),
+          m_pMidiClockTicker(new MidiClockTicker()),
           m_pMasterSyncable(nullptr) {
     qRegisterMetaType<SyncMode>("SyncMode");
     m_pInternalClock->setMasterBpm(124.0);
@@ -25,6 +27,7 @@ EngineSync::EngineSync(UserSettingsPointer pConfig)
 EngineSync::~EngineSync() {
     // We use the slider value because that is never set to 0.0.
     m_pConfig->set(ConfigKey(kInternalClockGroup, "bpm"), ConfigValue(m_pInternalClock->getBpm()));
+    delete m_pMidiClockTicker;
     delete m_pInternalClock;
 }
 
@@ -511,6 +514,10 @@ void EngineSync::onCallbackStart(int sampleRate, int bufferSize) {
 
 void EngineSync::onCallbackEnd(int sampleRate, int bufferSize) {
     m_pInternalClock->onCallbackEnd(sampleRate, bufferSize);
+    // After the internal clock has advanced so the master beat distance
+    // reflects the end of the buffer that was just produced.
+    m_pMidiClockTicker->onCallbackEnd(
+            sampleRate, bufferSize, masterBpm(), masterBeatDistance());
 }
 
 EngineChannel* EngineSync::getMaster() const {
@@ -7,6 +7,7 @@
 
 class InternalClock;
 class EngineChannel;
+class MidiClockTicker;
 
 /// EngineSync is the heart of the Mixxx Sync Lock engine.  It knows which objects
 /// (Decks, Internal Clock, etc) are participating in Sync and what their statuses
@@ -60,6 +61,12 @@ class EngineSync : public SyncableListener {
     void onCallbackStart(int sampleRate, int bufferSize);
     void onCallbackEnd(int sampleRate, int bufferSize);
 
+    /// The MIDI beat clock source, driven from onCallbackEnd. Used to wire
+    /// its tick signal to the controller subsystem at startup.
+    MidiClockTicker* getMidiClockTicker() const {
+        return m_pMidiClockTicker;
+    }
+
   private:
     /// Iterate over decks, and based on sync and play status, pick a new master.
     /// if enabling_syncable is not null, we treat it as if it were enabled because we may
@@ -156,6 +163,8 @@ class EngineSync : public SyncableListener {
     UserSettingsPointer m_pConfig;
     /// The InternalClock syncable.
     InternalClock* m_pInternalClock;
+    /// Emits 24 ppqn MIDI clock ticks derived from the master transport.
+    MidiClockTicker* m_pMidiClockTicker;
     /// The current Syncable that is the leader.
     Syncable* m_pMasterSyncable;
     /// The list of all Syncables registered via addSyncableDeck.
@@ -0,0 +1,76 @@
+#include "engine/sync/midiclockticker.h"
+
+#include <cmath>
+
+#include "control/controlpushbutton.h"
+#include "moc_midiclockticker.cpp"
+#include "preferences/usersettings.h"
+
+namespace {
+const QString kMidiClockGroup = QStringLiteral("[MidiClock]");
+
+// MIDI beat clock runs at 24 pulses per quarter note.
+constexpr int kPulsesPerBeat = 24;
+
+// A beat distance advance larger than this within a single callback means
+// the master seeked or sync was handed off to another deck. In that case we
+// resynchronize silently instead of bursting the missed ticks, which would
+// make slaved gear sprint to catch up.
+constexpr double kMaxBeatDistanceAdvance = 0.5;
+} // anonymous namespace
+
+MidiClockTicker::MidiClockTicker()
+        : m_pOutputEnabled(new ControlPushButton(
+                  ConfigKey(kMidiClockGroup, "output_enabled"), true)),
+          m_dLastBeatDistance(0.0) {
+    m_pOutputEnabled->setButtonMode(ControlPushButton::TOGGLE);
+}
+
+MidiClockTicker::~MidiClockTicker() {
+}
+
+void MidiClockTicker::onCallbackEnd(int sampleRate,
+        int bufferSize,
+        double masterBpm,
+        double masterBeatDistance) {
+    const double lastBeatDistance = m_dLastBeatDistance;
+    m_dLastBeatDistance = masterBeatDistance;
+
+    if (!m_pOutputEnabled->toBool()) {
+        return;
+    }
+    if (sampleRate <= 0 || bufferSize <= 0 || masterBpm <= 0.0) {
+        return;
+    }
+
+    double advance = masterBeatDistance - lastBeatDistance;
+    if (advance < 0.0) {
+        // The beat distance wrapped at a beat boundary.
+        advance += 1.0;
+    }
+    if (advance <= 0.0 || advance > kMaxBeatDistanceAdvance) {
+        // Transport is stopped, or the master seeked / changed. Resync.
+        return;
+    }
+
+    const int firstTick =
+            static_cast<int>(std::floor(lastBeatDistance * kPulsesPerBeat)) + 1;
+    const int lastTick = static_cast<int>(
+            std::floor((lastBeatDistance + advance) * kPulsesPerBeat));
+    if (lastTick < firstTick) {
+        return;
+    }
+
+    // bufferSize counts interleaved stereo samples, so the buffer spans
+    // bufferSize / 2 frames. Map beat distance linearly onto that span to
+    // place each tick at its frame-accurate time within the buffer.
+    const double bufferSeconds = bufferSize / 2.0 / sampleRate;
+    const double secondsPerBeat = bufferSeconds / advance;
+    const double firstTickOffsetSeconds =
+            (static_cast<double>(firstTick) / kPulsesPerBeat - lastBeatDistance) *
+            secondsPerBeat;
+
+    emit midiClockTicks(lastTick - firstTick + 1,
+            firstTickOffsetSeconds,
+            secondsPerBeat / kPulsesPerBeat);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QObject>
+#include <QScopedPointer>
+
+class ControlPushButton;
+
+/// MidiClockTicker derives 24 ppqn MIDI beat clock ticks from the sync master
+/// transport. EngineSync drives it once per callback from onCallbackEnd(), so
+/// the tick positions come straight from the beat distance the engine just
+/// rendered instead of from a GUI-thread timer. Each tick carries a
+/// sample-accurate offset into the buffer so controller backends with
+/// timestamped send APIs (e.g. PortMidi) can schedule the bytes on the wire
+/// instead of sending them whenever the controller thread wakes up.
+class MidiClockTicker : public QObject {
+    Q_OBJECT
+  public:
+    MidiClockTicker();
+    ~MidiClockTicker() override;
+
+    /// Called by EngineSync at the end of every engine callback with the
+    /// master BPM and beat distance for the buffer that was just produced.
+    /// Emits midiClockTicks() for every 1/24 beat boundary the buffer
+    /// crossed. Not reentrant; only call from the engine callback.
+    void onCallbackEnd(int sampleRate,
+            int bufferSize,
+            double masterBpm,
+            double masterBeatDistance);
+
+  signals:
+    /// One signal per buffer that contained ticks. The offsets are seconds
+    /// relative to the start of the buffer the engine just produced;
+    /// tick i is at firstTickOffsetSeconds + i * tickIntervalSeconds.
+    void midiClockTicks(int tickCount,
+            double firstTickOffsetSeconds,
+            double tickIntervalSeconds);
+
+  private:
+    QScopedPointer<ControlPushButton> m_pOutputEnabled;
+
+    // Master beat distance at the end of the previous callback, used to
+    // detect which tick boundaries this callback crossed.
+    double m_dLastBeatDistance;
+};
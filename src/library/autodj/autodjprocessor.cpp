@@ -7,6 +7,7 @@
 #include "mixer/basetrackplayer.h"
 #include "mixer/playermanager.h"
 #include "moc_autodjprocessor.cpp"
+#include "track/loudnesscurve.h"
 #include "track/track.h"
 #include "util/math.h"
 
@@ -17,6 +18,14 @@ const char* kTransitionModePreferenceName = "TransitionMode";
 const double kTransitionPreferenceDefault = 10.0;
 const double kKeepPosition = -1.0;
 
+// Reference level of the ReplayGain 2.0 values written by AnalyzerEbur128.
+const double kReplayGain2ReferenceLUFS = -18;
+// Bounds for the per-transition pregain correction. Corrections below the
+// minimum are inaudible and not worth touching the deck for; corrections
+// above the maximum indicate unreliable loudness data.
+const double kMinTransitionGainDb = 0.5;
+const double kMaxTransitionGainDb = 6.0;
+
 const mixxx::audio::ChannelCount kChannelCount = mixxx::kEngineChannelCount;
 
 static const bool sDebug = false;
@@ -43,6 +52,7 @@ DeckAttributes::DeckAttributes(int index,
           m_trackSamples(group, "track_samples"),
           m_sampleRate(group, "track_samplerate"),
           m_rateRatio(group, "rate_ratio"),
+          m_pregain(group, "pregain"),
           m_pPlayer(pPlayer) {
     connect(m_pPlayer, &BaseTrackPlayer::newTrackLoaded,
             this, &DeckAttributes::slotTrackLoaded);
@@ -120,12 +130,34 @@ AutoDJProcessor::AutoDJProcessor(
           m_pAutoDJTableModel(nullptr),
           m_eState(ADJ_DISABLED),
           m_transitionProgress(0.0),
+          m_pTransitionGainDeck(nullptr),
+          m_transitionGainOriginalPregain(1.0),
           m_transitionTime(kTransitionPreferenceDefault) {
     m_pAutoDJTableModel = new PlaylistTableModel(this, pTrackCollectionManager,
                                                  "mixxx.db.model.autodj");
     m_pAutoDJTableModel->setTableModel(iAutoDJPlaylistId);
     m_pAutoDJTableModel->select();
 
+    // Resolve the new top of the queue ahead of time whenever the playlist
+    // changes, so its Track object with metadata and cue points is already
+    // cached when it is loaded into a deck.
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::rowsInserted,
+            this,
+            &AutoDJProcessor::maybePrefetchNextTrack);
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::rowsRemoved,
+            this,
+            &AutoDJProcessor::maybePrefetchNextTrack);
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::rowsMoved,
+            this,
+            &AutoDJProcessor::maybePrefetchNextTrack);
+    connect(m_pAutoDJTableModel,
+            &PlaylistTableModel::modelReset,
+            this,
+            &AutoDJProcessor::maybePrefetchNextTrack);
+
     m_pShufflePlaylist = new ControlPushButton(
             ConfigKey("[AutoDJ]", "shuffle_playlist"));
     connect(m_pShufflePlaylist, &ControlPushButton::valueChanged,
@@ -549,12 +581,15 @@ AutoDJProcessor::AutoDJError AutoDJProcessor::toggleAutoDJ(bool enable) {
             }
         }
         emitAutoDJStateChanged(m_eState);
+        maybePrefetchNextTrack();
     } else {  // Disable Auto DJ
         if (m_pEnabledAutoDJ->get() != 0.0) {
             m_pEnabledAutoDJ->set(0.0);
         }
         qDebug() << "Auto DJ disabled";
         m_eState = ADJ_DISABLED;
+        m_pPrefetchedNextTrack.reset();
+        resetTransitionGain();
         disconnect(m_pCOCrossfader,
                 &ControlProxy::valueChanged,
                 this,
@@ -733,6 +768,7 @@ void AutoDJProcessor::playerPositionChanged(DeckAttributes* pAttributes,
                 setCrossfader(1.0);
             }
             m_eState = ADJ_IDLE;
+            resetTransitionGain();
             // Invalidate threshold calculated for the old otherDeck
             // This avoids starting a fade back before the new track is
             // loaded into the otherDeck
@@ -785,6 +821,11 @@ void AutoDJProcessor::playerPositionChanged(DeckAttributes* pAttributes,
 
                 if (thisDeck->fadeBeginPos >= thisDeck->fadeEndPos) {
                     setCrossfader(thisDeck->isLeft() ? 1.0 : -1.0);
+                } else {
+                    // Plan the gain staging for the whole fade up front
+                    // from the precomputed loudness curves instead of
+                    // correcting levels during the transition.
+                    applyTransitionGain(thisDeck, otherDeck);
                 }
 
                 // Now that we have started the other deck playing, remove the track
@@ -814,6 +855,9 @@ void AutoDJProcessor::playerPositionChanged(DeckAttributes* pAttributes,
             // P1/P2FADING case above).
             thisDeck->stop();
             m_transitionProgress = 1.0;
+            // The incoming track is past the overlapping region, so the
+            // loudness correction calculated for it no longer applies.
+            resetTransitionGain();
             // Note: If the user has stopped the toDeck during the transition.
             // this deck just stops as well. In this case a stopped AutoDJ is accepted
             // because the use did it intentionally
@@ -874,6 +918,33 @@ TrackPointer AutoDJProcessor::getNextTrackFromQueue() {
     }
 }
 
+void AutoDJProcessor::maybePrefetchNextTrack() {
+    if (m_eState == ADJ_DISABLED) {
+        m_pPrefetchedNextTrack.reset();
+        return;
+    }
+
+    // Unlike getNextTrackFromQueue() this must not modify the playlist,
+    // since it is called from the model's change signals.
+    TrackPointer pNextTrack = m_pAutoDJTableModel->getTrack(
+            m_pAutoDJTableModel->index(0, 0));
+    if (pNextTrack == m_pPrefetchedNextTrack) {
+        return;
+    }
+
+    if (pNextTrack) {
+        // Touch the file metadata now so the existence check in
+        // getNextTrackFromQueue() does not stall on a slow disk in the
+        // middle of a transition.
+        pNextTrack->getFileInfo().checkFileExists();
+    }
+
+    // Holding the reference keeps the track and its cue points in the
+    // GlobalTrackCache until it is loaded into a deck or leaves the top of
+    // the queue.
+    m_pPrefetchedNextTrack = pNextTrack;
+}
+
 bool AutoDJProcessor::loadNextTrackFromQueue(const DeckAttributes& deck, bool play) {
     TrackPointer nextTrack = getNextTrackFromQueue();
 
@@ -1147,6 +1218,86 @@ double AutoDJProcessor::samplePositionToSeconds(double samplePosition, DeckAttri
     return samplePosition / sampleRate / pDeck->rateRatio();
 }
 
+void AutoDJProcessor::applyTransitionGain(
+        DeckAttributes* pFromDeck, DeckAttributes* pToDeck) {
+    resetTransitionGain();
+
+    TrackPointer pFromTrack = pFromDeck->getLoadedTrack();
+    TrackPointer pToTrack = pToDeck->getLoadedTrack();
+    if (!pFromTrack || !pToTrack) {
+        return;
+    }
+    // The correction is relative to the integrated loudness that the
+    // ReplayGain stage in EnginePregain already aligns between both
+    // decks. Without valid gains there is no common reference level to
+    // correct against.
+    const mixxx::ReplayGain fromGain = pFromTrack->getReplayGain();
+    const mixxx::ReplayGain toGain = pToTrack->getReplayGain();
+    if (!fromGain.hasRatio() || !toGain.hasRatio()) {
+        return;
+    }
+    const mixxx::LoudnessCurve fromCurve = pFromTrack->getLoudnessCurve();
+    const mixxx::LoudnessCurve toCurve = pToTrack->getLoudnessCurve();
+    if (!fromCurve.isValid() || !toCurve.isValid()) {
+        return;
+    }
+    const mixxx::audio::SampleRate fromSampleRate = pFromDeck->sampleRate();
+    const mixxx::audio::SampleRate toSampleRate = pToDeck->sampleRate();
+    if (!fromSampleRate.isValid() || !toSampleRate.isValid()) {
+        return;
+    }
+
+    // The curves are indexed by track seconds, independent of the
+    // playback rate, so convert the position fractions directly.
+    const double fromTailStart = pFromDeck->fadeBeginPos *
+            pFromDeck->trackSamples() / kChannelCount / fromSampleRate;
+    const double fromTailEnd = pFromDeck->fadeEndPos *
+            pFromDeck->trackSamples() / kChannelCount / fromSampleRate;
+    const double toStartPos = pToDeck->startPos == kKeepPosition
+            ? pToDeck->playPosition()
+            : pToDeck->startPos;
+    const double toHeadStart = toStartPos *
+            pToDeck->trackSamples() / kChannelCount / toSampleRate;
+    const double toHeadEnd = toHeadStart + (fromTailEnd - fromTailStart);
+
+    const double fromTailLufs = fromCurve.averageLufs(fromTailStart, fromTailEnd);
+    const double toHeadLufs = toCurve.averageLufs(toHeadStart, toHeadEnd);
+    if (fromTailLufs == -HUGE_VAL || toHeadLufs == -HUGE_VAL) {
+        return;
+    }
+
+    // How much the overlapping regions deviate from the integrated
+    // loudness of their normalized tracks. The integrated loudness is
+    // reconstructed from the ReplayGain 2.0 ratio.
+    const double fromTailDb = fromTailLufs -
+            (kReplayGain2ReferenceLUFS - ratio2db(fromGain.getRatio()));
+    const double toHeadDb = toHeadLufs -
+            (kReplayGain2ReferenceLUFS - ratio2db(toGain.getRatio()));
+    const double correctionDb = math_clamp(fromTailDb - toHeadDb,
+            -kMaxTransitionGainDb,
+            kMaxTransitionGainDb);
+    if (fabs(correctionDb) < kMinTransitionGainDb) {
+        return;
+    }
+
+    if (sDebug) {
+        qDebug() << this << "applyTransitionGain" << pToDeck->group
+                 << "correction:" << correctionDb << "dB";
+    }
+    m_pTransitionGainDeck = pToDeck;
+    m_transitionGainOriginalPregain = pToDeck->pregain();
+    pToDeck->setPregain(
+            m_transitionGainOriginalPregain * db2ratio(correctionDb));
+}
+
+void AutoDJProcessor::resetTransitionGain() {
+    if (m_pTransitionGainDeck == nullptr) {
+        return;
+    }
+    m_pTransitionGainDeck->setPregain(m_transitionGainOriginalPregain);
+    m_pTransitionGainDeck = nullptr;
+}
+
 void AutoDJProcessor::calculateTransition(DeckAttributes* pFromDeck,
         DeckAttributes* pToDeck,
         bool seekToStartPoint) {
@@ -1487,6 +1638,12 @@ void AutoDJProcessor::playerLoadingTrack(DeckAttributes* pDeck,
 
     pDeck->loading = true;
 
+    // Do not carry a loudness correction calculated for the old track
+    // over to the new one.
+    if (pDeck == m_pTransitionGainDeck) {
+        resetTransitionGain();
+    }
+
     // The Deck is loading an new track
 
     // There are four conditions under which we load a track.
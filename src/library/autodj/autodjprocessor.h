@@ -89,6 +89,14 @@ class DeckAttributes : public QObject {
         return m_rateRatio.get();
     }
 
+    double pregain() const {
+        return m_pregain.get();
+    }
+
+    void setPregain(double pregain) {
+        m_pregain.set(pregain);
+    }
+
     TrackPointer getLoadedTrack() const;
 
   signals:
@@ -136,6 +144,7 @@ class DeckAttributes : public QObject {
     ControlProxy m_trackSamples;
     ControlProxy m_sampleRate;
     ControlProxy m_rateRatio;
+    ControlProxy m_pregain;
     BaseTrackPlayer* m_pPlayer;
 };
 
@@ -220,6 +229,8 @@ class AutoDJProcessor : public QObject {
     void playerEmpty(DeckAttributes* pDeck);
     void playerRateChanged(DeckAttributes* pDeck);
 
+    void maybePrefetchNextTrack();
+
     void controlEnable(double value);
     void controlFadeNow(double value);
     void controlShuffle(double value);
@@ -268,6 +279,15 @@ class AutoDJProcessor : public QObject {
     DeckAttributes* getOtherDeck(const DeckAttributes* pThisDeck);
     DeckAttributes* getFromDeck();
 
+    // Precomputes a pregain correction for the incoming deck from the
+    // short-term loudness curves of both tracks so the overlapping
+    // regions sum at matched loudness during the fade. Called once when
+    // a fade starts; a no-op if either track lacks a loudness curve or
+    // a ReplayGain value.
+    void applyTransitionGain(DeckAttributes* pFromDeck, DeckAttributes* pToDeck);
+    // Restores the pregain of the deck adjusted by applyTransitionGain().
+    void resetTransitionGain();
+
     // Removes the track loaded to the player group from the top of the AutoDJ
     // queue if it is present.
     bool removeLoadedTrackFromTopOfQueue(const DeckAttributes& deck);
@@ -280,8 +300,19 @@ class AutoDJProcessor : public QObject {
     PlayerManagerInterface* m_pPlayerManager;
     PlaylistTableModel* m_pAutoDJTableModel;
 
+    // Keeps the track at the top of the queue alive in the GlobalTrackCache
+    // between queue changes so loading it into a deck does not hit the
+    // database or a slow disk at transition time. Updated by
+    // maybePrefetchNextTrack().
+    TrackPointer m_pPrefetchedNextTrack;
+
     AutoDJState m_eState;
     double m_transitionProgress;
+
+    // Deck whose pregain is currently offset by a transition gain
+    // correction, or nullptr. See applyTransitionGain().
+    DeckAttributes* m_pTransitionGainDeck;
+    double m_transitionGainOriginalPregain;
     double m_transitionTime; // the desired value set by the user
     TransitionMode m_transitionMode;
 
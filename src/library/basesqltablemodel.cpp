@@ -191,6 +191,16 @@ void BaseSqlTableModel::replaceRows(
 }
 
 void BaseSqlTableModel::select() {
+    // The underlying table may have changed, so the cached base rows of
+    // a previous select must not be reused. Only search() bypasses this
+    // invalidation since the search text does not affect the table.
+    m_baseRowsQueryString.clear();
+    m_baseRowInfos.clear();
+    m_baseTrackIds.clear();
+    selectImpl();
+}
+
+void BaseSqlTableModel::selectImpl() {
     if (!m_bInitialized) {
         return;
     }
@@ -216,62 +226,86 @@ void BaseSqlTableModel::select() {
     QString queryString = QString("SELECT %1 FROM %2 %3")
                                   .arg(m_tableColumns.join(","), m_tableName, m_tableOrderBy);
 
-    if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
-    }
-
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    if (!query.prepare(queryString)) {
-        LOG_FAILED_QUERY(query);
-        return;
-    }
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
-        return;
-    }
-
-    // Remove all the rows from the table after(!) the query has been
-    // executed successfully. See Bug #1090888.
-    // TODO(rryan) we could edit the table in place instead of clearing it?
-    clearRows();
-
-    // The size of the result set is not known in advance for a
-    // forward-only query, so we cannot reserve memory for rows
-    // in advance.
     QVector<RowInfo> rowInfos;
     QSet<TrackId> trackIds;
-    int idColumn = -1;
-    while (query.next()) {
-        QSqlRecord sqlRecord = query.record();
+    if (queryString == m_baseRowsQueryString && !m_baseRowInfos.isEmpty()) {
+        // Incremental search over an unchanged table: reuse the base rows
+        // from the previous select instead of re-running the table query
+        // and re-materializing every row. Only the filtered id query below
+        // remains, which keeps search-as-you-type responsive on large
+        // libraries.
+        if (sDebug) {
+            qDebug() << this << "select() reusing" << m_baseRowInfos.size()
+                     << "cached base rows";
+        }
+        rowInfos = m_baseRowInfos;
+        trackIds = m_baseTrackIds;
+        clearRows();
+    } else {
+        if (sDebug) {
+            qDebug() << this << "select() executing:" << queryString;
+        }
 
-        if (idColumn < 0) {
-            idColumn = sqlRecord.indexOf(m_idColumn);
+        QSqlQuery query(m_database);
+        // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+        // won't allocate a giant in-memory table that we won't use at all.
+        query.setForwardOnly(true);
+        if (!query.prepare(queryString)) {
+            LOG_FAILED_QUERY(query);
+            return;
         }
-        VERIFY_OR_DEBUG_ASSERT(idColumn >= 0) {
-            qCritical()
-                    << "ID column not available in database query results:"
-                    << m_idColumn;
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
             return;
         }
-        // TODO(XXX): Can we get rid of the hard-coded assumption that
-        // the the first column always contains the id?
-        DEBUG_ASSERT(idColumn == kIdColumn);
-
-        TrackId trackId(sqlRecord.value(idColumn));
-        trackIds.insert(trackId);
-
-        RowInfo rowInfo;
-        rowInfo.trackId = trackId;
-        // current position defines the ordering
-        rowInfo.order = rowInfos.size();
-        rowInfo.metadata.reserve(sqlRecord.count());
-        for (int i = 0; i < m_tableColumns.size(); ++i) {
-            rowInfo.metadata.push_back(sqlRecord.value(i));
+
+        // Remove all the rows from the table after(!) the query has been
+        // executed successfully. See Bug #1090888.
+        // TODO(rryan) we could edit the table in place instead of clearing it?
+        clearRows();
+
+        // The size of the result set is not known in advance for a
+        // forward-only query, but the row count of the previous select()
+        // is a good estimate for reserving memory.
+        rowInfos.reserve(m_rowInfo.size());
+        trackIds.reserve(m_rowInfo.size());
+        const int columnCount = m_tableColumns.size();
+        int idColumn = -1;
+        while (query.next()) {
+            if (idColumn < 0) {
+                idColumn = query.record().indexOf(m_idColumn);
+            }
+            VERIFY_OR_DEBUG_ASSERT(idColumn >= 0) {
+                qCritical()
+                        << "ID column not available in database query results:"
+                        << m_idColumn;
+                return;
+            }
+            // TODO(XXX): Can we get rid of the hard-coded assumption that
+            // the the first column always contains the id?
+            DEBUG_ASSERT(idColumn == kIdColumn);
+
+            TrackId trackId(query.value(idColumn));
+            trackIds.insert(trackId);
+
+            RowInfo rowInfo;
+            rowInfo.trackId = trackId;
+            // current position defines the ordering
+            rowInfo.order = rowInfos.size();
+            rowInfo.metadata.reserve(columnCount);
+            for (int i = 0; i < columnCount; ++i) {
+                rowInfo.metadata.push_back(query.value(i));
+            }
+            rowInfos.push_back(std::move(rowInfo));
         }
-        rowInfos.push_back(rowInfo);
+
+        // Cache the pristine base rows for subsequent incremental
+        // searches. The later reordering detaches rowInfos, so the
+        // cached copy keeps the original row order. The per-row
+        // metadata remains implicitly shared.
+        m_baseRowsQueryString = queryString;
+        m_baseRowInfos = rowInfos;
+        m_baseTrackIds = trackIds;
     }
 
     if (sDebug) {
@@ -414,8 +448,18 @@ void BaseSqlTableModel::search(const QString& searchText, const QString& extraFi
     if (sDebug) {
         qDebug() << this << "search" << searchText;
     }
+    // Repeated queries with unchanged criteria would select the very
+    // same results again. The conditions mirror setSearch() below.
+    const bool searchIsDifferent = m_currentSearch.isNull() || m_currentSearch != searchText;
+    const bool filterDisabled = (m_currentSearchFilter.isNull() && extraFilter.isNull());
+    const bool searchFilterIsDifferent = m_currentSearchFilter != extraFilter;
+    if (!searchIsDifferent && (filterDisabled || !searchFilterIsDifferent)) {
+        return;
+    }
     setSearch(searchText, extraFilter);
-    select();
+    // Changing the search does not touch the underlying table, so the
+    // cached base rows of the previous select can be reused.
+    selectImpl();
 }
 
 void BaseSqlTableModel::setSort(int column, Qt::SortOrder order) {
@@ -811,16 +855,38 @@ void BaseSqlTableModel::tracksChanged(const QSet<TrackId>& trackIds) {
         qDebug() << this << "trackChanged" << trackIds.size();
     }
 
-    const int numColumns = columnCount();
+    // Map the changed tracks to rows via the id->row index and coalesce
+    // the rows into contiguous ranges. A batch of track updates (e.g.
+    // while a visible crate is being analyzed) then results in a few
+    // dataChanged signals instead of one per row, each of which would
+    // trigger a separate view update.
+    QVector<int> rows;
     for (const auto& trackId : trackIds) {
-        const auto rows = getTrackRows(trackId);
-        for (int row : rows) {
+        const auto trackRows = getTrackRows(trackId);
+        for (int row : trackRows) {
             //qDebug() << "Row in this result set was updated. Signalling update. track:" << trackId << "row:" << row;
-            QModelIndex topLeft = index(row, 0);
-            QModelIndex bottomRight = index(row, numColumns);
-            emit dataChanged(topLeft, bottomRight);
+            rows.append(row);
+        }
+    }
+    if (rows.isEmpty()) {
+        return;
+    }
+    std::sort(rows.begin(), rows.end());
+
+    const int lastColumn = columnCount() - 1;
+    int firstRow = rows.first();
+    int lastRow = firstRow;
+    for (int i = 1; i < rows.size(); ++i) {
+        const int row = rows.at(i);
+        if (row <= lastRow + 1) {
+            lastRow = row;
+            continue;
         }
+        emit dataChanged(index(firstRow, 0), index(lastRow, lastColumn));
+        firstRow = row;
+        lastRow = row;
     }
+    emit dataChanged(index(firstRow, 0), index(lastRow, lastColumn));
 }
 
 void BaseSqlTableModel::hideTracks(const QModelIndexList& indices) {
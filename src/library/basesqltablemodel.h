@@ -136,8 +136,21 @@ class BaseSqlTableModel : public BaseTrackTableModel {
             QVector<RowInfo>&& rows,
             TrackId2Rows&& trackIdToRows);
 
+    // Runs the select, reusing the cached base rows of the table query
+    // if they are still valid. select() invalidates them first, while
+    // search() keeps them because changing the search text does not
+    // affect the underlying table.
+    void selectImpl();
+
     QVector<RowInfo> m_rowInfo;
 
+    // Unfiltered result of the table query cached across incremental
+    // searches. The heavyweight per-row metadata is implicitly shared
+    // with m_rowInfo, so the copy only duplicates the row structs.
+    QString m_baseRowsQueryString;
+    QVector<RowInfo> m_baseRowInfos;
+    QSet<TrackId> m_baseTrackIds;
+
     QString m_tableName;
     QString m_idColumn;
     QSharedPointer<BaseTrackCache> m_trackSource;
@@ -1,5 +1,8 @@
 #include "library/basetrackcache.h"
 
+#include <algorithm>
+#include <cstddef>
+
 #include "library/queryutil.h"
 #include "library/searchqueryparser.h"
 #include "library/trackcollection.h"
@@ -14,6 +17,22 @@ namespace {
 
 constexpr bool sDebug = false;
 
+// Upper bound for the number of materialized search results. Large enough
+// to cover switching between a set of saved searches, small enough to keep
+// the memory overhead negligible.
+constexpr std::size_t kMaxMaterializedSearches = 16;
+
+// Returns true if the query consists only of plain search terms without any
+// operator syntax. Only for such queries appending characters is guaranteed
+// to narrow down the set of matching tracks; negations, quotes and field
+// filters (e.g. 'bpm:120') can widen it again.
+bool isPlainSearchTerms(const QString& query) {
+    return !query.contains(QLatin1Char(':')) &&
+            !query.contains(QLatin1Char('-')) &&
+            !query.contains(QLatin1Char('"')) &&
+            !query.contains(QLatin1Char('~'));
+}
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -78,6 +97,7 @@ void BaseTrackCache::slotTracksAddedOrChanged(const QSet<TrackId>& trackIds) {
         qDebug() << this << "slotTracksAddedOrChanged" << trackIds.size();
     }
     updateTracksInIndex(trackIds);
+    invalidateMaterializedSearches(trackIds);
 }
 
 void BaseTrackCache::slotScanTrackAdded(TrackPointer pTrack) {
@@ -95,6 +115,7 @@ void BaseTrackCache::slotTracksRemoved(const QSet<TrackId>& trackIds) {
         m_trackInfo.remove(trackId);
         m_dirtyTracks.remove(trackId);
     }
+    invalidateMaterializedSearches(trackIds);
 }
 
 void BaseTrackCache::slotTrackDirty(TrackId trackId) {
@@ -111,6 +132,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
     m_dirtyTracks.remove(trackId);
     // The track might have been reloaded from the database
     updateTrackInIndex(trackId);
+    invalidateMaterializedSearches(QSet<TrackId>{trackId});
 }
 
 bool BaseTrackCache::isCached(TrackId trackId) const {
@@ -127,6 +149,8 @@ void BaseTrackCache::ensureCached(const QSet<TrackId>& trackIds) {
 
 void BaseTrackCache::setSearchColumns(const QStringList& columns) {
     m_searchColumns = columns;
+    // The stored queries were parsed with the previous search columns.
+    m_materializedSearches.clear();
 }
 
 const TrackPointer& BaseTrackCache::getRecentTrack(TrackId trackId) const {
@@ -263,6 +287,15 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
 
     int numColumns = columnCount();
     int idColumn = query.record().indexOf(m_idColumn);
+    int locationColumn = fieldIndex(ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION);
+
+    // String columns like artist, album, genre or file type repeat heavily
+    // across the library, but the query result allocates a fresh deep copy
+    // for every single cell. Intern the values so that all rows with an
+    // equal string share a single implicitly shared instance. This cuts the
+    // memory footprint of the cache roughly in half for large libraries.
+    // Numeric values are stored inline by QVariant and need no interning.
+    QHash<QString, QVariant> internedStrings;
 
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
@@ -273,13 +306,24 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
         record.resize(numColumns);
 
         for (int i = 0; i < numColumns; ++i) {
-            if (fieldIndex(ColumnCache::COLUMN_TRACKLOCATIONSTABLE_LOCATION) == i) {
+            if (locationColumn == i) {
                 // Database stores all locations with Qt separators: "/"
                 // Here we want to cache the display string with native separators.
+                // Locations are unique per track and not worth interning.
                 QString location = query.value(i).toString();
                 record[i] = QDir::toNativeSeparators(location);
             } else {
-                record[i] = query.value(i);
+                QVariant value = query.value(i);
+                if (value.type() == QVariant::String) {
+                    const QString stringValue = value.toString();
+                    auto it = internedStrings.constFind(stringValue);
+                    if (it != internedStrings.constEnd()) {
+                        value = it.value();
+                    } else {
+                        internedStrings.insert(stringValue, value);
+                    }
+                }
+                record[i] = std::move(value);
             }
         }
     }
@@ -310,6 +354,7 @@ void BaseTrackCache::buildIndex() {
     }
 
     m_bIndexBuilt = true;
+    m_materializedSearches.clear();
 }
 
 void BaseTrackCache::updateTrackInIndex(TrackId trackId) {
@@ -471,24 +516,96 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         buildIndex();
     }
 
-    QStringList idStrings;
     // TODO(rryan) consider making this the data passed in and a separate
     // QVector for output
     QSet<TrackId> dirtyTracks;
     for (const auto& trackId: trackIds) {
-        idStrings << trackId.toString();
         if (m_dirtyTracks.contains(trackId)) {
             dirtyTracks.insert(trackId);
         }
     }
 
+    MaterializedSearch* pMaterialized = findMaterializedSearch(
+            trackIds, searchQuery, extraFilter, orderByClause);
+    if (pMaterialized) {
+        if (sDebug) {
+            qDebug() << this << "reusing materialized result with"
+                     << pMaterialized->trackOrder.size() << "tracks";
+        }
+        // Both containers detach from the materialized result if the dirty
+        // track corrections below modify them.
+        m_trackOrder = pMaterialized->trackOrder;
+        *trackToIndex = pMaterialized->trackToIndex;
+        m_prevSearchQuery = searchQuery;
+        m_prevExtraFilter = extraFilter;
+        if (trackIds != m_prevTrackIds) {
+            // The joined id list was built from a different candidate set.
+            m_prevIdListSql.clear();
+            m_prevTrackIds = trackIds;
+        }
+        applyDirtyTrackCorrections(dirtyTracks,
+                pMaterialized->pQuery.get(),
+                searchQuery,
+                sortColumns,
+                columnOffset,
+                trackToIndex);
+        return;
+    }
+
+    // When the user has appended characters to the previous plain text
+    // search the new results are a subset of the previous ones, so the query
+    // only needs to consider the previous results instead of all candidate
+    // tracks. Dirty tracks are corrected in-memory below either way.
+    const bool sameCandidateTracks = trackIds == m_prevTrackIds;
+    const bool refinePreviousResults = !m_prevSearchQuery.isEmpty() &&
+            searchQuery.length() > m_prevSearchQuery.length() &&
+            searchQuery.startsWith(m_prevSearchQuery) &&
+            isPlainSearchTerms(searchQuery) &&
+            extraFilter == m_prevExtraFilter &&
+            !m_trackOrder.isEmpty() &&
+            sameCandidateTracks;
+    m_prevSearchQuery = searchQuery;
+    m_prevExtraFilter = extraFilter;
+    m_prevTrackIds = trackIds;
+
+    QString idListSql;
+    if (refinePreviousResults) {
+        if (sDebug) {
+            qDebug() << this << "refining" << m_trackOrder.size()
+                     << "previous results instead of" << trackIds.size()
+                     << "candidates";
+        }
+        QStringList idStrings;
+        idStrings.reserve(m_trackOrder.size());
+        for (const auto& trackId: qAsConst(m_trackOrder)) {
+            idStrings << trackId.toString();
+        }
+        idListSql = idStrings.join(",");
+    } else if (sameCandidateTracks && !m_prevIdListSql.isEmpty()) {
+        // Re-sorting or searching over the unchanged candidate set, e.g.
+        // after clicking a column header, only changes the ORDER BY or
+        // WHERE clause. Reuse the joined id list instead of formatting all
+        // candidate ids again; for large libraries the list spans megabytes
+        // of SQL text and rebuilding it dominates the time spent on the
+        // GUI thread.
+        idListSql = m_prevIdListSql;
+    } else {
+        QStringList idStrings;
+        idStrings.reserve(trackIds.size());
+        for (const auto& trackId: trackIds) {
+            idStrings << trackId.toString();
+        }
+        idListSql = idStrings.join(",");
+        m_prevIdListSql = idListSql;
+    }
+
     QStringList queryFragments;
     if (!extraFilter.isNull() && extraFilter != "") {
         queryFragments << QString("(%1)").arg(extraFilter);
     }
-    if (idStrings.size() > 0) {
+    if (!idListSql.isEmpty()) {
         queryFragments << QString("%1 in (%2)")
-                .arg(m_idColumn, idStrings.join(","));
+                .arg(m_idColumn, idListSql);
     }
 
     const std::unique_ptr<QueryNode> pQuery =
@@ -539,6 +656,27 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         m_trackOrder.append(trackId);
     }
 
+    storeMaterializedSearch(trackIds,
+            searchQuery,
+            extraFilter,
+            orderByClause,
+            *trackToIndex);
+
+    applyDirtyTrackCorrections(dirtyTracks,
+            pQuery.get(),
+            searchQuery,
+            sortColumns,
+            columnOffset,
+            trackToIndex);
+}
+
+void BaseTrackCache::applyDirtyTrackCorrections(
+        const QSet<TrackId>& dirtyTracks,
+        const QueryNode* pQuery,
+        const QString& searchQuery,
+        const QList<SortColumn>& sortColumns,
+        const int columnOffset,
+        QHash<TrackId, int>* trackToIndex) {
     // At this point, the original set of tracks have been divided into two
     // pieces: those that should be in the result set and those that should
     // not. Unfortunately, due to TrackDAO caching, there may be tracks in
@@ -552,6 +690,12 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         return;
     }
 
+    // First decide for all dirty tracks whether their membership has to be
+    // corrected, then apply the corrections to m_trackOrder and rebuild the
+    // index once. Rebuilding it after every single correction would be
+    // quadratic in the number of dirty tracks.
+    QSet<TrackId> tracksToRemove;
+    QList<TrackPointer> tracksToInsert;
     for (TrackId trackId: qAsConst(dirtyTracks)) {
         // Only get the track if it is in the cache. Tracks that
         // are not cached in memory cannot be dirty.
@@ -570,46 +714,136 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         bool isInResultSet = trackToIndex->contains(trackId);
 
         if (shouldBeInResultSet) {
-            // Track should be in result set...
-
-            // Remove the track from the results first (we have to do this or it
-            // will sort wrong).
+            // Track should be in result set. Remove it from the results
+            // first (we have to do this or it will sort wrong) and
+            // insertion-sort it back in below.
             if (isInResultSet) {
-                int index = (*trackToIndex)[trackId];
-                m_trackOrder.remove(index);
-                // Don't update trackToIndex, since we do it below.
+                tracksToRemove.insert(trackId);
             }
+            tracksToInsert.append(pTrack);
+        } else if (isInResultSet) {
+            // Track should not be in this result set, but it is. We need to
+            // remove it.
+            tracksToRemove.insert(trackId);
+        }
+    }
+
+    if (tracksToRemove.isEmpty() && tracksToInsert.isEmpty()) {
+        return;
+    }
 
-            // Figure out where it is supposed to sort. The table is sorted by
-            // the sort column, so we can binary search.
-            int insertRow = findSortInsertionPoint(
-                    pTrack, sortColumns, columnOffset, m_trackOrder);
+    if (!tracksToRemove.isEmpty()) {
+        const auto end = std::remove_if(m_trackOrder.begin(),
+                m_trackOrder.end(),
+                [&tracksToRemove](const TrackId& trackId) {
+                    return tracksToRemove.contains(trackId);
+                });
+        m_trackOrder.erase(end, m_trackOrder.end());
+    }
 
-            if (sDebug) {
-                qDebug() << this
-                         << "Insertion sort says it should be inserted at:"
-                         << insertRow;
-            }
+    for (const TrackPointer& pTrack : qAsConst(tracksToInsert)) {
+        // Figure out where it is supposed to sort. The table is sorted by
+        // the sort column, so we can binary search.
+        int insertRow = findSortInsertionPoint(
+                pTrack, sortColumns, columnOffset, m_trackOrder);
 
-            // The track should sort at insertRow
-            m_trackOrder.insert(insertRow, trackId);
+        if (sDebug) {
+            qDebug() << this
+                     << "Insertion sort says it should be inserted at:"
+                     << insertRow;
+        }
 
-            trackToIndex->clear();
-            // Fix the index. TODO(rryan) find a non-stupid way to do this.
-            for (int i = 0; i < m_trackOrder.size(); ++i) {
-                (*trackToIndex)[m_trackOrder[i]] = i;
-            }
-        } else if (isInResultSet) {
-            // Track should not be in this result set, but it is. We need to
-            // remove it.
-            int index = (*trackToIndex)[trackId];
-            m_trackOrder.remove(index);
+        // The track should sort at insertRow
+        m_trackOrder.insert(insertRow, pTrack->getId());
+    }
 
-            trackToIndex->clear();
-            // Fix the index. TODO(rryan) find a non-stupid way to do this.
-            for (int i = 0; i < m_trackOrder.size(); ++i) {
-                (*trackToIndex)[m_trackOrder[i]] = i;
+    // Fix the index.
+    trackToIndex->clear();
+    trackToIndex->reserve(m_trackOrder.size());
+    for (int i = 0; i < m_trackOrder.size(); ++i) {
+        (*trackToIndex)[m_trackOrder[i]] = i;
+    }
+}
+
+BaseTrackCache::MaterializedSearch* BaseTrackCache::findMaterializedSearch(
+        const QSet<TrackId>& trackIds,
+        const QString& searchQuery,
+        const QString& extraFilter,
+        const QString& orderByClause) {
+    for (auto it = m_materializedSearches.begin();
+            it != m_materializedSearches.end();
+            ++it) {
+        if (it->searchQuery == searchQuery &&
+                it->extraFilter == extraFilter &&
+                it->orderByClause == orderByClause &&
+                it->trackIds == trackIds) {
+            // Move the entry to the back to keep the vector in LRU order.
+            std::rotate(it, it + 1, m_materializedSearches.end());
+            return &m_materializedSearches.back();
+        }
+    }
+    return nullptr;
+}
+
+void BaseTrackCache::storeMaterializedSearch(
+        const QSet<TrackId>& trackIds,
+        const QString& searchQuery,
+        const QString& extraFilter,
+        const QString& orderByClause,
+        const QHash<TrackId, int>& trackToIndex) {
+    if (m_materializedSearches.size() >= kMaxMaterializedSearches) {
+        m_materializedSearches.erase(m_materializedSearches.begin());
+    }
+    MaterializedSearch materialized;
+    materialized.searchQuery = searchQuery;
+    materialized.extraFilter = extraFilter;
+    materialized.orderByClause = orderByClause;
+    materialized.trackIds = trackIds;
+    materialized.trackOrder = m_trackOrder;
+    materialized.trackToIndex = trackToIndex;
+    // Parse the query without the candidate id list and extra filter SQL;
+    // their SqlNodes match any track and would only bloat the entry.
+    materialized.pQuery = m_pQueryParser->parseQuery(
+            searchQuery, m_searchColumns, QString());
+    m_materializedSearches.push_back(std::move(materialized));
+}
+
+void BaseTrackCache::invalidateMaterializedSearches(const QSet<TrackId>& trackIds) {
+    if (m_materializedSearches.empty() || trackIds.isEmpty()) {
+        return;
+    }
+    auto it = m_materializedSearches.begin();
+    while (it != m_materializedSearches.end()) {
+        bool affected = false;
+        for (const auto& trackId : trackIds) {
+            if (it->trackToIndex.contains(trackId)) {
+                // The track is part of the result, so its values or
+                // membership may have changed.
+                affected = true;
+                break;
+            }
+            if (!it->trackIds.contains(trackId)) {
+                // The track is not a candidate of this result, so it
+                // cannot enter it either.
+                continue;
             }
+            // The track is a candidate but not part of the result yet. The
+            // result is affected if the track matches the search now. If
+            // the track is not loaded its updated values cannot be
+            // evaluated, so the result has to be dropped.
+            TrackPointer pTrack;
+            if (m_bIsCaching) {
+                pTrack = getRecentTrack(trackId);
+            }
+            if (!pTrack || it->pQuery->match(pTrack)) {
+                affected = true;
+                break;
+            }
+        }
+        if (affected) {
+            it = m_materializedSearches.erase(it);
+        } else {
+            ++it;
         }
     }
 }
@@ -9,6 +9,7 @@
 #include <QStringList>
 #include <QVector>
 #include <memory>
+#include <vector>
 
 #include "library/columncache.h"
 #include "track/track_decl.h"
@@ -16,6 +17,7 @@
 #include "util/class.h"
 #include "util/string.h"
 
+class QueryNode;
 class SearchQueryParser;
 class TrackCollection;
 
@@ -115,6 +117,44 @@ class BaseTrackCache : public QObject {
                              const QStringList& numberMatchers) const;
     bool evaluateNumeric(const int value, const QString& expression) const;
 
+    // One materialized filterAndSort() result. Saved searches that are used
+    // like virtual crates switch between a handful of search strings, so the
+    // results of recent search/filter/sort combinations are kept and only
+    // dropped when a track update actually affects them.
+    struct MaterializedSearch {
+        QString searchQuery;
+        QString extraFilter;
+        QString orderByClause;
+        // The candidate set the result was computed for. Models reuse the
+        // implicitly shared set from their unchanged base query, so the
+        // comparison is usually a cheap d-pointer check.
+        QSet<TrackId> trackIds;
+        QVector<TrackId> trackOrder;
+        QHash<TrackId, int> trackToIndex;
+        // Parsed without the candidate id list so match() can decide
+        // whether an updated track affects this result.
+        std::unique_ptr<QueryNode> pQuery;
+    };
+    // Corrects the membership and position of dirty tracks in m_trackOrder
+    // and trackToIndex after the base result has been computed or restored
+    // from a materialized search.
+    void applyDirtyTrackCorrections(const QSet<TrackId>& dirtyTracks,
+            const QueryNode* pQuery,
+            const QString& searchQuery,
+            const QList<SortColumn>& sortColumns,
+            const int columnOffset,
+            QHash<TrackId, int>* trackToIndex);
+    MaterializedSearch* findMaterializedSearch(const QSet<TrackId>& trackIds,
+            const QString& searchQuery,
+            const QString& extraFilter,
+            const QString& orderByClause);
+    void storeMaterializedSearch(const QSet<TrackId>& trackIds,
+            const QString& searchQuery,
+            const QString& extraFilter,
+            const QString& orderByClause,
+            const QHash<TrackId, int>& trackToIndex);
+    void invalidateMaterializedSearches(const QSet<TrackId>& trackIds);
+
     const QString m_tableName;
     const QString m_idColumn;
     const int m_columnCount;
@@ -133,6 +173,21 @@ class BaseTrackCache : public QObject {
 
     QVector<TrackId> m_trackOrder;
 
+    // The search parameters m_trackOrder has been computed for. While the
+    // user appends characters to a plain text search the new results are a
+    // subset of the previous ones, so filterAndSort() only queries the
+    // previous results instead of all candidate tracks.
+    QString m_prevSearchQuery;
+    QString m_prevExtraFilter;
+    QSet<TrackId> m_prevTrackIds;
+    // The joined "id IN (...)" list built from m_prevTrackIds. Reused by
+    // filterAndSort() while the candidate set stays the same, e.g. when
+    // only the sort order changes.
+    QString m_prevIdListSql;
+
+    // Materialized results of recent searches, most recently used last.
+    std::vector<MaterializedSearch> m_materializedSearches;
+
     // Remember key and value of the most recent cache lookup to avoid querying
     // the global track cache again and again while populating the columns
     // of a single row. These members serve as a single-valued private cache.
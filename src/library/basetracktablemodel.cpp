@@ -1,5 +1,6 @@
 #include "library/basetracktablemodel.h"
 
+#include "control/controlproxy.h"
 #include "library/bpmdelegate.h"
 #include "library/colordelegate.h"
 #include "library/coverartcache.h"
@@ -30,6 +31,16 @@ const mixxx::Logger kLogger("BaseTrackTableModel");
 constexpr double kRelativeHeightOfCoverartToolTip =
         0.165; // Height of the image for the cover art tooltip (Relative to the available screen size)
 
+// Upper bound of the per-cell display value cache. Covers many screens
+// worth of rows; when exceeded while scrolling through a huge library
+// the cache is simply started over.
+constexpr int kDisplayValueCacheLimit = 1 << 15;
+
+inline qint64 displayValueCacheKey(const QModelIndex& index) {
+    return (static_cast<qint64>(index.row()) << 32) |
+            static_cast<quint32>(index.column());
+}
+
 const QStringList kDefaultTableColumns = {
         LIBRARYTABLE_ALBUM,
         LIBRARYTABLE_ALBUMARTIST,
@@ -112,6 +123,46 @@ BaseTrackTableModel::BaseTrackTableModel(
             &PlayerInfo::trackLoaded,
             this,
             &BaseTrackTableModel::slotTrackLoaded);
+    // Invalidate the memoized display values whenever the model reports
+    // any change. Changes are rare compared to the per-paint requests
+    // served from the cache, so a full clear is both simple and safe.
+    connect(this,
+            &QAbstractItemModel::dataChanged,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::modelReset,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::layoutChanged,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::rowsInserted,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::rowsRemoved,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::columnsInserted,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    connect(this,
+            &QAbstractItemModel::columnsRemoved,
+            this,
+            &BaseTrackTableModel::slotClearDisplayValueCache);
+    // The rendered key strings depend on the selected notation, which
+    // is changed through a control instead of a model signal.
+    m_pKeyNotation = new ControlProxy("[Library]", "key_notation", this);
+    m_pKeyNotation->connectValueChanged(
+            this, &BaseTrackTableModel::slotClearDisplayValueCache);
+}
+
+void BaseTrackTableModel::slotClearDisplayValueCache() {
+    m_displayValueCache.clear();
 }
 
 void BaseTrackTableModel::initTableColumnsAndHeaderProperties(
@@ -431,6 +482,22 @@ QVariant BaseTrackTableModel::data(
         return QVariant();
     }
 
+    if (role == Qt::DisplayRole) {
+        // The view requests every visible cell for each paint, so serve
+        // repeated requests from the memoized display values.
+        const qint64 cacheKey = displayValueCacheKey(index);
+        const auto it = m_displayValueCache.constFind(cacheKey);
+        if (it != m_displayValueCache.constEnd()) {
+            return it.value();
+        }
+        QVariant value = roleValue(index, rawValue(index), role);
+        if (m_displayValueCache.size() >= kDisplayValueCacheLimit) {
+            m_displayValueCache.clear();
+        }
+        m_displayValueCache.insert(cacheKey, value);
+        return value;
+    }
+
     return roleValue(index, rawValue(index), role);
 }
 
@@ -504,10 +571,15 @@ bool BaseTrackTableModel::setData(
         return false;
     }
 
-    // Do not save the track here. Changing the track dirties it and the caching
-    // system will automatically save the track once it is unloaded from
-    // memory. rryan 10/2010
-    return setTrackValueForColumn(pTrack, column, value, role);
+    if (!setTrackValueForColumn(pTrack, column, value, role)) {
+        return false;
+    }
+    // The edit has been applied to the track object and is immediately
+    // visible through the cache. The database update is queued as a
+    // write-behind save, so rapid edits like bulk rating do not block
+    // the view with one synchronous UPDATE per click.
+    m_pTrackCollectionManager->saveTrackLater(pTrack);
+    return true;
 }
 
 QVariant BaseTrackTableModel::composeCoverArtToolTipHtml(
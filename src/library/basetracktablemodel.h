@@ -9,6 +9,7 @@
 #include "library/trackmodel.h"
 #include "track/track_decl.h"
 
+class ControlProxy;
 class TrackCollectionManager;
 
 class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
@@ -230,6 +231,8 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
 
     void slotRefreshAllRows();
 
+    void slotClearDisplayValueCache();
+
   private:
     // Track models may reference tracks by an external id
     // TODO: TrackId should only be used for tracks from
@@ -261,4 +264,16 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
     int countValidColumnHeaders() const;
 
     TrackId m_previewDeckTrackId;
+
+    // The rendered key strings depend on the selected notation, which
+    // changes without any model signal.
+    ControlProxy* m_pKeyNotation;
+
+    // Memoizes the Qt::DisplayRole conversions per cell. The item view
+    // requests every visible cell on each paint, so during kinetic
+    // scrolling the same date/duration/BPM formatting would otherwise
+    // be redone dozens of times per row. The cache is cleared whenever
+    // the model signals any change, see the connections in the
+    // constructor.
+    mutable QHash<qint64, QVariant> m_displayValueCache;
 };
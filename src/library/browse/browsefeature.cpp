@@ -8,6 +8,7 @@
 #include <QStandardPaths>
 #include <QStringList>
 #include <QTreeView>
+#include <QtConcurrentRun>
 
 #include "controllers/keyboard/keyboardeventfilter.h"
 #include "library/library.h"
@@ -60,6 +61,11 @@ BrowseFeature::BrowseFeature(
             this,
             &BrowseFeature::slotAddToLibrary);
 
+    connect(&m_directoryListingWatcher,
+            &QFutureWatcher<QList<ChildDirectory>>::finished,
+            this,
+            &BrowseFeature::slotDirectoryListingFinished);
+
     m_proxyModel.setFilterCaseSensitivity(Qt::CaseInsensitive);
     m_proxyModel.setSortCaseSensitivity(Qt::CaseInsensitive);
     // BrowseThread sets the Qt::UserRole of every QStandardItem to the sort key
@@ -391,38 +397,79 @@ void BrowseFeature::onLazyChildExpandation(const QModelIndex& index) {
         return;
     }
 
-    // Before we populate the subtree, we need to delete old subtrees
-    m_childModel.removeRows(0, item->childRows(), index);
-
-    // List of subfolders or drive letters
-    QList<TreeItem*> folders;
-
     // If we are on the special device node
     if (path == DEVICE_NODE) {
-        folders += getRemovableDevices();
-    } else {
-        // we assume that the path refers to a folder in the file system
-        // populate childs
-        const auto dirAccess = mixxx::FileAccess(mixxx::FileInfo(path));
+        // Before we populate the subtree, we need to delete old subtrees
+        m_childModel.removeRows(0, item->childRows(), index);
+        // Listing the mount points is cheap and done synchronously
+        QList<TreeItem*> folders = getRemovableDevices();
+        // we need to check here if subfolders are found
+        // On Ubuntu 10.04, otherwise, this will draw an icon although the folder
+        // has no subfolders
+        if (!folders.isEmpty()) {
+            m_childModel.insertTreeItemRows(folders, 0, index);
+        }
+        return;
+    }
 
-        QFileInfoList all = dirAccess.info().toQDir().entryInfoList(
-                QDir::Dirs | QDir::NoDotAndDotDot);
+    // we assume that the path refers to a folder in the file system.
+    // Listing its subfolders may block for multiple seconds if the folder
+    // lives on an unresponsive network share, so the listing runs on a
+    // worker thread and the subtree is populated once it has finished.
+    // The security token is opened on the GUI thread and passed along.
+    auto dirAccess = mixxx::FileAccess(mixxx::FileInfo(path));
+
+    // Starting a new listing implicitly abandons the result of a still
+    // pending one, i.e. only the most recently expanded node wins.
+    m_pendingExpandIndex = QPersistentModelIndex(index);
+    m_pendingExpandPath = path;
+    m_directoryListingFuture = QtConcurrent::run(
+            &BrowseFeature::listChildDirectories, std::move(dirAccess));
+    m_directoryListingWatcher.setFuture(m_directoryListingFuture);
+}
 
-        // loop through all the item and construct the childs
-        foreach (QFileInfo one, all) {
-            // Skip folders that end with .app on OS X
+// static
+QList<BrowseFeature::ChildDirectory> BrowseFeature::listChildDirectories(
+        mixxx::FileAccess dirAccess) {
+    QList<ChildDirectory> entries;
+    const QFileInfoList all = dirAccess.info().toQDir().entryInfoList(
+            QDir::Dirs | QDir::NoDotAndDotDot);
+    foreach (const QFileInfo& one, all) {
+        // Skip folders that end with .app on OS X
 #if defined(__APPLE__)
-            if (one.isDir() && one.fileName().endsWith(".app"))
-                continue;
+        if (one.isDir() && one.fileName().endsWith(".app"))
+            continue;
 #endif
-            // We here create new items for the sidebar models
-            // Once the items are added to the TreeItemModel,
-            // the models takes ownership of them and ensures their deletion
-            TreeItem* folder = new TreeItem(
+        entries.append(ChildDirectory{
                 one.fileName(),
-                QVariant(one.absoluteFilePath() + QStringLiteral("/")));
-            folders << folder;
-        }
+                one.absoluteFilePath() + QStringLiteral("/")});
+    }
+    return entries;
+}
+
+void BrowseFeature::slotDirectoryListingFinished() {
+    const QModelIndex index = m_pendingExpandIndex;
+    if (!index.isValid()) {
+        // The expanded node has been removed while the listing was
+        // running, e.g. because its quick link has been deleted.
+        return;
+    }
+    TreeItem* item = static_cast<TreeItem*>(index.internalPointer());
+    if (!(item && item->getData().isValid()) ||
+            item->getData().toString() != m_pendingExpandPath) {
+        return;
+    }
+
+    // Before we populate the subtree, we need to delete old subtrees
+    m_childModel.removeRows(0, item->childRows(), index);
+
+    QList<TreeItem*> folders;
+    const QList<ChildDirectory> entries = m_directoryListingWatcher.result();
+    foreach (const ChildDirectory& entry, entries) {
+        // We here create new items for the sidebar models
+        // Once the items are added to the TreeItemModel,
+        // the models takes ownership of them and ensures their deletion
+        folders << new TreeItem(entry.name, QVariant(entry.path));
     }
     // we need to check here if subfolders are found
     // On Ubuntu 10.04, otherwise, this will draw an icon although the folder
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QStringListModel>
 #include <QSortFilterProxyModel>
 #include <QObject>
@@ -14,6 +16,7 @@
 #include "library/browse/foldertreemodel.h"
 #include "library/libraryfeature.h"
 #include "library/proxytrackmodel.h"
+#include "util/fileaccess.h"
 
 #define QUICK_LINK_NODE "::mixxx_quick_lnk_node::"
 #define DEVICE_NODE "::mixxx_device_node::"
@@ -49,6 +52,7 @@ class BrowseFeature : public LibraryFeature {
     void onLazyChildExpandation(const QModelIndex& index);
     void slotLibraryScanStarted();
     void slotLibraryScanFinished();
+    void slotDirectoryListingFinished();
 
   signals:
     void setRootIndex(const QModelIndex&);
@@ -56,11 +60,22 @@ class BrowseFeature : public LibraryFeature {
     void scanLibrary();
 
   private:
+    // A subdirectory found by the worker thread during a directory
+    // listing. TreeItems are only constructed on the GUI thread once
+    // the listing has finished.
+    struct ChildDirectory {
+        QString name;
+        QString path;
+    };
+
     QString getRootViewHtml() const;
     QString extractNameFromPath(const QString& spath);
     QStringList getDefaultQuickLinks() const;
     void saveQuickLinks();
     void loadQuickLinks();
+    // Runs on a worker thread. Listing a directory may block for
+    // multiple seconds on unresponsive network shares.
+    static QList<ChildDirectory> listChildDirectories(mixxx::FileAccess dirAccess);
 
     TrackCollection* const m_pTrackCollection;
 
@@ -75,4 +90,12 @@ class BrowseFeature : public LibraryFeature {
     QStringList m_quickLinkList;
     QIcon m_icon;
     QPointer<WLibrarySidebar> m_pSidebarWidget;
+
+    // The sidebar node whose children are currently being listed on the
+    // worker thread. The persistent index survives model changes and
+    // becomes invalid if the node is removed while the listing runs.
+    QPersistentModelIndex m_pendingExpandIndex;
+    QString m_pendingExpandPath;
+    QFuture<QList<ChildDirectory>> m_directoryListingFuture;
+    QFutureWatcher<QList<ChildDirectory>> m_directoryListingWatcher;
 };
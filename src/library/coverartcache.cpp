@@ -1,7 +1,9 @@
 #include "library/coverartcache.h"
 
+#include <QDir>
 #include <QFutureWatcher>
 #include <QPixmapCache>
+#include <QStandardPaths>
 #include <QtConcurrentRun>
 #include <QtDebug>
 
@@ -38,6 +40,23 @@ inline QImage resizeImageWidth(const QImage& image, int width) {
     return image.scaledToWidth(width, kTransformationMode);
 }
 
+constexpr int kThumbnailJpegQuality = 90;
+
+// Directory of the persistent cover thumbnail cache. Scaled covers are
+// stored here after they have been decoded once, so scrolling through the
+// library does not re-decode full-size (embedded) images again and again
+// after the corresponding pixmaps have been evicted from QPixmapCache.
+QString coverThumbnailCacheDir() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+            QStringLiteral("/coverthumbs");
+}
+
+QString coverThumbnailFilePath(mixxx::cache_key_t hash, int width) {
+    return coverThumbnailCacheDir() +
+            QStringLiteral("/%1_%2.jpg")
+                    .arg(QString::number(hash), QString::number(width));
+}
+
 } // anonymous namespace
 
 CoverArtCache::CoverArtCache() {
@@ -181,6 +200,30 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
             signalWhenDone);
     DEBUG_ASSERT(!res.coverInfoUpdated);
 
+    if (desiredWidth > 0 && mixxx::isValidCacheKey(res.requestedCacheKey)) {
+        // Try the persistent thumbnail cache before decoding the (possibly
+        // embedded) full-size image.
+        const QString thumbnailPath = coverThumbnailFilePath(
+                res.requestedCacheKey, desiredWidth);
+        QImage thumbnail(thumbnailPath);
+        if (!thumbnail.isNull()) {
+            if (kLogger.traceEnabled()) {
+                kLogger.trace()
+                        << "loadCover thumbnail cache hit"
+                        << thumbnailPath;
+            }
+            auto loadedThumbnail = CoverInfo::LoadedImage(
+                    CoverInfo::LoadedImage::Result::Ok);
+            loadedThumbnail.image = std::move(thumbnail);
+            loadedThumbnail.location = thumbnailPath;
+            res.coverArt = CoverArt(
+                    std::move(coverInfo),
+                    std::move(loadedThumbnail),
+                    desiredWidth);
+            return res;
+        }
+    }
+
     auto loadedImage = coverInfo.loadImage(
             pTrack ? pTrack->getFileAccess().token() : SecurityTokenPointer());
     if (!loadedImage.image.isNull()) {
@@ -198,6 +241,17 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
             // Adjust the cover size according to the request
             // or downsize the image for efficiency.
             loadedImage.image = resizeImageWidth(loadedImage.image, desiredWidth);
+            // Persist the scaled image so subsequent requests after the
+            // pixmap has been evicted from QPixmapCache skip the full-size
+            // decode. Keyed by the (just refreshed) image digest.
+            const auto cacheKey = coverInfo.cacheKey();
+            if (mixxx::isValidCacheKey(cacheKey)) {
+                QDir().mkpath(coverThumbnailCacheDir());
+                loadedImage.image.save(
+                        coverThumbnailFilePath(cacheKey, desiredWidth),
+                        "JPEG",
+                        kThumbnailJpegQuality);
+            }
         }
     }
 
@@ -178,6 +178,21 @@ void AutoDJCratesDAO::createAndConnectAutoDjCratesDatabase() {
         return;
     }
 
+    // Index the columns that the active-tracks view filters and orders by.
+    // Without it every random-track selection sorts the whole table, which
+    // gets noticeably slower in long sessions with large crates as more
+    // and more played tracks are excluded. Created after populating the
+    // table so the bulk insert does not pay for per-row index maintenance.
+    // CREATE INDEX temp_autodj_crates_active_index ON temp_autodj_crates (autodjrefs, timesplayed, lastplayed);
+    oQuery.prepare(
+            "CREATE INDEX " AUTODJCRATES_TABLE "_active_index ON " AUTODJCRATES_TABLE
+            " (" AUTODJCRATESTABLE_AUTODJREFS ", " AUTODJCRATESTABLE_TIMESPLAYED
+            ", " AUTODJCRATESTABLE_LASTPLAYED ")");
+    if (!oQuery.exec()) {
+        LOG_FAILED_QUERY(oQuery);
+        return;
+    }
+
     // Fill out the number of auto-DJ-playlist references.
     if (!updateAutoDjPlaylistReferences()) {
         return;
@@ -36,6 +36,39 @@ inline QString labelFromQVariant(const QVariant& value) {
     }
 }
 
+// Prepares the statements for inserting or updating a single cue. They are
+// compiled once and reused for all cues of a track, see
+// CueDAO::saveTrackCues().
+void prepareCueInsert(QSqlQuery* pInsertQuery) {
+    pInsertQuery->prepare(
+            QStringLiteral("INSERT INTO " CUE_TABLE
+                           " (track_id, type, position, length, hotcue, "
+                           "label, color) VALUES (:track_id, :type, "
+                           ":position, :length, :hotcue, :label, :color)"));
+}
+
+void prepareCueUpdate(QSqlQuery* pUpdateQuery) {
+    pUpdateQuery->prepare(QStringLiteral("UPDATE " CUE_TABLE " SET "
+                                         "track_id=:track_id,"
+                                         "type=:type,"
+                                         "position=:position,"
+                                         "length=:length,"
+                                         "hotcue=:hotcue,"
+                                         "label=:label,"
+                                         "color=:color"
+                                         " WHERE id=:id"));
+}
+
+void bindCueValues(QSqlQuery* pQuery, TrackId trackId, const Cue* pCue) {
+    pQuery->bindValue(":track_id", trackId.toVariant());
+    pQuery->bindValue(":type", static_cast<int>(pCue->getType()));
+    pQuery->bindValue(":position", pCue->getPosition());
+    pQuery->bindValue(":length", pCue->getLength());
+    pQuery->bindValue(":hotcue", pCue->getHotCue());
+    pQuery->bindValue(":label", labelToQVariant(pCue->getLabel()));
+    pQuery->bindValue(":color", mixxx::RgbColor::toQVariant(pCue->getColor()));
+}
+
 CuePointer cueFromRow(const QSqlRecord& row) {
     const auto id = DbId(row.value(row.indexOf("id")));
     TrackId trackId(row.value(row.indexOf("track_id")));
@@ -135,49 +168,43 @@ bool CueDAO::deleteCuesForTracks(const QList<TrackId>& trackIds) const {
 
 bool CueDAO::saveCue(TrackId trackId, Cue* cue) const {
     //qDebug() << "CueDAO::saveCue" << QThread::currentThread() << m_database.connectionName();
+    QSqlQuery insertQuery(m_database);
+    prepareCueInsert(&insertQuery);
+    QSqlQuery updateQuery(m_database);
+    prepareCueUpdate(&updateQuery);
+    return saveCue(trackId, cue, &insertQuery, &updateQuery);
+}
+
+bool CueDAO::saveCue(
+        TrackId trackId,
+        Cue* cue,
+        QSqlQuery* pInsertQuery,
+        QSqlQuery* pUpdateQuery) const {
     VERIFY_OR_DEBUG_ASSERT(cue) {
         return false;
     }
 
-    // Prepare query
-    QSqlQuery query(m_database);
+    // Select the prepared query
+    QSqlQuery* pQuery;
     if (cue->getId().isValid()) {
         // Update cue
-        query.prepare(QStringLiteral("UPDATE " CUE_TABLE " SET "
-                        "track_id=:track_id,"
-                        "type=:type,"
-                        "position=:position,"
-                        "length=:length,"
-                        "hotcue=:hotcue,"
-                        "label=:label,"
-                        "color=:color"
-                        " WHERE id=:id"));
-        query.bindValue(":id", cue->getId().toVariant());
+        pQuery = pUpdateQuery;
+        pQuery->bindValue(":id", cue->getId().toVariant());
     } else {
         // New cue
-        query.prepare(
-                QStringLiteral("INSERT INTO " CUE_TABLE
-                               " (track_id, type, position, length, hotcue, "
-                               "label, color) VALUES (:track_id, :type, "
-                               ":position, :length, :hotcue, :label, :color)"));
+        pQuery = pInsertQuery;
     }
 
     // Bind values and execute query
-    query.bindValue(":track_id", trackId.toVariant());
-    query.bindValue(":type", static_cast<int>(cue->getType()));
-    query.bindValue(":position", cue->getPosition());
-    query.bindValue(":length", cue->getLength());
-    query.bindValue(":hotcue", cue->getHotCue());
-    query.bindValue(":label", labelToQVariant(cue->getLabel()));
-    query.bindValue(":color", mixxx::RgbColor::toQVariant(cue->getColor()));
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
+    bindCueValues(pQuery, trackId, cue);
+    if (!pQuery->exec()) {
+        LOG_FAILED_QUERY(*pQuery);
         return false;
     }
 
     if (!cue->getId().isValid()) {
         // New cue
-        const auto newId = DbId(query.lastInsertId());
+        const auto newId = DbId(pQuery->lastInsertId());
         DEBUG_ASSERT(newId.isValid());
         cue->setId(newId);
     }
@@ -205,6 +232,13 @@ void CueDAO::saveTrackCues(
         TrackId trackId,
         const QList<CuePointer>& cueList) const {
     DEBUG_ASSERT(trackId.isValid());
+    // Compile the statements only once and reuse them for all dirty
+    // cues, e.g. the hot cues that have been set in quick succession
+    // while the track was loaded in a deck.
+    QSqlQuery insertQuery(m_database);
+    prepareCueInsert(&insertQuery);
+    QSqlQuery updateQuery(m_database);
+    prepareCueUpdate(&updateQuery);
     QStringList cueIds;
     cueIds.reserve(cueList.size());
     for (const auto& pCue : cueList) {
@@ -212,7 +246,7 @@ void CueDAO::saveTrackCues(
         DEBUG_ASSERT(pCue->getId().isValid() || pCue->isDirty());
         // Update or save cue
         if (pCue->isDirty()) {
-            saveCue(trackId, pCue.get());
+            saveCue(trackId, pCue.get(), &insertQuery, &updateQuery);
         }
         // After saving each cue must have a valid id
         VERIFY_OR_DEBUG_ASSERT(pCue->getId().isValid()) {
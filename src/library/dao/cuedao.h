@@ -22,5 +22,9 @@ class CueDAO : public DAO {
 
   private:
     bool saveCue(TrackId trackId, Cue* pCue) const;
+    bool saveCue(TrackId trackId,
+            Cue* pCue,
+            QSqlQuery* pInsertQuery,
+            QSqlQuery* pUpdateQuery) const;
     bool deleteCue(Cue* pCue) const;
 };
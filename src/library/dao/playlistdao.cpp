@@ -405,6 +405,29 @@ unsigned int PlaylistDAO::playlistCount() const {
     return numRecords;
 }
 
+QList<PlaylistDAO::PlaylistSummary> PlaylistDAO::getUnhiddenPlaylistSummaries() const {
+    QList<PlaylistSummary> summaries;
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT id, name, locked FROM Playlists "
+            "WHERE hidden = :hidden ORDER BY name"));
+    query.bindValue(":hidden", PLHT_NOT_HIDDEN);
+    query.setForwardOnly(true);
+
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return summaries;
+    }
+
+    while (query.next()) {
+        summaries.append(PlaylistSummary{
+                query.value(0).toInt(),
+                query.value(1).toString(),
+                query.value(2).toInt() == 1});
+    }
+    return summaries;
+}
+
 int PlaylistDAO::getPlaylistId(const int index) const {
     //qDebug() << "PlaylistDAO::getPlaylistId"
     //         << QThread::currentThread() << m_database.connectionName();
@@ -79,6 +79,15 @@ class PlaylistDAO : public QObject, public virtual DAO {
     // position in the database table, not the display order position column
     // stored in the database.
     int getPlaylistId(const int index) const;
+    struct PlaylistSummary {
+        int id;
+        QString name;
+        bool locked;
+    };
+    // Returns id, name and lock state of all unhidden playlists with a
+    // single query, sorted by name. Use this instead of querying each
+    // playlist individually when populating menus.
+    QList<PlaylistSummary> getUnhiddenPlaylistSummaries() const;
     QList<TrackId> getTrackIds(const int playlistId) const;
     // Returns true if the playlist with playlistId is hidden
     bool isHidden(const int playlistId) const;
@@ -601,6 +601,59 @@ void bindTrackLibraryValues(
     pTrackLibraryQuery->bindValue(":key", keyText);
 }
 
+// Prepare the UPDATE statement for saving a track's library row. The
+// statement is compiled once and then reused for all tracks that are
+// saved with it, see TrackDAO::updateTrack() and TrackDAO::saveTracks().
+void prepareTrackLibraryUpdate(QSqlQuery* pTrackLibraryUpdate) {
+    // Update everything but "location", since that's what we identify the track by.
+    pTrackLibraryUpdate->prepare(
+            "UPDATE library SET "
+            "artist=:artist,"
+            "title=:title,"
+            "album=:album,"
+            "album_artist=:album_artist,"
+            "year=:year,"
+            "genre=:genre,"
+            "composer=:composer,"
+            "grouping=:grouping,"
+            "filetype=:filetype,"
+            "tracknumber=:tracknumber,"
+            "tracktotal=:tracktotal,"
+            "color=:color,"
+            "comment=:comment,"
+            "url=:url,"
+            "rating=:rating,"
+            "key=:key,"
+            "key_id=:key_id,"
+            "cuepoint=:cuepoint,"
+            "bpm=:bpm,"
+            "replaygain=:replaygain,"
+            "replaygain_peak=:replaygain_peak,"
+            "timesplayed=:timesplayed,"
+            "last_played_at=:last_played_at,"
+            "played=:played,"
+            "header_parsed=:header_parsed,"
+            "channels=:channels,"
+            "bitrate=:bitrate,"
+            "samplerate=:samplerate,"
+            "bitrate=:bitrate,"
+            "duration=:duration,"
+            "beats_version=:beats_version,"
+            "beats_sub_version=:beats_sub_version,"
+            "beats=:beats,"
+            "bpm_lock=:bpm_lock,"
+            "keys_version=:keys_version,"
+            "keys_sub_version=:keys_sub_version,"
+            "keys=:keys,"
+            "coverart_source=:coverart_source,"
+            "coverart_type=:coverart_type,"
+            "coverart_location=:coverart_location,"
+            "coverart_color=:coverart_color,"
+            "coverart_digest=:coverart_digest,"
+            "coverart_hash=:coverart_hash "
+            "WHERE id=:track_id");
+}
+
 bool insertTrackLibrary(
         QSqlQuery* pTrackLibraryInsert,
         const mixxx::TrackRecord& trackRecord,
@@ -1571,68 +1624,42 @@ bool TrackDAO::updateTrack(Track* pTrack) const {
     // time.start();
 
     QSqlQuery query(m_database);
+    prepareTrackLibraryUpdate(&query);
 
-    // Update everything but "location", since that's what we identify the track by.
-    query.prepare(
-            "UPDATE library SET "
-            "artist=:artist,"
-            "title=:title,"
-            "album=:album,"
-            "album_artist=:album_artist,"
-            "year=:year,"
-            "genre=:genre,"
-            "composer=:composer,"
-            "grouping=:grouping,"
-            "filetype=:filetype,"
-            "tracknumber=:tracknumber,"
-            "tracktotal=:tracktotal,"
-            "color=:color,"
-            "comment=:comment,"
-            "url=:url,"
-            "rating=:rating,"
-            "key=:key,"
-            "key_id=:key_id,"
-            "cuepoint=:cuepoint,"
-            "bpm=:bpm,"
-            "replaygain=:replaygain,"
-            "replaygain_peak=:replaygain_peak,"
-            "timesplayed=:timesplayed,"
-            "last_played_at=:last_played_at,"
-            "played=:played,"
-            "header_parsed=:header_parsed,"
-            "channels=:channels,"
-            "bitrate=:bitrate,"
-            "samplerate=:samplerate,"
-            "bitrate=:bitrate,"
-            "duration=:duration,"
-            "beats_version=:beats_version,"
-            "beats_sub_version=:beats_sub_version,"
-            "beats=:beats,"
-            "bpm_lock=:bpm_lock,"
-            "keys_version=:keys_version,"
-            "keys_sub_version=:keys_sub_version,"
-            "keys=:keys,"
-            "coverart_source=:coverart_source,"
-            "coverart_type=:coverart_type,"
-            "coverart_location=:coverart_location,"
-            "coverart_color=:coverart_color,"
-            "coverart_digest=:coverart_digest,"
-            "coverart_hash=:coverart_hash "
-            "WHERE id=:track_id");
+    if (!updateTrack(pTrack, &query)) {
+        return false;
+    }
+    transaction.commit();
+
+    //qDebug() << "Update track in database took: " << time.elapsed().formatMillisWithUnit();
+    //time.start();
+    pTrack->markClean();
+    //qDebug() << "Dirtying track took: " << time.elapsed().formatMillisWithUnit();
+    return true;
+}
 
-    query.bindValue(":track_id", trackId.toVariant());
+// Saves a track's info back to the database reusing the given prepared
+// statement. The caller is responsible for the enclosing transaction and
+// for marking the track clean after a successful commit.
+bool TrackDAO::updateTrack(
+        Track* pTrack,
+        QSqlQuery* pLibraryUpdateQuery) const {
+    const TrackId trackId = pTrack->getId();
+    DEBUG_ASSERT(trackId.isValid());
+
+    pLibraryUpdateQuery->bindValue(":track_id", trackId.toVariant());
 
     bindTrackLibraryValues(
-            &query,
+            pLibraryUpdateQuery,
             pTrack->getRecord(),
             pTrack->getBeats());
 
-    VERIFY_OR_DEBUG_ASSERT(query.exec()) {
-        LOG_FAILED_QUERY(query);
+    VERIFY_OR_DEBUG_ASSERT(pLibraryUpdateQuery->exec()) {
+        LOG_FAILED_QUERY(*pLibraryUpdateQuery);
         return false;
     }
 
-    if (query.numRowsAffected() == 0) {
+    if (pLibraryUpdateQuery->numRowsAffected() == 0) {
         qWarning() << "updateTrack had no effect: trackId" << trackId << "invalid";
         return false;
     }
@@ -1645,15 +1672,50 @@ bool TrackDAO::updateTrack(Track* pTrack) const {
             pTrack->getWaveformSummary());
     m_cueDao.saveTrackCues(
             trackId, pTrack->getCuePoints());
-    transaction.commit();
-
-    //qDebug() << "Update track in database took: " << time.elapsed().formatMillisWithUnit();
-    //time.start();
-    pTrack->markClean();
-    //qDebug() << "Dirtying track took: " << time.elapsed().formatMillisWithUnit();
     return true;
 }
 
+void TrackDAO::saveTracks(const QList<TrackPointer>& tracks) const {
+    if (tracks.isEmpty()) {
+        return;
+    }
+
+    qDebug() << "TrackDAO: Saving" << tracks.size() << "tracks";
+
+    SqlTransaction transaction(m_database);
+
+    // Compile the UPDATE statement once for the whole batch instead of
+    // once per track.
+    QSqlQuery query(m_database);
+    prepareTrackLibraryUpdate(&query);
+
+    QList<TrackPointer> savedTracks;
+    savedTracks.reserve(tracks.size());
+    for (const TrackPointer& pTrack : tracks) {
+        VERIFY_OR_DEBUG_ASSERT(pTrack && pTrack->getId().isValid()) {
+            continue;
+        }
+        if (!pTrack->isDirty()) {
+            continue;
+        }
+        if (updateTrack(pTrack.get(), &query)) {
+            savedTracks.append(pTrack);
+        }
+    }
+    if (!transaction.commit()) {
+        return;
+    }
+
+    for (const TrackPointer& pTrack : qAsConst(savedTracks)) {
+        pTrack->markClean();
+        // BaseTrackCache must be informed separately, because the
+        // tracks have already been disconnected and TrackDAO does
+        // not receive any signals that are usually forwarded to
+        // BaseTrackCache.
+        emit mixxx::thisAsNonConst(this)->trackClean(pTrack->getId());
+    }
+}
+
 // Mark all the tracks in the library as invalid.
 // That means we'll need to later check that those tracks actually
 // (still) exist as part of the library scanning procedure.
@@ -75,6 +75,11 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     // Only used by friend class TrackCollection, but public for testing!
     void saveTrack(Track* pTrack) const;
 
+    // Saves all dirty tracks of the list within a single transaction,
+    // reusing one prepared UPDATE statement for all of them. Much faster
+    // than saving the tracks one by one when modifying many tracks at once.
+    void saveTracks(const QList<TrackPointer>& tracks) const;
+
     /// Update the play counter properties according to the corresponding
     /// aggregated properties obtained from the played history.
     bool updatePlayCounterFromPlayedHistory(
@@ -137,6 +142,9 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     void addTracksFinish(bool rollback = false);
 
     bool updateTrack(Track* pTrack) const;
+    bool updateTrack(
+            Track* pTrack,
+            QSqlQuery* pLibraryUpdateQuery) const;
 
     void hideAllTracks(const QDir& rootDir) const;
 
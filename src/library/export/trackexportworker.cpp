@@ -2,13 +2,24 @@
 
 #include <QDebug>
 #include <QFileInfo>
+#include <QFuture>
 #include <QMessageBox>
+#include <QtConcurrentRun>
 
 #include "moc_trackexportworker.cpp"
 #include "track/track.h"
 
 namespace {
 
+// Upper bound on overlapped copies. Two is enough to keep one write in
+// flight while the next source file is read; more than a few just makes
+// slow USB media seek between destination files.
+constexpr int kMaxConcurrentCopies = 2;
+
+// Coalesce progress emissions so a fast medium does not flood the GUI
+// queue with one signal per file.
+constexpr int kProgressBatchSize = 8;
+
 QString rewriteFilename(const mixxx::FileInfo& fileinfo, int index) {
     // We don't have total control over the inputs, so definitely
     // don't use .arg().arg().arg().
@@ -66,83 +77,145 @@ QMap<QString, mixxx::FileInfo> createCopylist(const TrackPointerList& tracks) {
     return copylist;
 }
 
+// Runs on the thread pool.  Returns an empty string on success and a
+// user-facing error message on failure.
+QString copyOneFile(const QString& sourcePath, const QString& destPath) {
+    qDebug() << "Copying" << sourcePath << "to" << destPath;
+    QFile source_file(sourcePath);
+    if (!source_file.copy(destPath)) {
+        return TrackExportWorker::tr(
+                "Error exporting track %1 to %2: %3. Stopping.").arg(
+                sourcePath, destPath, source_file.errorString());
+    }
+    return QString();
+}
+
 }  // namespace
 
 void TrackExportWorker::run() {
-    int i = 0;
-    QMap<QString, mixxx::FileInfo> copy_list = createCopylist(m_tracks);
+    const QMap<QString, mixxx::FileInfo> copy_list = createCopylist(m_tracks);
+
+    // Phase 1: resolve all overwrite questions serially, since they may
+    // block on the user. This leaves a list of copy jobs that need no
+    // further interaction and can run overlapped. Skipped files still count
+    // towards the reported progress.
+    QList<CopyJob> jobs;
+    int skipped = 0;
     for (auto it = copy_list.constBegin(); it != copy_list.constEnd(); ++it) {
-        // We emit progress twice per loop, which may seem excessive, but it
-        // guarantees that we emit a sane progress before we start and after
-        // we end.  In between, each filename will get its own visible tick
-        // on the bar, which looks really nice.
-        emit progress(it->fileName(), i, copy_list.size());
-        copyFile(*it, it.key());
+        const QString dest_path = QDir(m_destDir).filePath(it.key());
+        if (resolveDestination(*it, dest_path)) {
+            jobs.append(CopyJob{it->canonicalLocation(), dest_path, it.key()});
+        } else {
+            ++skipped;
+        }
         if (atomicLoadAcquire(m_bStop)) {
             emit canceled();
             return;
         }
-        ++i;
-        emit progress(it->fileName(), i, copy_list.size());
+    }
+
+    copyJobs(jobs, skipped, copy_list.size());
+    if (atomicLoadAcquire(m_bStop)) {
+        emit canceled();
     }
 }
 
-void TrackExportWorker::copyFile(
-        const mixxx::FileInfo& source_fileinfo,
-        const QString& dest_filename) {
-    QString sourceFilename = source_fileinfo.canonicalLocation();
-    const QString dest_path = QDir(m_destDir).filePath(dest_filename);
-    QFileInfo dest_fileinfo(dest_path);
+void TrackExportWorker::copyJobs(const QList<CopyJob>& jobs, int skipped, int total) {
+    if (total == 0) {
+        return;
+    }
 
-    if (dest_fileinfo.exists()) {
-        switch (m_overwriteMode) {
-        // Give the user the option to overwrite existing files in the destination.
-        case OverwriteMode::ASK:
-            switch (makeOverwriteRequest(dest_path)) {
-            case OverwriteAnswer::SKIP:
-            case OverwriteAnswer::SKIP_ALL:
-                qDebug() << "skipping" << sourceFilename;
-                return;
-            case OverwriteAnswer::OVERWRITE:
-            case OverwriteAnswer::OVERWRITE_ALL:
-                break;
-            case OverwriteAnswer::CANCEL:
-                m_errorMessage = tr("Export process was canceled");
-                stop();
-                return;
-            }
-            break;
-        case OverwriteMode::SKIP_ALL:
-            qDebug() << "skipping" << sourceFilename;
-            return;
-        case OverwriteMode::OVERWRITE_ALL:;
-        }
+    // Phase 2: run the copies with a bounded number in flight. Completions
+    // are reaped in submission order, which is sufficient to bound the
+    // window since the jobs are all similarly sized file copies.
+    QList<QPair<int, QFuture<QString>>> inFlight;
+    int completed = skipped;
+    int lastReported = 0;
 
-        // Remove the existing file in preparation for overwriting.
-        QFile dest_file(dest_path);
-        qDebug() << "Removing existing file" << dest_path;
-        if (!dest_file.remove()) {
-            const QString error_message = tr(
-                    "Error removing file %1: %2. Stopping.").arg(
-                    dest_path, dest_file.errorString());
+    emit progress(jobs.isEmpty() ? QString() : jobs.first().destFileName,
+            completed == total ? total : 0, total);
+
+    const auto reapOldest = [&] {
+        const auto oldest = inFlight.takeFirst();
+        const QString error_message = oldest.second.result();
+        if (!error_message.isEmpty()) {
             qWarning() << error_message;
             m_errorMessage = error_message;
             stop();
             return;
         }
+        ++completed;
+        if (completed - lastReported >= kProgressBatchSize || completed == total) {
+            emit progress(jobs.at(oldest.first).destFileName, completed, total);
+            lastReported = completed;
+        }
+    };
+
+    for (int i = 0; i < jobs.size(); ++i) {
+        if (atomicLoadAcquire(m_bStop)) {
+            break;
+        }
+        const CopyJob& job = jobs.at(i);
+        inFlight.append(qMakePair(i,
+                QtConcurrent::run(copyOneFile, job.sourcePath, job.destPath)));
+        if (inFlight.size() >= kMaxConcurrentCopies) {
+            reapOldest();
+        }
+    }
+
+    // Drain whatever is still in flight, even on stop or error, so no copy
+    // outlives this thread.
+    while (!inFlight.isEmpty()) {
+        reapOldest();
+    }
+}
+
+bool TrackExportWorker::resolveDestination(
+        const mixxx::FileInfo& source_fileinfo,
+        const QString& dest_path) {
+    const QString sourceFilename = source_fileinfo.canonicalLocation();
+    QFileInfo dest_fileinfo(dest_path);
+
+    if (!dest_fileinfo.exists()) {
+        return true;
     }
 
-    qDebug() << "Copying" << sourceFilename << "to" << dest_path;
-    QFile source_file(sourceFilename);
-    if (!source_file.copy(dest_path)) {
+    switch (m_overwriteMode) {
+    // Give the user the option to overwrite existing files in the destination.
+    case OverwriteMode::ASK:
+        switch (makeOverwriteRequest(dest_path)) {
+        case OverwriteAnswer::SKIP:
+        case OverwriteAnswer::SKIP_ALL:
+            qDebug() << "skipping" << sourceFilename;
+            return false;
+        case OverwriteAnswer::OVERWRITE:
+        case OverwriteAnswer::OVERWRITE_ALL:
+            break;
+        case OverwriteAnswer::CANCEL:
+            m_errorMessage = tr("Export process was canceled");
+            stop();
+            return false;
+        }
+        break;
+    case OverwriteMode::SKIP_ALL:
+        qDebug() << "skipping" << sourceFilename;
+        return false;
+    case OverwriteMode::OVERWRITE_ALL:;
+    }
+
+    // Remove the existing file in preparation for overwriting.
+    QFile dest_file(dest_path);
+    qDebug() << "Removing existing file" << dest_path;
+    if (!dest_file.remove()) {
         const QString error_message = tr(
-                "Error exporting track %1 to %2: %3. Stopping.").arg(
-                sourceFilename, dest_path, source_file.errorString());
+                "Error removing file %1: %2. Stopping.").arg(
+                dest_path, dest_file.errorString());
         qWarning() << error_message;
         m_errorMessage = error_message;
         stop();
-        return;
+        return false;
     }
+    return true;
 }
 
 TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
@@ -191,6 +264,6 @@ TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
 }
 
 void TrackExportWorker::stop() {
-    // We'll wait for the current file to finish copying, then stop.
+    // We'll wait for the in-flight copies to finish, then stop.
     m_bStop = true;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QList>
 #include <QObject>
 #include <QScopedPointer>
 #include <QString>
@@ -10,9 +11,10 @@
 #include "util/fileinfo.h"
 
 // A QThread class for copying a list of files to a single destination directory.
-// Currently does not preserve subdirectory relationships.  This class performs
-// all copies in a blocking style within its own thread.  May be canceled from
-// another thread.
+// Currently does not preserve subdirectory relationships.  Overwrite questions
+// are resolved serially up front; the copies themselves run overlapped on the
+// global thread pool with a bounded number in flight so a single slow medium
+// is kept saturated.  May be canceled from another thread.
 class TrackExportWorker : public QThread {
     Q_OBJECT
   public:
@@ -48,7 +50,7 @@ class TrackExportWorker : public QThread {
         return m_errorMessage;
     }
 
-    // Cancels the export after the current copy operation.
+    // Cancels the export after the in-flight copy operations.
     // May be called from another thread.
     void stop();
 
@@ -65,13 +67,27 @@ class TrackExportWorker : public QThread {
     void canceled();
 
   private:
-    // Copies the file at source_fileinfo to the destination directory with the
-    // name given by dest_filename (not a full path).  If the destination file
-    // exists, will emit an overwrite request signal to ask how to proceed.
-    // On unrecoverable error, sets the error message and stops the export
-    // process entirely.
-    void copyFile(const mixxx::FileInfo& source_fileinfo,
-            const QString& dest_filename);
+    // A fully resolved copy operation: all overwrite questions have been
+    // answered and any existing destination file has been removed.
+    struct CopyJob {
+        QString sourcePath;
+        QString destPath;
+        QString destFileName;
+    };
+
+    // Resolves the overwrite policy for the given destination.  If the
+    // destination file exists, may emit an overwrite request signal and block
+    // for the answer, and removes the file when it is to be overwritten.
+    // Returns true if the file should be copied, false if it should be
+    // skipped.  On unrecoverable error, sets the error message and stops the
+    // export process entirely.
+    bool resolveDestination(const mixxx::FileInfo& source_fileinfo,
+            const QString& dest_path);
+
+    // Runs the given jobs with a bounded number of overlapped copies on the
+    // global thread pool, emitting coalesced progress. skipped and total
+    // account for the files that phase 1 already resolved without a copy.
+    void copyJobs(const QList<CopyJob>& jobs, int skipped, int total);
 
     // Emit a signal requesting overwrite mode, and block until we get an
     // answer.  Updates m_overwriteMode appropriately.
@@ -30,6 +30,7 @@
 #include "library/trackcollection.h"
 #include "library/trackcollectionmanager.h"
 #include "library/trackmodel.h"
+#include "library/trackprewarmer.h"
 #include "library/trackset/crate/cratefeature.h"
 #include "library/trackset/playlistfeature.h"
 #include "library/trackset/setlogfeature.h"
@@ -75,6 +76,7 @@ Library::Library(
           m_pTrackCollectionManager(pTrackCollectionManager),
           m_pSidebarModel(make_parented<SidebarModel>(this)),
           m_pLibraryControl(make_parented<LibraryControl>(this)),
+          m_pTrackPrewarmer(make_parented<TrackPrewarmer>(this)),
           m_pMixxxLibraryFeature(nullptr),
           m_pPlaylistFeature(nullptr),
           m_pCrateFeature(nullptr),
@@ -88,6 +90,13 @@ Library::Library(
             this,
             &Library::slotRefreshLibraryModels);
 
+    // Prewarm the selected track while the user is still deciding, so the
+    // actual deck load hits warm caches.
+    connect(this,
+            &Library::trackSelected,
+            m_pTrackPrewarmer,
+            &TrackPrewarmer::slotTrackSelected);
+
     // TODO(rryan) -- turn this construction / adding of features into a static
     // method or something -- CreateDefaultLibrary
     m_pMixxxLibraryFeature = new MixxxLibraryFeature(
@@ -267,6 +276,7 @@ void Library::stopPendingTasks() {
         m_pAnalysisFeature->stopAnalysis();
         m_pAnalysisFeature = nullptr;
     }
+    m_pTrackPrewarmer->stop();
 }
 
 void Library::bindSearchboxWidget(WSearchLineEdit* pSearchboxWidget) {
@@ -32,6 +32,7 @@ class SidebarModel;
 class TrackCollection;
 class TrackCollectionManager;
 class TrackModel;
+class TrackPrewarmer;
 class WSearchLineEdit;
 class WLibrarySidebar;
 class WLibrary;
@@ -151,6 +152,7 @@ class Library: public QObject {
 
     parented_ptr<SidebarModel> m_pSidebarModel;
     parented_ptr<LibraryControl> m_pLibraryControl;
+    parented_ptr<TrackPrewarmer> m_pTrackPrewarmer;
 
     QList<LibraryFeature*> m_features;
     const static QString m_sTrackViewName;
@@ -15,10 +15,45 @@
 #include <QDir>
 #include <QFile>
 #include <QIODevice>
+#include <QSaveFile>
 #include <QUrl>
 
 #include "library/parser.h"
 
+// static
+bool Parser::writePlaylistFile(const QString& fileLocation,
+        const QByteArray& contents) {
+    // Skip the write when the file already contains the exported bytes.
+    QFile existingFile(fileLocation);
+    if (existingFile.exists() &&
+            existingFile.size() == contents.size() &&
+            existingFile.open(QIODevice::ReadOnly)) {
+        if (existingFile.readAll() == contents) {
+            return true;
+        }
+        existingFile.close();
+    }
+
+    QSaveFile file(fileLocation);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Failed to open playlist file for writing"
+                   << fileLocation << file.errorString();
+        return false;
+    }
+    if (file.write(contents) != contents.size()) {
+        qWarning() << "Failed to write playlist file"
+                   << fileLocation << file.errorString();
+        file.cancelWriting();
+        return false;
+    }
+    if (!file.commit()) {
+        qWarning() << "Failed to commit playlist file"
+                   << fileLocation << file.errorString();
+        return false;
+    }
+    return true;
+}
+
 Parser::Parser() {
 }
 
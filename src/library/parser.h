@@ -43,6 +43,14 @@ class Parser : public QObject {
      or 0 in order for the trackimporter to function**/
     virtual QList<QString> parse(const QString&) = 0;
 
+    // Writes the serialized playlist contents to fileLocation through a
+    // QSaveFile so that readers never observe a partially written playlist.
+    // If the file already contains exactly the exported bytes the write is
+    // skipped entirely, which keeps repeated exports of unchanged playlists
+    // (e.g. from scripted batch exports) cheap.
+    static bool writePlaylistFile(const QString& fileLocation,
+            const QByteArray& contents);
+
   protected:
     // Pointer to the parsed Filelocations
     QList<QString> m_sLocations;
@@ -14,6 +14,7 @@
 
 #include "library/parsercsv.h"
 
+#include <QBuffer>
 #include <QDir>
 #include <QMessageBox>
 #include <QTextStream>
@@ -127,19 +128,19 @@ bool ParserCsv::writeCSVFile(const QString &file_str, BaseSqlTableModel* pPlayli
      * On Linux and OS X \n is <CR> (which remains \n)
      */
 
-    QFile file(file_str);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr,
-                tr("Playlist Export Failed"),
-                tr("Could not create file") + " " + file_str);
-        return false;
-    }
     //Base folder of file
     QString base = file_str.section('/', 0, -2);
     QDir base_dir(base);
 
     qDebug() << "Basepath: " << base;
-    QTextStream out(&file);
+
+    // Serialize the whole playlist into memory first so the file can be
+    // replaced atomically and unchanged playlists are not rewritten,
+    // see Parser::writePlaylistFile().
+    QByteArray contents;
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream out(&buffer);
     out.setCodec("UTF-8"); // rfc4180: Common usage of CSV is US-ASCII ...
                            // Using UTF-8 to get around codepage issues
                            // and it's the default encoding in Ooo Calc
@@ -202,6 +203,14 @@ bool ParserCsv::writeCSVFile(const QString &file_str, BaseSqlTableModel* pPlayli
         }
         out << "\r\n"; // CRLF according to rfc4180
     }
+    out.flush();
+
+    if (!writePlaylistFile(file_str, contents)) {
+        QMessageBox::warning(nullptr,
+                tr("Playlist Export Failed"),
+                tr("Could not create file") + " " + file_str);
+        return false;
+    }
     return true;
 }
 
@@ -213,15 +222,11 @@ bool ParserCsv::writeReadableTextFile(const QString &file_str, BaseSqlTableModel
      * On Linux and OS X \n is <CR> (which remains \n)
      */
 
-    QFile file(file_str);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr,
-                tr("Readable text Export Failed"),
-                tr("Could not create file") + " " + file_str);
-        return false;
-    }
-
-    QTextStream out(&file);
+    // Serialize the whole playlist into memory first, see writeCSVFile().
+    QByteArray contents;
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream out(&buffer);
 
     // export each row as "01. 0:00:00 Artist - Title"
 
@@ -271,5 +276,13 @@ bool ParserCsv::writeReadableTextFile(const QString &file_str, BaseSqlTableModel
         }
         out << "\n";
     }
+    out.flush();
+
+    if (!writePlaylistFile(file_str, contents)) {
+        QMessageBox::warning(nullptr,
+                tr("Readable text Export Failed"),
+                tr("Could not create file") + " " + file_str);
+        return false;
+    }
     return true;
 }
@@ -13,6 +13,7 @@
 
 #include "library/parserm3u.h"
 
+#include <QBuffer>
 #include <QDir>
 #include <QMessageBox>
 #include <QTextCodec>
@@ -144,20 +145,19 @@ bool ParserM3u::writeM3UFile(const QString &file_str, const QList<QString> &item
         }
     }
 
-    QFile file(file_str);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr,
-                tr("Playlist Export Failed"),
-                tr("Could not create file") + " " + file_str);
-        return false;
-    }
-
     // Base folder of file
     QString base = file_str.section('/', 0, -2);
     QDir base_dir(base);
 
     qDebug() << "Basepath: " << base;
-    QTextStream out(&file);
+
+    // Serialize the whole playlist into memory first so the file can be
+    // replaced atomically and unchanged playlists are not rewritten,
+    // see Parser::writePlaylistFile().
+    QByteArray contents;
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream out(&buffer);
     out.setCodec(codec);
     out << "#EXTM3U\n";
     for (int i = 0; i < items.size(); ++i) {
@@ -171,5 +171,13 @@ bool ParserM3u::writeM3UFile(const QString &file_str, const QList<QString> &item
             out << items.at(i) << "\n";
         }
     }
+    out.flush();
+
+    if (!writePlaylistFile(file_str, contents)) {
+        QMessageBox::warning(nullptr,
+                tr("Playlist Export Failed"),
+                tr("Could not create file") + " " + file_str);
+        return false;
+    }
     return true;
 }
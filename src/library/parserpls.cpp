@@ -12,6 +12,7 @@
 //
 #include "library/parserpls.h"
 
+#include <QBuffer>
 #include <QDir>
 #include <QFile>
 #include <QMessageBox>
@@ -130,18 +131,17 @@ QString ParserPls::getFilePath(QTextStream *stream, const QString& basePath) {
 
 bool ParserPls::writePLSFile(const QString &file_str, const QList<QString> &items, bool useRelativePath)
 {
-    QFile file(file_str);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QMessageBox::warning(nullptr,
-                tr("Playlist Export Failed"),
-                tr("Could not create file") + " " + file_str);
-        return false;
-    }
     //Base folder of file
     QString base = file_str.section('/', 0, -2);
     QDir base_dir(base);
 
-    QTextStream out(&file);
+    // Serialize the whole playlist into memory first so the file can be
+    // replaced atomically and unchanged playlists are not rewritten,
+    // see Parser::writePlaylistFile().
+    QByteArray contents;
+    QBuffer buffer(&contents);
+    buffer.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream out(&buffer);
     out << "[playlist]\n";
     out << "NumberOfEntries=" << items.size() << "\n";
     for (int i = 0; i < items.size(); ++i) {
@@ -154,6 +154,13 @@ bool ParserPls::writePLSFile(const QString &file_str, const QList<QString> &item
             out << "File" << i << "=" << items.at(i) << "\n";
         }
     }
+    out.flush();
 
+    if (!writePlaylistFile(file_str, contents)) {
+        QMessageBox::warning(nullptr,
+                tr("Playlist Export Failed"),
+                tr("Could not create file") + " " + file_str);
+        return false;
+    }
     return true;
 }
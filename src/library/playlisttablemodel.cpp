@@ -13,7 +13,9 @@ PlaylistTableModel::PlaylistTableModel(QObject* parent,
         bool keepDeletedTracks)
         : TrackSetTableModel(parent, pTrackCollectionManager, settingsNamespace),
           m_iPlaylistId(-1),
-          m_keepDeletedTracks(keepDeletedTracks) {
+          m_keepDeletedTracks(keepDeletedTracks),
+          m_deferredRefresh(false),
+          m_refreshPending(false) {
     connect(&m_pTrackCollectionManager->internalCollection()->getPlaylistDAO(),
             &PlaylistDAO::tracksChanged,
             this,
@@ -113,9 +115,16 @@ void PlaylistTableModel::setTableModel(int playlistId) {
     //qDebug() << "PlaylistTableModel::setTableModel" << playlistId;
     if (m_iPlaylistId == playlistId) {
         qDebug() << "Already focused on playlist " << playlistId;
+        // The playlist is about to be shown again, so apply a re-select
+        // that was deferred while its view was hidden.
+        setDeferredRefresh(false);
         return;
     }
 
+    // The new table is selected from scratch, so nothing is pending.
+    m_deferredRefresh = false;
+    m_refreshPending = false;
+
     m_iPlaylistId = playlistId;
 
     if (!m_keepDeletedTracks) {
@@ -346,7 +355,23 @@ TrackModel::Capabilities PlaylistTableModel::getCapabilities() const {
 }
 
 void PlaylistTableModel::playlistsChanged(const QSet<int>& playlistIds) {
-    if (playlistIds.contains(m_iPlaylistId)) {
+    if (!playlistIds.contains(m_iPlaylistId)) {
+        return;
+    }
+    if (m_deferredRefresh) {
+        m_refreshPending = true;
+        return;
+    }
+    select(); // Repopulate the data model.
+}
+
+void PlaylistTableModel::setDeferredRefresh(bool deferred) {
+    if (m_deferredRefresh == deferred) {
+        return;
+    }
+    m_deferredRefresh = deferred;
+    if (!deferred && m_refreshPending) {
+        m_refreshPending = false;
         select(); // Repopulate the data model.
     }
 }
@@ -30,6 +30,12 @@ class PlaylistTableModel final : public TrackSetTableModel {
 
     Capabilities getCapabilities() const final;
 
+    /// While enabled, content changes of the playlist do not trigger an
+    /// immediate re-select and only mark the model as pending. Disabling
+    /// applies a pending re-select. Used by the history feature to avoid
+    /// refreshing a hidden view for every track played.
+    void setDeferredRefresh(bool deferred);
+
   private slots:
     void playlistsChanged(const QSet<int>& playlistIds);
 
@@ -38,4 +44,6 @@ class PlaylistTableModel final : public TrackSetTableModel {
 
     int m_iPlaylistId;
     bool m_keepDeletedTracks;
+    bool m_deferredRefresh;
+    bool m_refreshPending;
 };
@@ -302,19 +302,7 @@ int createDevicePlaylist(QSqlDatabase& database, const QString& devicePath) {
         return playlistID;
     }
 
-    QSqlQuery idQuery(database);
-    idQuery.prepare("select id from " + kRekordboxPlaylistsTable + " where name=:path");
-    idQuery.bindValue(":path", devicePath);
-
-    if (!idQuery.exec()) {
-        LOG_FAILED_QUERY(idQuery)
-                << "devicePath: " << devicePath;
-        return playlistID;
-    }
-
-    while (idQuery.next()) {
-        playlistID = idQuery.value(idQuery.record().indexOf("id")).toInt();
-    }
+    playlistID = queryInsertIntoDevicePlaylist.lastInsertId().toInt();
 
     return playlistID;
 }
@@ -342,10 +330,10 @@ mixxx::RgbColor colorFromID(int colorID) {
 }
 
 void insertTrack(
-        QSqlDatabase& database,
         rekordbox_pdb_t::track_row_t* track,
         QSqlQuery& query,
         QSqlQuery& queryInsertIntoDevicePlaylistTracks,
+        QMap<uint32_t, int>& trackIdMap,
         QMap<uint32_t, QString>& artistsMap,
         QMap<uint32_t, QString>& albumsMap,
         QMap<uint32_t, QString>& genresMap,
@@ -393,21 +381,11 @@ void insertTrack(
         LOG_FAILED_QUERY(query);
     }
 
-    int trackID = -1;
-    QSqlQuery finderQuery(database);
-    finderQuery.prepare("select id from " + kRekordboxLibraryTable +
-            " where rb_id=:rb_id and device=:device");
-    finderQuery.bindValue(":rb_id", rbID);
-    finderQuery.bindValue(":device", device);
-
-    if (!finderQuery.exec()) {
-        LOG_FAILED_QUERY(finderQuery)
-                << "rbID:" << rbID;
-    }
-
-    if (finderQuery.next()) {
-        trackID = finderQuery.value(finderQuery.record().indexOf("id")).toInt();
-    }
+    int trackID = query.lastInsertId().toInt();
+    // Remember the Rekordbox id of the inserted track so playlist entries
+    // can be resolved in memory instead of querying each track back from
+    // the database.
+    trackIdMap[track->id()] = trackID;
 
     // Insert into device all tracks playlist
     queryInsertIntoDevicePlaylistTracks.bindValue(":track_id", trackID);
@@ -428,6 +406,7 @@ void buildPlaylistTree(
         QMap<uint32_t, bool>& playlistIsFolderMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTreeMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTrackMap,
+        const QMap<uint32_t, int>& trackIdMap,
         const QString& playlistPath,
         const QString& device);
 
@@ -515,6 +494,7 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
     QMap<uint32_t, QString> genresMap;
     QMap<uint32_t, QString> artistsMap;
     QMap<uint32_t, QString> albumsMap;
+    QMap<uint32_t, int> trackIdMap;
     QMap<uint32_t, QString> playlistNameMap;
     QMap<uint32_t, bool> playlistIsFolderMap;
     QMap<uint32_t, QMap<uint32_t, uint32_t>> playlistTreeMap;
@@ -595,12 +575,13 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
                                     } break;
                                     case rekordbox_pdb_t::PAGE_TYPE_TRACKS: {
                                         // Track found, insert into database
-                                        insertTrack(database,
+                                        insertTrack(
                                                 static_cast<rekordbox_pdb_t::
                                                                 track_row_t*>(
                                                         (*rowRef)->body()),
                                                 query,
                                                 queryInsertIntoDevicePlaylistTracks,
+                                                trackIdMap,
                                                 artistsMap,
                                                 albumsMap,
                                                 genresMap,
@@ -659,6 +640,7 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
                 playlistIsFolderMap,
                 playlistTreeMap,
                 playlistTrackMap,
+                trackIdMap,
                 devicePath,
                 device);
     }
@@ -678,6 +660,7 @@ void buildPlaylistTree(
         QMap<uint32_t, bool>& playlistIsFolderMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTreeMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTrackMap,
+        const QMap<uint32_t, int>& trackIdMap,
         const QString& playlistPath,
         const QString& device) {
     for (uint32_t childIndex = 0;
@@ -710,20 +693,7 @@ void buildPlaylistTree(
             return;
         }
 
-        QSqlQuery idQuery(database);
-        idQuery.prepare("select id from " + kRekordboxPlaylistsTable + " where name=:path");
-        idQuery.bindValue(":path", currentPath);
-
-        if (!idQuery.exec()) {
-            LOG_FAILED_QUERY(idQuery)
-                    << "currentPath" << currentPath;
-            return;
-        }
-
-        int playlistID = -1;
-        while (idQuery.next()) {
-            playlistID = idQuery.value(idQuery.record().indexOf("id")).toInt();
-        }
+        int playlistID = queryInsertIntoPlaylist.lastInsertId().toInt();
 
         QSqlQuery queryInsertIntoPlaylistTracks(database);
         queryInsertIntoPlaylistTracks.prepare(
@@ -738,23 +708,9 @@ void buildPlaylistTree(
                     trackIndex++) {
                 uint32_t rbTrackID = playlistTrackMap[childID][trackIndex];
 
-                int trackID = -1;
-                QSqlQuery finderQuery(database);
-                finderQuery.prepare("select id from " + kRekordboxLibraryTable +
-                        " where rb_id=:rb_id and device=:device");
-                finderQuery.bindValue(":rb_id", rbTrackID);
-                finderQuery.bindValue(":device", device);
-
-                if (!finderQuery.exec()) {
-                    LOG_FAILED_QUERY(finderQuery)
-                            << "rbTrackID:" << rbTrackID
-                            << "device:" << device;
-                    return;
-                }
-
-                if (finderQuery.next()) {
-                    trackID = finderQuery.value(finderQuery.record().indexOf("id")).toInt();
-                }
+                // The tracks have already been inserted, look up the database
+                // id of this playlist entry in memory.
+                int trackID = trackIdMap.value(rbTrackID, -1);
 
                 queryInsertIntoPlaylistTracks.bindValue(":playlist_id", playlistID);
                 queryInsertIntoPlaylistTracks.bindValue(":track_id", trackID);
@@ -780,6 +736,7 @@ void buildPlaylistTree(
                     playlistIsFolderMap,
                     playlistTreeMap,
                     playlistTrackMap,
+                    trackIdMap,
                     currentPath,
                     device);
         }
@@ -854,39 +811,41 @@ void clearDeviceTables(QSqlDatabase& database, TreeItem* child) {
     transaction.commit();
 }
 
-void setHotCue(TrackPointer track,
+// Updates or creates a hot cue in the given list of pending cue points.
+// The cue points are applied to the track in a single batch after the
+// whole ANLZ file has been parsed (see readAnalyze) to avoid emitting
+// Track::cuesUpdated once per imported cue.
+void setHotCue(QList<CuePointer>* pCuePoints,
         double startPosition,
         double endPosition,
         int id,
         const QString& label,
         mixxx::RgbColor::optional_t color) {
-    CuePointer pCue;
-    const QList<CuePointer> cuePoints = track->getCuePoints();
-    for (const CuePointer& trackCue : cuePoints) {
-        if (trackCue->getHotCue() == id) {
-            pCue = trackCue;
-            break;
-        }
-    }
-
     mixxx::CueType type = mixxx::CueType::HotCue;
     if (endPosition != Cue::kNoPosition) {
         type = mixxx::CueType::Loop;
     }
 
-    if (pCue) {
-        pCue->setStartAndEndPosition(startPosition, endPosition);
-    } else {
-        pCue = track->createAndAddCue(
-                type,
-                id,
-                startPosition,
-                endPosition);
-    }
+    CuePointer pCue(new Cue(
+            type,
+            id,
+            startPosition,
+            endPosition));
     pCue->setLabel(label);
     if (color) {
         pCue->setColor(*color);
     }
+
+    // Replace an existing cue with the same hot cue number. Cues that
+    // are already attached to the track must not be modified in place,
+    // because every setter would emit a separate Cue::updated signal.
+    for (int i = 0; i < pCuePoints->size(); i++) {
+        if (pCuePoints->at(i)->getHotCue() == id) {
+            pCuePoints->replace(i, pCue);
+            return;
+        }
+    }
+    pCuePoints->append(pCue);
 }
 
 void readAnalyze(TrackPointer track,
@@ -911,6 +870,12 @@ void readAnalyze(TrackPointer track,
     QList<memory_cue_loop_t> memoryCuesAndLoops;
     int lastHotCueIndex = 0;
 
+    // Collect all imported cues here and apply them to the track in a
+    // single batch below, so that only one cuesUpdated signal is emitted
+    // per ANLZ file instead of one per cue.
+    QList<CuePointer> cuePoints = track->getCuePoints();
+    bool cuesModified = false;
+
     for (std::vector<rekordbox_anlz_t::tagged_section_t*>::iterator section =
                     anlz.sections()->begin();
             section != anlz.sections()->end();
@@ -996,12 +961,13 @@ void readAnalyze(TrackPointer track,
                         lastHotCueIndex = hotCueIndex;
                     }
                     setHotCue(
-                            track,
+                            &cuePoints,
                             position,
                             Cue::kNoPosition,
                             hotCueIndex,
                             QString(),
                             mixxx::RgbColor::nullopt());
+                    cuesModified = true;
                 } break;
                 }
             }
@@ -1062,7 +1028,7 @@ void readAnalyze(TrackPointer track,
                     if (hotCueIndex > lastHotCueIndex) {
                         lastHotCueIndex = hotCueIndex;
                     }
-                    setHotCue(track,
+                    setHotCue(&cuePoints,
                             position,
                             Cue::kNoPosition,
                             hotCueIndex,
@@ -1074,6 +1040,7 @@ void readAnalyze(TrackPointer track,
                                             (*cueExtendedEntry)->color_green()),
                                     static_cast<int>((*cueExtendedEntry)
                                                              ->color_blue()))));
+                    cuesModified = true;
                 } break;
                 }
             }
@@ -1099,24 +1066,54 @@ void readAnalyze(TrackPointer track,
 
             if (!mainCueFound && memoryCueOrLoop.endPosition == Cue::kNoPosition) {
                 // Set first chronological memory cue as Mixxx MainCue
-                track->setCuePoint(CuePosition(memoryCueOrLoop.startPosition));
-                CuePointer pMainCue = track->findCueByType(mixxx::CueType::MainCue);
+                CuePointer pMainCue(new Cue(
+                        mixxx::CueType::MainCue,
+                        Cue::kNoHotCue,
+                        memoryCueOrLoop.startPosition,
+                        Cue::kNoPosition));
                 pMainCue->setLabel(memoryCueOrLoop.comment);
-                pMainCue->setColor(*memoryCueOrLoop.color);
+                if (memoryCueOrLoop.color) {
+                    pMainCue->setColor(*memoryCueOrLoop.color);
+                }
+                bool mainCueReplaced = false;
+                for (int i = 0; i < cuePoints.size(); i++) {
+                    if (cuePoints.at(i)->getType() == mixxx::CueType::MainCue) {
+                        cuePoints.replace(i, pMainCue);
+                        mainCueReplaced = true;
+                        break;
+                    }
+                }
+                if (!mainCueReplaced) {
+                    cuePoints.append(pMainCue);
+                }
+                cuesModified = true;
                 mainCueFound = true;
             } else {
                 // Mixxx v2.4 will feature multiple loops, so these saved here will be usable
                 // For 2.3, Mixxx treats them as hotcues and the first one will be loaded as the single loop Mixxx supports
                 lastHotCueIndex++;
                 setHotCue(
-                        track,
+                        &cuePoints,
                         memoryCueOrLoop.startPosition,
                         memoryCueOrLoop.endPosition,
                         lastHotCueIndex,
                         memoryCueOrLoop.comment,
                         memoryCueOrLoop.color);
+                cuesModified = true;
+            }
+        }
+    }
+
+    if (cuesModified) {
+        // Associated Cue objects should always live on the same thread
+        // as their host track (see Track::createAndAddCue()).
+        for (const CuePointer& pCue : qAsConst(cuePoints)) {
+            if (pCue->thread() != track->thread()) {
+                pCue->moveToThread(track->thread());
             }
         }
+        // Apply the whole batch at once, emitting a single cuesUpdated signal.
+        track->setCuePoints(cuePoints);
     }
 }
 
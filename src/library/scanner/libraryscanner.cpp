@@ -20,7 +20,12 @@
 namespace {
 
 // TODO(rryan) make configurable
-const int kScannerThreadPoolSize = 1;
+// Directory hashing is dominated by stat calls that block on the file
+// system, especially for libraries on network shares. Running a few tasks
+// in parallel overlaps that latency without hammering the disk. All
+// database writes stay on the scanner thread, the pooled tasks only emit
+// queued signals.
+const int kScannerThreadPoolSize = 4;
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -0,0 +1,119 @@
+#include "library/scanner/librarywatcher.h"
+
+#include <QDir>
+#include <QDirIterator>
+
+#include "moc_librarywatcher.cpp"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("LibraryWatcher");
+
+// Wait for the filesystem to settle before reporting a batch of
+// changes. Restarted on every incoming notification, so a pipeline
+// exporting dozens of files produces a single batch.
+constexpr int kCoalesceTimeoutMs = 5000;
+
+// Upper bound on how long a continuous trickle of changes may defer
+// the batch.
+constexpr qint64 kMaxCoalesceDelayMs = 30000;
+
+} // anonymous namespace
+
+LibraryWatcher::LibraryWatcher(QObject* parent)
+        : QObject(parent),
+          m_hasPendingChanges(false) {
+    m_coalesceTimer.setSingleShot(true);
+    connect(&m_watcher,
+            &QFileSystemWatcher::directoryChanged,
+            this,
+            &LibraryWatcher::slotDirectoryChanged);
+    connect(&m_coalesceTimer,
+            &QTimer::timeout,
+            this,
+            &LibraryWatcher::slotCoalesceTimerExpired);
+}
+
+void LibraryWatcher::watchRootDirs(const QList<mixxx::FileInfo>& rootDirs) {
+    const QStringList watchedDirs = m_watcher.directories();
+    if (!watchedDirs.isEmpty()) {
+        m_watcher.removePaths(watchedDirs);
+    }
+    for (const mixxx::FileInfo& rootDir : rootDirs) {
+        addDirectoryTree(rootDir.location());
+    }
+    kLogger.debug() << "Watching" << m_watcher.directories().size()
+                    << "directories in" << rootDirs.size()
+                    << "library root(s)";
+}
+
+void LibraryWatcher::addDirectoryTree(const QString& dirPath) {
+    if (dirPath.isEmpty() || !QDir(dirPath).exists()) {
+        return;
+    }
+    QStringList dirs(dirPath);
+    QDirIterator it(dirPath,
+            QDir::Dirs | QDir::NoDotAndDotDot,
+            QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    while (it.hasNext()) {
+        dirs.append(it.next());
+    }
+    // addPaths() skips paths that are already watched and returns the
+    // paths it could not watch, e.g. when the inotify watch limit has
+    // been reached.
+    const QStringList failedDirs = m_watcher.addPaths(dirs);
+    if (!failedDirs.isEmpty()) {
+        kLogger.warning()
+                << "Could not watch" << failedDirs.size()
+                << "directories for changes, e.g." << failedDirs.first()
+                << "- changes in them are only picked up by manual scans."
+                << "On Linux the inotify watch limit"
+                << "(fs.inotify.max_user_watches) may need to be raised.";
+    }
+}
+
+void LibraryWatcher::slotDirectoryChanged(const QString& path) {
+    // A change may be a newly created subdirectory; bring its tree
+    // under watch so that changes inside it are noticed, too. Deleted
+    // directories are dropped by QFileSystemWatcher itself.
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        const QString subDir = it.next();
+        if (!m_watcher.directories().contains(subDir)) {
+            addDirectoryTree(subDir);
+        }
+    }
+
+    if (!m_hasPendingChanges) {
+        m_hasPendingChanges = true;
+        m_sinceFirstPendingChange.start();
+    } else if (m_sinceFirstPendingChange.elapsed() >= kMaxCoalesceDelayMs) {
+        // Do not let a continuous trickle of changes defer the batch
+        // forever.
+        m_coalesceTimer.stop();
+        slotCoalesceTimerExpired();
+        return;
+    }
+    m_coalesceTimer.start(kCoalesceTimeoutMs);
+}
+
+void LibraryWatcher::slotCoalesceTimerExpired() {
+    if (!m_hasPendingChanges) {
+        return;
+    }
+    m_hasPendingChanges = false;
+    kLogger.debug() << "Coalesced filesystem changes detected,"
+                    << "requesting library scan";
+    emit changesDetected();
+}
+
+void LibraryWatcher::slotScanFinished() {
+    // Changes that arrived while the scan was running were either
+    // picked up by the scan itself (if the directory was visited after
+    // the change) or are still pending; re-arm the timer so the
+    // pending ones are not lost.
+    if (m_hasPendingChanges && !m_coalesceTimer.isActive()) {
+        m_coalesceTimer.start(kCoalesceTimeoutMs);
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
+#include <QObject>
+#include <QSet>
+#include <QTimer>
+
+#include "util/fileinfo.h"
+
+/// Watches the library root directories (and their subdirectories) for
+/// filesystem changes via the native notification APIs wrapped by
+/// QFileSystemWatcher (inotify/FSEvents/ReadDirectoryChangesW) and emits
+/// changesDetected() with the change notifications coalesced, so that a
+/// batch of newly exported files triggers a single incremental library
+/// scan instead of one per file.
+///
+/// The actual change detection is left to the scanner: it hashes the
+/// directory listings and skips unchanged directories, so a scan
+/// triggered by this watcher only touches the directories that actually
+/// changed.
+class LibraryWatcher : public QObject {
+    Q_OBJECT
+  public:
+    explicit LibraryWatcher(QObject* parent = nullptr);
+
+    /// Replaces the watched directory trees with the given root
+    /// directories and their subdirectories.
+    void watchRootDirs(const QList<mixxx::FileInfo>& rootDirs);
+
+  public slots:
+    /// Re-arms the coalescing timer for changes that arrived while a
+    /// scan was running. Connect to the scan-finished signal.
+    void slotScanFinished();
+
+  signals:
+    /// Emitted once per coalesced batch of filesystem changes.
+    void changesDetected();
+
+  private slots:
+    void slotDirectoryChanged(const QString& path);
+    void slotCoalesceTimerExpired();
+
+  private:
+    void addDirectoryTree(const QString& dirPath);
+
+    QFileSystemWatcher m_watcher;
+    QTimer m_coalesceTimer;
+    // Time of the first change of the currently pending batch, used to
+    // bound the latency when changes keep trickling in.
+    QElapsedTimer m_sinceFirstPendingChange;
+    bool m_hasPendingChanges;
+};
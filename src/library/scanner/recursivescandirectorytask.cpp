@@ -46,9 +46,9 @@ void RecursiveScanDirectoryTask::run() {
     // TODO(rryan) benchmark QRegExp copy versus QMutex/QRegExp in ScannerGlobal
     // versus slicing the extension off and checking for set/list containment.
     QRegExp supportedExtensionsRegex =
-            m_scannerGlobal->supportedExtensionsRegex();
+            m_scannerGlobal->deepCopySupportedExtensionsRegex();
     QRegExp supportedCoverExtensionsRegex =
-            m_scannerGlobal->supportedCoverExtensionsRegex();
+            m_scannerGlobal->deepCopySupportedCoverExtensionsRegex();
 
     while (it.hasNext()) {
         QString currentFile = it.next();
@@ -54,6 +54,24 @@ class ScannerGlobal {
         return m_supportedExtensionsMatcher;
     }
 
+    // QRegExp is implicitly shared and matching mutates the shared internal
+    // state even though indexIn() is const. Tasks that match concurrently on
+    // multiple scanner threads therefore need their own deep copy instead of
+    // a flat copy that still shares its internals with this instance.
+    QRegExp deepCopySupportedExtensionsRegex() const {
+        QMutexLocker locker(&m_supportedExtensionsMatcherMutex);
+        return QRegExp(m_supportedExtensionsMatcher.pattern(),
+                m_supportedExtensionsMatcher.caseSensitivity(),
+                m_supportedExtensionsMatcher.patternSyntax());
+    }
+
+    QRegExp deepCopySupportedCoverExtensionsRegex() const {
+        QMutexLocker locker(&m_supportedCoverExtensionsMatcherMutex);
+        return QRegExp(m_supportedCoverExtensionsMatcher.pattern(),
+                m_supportedCoverExtensionsMatcher.caseSensitivity(),
+                m_supportedCoverExtensionsMatcher.patternSyntax());
+    }
+
     bool testAndMarkDirectoryScanned(const QDir& dir) {
         const QString canonicalPath(dir.canonicalPath());
         QMutexLocker locker(&m_directoriesScannedMutex);
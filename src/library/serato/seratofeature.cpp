@@ -111,11 +111,18 @@ int createPlaylist(const QSqlDatabase& database, const QString& name, const QStr
     return query.lastInsertId().toInt();
 }
 
-int insertTrackIntoPlaylist(const QSqlDatabase& database, int playlistId, int trackId, int position) {
+// Prepares the INSERT statement for insertTrackIntoPlaylist once, so it can
+// be reused for all tracks of a playlist instead of being recompiled for
+// every single track.
+QSqlQuery preparePlaylistTrackInsert(const QSqlDatabase& database) {
     QSqlQuery query(database);
     query.prepare(
             "INSERT INTO serato_playlist_tracks (playlist_id, track_id, position) "
             "VALUES (:playlist_id, :track_id, :position)");
+    return query;
+}
+
+int insertTrackIntoPlaylist(QSqlQuery& query, int playlistId, int trackId, int position) {
     query.bindValue(":playlist_id", playlistId);
     query.bindValue(":track_id", trackId);
     query.bindValue(":position", position);
@@ -363,6 +370,8 @@ QString parseCrate(
         return QString();
     }
 
+    QSqlQuery playlistTrackInsert = preparePlaylistTrackInsert(database);
+
     int trackCount = 0;
     QByteArray headerData = crateFile.read(kHeaderSize);
     while (headerData.length() == kHeaderSize) {
@@ -397,7 +406,7 @@ QString parseCrate(
             QString location = parseCrateTrackPath(&buffer);
             if (!location.isEmpty()) {
                 int trackId = trackIdMap.value(location, -1);
-                insertTrackIntoPlaylist(database, playlistId, trackId, trackCount);
+                insertTrackIntoPlaylist(playlistTrackInsert, playlistId, trackId, trackCount);
                 trackCount++;
                 break;
             }
@@ -545,6 +554,8 @@ QString parseDatabase(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dat
         return QString();
     }
 
+    QSqlQuery playlistTrackInsert = preparePlaylistTrackInsert(database);
+
     int trackCount = 0;
     QMap<QString, int> trackIdMap;
     QByteArray headerData = databaseFile.read(kHeaderSize);
@@ -602,7 +613,7 @@ QString parseDatabase(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dat
                     LOG_FAILED_QUERY(query);
                 } else {
                     int trackId = query.lastInsertId().toInt();
-                    insertTrackIntoPlaylist(database, playlistId, trackId, trackCount);
+                    insertTrackIntoPlaylist(playlistTrackInsert, playlistId, trackId, trackCount);
                     trackIdMap.insert(track.location, trackId);
                     trackCount++;
                 }
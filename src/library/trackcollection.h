@@ -164,6 +164,7 @@ class TrackCollection : public QObject,
     void relocateDirectory(const QString& oldDir, const QString& newDir);
 
     void saveTrack(Track* pTrack) const;
+    void saveTracks(const QList<TrackPointer>& tracks) const;
 
     QSqlDatabase m_database;
 
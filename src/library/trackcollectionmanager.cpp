@@ -2,6 +2,7 @@
 
 #include "library/externaltrackcollection.h"
 #include "library/scanner/libraryscanner.h"
+#include "library/scanner/librarywatcher.h"
 #include "library/trackcollection.h"
 #include "moc_trackcollectionmanager.cpp"
 #include "sources/soundsourceproxy.h"
@@ -18,6 +19,11 @@ const QString kConfigGroup = QStringLiteral("[TrackCollection]");
 
 const ConfigKey kConfigKeyRepairDatabaseOnNextRestart(kConfigGroup, "RepairDatabaseOnNextRestart");
 
+// Delay before flushing queued write-behind saves to the database. Long
+// enough to coalesce a burst of quick edits, short enough that the
+// database never lags noticeably behind the in-memory state.
+constexpr int kDeferredTrackSavesTimeoutMillis = 500;
+
 inline
 parented_ptr<TrackCollection> createInternalTrackCollection(
         TrackCollectionManager* parent,
@@ -51,6 +57,13 @@ TrackCollectionManager::TrackCollectionManager(
 
     m_pInternalCollection->connectDatabase(dbConnection);
 
+    m_deferredTrackSavesTimer.setSingleShot(true);
+    m_deferredTrackSavesTimer.setInterval(kDeferredTrackSavesTimeoutMillis);
+    connect(&m_deferredTrackSavesTimer,
+            &QTimer::timeout,
+            this,
+            &TrackCollectionManager::flushDeferredTrackSaves);
+
     if (deleteTrackForTestingFn) {
         kLogger.info() << "External collections are disabled in test mode";
     } else {
@@ -122,10 +135,36 @@ TrackCollectionManager::TrackCollectionManager(
 
         kLogger.info() << "Starting library scanner thread";
         m_pScanner->start();
+
+        if (pConfig->getValue(
+                    ConfigKey("[Library]", "WatchRootDirectories"), true)) {
+            m_pWatcher = std::make_unique<LibraryWatcher>();
+            connect(m_pWatcher.get(),
+                    &LibraryWatcher::changesDetected,
+                    this,
+                    &TrackCollectionManager::startLibraryScan);
+            connect(m_pScanner.get(),
+                    &LibraryScanner::scanFinished,
+                    m_pWatcher.get(),
+                    &LibraryWatcher::slotScanFinished);
+            updateWatchedRootDirs();
+        }
+    }
+}
+
+void TrackCollectionManager::updateWatchedRootDirs() const {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    if (m_pWatcher) {
+        m_pWatcher->watchRootDirs(m_pInternalCollection->loadRootDirs(
+                /*skipInvalidOrMissing*/ true));
     }
 }
 
 TrackCollectionManager::~TrackCollectionManager() {
+    // Persist any queued write-behind saves before the cache is
+    // deactivated and the database connection is closed.
+    flushDeferredTrackSaves();
+
     if (m_pScanner) {
         while (m_pScanner->isRunning()) {
             kLogger.info() << "Stopping library scanner thread";
@@ -182,6 +221,86 @@ TrackCollectionManager::SaveTrackResult TrackCollectionManager::saveTrack(
     return res;
 }
 
+void TrackCollectionManager::saveTrackLater(const TrackPointer& pTrack) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    VERIFY_OR_DEBUG_ASSERT(pTrack) {
+        return;
+    }
+    if (!pTrack->getId().isValid()) {
+        // Tracks that are not (yet) part of the library cannot be queued
+        // and are saved when evicted from the cache.
+        return;
+    }
+    m_deferredTrackSaves.insert(pTrack->getId(), pTrack);
+    if (!m_deferredTrackSavesTimer.isActive()) {
+        m_deferredTrackSavesTimer.start();
+    }
+}
+
+void TrackCollectionManager::flushDeferredTrackSaves() {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    // Move the queue into a local copy first: dropping a TrackPointer after
+    // saving might evict the track from the cache, which re-enters this
+    // class through saveEvictedTrack().
+    const auto deferredTrackSaves = std::move(m_deferredTrackSaves);
+    m_deferredTrackSaves.clear();
+
+    // Mirrors the flow of saveTrack(), but hands the database update of
+    // the whole batch to TrackCollection::saveTracks() so all tracks are
+    // saved within a single transaction with one prepared statement.
+    QList<TrackPointer> dirtyTracks;
+    dirtyTracks.reserve(deferredTrackSaves.size());
+    for (const auto& pTrack : deferredTrackSaves) {
+        // Skips tracks that are no longer dirty, e.g. after an edit has
+        // been reverted or an explicit save happened in the meantime.
+        if (!pTrack->isDirty()) {
+            continue;
+        }
+        DEBUG_ASSERT(pTrack->getDateAdded().isValid());
+        const auto fileInfo = pTrack->getFileInfo();
+        if (!fileInfo.checkFileExists()) {
+            // Missing tracks should not be modified until they either
+            // reappear or are purged.
+            kLogger.debug()
+                    << "Skip saving of missing track"
+                    << fileInfo.location();
+            continue;
+        }
+        // The metadata must be exported while the cache is locked to
+        // ensure that we have exclusive (write) access on the file
+        // and not reader or writer is accessing the same file
+        // concurrently.
+        exportTrackMetadata(pTrack.get(), TrackMetadataExportMode::Deferred);
+        dirtyTracks.append(pTrack);
+    }
+    if (dirtyTracks.isEmpty()) {
+        return;
+    }
+
+    m_pInternalCollection->saveTracks(dirtyTracks);
+
+    if (m_externalCollections.isEmpty()) {
+        return;
+    }
+    for (const auto& pTrack : qAsConst(dirtyTracks)) {
+        if (pTrack->getId().isValid()) {
+            // Track still exists in the internal collection/database
+            for (const auto& externalTrackCollection : qAsConst(m_externalCollections)) {
+                externalTrackCollection->saveTrack(
+                        *pTrack,
+                        ExternalTrackCollection::ChangeHint::Modified);
+            }
+        } else {
+            // Track has been deleted from the internal collection/database
+            // while it was cached in-memory
+            for (const auto& externalTrackCollection : qAsConst(m_externalCollections)) {
+                externalTrackCollection->purgeTracks(
+                        QStringList{pTrack->getLocation()});
+            }
+        }
+    }
+}
+
 // Export metadata and save the track in both the internal database
 // and external libraries.
 void TrackCollectionManager::saveEvictedTrack(Track* pTrack) noexcept {
@@ -301,13 +420,21 @@ void TrackCollectionManager::exportTrackMetadata(
 bool TrackCollectionManager::addDirectory(const mixxx::FileInfo& newDir) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
-    return m_pInternalCollection->addDirectory(newDir);
+    if (!m_pInternalCollection->addDirectory(newDir)) {
+        return false;
+    }
+    updateWatchedRootDirs();
+    return true;
 }
 
 bool TrackCollectionManager::removeDirectory(const mixxx::FileInfo& oldDir) const {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
-    return m_pInternalCollection->removeDirectory(oldDir);
+    if (!m_pInternalCollection->removeDirectory(oldDir)) {
+        return false;
+    }
+    updateWatchedRootDirs();
+    return true;
 }
 
 void TrackCollectionManager::relocateDirectory(const QString& oldDir, const QString& newDir) const {
@@ -320,6 +447,7 @@ void TrackCollectionManager::relocateDirectory(const QString& oldDir, const QStr
             << newDir;
     // TODO(XXX): Add error handling in TrackCollection::relocateDirectory()
     m_pInternalCollection->relocateDirectory(oldDir, newDir);
+    updateWatchedRootDirs();
     if (m_externalCollections.isEmpty()) {
         return;
     }
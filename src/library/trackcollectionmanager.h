@@ -1,8 +1,10 @@
 #pragma once
 
 #include <QDir>
+#include <QHash>
 #include <QList>
 #include <QSet>
+#include <QTimer>
 #include <memory>
 
 #include "library/relocatedtrack.h"
@@ -14,6 +16,7 @@
 #include "util/thread_affinity.h"
 
 class LibraryScanner;
+class LibraryWatcher;
 class TrackCollection;
 class ExternalTrackCollection;
 
@@ -82,6 +85,14 @@ class TrackCollectionManager: public QObject,
     };
     SaveTrackResult saveTrack(const TrackPointer& pTrack) const;
 
+    // Queue the track for a deferred write-behind save. The track object
+    // has already been modified in memory and all views read through the
+    // cache, so the database update can be batched and executed later on
+    // the event loop. Rapid consecutive quick edits like bulk rating or
+    // coloring tracks then issue a single coalesced save per track instead
+    // of one synchronous UPDATE per click.
+    void saveTrackLater(const TrackPointer& pTrack);
+
   signals:
     void libraryScanStarted();
     void libraryScanFinished();
@@ -110,6 +121,15 @@ class TrackCollectionManager: public QObject,
             Track* pTrack,
             TrackMetadataExportMode mode) const;
 
+    void flushDeferredTrackSaves();
+
+    // Pending write-behind saves, keyed by track id to coalesce repeated
+    // edits of the same track. Holding the TrackPointer also keeps the
+    // track alive, so releasing the last UI reference does not trigger a
+    // synchronous save upon eviction from the cache.
+    QHash<TrackId, TrackPointer> m_deferredTrackSaves;
+    QTimer m_deferredTrackSavesTimer;
+
     const UserSettingsPointer m_pConfig;
 
     const parented_ptr<TrackCollection> m_pInternalCollection;
@@ -118,4 +138,10 @@ class TrackCollectionManager: public QObject,
 
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     std::unique_ptr<LibraryScanner> m_pScanner;
+
+    // Triggers incremental scans when files change inside the library
+    // root directories. Only created together with the scanner.
+    std::unique_ptr<LibraryWatcher> m_pWatcher;
+
+    void updateWatchedRootDirs() const;
 };
@@ -0,0 +1,122 @@
+#include "library/trackprewarmer.h"
+
+#include <QFile>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include "moc_trackprewarmer.cpp"
+#include "track/track.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackPrewarmer");
+
+// Dwell time on a selection before we consider it a load candidate. Short
+// enough to finish the read-ahead during a typical decision pause, long
+// enough to not trigger while scrolling through the list.
+constexpr int kDwellTimeoutMillis = 500;
+
+// Number of tracks kept pinned. Together with kReadAheadBytes this caps
+// the page cache footprint of the read-aheads.
+constexpr int kMaxPrewarmedTracks = 8;
+
+// How much of the file to read ahead. Covers the header, the seek tables
+// and the first minute of typical compressed audio, which is what the
+// CachingReaderWorker touches first on load.
+constexpr qint64 kReadAheadBytes = 8 * 1024 * 1024;
+
+constexpr qint64 kReadChunkBytes = 64 * 1024;
+
+// Reads the first chunks of the file to pull it into the OS page cache.
+// The data itself is discarded. Runs in a worker thread at idle priority;
+// pStopRequested aborts between chunks on shutdown.
+void readFileAhead(const QString& location, QAtomicInt* pStopRequested) {
+    QThread* thisThread = QThread::currentThread();
+    thisThread->setPriority(QThread::IdlePriority);
+
+    QFile file(location);
+    if (!file.open(QIODevice::ReadOnly)) {
+        kLogger.debug() << "Failed to open" << location << "for read-ahead";
+        return;
+    }
+
+    char chunk[kReadChunkBytes];
+    qint64 remaining = kReadAheadBytes;
+    while (remaining > 0 && pStopRequested->loadAcquire() == 0) {
+        const qint64 read = file.read(chunk, kReadChunkBytes);
+        if (read <= 0) {
+            break;
+        }
+        remaining -= read;
+    }
+}
+
+} // namespace
+
+TrackPrewarmer::TrackPrewarmer(QObject* parent)
+        : QObject(parent),
+          m_stopRequested(0) {
+    m_dwellTimer.setSingleShot(true);
+    m_dwellTimer.setInterval(kDwellTimeoutMillis);
+    connect(&m_dwellTimer,
+            &QTimer::timeout,
+            this,
+            &TrackPrewarmer::slotDwellTimeout);
+}
+
+TrackPrewarmer::~TrackPrewarmer() {
+    stop();
+}
+
+void TrackPrewarmer::stop() {
+    m_dwellTimer.stop();
+    m_stopRequested.storeRelease(1);
+    m_readAheadFuture.waitForFinished();
+    m_pSelectedTrack.reset();
+    m_prewarmedTracks.clear();
+}
+
+void TrackPrewarmer::slotTrackSelected(TrackPointer pTrack) {
+    if (!pTrack) {
+        // None or multiple tracks selected
+        m_dwellTimer.stop();
+        m_pSelectedTrack.reset();
+        return;
+    }
+    if (pTrack == m_pSelectedTrack) {
+        // Unchanged selection, the dwell timer is either pending or the
+        // track has been prewarmed already.
+        return;
+    }
+    m_pSelectedTrack = pTrack;
+    m_dwellTimer.start();
+}
+
+void TrackPrewarmer::slotDwellTimeout() {
+    const TrackPointer pTrack = m_pSelectedTrack;
+    if (!pTrack) {
+        return;
+    }
+    if (m_prewarmedTracks.contains(pTrack)) {
+        return;
+    }
+    if (m_readAheadFuture.isRunning()) {
+        // Only one read-ahead at a time; try again after another dwell
+        // interval in case the user is still deciding.
+        m_dwellTimer.start();
+        return;
+    }
+
+    // Pin the track. This keeps its metadata, cues and analysis data in
+    // the GlobalTrackCache until it is evicted from this bounded list.
+    m_prewarmedTracks.append(pTrack);
+    while (m_prewarmedTracks.size() > kMaxPrewarmedTracks) {
+        m_prewarmedTracks.removeFirst();
+    }
+
+    kLogger.debug() << "Prewarming" << pTrack->getLocation();
+    m_stopRequested.storeRelease(0);
+    m_readAheadFuture = QtConcurrent::run(
+            readFileAhead, pTrack->getLocation(), &m_stopRequested);
+}
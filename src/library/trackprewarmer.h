@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QFuture>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+
+#include "track/track_decl.h"
+
+// Prewarms the track most likely to be loaded next. When the user dwells
+// on a library selection the selected track's file is read ahead at idle
+// priority so the OS page cache already holds the first chunks when the
+// actual load via PlayerManager happens. The selected tracks are also
+// pinned for a while, which keeps their metadata, cues and analysis data
+// alive in the GlobalTrackCache. This turns the first-access latency of
+// slow (network) storage into background work during the decision pause.
+class TrackPrewarmer : public QObject {
+    Q_OBJECT
+  public:
+    explicit TrackPrewarmer(QObject* parent = nullptr);
+    ~TrackPrewarmer() override;
+
+    // Cancels the pending read-ahead and waits for it to finish.
+    // Called from Library::stopPendingTasks() on shutdown.
+    void stop();
+
+  public slots:
+    void slotTrackSelected(TrackPointer pTrack);
+
+  private slots:
+    void slotDwellTimeout();
+
+  private:
+    QTimer m_dwellTimer;
+    TrackPointer m_pSelectedTrack;
+
+    // Most recently prewarmed tracks, newest last. Pinning the
+    // TrackPointers keeps the tracks cached; the list is bounded so the
+    // pinned memory and the page cache footprint of the read-aheads
+    // stay capped.
+    QList<TrackPointer> m_prewarmedTracks;
+
+    QFuture<void> m_readAheadFuture;
+    QAtomicInt m_stopRequested;
+};
@@ -66,6 +66,12 @@ int ModalTrackBatchProcessor::processTracks(
                     << "track(s)";
             return finishedTrackCount;
         case ProcessNextTrackResult::ContinueProcessing:
+            // Queue a write-behind save instead of relying on the eviction
+            // of the track from the cache, which would issue a synchronous
+            // save per track as soon as the iterator releases the pointer.
+            // Tracks left unmodified by the operation are skipped when the
+            // queue is flushed.
+            pTrackCollectionManager->saveTrackLater(pTrack);
             break;
         case ProcessNextTrackResult::SaveTrackAndContinueProcessing:
             pTrackCollectionManager->saveTrack(pTrack);
@@ -408,6 +408,11 @@ void SetlogFeature::slotPlayingTrackChanged(TrackPointer currentPlayingTrack) {
             m_pPlaylistTableModel->appendTrack(currentPlayingTrackId);
             view->setSelectedTracks(trackIds);
         } else {
+            // The history view is hidden, e.g. while AutoDJ plays through
+            // the night. Defer the model refresh until the view is shown
+            // again instead of re-selecting the whole history playlist
+            // for every played track.
+            m_pPlaylistTableModel->setDeferredRefresh(true);
             m_pPlaylistTableModel->appendTrack(currentPlayingTrackId);
         }
     } else {
@@ -10,6 +10,7 @@
 #include "errordialoghandler.h"
 #include "mixxx.h"
 #include "mixxxapplication.h"
+#include "soundio/soundmanager.h"
 #include "sources/soundsourceproxy.h"
 #include "util/cmdlineargs.h"
 #include "util/console.h"
@@ -26,7 +27,37 @@ namespace {
 constexpr int kFatalErrorOnStartupExitCode = 1;
 constexpr int kParseCmdlineArgsErrorExitCode = 2;
 
+int runMixxxHeadless(MixxxApplication* app, const CmdlineArgs& args) {
+    // Run the audio engine, library and controllers without instantiating
+    // any widget UI. Skins, waveforms and all other rendering are never
+    // initialized in this mode; the application is controlled through
+    // controllers and the ControlObject layer (e.g. AutoDJ) and terminated
+    // with SIGTERM/SIGINT.
+    auto coreServices = std::make_shared<mixxx::CoreServices>(args);
+    coreServices->initializeSettings();
+    coreServices->initialize(app);
+
+    SoundDeviceError result = coreServices->getSoundManager()->setupDevices();
+    if (result != SOUNDDEVICE_ERROR_OK) {
+        qCritical() << "Failed to open the configured sound devices:" << result;
+        coreServices->shutdown();
+        return kFatalErrorOnStartupExitCode;
+    }
+    if (ErrorDialogHandler::instance()->checkError()) {
+        coreServices->shutdown();
+        return kFatalErrorOnStartupExitCode;
+    }
+
+    qDebug() << "Running Mixxx in headless mode";
+    const int exitCode = app->exec();
+    coreServices->shutdown();
+    return exitCode;
+}
+
 int runMixxx(MixxxApplication* app, const CmdlineArgs& args) {
+    if (args.getHeadless()) {
+        return runMixxxHeadless(app, args);
+    }
     auto coreServices = std::make_shared<mixxx::CoreServices>(args);
     MixxxMainWindow mainWindow(app, coreServices);
     // If startup produced a fatal error, then don't even start the
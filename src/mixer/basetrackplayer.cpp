@@ -91,6 +91,11 @@ BaseTrackPlayerImpl::BaseTrackPlayerImpl(
     m_pDuration = std::make_unique<ControlObject>(
         ConfigKey(getGroup(), "duration"));
 
+    // Time from the track load request until the engine can play the track,
+    // for monitoring load performance e.g. on network storage.
+    m_pTrackLoadLatencyMs = std::make_unique<ControlObject>(
+            ConfigKey(getGroup(), "track_load_latency_ms"));
+
     // Track color of the current track
     m_pTrackColor = std::make_unique<ControlObject>(
             ConfigKey(getGroup(), "track_color"));
@@ -389,12 +394,19 @@ void BaseTrackPlayerImpl::slotLoadTrack(TrackPointer pNewTrack, bool bPlay) {
 
     auto pOldTrack = unloadTrack();
 
-    loadTrack(pNewTrack);
+    m_loadLatencyTimer.start();
 
-    // Request a new track from EngineBuffer
+    // Request the new track from EngineBuffer first. This only wakes the
+    // CachingReaderWorker, which then opens the decoder and reads the first
+    // chunks on its own thread while this thread performs the remaining
+    // bookkeeping and fans out loadingTrack() to waveforms and the library.
+    // The resulting trackLoaded()/trackLoadFailed() signals are queued and
+    // cannot arrive before this function has returned.
     EngineBuffer* pEngineBuffer = m_pChannel->getEngineBuffer();
     pEngineBuffer->loadTrack(pNewTrack, bPlay);
 
+    loadTrack(pNewTrack);
+
     // await slotTrackLoaded()/slotLoadFailed()
     emit loadingTrack(pNewTrack, pOldTrack);
 }
@@ -440,6 +452,11 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         m_pLoadedTrack.reset();
         emit playerEmpty();
     } else if (pNewTrack && pNewTrack == m_pLoadedTrack) {
+        // The engine can play the track from now on; everything below and
+        // all other consumers of newTrackLoaded() (waveforms, cover art,
+        // key display) stream in behind the audible start.
+        m_pTrackLoadLatencyMs->set(m_loadLatencyTimer.elapsed().toDoubleMillis());
+
         // NOTE(uklotzde): In a previous version track metadata was reloaded
         // from the source file at this point again. This is no longer necessary
         // since track objects will always be created in a controlled manner
@@ -13,6 +13,7 @@
 #include "util/color/rgbcolor.h"
 #include "util/memory.h"
 #include "util/parented_ptr.h"
+#include "util/performancetimer.h"
 
 class EngineMaster;
 class ControlObject;
@@ -131,6 +132,11 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
     parented_ptr<ControlProxy> m_pLoopOutPoint;
     std::unique_ptr<ControlObject> m_pDuration;
 
+    // Duration between requesting a track load and the engine reporting
+    // the track as playable, in milliseconds.
+    std::unique_ptr<ControlObject> m_pTrackLoadLatencyMs;
+    PerformanceTimer m_loadLatencyTimer;
+
     // TODO() these COs are reconnected during runtime
     // This may lock the engine
     std::unique_ptr<ControlObject> m_pFileBPM;
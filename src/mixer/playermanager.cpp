@@ -734,8 +734,13 @@ void PlayerManager::slotAnalyzeTrack(TrackPointer track) {
     }
 }
 
-void PlayerManager::onTrackAnalysisProgress(TrackId trackId, AnalyzerProgress analyzerProgress) {
-    emit trackAnalyzerProgress(trackId, analyzerProgress);
+void PlayerManager::onTrackAnalysisProgress(
+        const QHash<TrackId, AnalyzerProgress>& trackProgresses) {
+    for (auto it = trackProgresses.constBegin();
+            it != trackProgresses.constEnd();
+            ++it) {
+        emit trackAnalyzerProgress(it.key(), it.value());
+    }
 }
 
 void PlayerManager::onTrackAnalysisFinished() {
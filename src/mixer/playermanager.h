@@ -204,7 +204,8 @@ class PlayerManager : public QObject, public PlayerManagerInterface {
   private slots:
     void slotAnalyzeTrack(TrackPointer track);
 
-    void onTrackAnalysisProgress(TrackId trackId, AnalyzerProgress analyzerProgress);
+    void onTrackAnalysisProgress(
+            const QHash<TrackId, AnalyzerProgress>& trackProgresses);
     void onTrackAnalysisFinished();
 
   signals:
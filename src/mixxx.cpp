@@ -1028,6 +1028,16 @@ void MixxxMainWindow::setToolTipsCfg(mixxx::TooltipsPreference tt) {
 void MixxxMainWindow::rebootMixxxView() {
     qDebug() << "Now in rebootMixxxView...";
 
+    // Preference pages and skin development workflows trigger reboots where
+    // the effective skin did not change at all. Rebuilding the widget tree
+    // then takes seconds, drops the waveform GL contexts and floods the
+    // control system with teardown/setup traffic for no visible difference,
+    // so keep the live widget tree when the skin fingerprint still matches.
+    if (m_pCentralWidget && m_pSkinLoader->skinUnchangedSinceLoad()) {
+        qDebug() << "rebootMixxxView - configured skin unchanged, keeping the live widget tree";
+        return;
+    }
+
     // safe geometry for later restoration
     const QRect initGeometry = geometry();
 
@@ -5,10 +5,12 @@
 #include <QtDebug>
 #include <vector>
 
+#include "analyzer/constants.h"
 #include "moc_chromaprinter.cpp"
 #include "sources/audiosourcestereoproxy.h"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
+#include "util/math.h"
 #include "util/performancetimer.h"
 #include "util/sample.h"
 
@@ -34,32 +36,8 @@ const SINT kFingerprintDuration = 120; // in seconds
 QString calcFingerprint(
         mixxx::AudioSourceStereoProxy& audioSourceProxy,
         mixxx::IndexRange fingerprintRange) {
-    PerformanceTimer timerReadingFile;
-    timerReadingFile.start();
-
-    mixxx::SampleBuffer sampleBuffer(math_max(
-            fingerprintRange.length(),
-            audioSourceProxy.getSignalInfo().frames2samples(fingerprintRange.length())));
-    const auto readableSampleFrames =
-            audioSourceProxy.readSampleFrames(
-                    mixxx::WritableSampleFrames(
-                            fingerprintRange,
-                            mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
-    if (fingerprintRange != readableSampleFrames.frameIndexRange()) {
-        qWarning() << "Failed to read sample data for fingerprint";
-        return QString();
-    }
-
-    std::vector<SAMPLE> fingerprintSamples(
-            audioSourceProxy.getSignalInfo().frames2samples(
-                    readableSampleFrames.frameLength()));
-    // Convert floating-point to integer
-    SampleUtil::convertFloat32ToS16(
-            &fingerprintSamples[0],
-            sampleBuffer.data(),
-            fingerprintSamples.size());
-
-    qDebug() << "reading file took" << timerReadingFile.elapsed().debugMillisWithUnit();
+    PerformanceTimer timerFingerprinting;
+    timerFingerprinting.start();
 
     ChromaprintContext* ctx = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
     chromaprint_start(
@@ -67,15 +45,52 @@ QString calcFingerprint(
             audioSourceProxy.getSignalInfo().getSampleRate(),
             audioSourceProxy.getSignalInfo().getChannelCount());
 
-    PerformanceTimer timerGeneratingFingerprint;
-    timerGeneratingFingerprint.start();
-    const int success = chromaprint_feed(
-            ctx,
-            &fingerprintSamples[0],
-            static_cast<int>(fingerprintSamples.size()));
+    // Instead of materializing the whole two minutes of audio up front
+    // (> 60 MiB for a 44.1 kHz stereo track) the samples are decoded and
+    // fed into chromaprint in analyzer-sized chunks. This keeps the
+    // memory footprint small and independent of the fingerprint duration
+    // and lets the fingerprint computation overlap with decoding.
+    mixxx::SampleBuffer sampleBuffer(mixxx::kAnalysisSamplesPerChunk);
+    std::vector<SAMPLE> fingerprintSamples(mixxx::kAnalysisSamplesPerChunk);
+
+    bool success = true;
+    mixxx::IndexRange remainingFrameRange = fingerprintRange;
+    while (!remainingFrameRange.empty()) {
+        // Split the range for the next chunk from the remaining frames
+        const auto chunkFrameRange =
+                remainingFrameRange.splitAndShrinkFront(
+                        math_min(mixxx::kAnalysisFramesPerChunk,
+                                remainingFrameRange.length()));
+        DEBUG_ASSERT(!chunkFrameRange.empty());
+        const auto readableSampleFrames =
+                audioSourceProxy.readSampleFrames(
+                        mixxx::WritableSampleFrames(
+                                chunkFrameRange,
+                                mixxx::SampleBuffer::WritableSlice(sampleBuffer)));
+        if (readableSampleFrames.frameIndexRange() != chunkFrameRange) {
+            qWarning() << "Failed to read sample data for fingerprint";
+            success = false;
+            break;
+        }
+        const SINT chunkSamples =
+                audioSourceProxy.getSignalInfo().frames2samples(
+                        readableSampleFrames.frameLength());
+        // Convert floating-point to integer
+        SampleUtil::convertFloat32ToS16(
+                fingerprintSamples.data(),
+                readableSampleFrames.readableData(),
+                chunkSamples);
+        if (!chromaprint_feed(
+                    ctx,
+                    fingerprintSamples.data(),
+                    static_cast<int>(chunkSamples))) {
+            qWarning() << "Failed to generate fingerprint from sample data";
+            success = false;
+            break;
+        }
+    }
     chromaprint_finish(ctx);
     if (!success) {
-        qWarning() << "Failed to generate fingerprint from sample data";
         chromaprint_free(ctx);
         return QString();
     }
@@ -99,8 +114,8 @@ QString calcFingerprint(
     }
     chromaprint_free(ctx);
 
-    qDebug() << "generating fingerprint took"
-             << timerGeneratingFingerprint.elapsed().debugMillisWithUnit();
+    qDebug() << "fingerprinting (decoding + analysis) took"
+             << timerFingerprinting.elapsed().debugMillisWithUnit();
 
     return fingerprint;
 }
@@ -128,9 +143,11 @@ QString ChromaPrinter::getFingerprint(TrackPointer pTrack) {
             mixxx::IndexRange::forward(
                     pAudioSource->frameIndexMin(),
                     kFingerprintDuration * pAudioSource->getSignalInfo().getSampleRate()));
+    // The proxy only needs to buffer a single decode chunk at a time,
+    // see calcFingerprint().
     mixxx::AudioSourceStereoProxy audioSourceProxy(
             pAudioSource,
-            fingerprintRange.length());
+            mixxx::kAnalysisFramesPerChunk);
 
     return calcFingerprint(audioSourceProxy, fingerprintRange);
 }
@@ -106,7 +106,8 @@ ConfigValueKbd::ConfigValueKbd(const QKeySequence& keys)
 }
 
 template <class ValueType> ConfigObject<ValueType>::ConfigObject(const QString& file)
-        : m_resourcePath(computeResourcePath()),
+        : m_pValues(std::make_shared<ValueMap>()),
+          m_resourcePath(computeResourcePath()),
           m_settingsPath(computeSettingsPath(file)) {
     reopen(file);
 }
@@ -116,26 +117,29 @@ template <class ValueType> ConfigObject<ValueType>::~ConfigObject() {
 
 template <class ValueType>
 void ConfigObject<ValueType>::set(const ConfigKey& k, const ValueType& v) {
-    QWriteLocker lock(&m_valuesLock);
-    m_values.insert(k, v);
+    const QMutexLocker lock(&m_writeMutex);
+    auto pValues = std::make_shared<ValueMap>(*loadValues());
+    pValues->insert(k, v);
+    storeValues(std::move(pValues));
 }
 
 template <class ValueType>
 ValueType ConfigObject<ValueType>::get(const ConfigKey& k) const {
-    QReadLocker lock(&m_valuesLock);
-    return m_values.value(k);
+    return loadValues()->value(k);
 }
 
 template <class ValueType>
 bool ConfigObject<ValueType>::exists(const ConfigKey& k) const {
-    QReadLocker lock(&m_valuesLock);
-    return m_values.contains(k);
+    return loadValues()->contains(k);
 }
 
 template <class ValueType>
 bool ConfigObject<ValueType>::remove(const ConfigKey& k) {
-    QWriteLocker lock(&m_valuesLock);
-    return m_values.remove(k) > 0;
+    const QMutexLocker lock(&m_writeMutex);
+    auto pValues = std::make_shared<ValueMap>(*loadValues());
+    const bool removed = pValues->remove(k) > 0;
+    storeValues(std::move(pValues));
+    return removed;
 }
 
 template <class ValueType>
@@ -152,7 +156,10 @@ template <class ValueType> bool ConfigObject<ValueType>::parse() {
         return false;
     } else {
         //qDebug() << "ConfigObject: Parse" << m_filename;
-        // Parse the file
+        // Parse the file into a single new snapshot. Publishing every
+        // entry through set() would copy the whole map per line.
+        const QMutexLocker lock(&m_writeMutex);
+        auto pValues = std::make_shared<ValueMap>(*loadValues());
         int group = 0;
         QString groupStr, line;
         QTextStream text(&configfile);
@@ -173,10 +180,11 @@ template <class ValueType> bool ConfigObject<ValueType>::parse() {
                     //qDebug() << "control:" << key << "value:" << val;
                     ConfigKey k(groupStr, key);
                     ValueType m(val);
-                    set(k, m);
+                    pValues->insert(k, m);
                 }
             }
         }
+        storeValues(std::move(pValues));
         configfile.close();
     }
     return true;
@@ -193,7 +201,10 @@ template <class ValueType> void ConfigObject<ValueType>::reopen(const QString& f
 /// Returns true on success
 template<class ValueType>
 bool ConfigObject<ValueType>::save() {
-    QReadLocker lock(&m_valuesLock); // we only read the m_values here.
+    // Serialize the current snapshot. The file I/O below runs without
+    // any lock, so concurrent reads and writes are never stalled by a
+    // save in progress; they simply publish newer snapshots.
+    const std::shared_ptr<const ValueMap> pValues = loadValues();
     QFile tmpFile(m_filename + kTempFilenameExtension);
     if (!QDir(QFileInfo(tmpFile).absolutePath()).exists()) {
         QDir().mkpath(QFileInfo(tmpFile).absolutePath());
@@ -211,7 +222,7 @@ bool ConfigObject<ValueType>::save() {
     // the stream.pos alone will yield wrong warnings. We therefore estimate
     // a minimum length as an additional safety check.
     qint64 minLength = 0;
-    for (auto i = m_values.constBegin(); i != m_values.constEnd(); ++i) {
+    for (auto i = pValues->constBegin(); i != pValues->constEnd(); ++i) {
         //qDebug() << "group:" << it.key().group << "item" << it.key().item << "val" << it.value()->value;
         if (i.key().group != group) {
             group = i.key().group;
@@ -258,27 +269,29 @@ bool ConfigObject<ValueType>::save() {
 
 template<class ValueType>
 QSet<QString> ConfigObject<ValueType>::getGroups() {
-    QWriteLocker lock(&m_valuesLock);
+    const std::shared_ptr<const ValueMap> pValues = loadValues();
     QSet<QString> groups;
-    for (const ConfigKey& key : m_values.keys()) {
-        groups.insert(key.group);
+    for (auto it = pValues->constBegin(); it != pValues->constEnd(); ++it) {
+        groups.insert(it.key().group);
     }
     return groups;
 }
 
 template<class ValueType>
 QList<ConfigKey> ConfigObject<ValueType>::getKeysWithGroup(const QString& group) const {
-    QWriteLocker lock(&m_valuesLock);
+    const std::shared_ptr<const ValueMap> pValues = loadValues();
     QList<ConfigKey> filteredList;
-    for (const ConfigKey& key : m_values.keys()) {
-        if (key.group == group) {
-            filteredList.append(key);
+    for (auto it = pValues->constBegin(); it != pValues->constEnd(); ++it) {
+        if (it.key().group == group) {
+            filteredList.append(it.key());
         }
     }
     return filteredList;
 }
 
-template <class ValueType> ConfigObject<ValueType>::ConfigObject(const QDomNode& node) {
+template <class ValueType>
+ConfigObject<ValueType>::ConfigObject(const QDomNode& node)
+        : m_pValues(std::make_shared<ValueMap>()) {
     if (!node.isNull() && node.isElement()) {
         QDomNode ctrl = node.firstChild();
 
@@ -297,10 +310,9 @@ template <class ValueType> ConfigObject<ValueType>::ConfigObject(const QDomNode&
 
 template <class ValueType>
 QMultiHash<ValueType, ConfigKey> ConfigObject<ValueType>::transpose() const {
-    QReadLocker lock(&m_valuesLock);
-
+    const std::shared_ptr<const ValueMap> pValues = loadValues();
     QMultiHash<ValueType, ConfigKey> transposedHash;
-    for (auto it = m_values.constBegin(); it != m_values.constEnd(); ++it) {
+    for (auto it = pValues->constBegin(); it != pValues->constEnd(); ++it) {
         transposedHash.insert(it.value(), it.key());
     }
     return transposedHash;
@@ -6,7 +6,9 @@
 #include <QMap>
 #include <QHash>
 #include <QMetaType>
-#include <QReadWriteLock>
+#include <QMutex>
+
+#include <memory>
 
 #include "util/assert.h"
 #include "util/debug.h"
@@ -192,8 +194,25 @@ template <class ValueType> class ConfigObject {
 
   protected:
     // We use QMap because we want a sorted list in mixxx.cfg
-    QMap<ConfigKey, ValueType> m_values;
-    mutable QReadWriteLock m_valuesLock;
+    typedef QMap<ConfigKey, ValueType> ValueMap;
+
+    // The values are published as an immutable snapshot. Readers load
+    // the current snapshot with a single atomic operation and read it
+    // without taking a lock, so hot-path getValue() calls never contend
+    // with writers or with save(). Writers copy the current snapshot,
+    // apply their change and publish the result under m_writeMutex.
+    std::shared_ptr<const ValueMap> loadValues() const {
+        return std::atomic_load_explicit(&m_pValues, std::memory_order_acquire);
+    }
+    void storeValues(std::shared_ptr<const ValueMap> pValues) {
+        std::atomic_store_explicit(&m_pValues,
+                std::move(pValues),
+                std::memory_order_release);
+    }
+
+    std::shared_ptr<const ValueMap> m_pValues;
+    // Serializes writers; readers never take it.
+    mutable QMutex m_writeMutex;
     QString m_filename;
     const QString m_resourcePath;
     const QString m_settingsPath;
@@ -214,6 +214,8 @@ void DlgPrefLibrary::slotUpdate() {
             ConfigKey("[Library]","ShowRekordboxLibrary"), true));
     checkBox_show_serato->setChecked(m_pConfig->getValue(
             ConfigKey("[Library]", "ShowSeratoLibrary"), true));
+    checkBox_pin_analysis_threads->setChecked(m_pConfig->getValue(
+            ConfigKey("[Library]", "PinAnalysisThreads"), false));
 
     switch (m_pConfig->getValue<int>(
             ConfigKey("[Library]", "TrackLoadAction"),
@@ -381,6 +383,8 @@ void DlgPrefLibrary::slotApply() {
                 ConfigValue((int)checkBox_show_rekordbox->isChecked()));
     m_pConfig->set(ConfigKey("[Library]", "ShowSeratoLibrary"),
             ConfigValue((int)checkBox_show_serato->isChecked()));
+    m_pConfig->set(ConfigKey("[Library]", "PinAnalysisThreads"),
+            ConfigValue((int)checkBox_pin_analysis_threads->isChecked()));
     int dbclick_status;
     if (radioButton_dbclick_bottom->isChecked()) {
         dbclick_status = static_cast<int>(TrackDoubleClickAction::AddToAutoDJBottom);
@@ -643,6 +643,13 @@ void DlgPrefSound::refreshDevices() {
     }
     emit refreshOutputDevices(m_outputDevices);
     emit refreshInputDevices(m_inputDevices);
+
+    if (!queryButton->isEnabled()) {
+        // An asynchronous device requery started by queryClicked() has
+        // finished.
+        updateAPIs();
+        queryButton->setEnabled(true);
+    }
 }
 
 /**
@@ -669,9 +676,14 @@ void DlgPrefSound::deviceSettingChanged() {
  * Slot called when the "Query Devices" button is clicked.
  */
 void DlgPrefSound::queryClicked() {
-    ScopedWaitCursor cursor;
-    m_pSoundManager->clearAndQueryDevices();
-    updateAPIs();
+    if (m_pSoundManager->isDeviceQueryInProgress()) {
+        return;
+    }
+    // The driver probing runs on a worker thread; refreshDevices() is
+    // invoked via SoundManager::devicesUpdated() once the new device
+    // list is available and re-enables the button.
+    queryButton->setEnabled(false);
+    m_pSoundManager->clearAndQueryDevicesAsync();
 }
 
 /**
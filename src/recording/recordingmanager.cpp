@@ -17,8 +17,16 @@
 
 #define MIN_DISK_FREE 1024 * 1024 * 1024ll // one gibibyte
 
+namespace {
+// Pre-open the next split segment this far ahead of the size or time
+// cap, so its encoder is warmed up by the time the cut happens.
+constexpr quint64 kSplitPrepareAheadBytes = 8 * 1024 * 1024;
+constexpr unsigned int kSplitPrepareAheadSeconds = 10;
+} // anonymous namespace
+
 RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMaster* pEngine)
         : m_pConfig(pConfig),
+          m_pEngineRecord(nullptr),
           m_recordingDir(""),
           m_recording_base_file(""),
           m_recordingFile(""),
@@ -58,7 +66,8 @@ RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMaster* pE
                 &EngineRecord::durationRecorded,
                 this,
                 &RecordingManager::slotDurationRecorded);
-        pSidechain->addSideChainWorker(pEngineRecord);
+        pSidechain->addSideChainWorker(pEngineRecord, QStringLiteral("EngineRecord"));
+        m_pEngineRecord = pEngineRecord;
     }
 }
 
@@ -129,6 +138,7 @@ void RecordingManager::startRecording() {
     }
 
     m_iNumberSplits = 1;
+    m_nextSegmentLocation = QString();
     // Append file extension.
     QString date_time_str = formatDateTimeForFilename(QDateTime::currentDateTime());
     m_recordingFile = QString("%1.%2")
@@ -145,21 +155,42 @@ void RecordingManager::startRecording() {
     m_recReady->set(RECORD_READY);
 }
 
+QString RecordingManager::nextSplitLocation()
+{
+    QString encodingType = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Encoding"));
+    QString fileExtension = EncoderFactory::getFactory()
+                                    .getFormatFor(encodingType)
+                                    .fileExtension;
+
+    QString new_base_filename = m_recording_base_file + QStringLiteral("part") + QString::number(m_iNumberSplits + 1);
+    return new_base_filename + QChar('.') + fileExtension;
+}
+
+void RecordingManager::prepareNextSplitSegment()
+{
+    if (!m_pEngineRecord || !m_nextSegmentLocation.isEmpty()) {
+        return;
+    }
+    // The segment is opened and its encoder warmed up on this (the GUI)
+    // thread, so the cut itself is a gapless handoff on the sidechain
+    // thread. splitContinueRecording() below derives the same location.
+    m_nextSegmentLocation = nextSplitLocation();
+    m_pEngineRecord->prepareNextSegment(m_nextSegmentLocation);
+}
+
 void RecordingManager::splitContinueRecording()
 {
+    // Must match what prepareNextSplitSegment() may have pre-opened, so
+    // the location is derived before the split counter moves on.
+    m_recordingLocation = nextSplitLocation();
     ++m_iNumberSplits;
     m_secondsRecorded+=m_secondsRecordedSplit;
 
     m_iNumberOfBytesRecordedSplit = 0;
     m_secondsRecordedSplit=0;
 
-    QString encodingType = m_pConfig->getValueString(ConfigKey(RECORDING_PREF_KEY, "Encoding"));
-    QString fileExtension = EncoderFactory::getFactory()
-                                    .getFormatFor(encodingType)
-                                    .fileExtension;
-
-    QString new_base_filename = m_recording_base_file + QStringLiteral("part") + QString::number(m_iNumberSplits);
-    m_recordingLocation = new_base_filename + QChar('.') + fileExtension;
+    QString new_base_filename = m_recordingLocation.left(m_recordingLocation.lastIndexOf(QChar('.')));
+    m_nextSegmentLocation = QString();
 
     m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "Path"), m_recordingLocation);
     m_pConfig->set(ConfigKey(RECORDING_PREF_KEY, "CuePath"), ConfigValue(new_base_filename + QStringLiteral(".cue")));
@@ -174,6 +205,7 @@ void RecordingManager::stopRecording()
     m_recReady->set(RECORD_OFF);
     m_recordingFile = "";
     m_recordingLocation = "";
+    m_nextSegmentLocation = QString();
     m_iNumberOfBytesRecorded = 0;
     m_secondsRecorded = 0;
 }
@@ -212,6 +244,11 @@ void RecordingManager::slotDurationRecorded(quint64 duration)
             // This will reuse the previous filename but append a suffix.
             splitContinueRecording();
         }
+        else if (m_split_time < INT_MAX &&
+                duration + kSplitPrepareAheadSeconds >= m_split_time)
+        {
+            prepareNextSplitSegment();
+        }
         emit durationRecorded(getRecordedDurationStr(m_secondsRecorded+m_secondsRecordedSplit));
     }
 }
@@ -238,6 +275,10 @@ void RecordingManager::slotBytesRecorded(int bytes)
         // This will reuse the previous filename but append a suffix.
         splitContinueRecording();
     }
+    else if (m_iNumberOfBytesRecordedSplit + kSplitPrepareAheadBytes >= m_split_size)
+    {
+        prepareNextSplitSegment();
+    }
     emit bytesRecorded(m_iNumberOfBytesRecorded);
 
     // check for free space
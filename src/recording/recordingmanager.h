@@ -11,6 +11,7 @@
 #include "recording/defs_recording.h"
 
 class EngineMaster;
+class EngineRecord;
 class ControlPushButton;
 class ControlProxy;
 
@@ -59,6 +60,12 @@ class RecordingManager : public QObject {
     // to split the file. The nth filename will follow the date/time
     // name of the first split but with a suffix.
     void splitContinueRecording();
+    // The location the next split will record into.
+    QString nextSplitLocation();
+    // Asks EngineRecord to pre-open the next split segment once, shortly
+    // before the size or time cap is reached, so the cut itself happens
+    // without a gap.
+    void prepareNextSplitSegment();
     void warnFreespace();
     ControlProxy* m_recReady;
     ControlObject* m_recReadyCO;
@@ -69,6 +76,8 @@ class RecordingManager : public QObject {
     qint64 getFreeSpace();
 
     UserSettingsPointer m_pConfig;
+    // Owned by the engine sidechain; only used while recording is active.
+    EngineRecord* m_pEngineRecord;
     QString m_recordingDir;
     // the base file
     QString m_recording_base_file;
@@ -76,6 +85,9 @@ class RecordingManager : public QObject {
     QString m_recordingFile;
     // Absolute file
     QString m_recordingLocation;
+    // Absolute location of the pre-opened next split segment, empty if
+    // none has been prepared for the current segment.
+    QString m_nextSegmentLocation;
 
     bool m_bRecording;
     bool m_dfSilence;
@@ -1,9 +1,13 @@
 #include "skin/legacyskinparser.h"
 
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QGridLayout>
+#include <QHash>
 #include <QLabel>
 #include <QMutexLocker>
+#include <QSet>
 #include <QSplitter>
 #include <QStackedWidget>
 #include <QVBoxLayout>
@@ -91,6 +95,73 @@ QSet<QString> LegacySkinParser::s_sharedGroupStrings;
 
 static bool sDebug = false;
 
+namespace {
+
+// Parsed skin templates shared across skin loads. Skin changes and the
+// developer "reload skin" shortcut construct a new parser and would
+// otherwise re-read and re-parse every template file from disk again.
+// Entries are validated against the file metadata, so edited templates
+// are still picked up on the next reload. Only accessed from the GUI
+// thread that parses skins.
+struct TemplateCacheEntry {
+    QDomElement root;
+    QDateTime lastModified;
+    qint64 fileSize;
+};
+QHash<QString, TemplateCacheEntry> s_templateCache;
+
+// Collects the image files referenced by text nodes of the skin
+// document so they can be preloaded while the widget tree is built.
+// This is a best effort scan: references assembled from skin variables
+// at parse time are simply not found here and get decoded on demand as
+// before.
+QStringList collectSkinImagePaths(
+        const QDomElement& rootElement, const QDir& skinDir) {
+    QStringList imagePaths;
+    QSet<QString> seenPaths;
+    QList<QDomNode> pendingNodes;
+    pendingNodes.append(rootElement);
+    while (!pendingNodes.isEmpty()) {
+        QDomNode node = pendingNodes.takeLast();
+        for (QDomNode child = node.firstChild(); !child.isNull();
+                child = child.nextSibling()) {
+            if (child.isElement()) {
+                pendingNodes.append(child);
+                continue;
+            }
+            if (!child.isText()) {
+                continue;
+            }
+            const QString text = child.nodeValue().trimmed();
+            if (!text.endsWith(QStringLiteral(".png"), Qt::CaseInsensitive) &&
+                    !text.endsWith(QStringLiteral(".svg"), Qt::CaseInsensitive) &&
+                    !text.endsWith(QStringLiteral(".jpg"), Qt::CaseInsensitive) &&
+                    !text.endsWith(QStringLiteral(".gif"), Qt::CaseInsensitive) &&
+                    !text.endsWith(QStringLiteral(".bmp"), Qt::CaseInsensitive)) {
+                continue;
+            }
+            // Emit the same path form that SkinContext::makeSkinPath
+            // hands to the widgets, so the preload cache keys match.
+            const bool absolute =
+                    text.startsWith(QLatin1Char('/')) || text.contains(QLatin1Char(':'));
+            const QFileInfo fileInfo(absolute ? text : skinDir.filePath(text));
+            if (!fileInfo.isFile()) {
+                continue;
+            }
+            const QString loadPath =
+                    absolute ? text : QStringLiteral("skin:") + text;
+            if (seenPaths.contains(loadPath)) {
+                continue;
+            }
+            seenPaths.insert(loadPath);
+            imagePaths.append(loadPath);
+        }
+    }
+    return imagePaths;
+}
+
+} // anonymous namespace
+
 ControlObject* LegacySkinParser::controlFromConfigKey(
         const ConfigKey& key, bool bPersist, bool* pCreated) {
     if (!key.isValid()) {
@@ -390,6 +461,16 @@ QWidget* LegacySkinParser::parseSkin(const QString& skinPath, QWidget* pParent)
 
     ColorSchemeParser::setupLegacyColorSchemes(skinDocument, m_pConfig, &m_style, m_pContext.get());
 
+    // Kick off decoding of the image files referenced by the skin on the
+    // global thread pool. The decodes overlap with the widget creation
+    // below, which picks the decoded images up from the shared cache in
+    // WPixmapStore instead of decoding each file per widget request.
+    // This has to happen after the color scheme setup above, which swaps
+    // the image loader and would discard an earlier preload.
+    WPixmapStore::preloadImages(
+            collectSkinImagePaths(skinDocument, QDir(skinPath)),
+            m_pContext->getScaleFactor());
+
     // don't parent till here so the first opengl waveform doesn't screw
     // up --bkgood
     // I'm disregarding this return value because I want to return the
@@ -398,6 +479,10 @@ QWidget* LegacySkinParser::parseSkin(const QString& skinPath, QWidget* pParent)
     m_pParent = pParent;
     QList<QWidget*> widgets = parseNode(skinDocument);
 
+    // All widgets have been constructed; drop the decoded image cache to
+    // free the memory held by the preloaded variants.
+    WPixmapStore::endPreload();
+
     if (widgets.empty()) {
         SKIN_WARNING(skinDocument, *m_pContext) << "Skin produced no widgets!";
         return nullptr;
@@ -1510,9 +1595,19 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
 
     QString absolutePath = templateFileInfo.absoluteFilePath();
 
-    auto it = m_templateCache.constFind(absolutePath);
-    if (it != m_templateCache.constEnd()) {
-        return it.value();
+    auto it = s_templateCache.constFind(absolutePath);
+    if (it != s_templateCache.constEnd() &&
+            it->lastModified == templateFileInfo.lastModified() &&
+            it->fileSize == templateFileInfo.size()) {
+        // The template search path is only updated when a template file
+        // is visited for the first time during this parse, matching the
+        // behavior of the previous per-parser cache.
+        if (!m_visitedTemplatePaths.contains(absolutePath)) {
+            m_visitedTemplatePaths.insert(absolutePath);
+            m_pContext->setSkinTemplatePath(
+                    templateFileInfo.absoluteDir().absolutePath());
+        }
+        return it->root;
     }
 
     QFile templateFile(absolutePath);
@@ -1534,7 +1629,12 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
         return QDomElement();
     }
 
-    m_templateCache[absolutePath] = tmpl.documentElement();
+    s_templateCache.insert(absolutePath,
+            TemplateCacheEntry{
+                    tmpl.documentElement(),
+                    templateFileInfo.lastModified(),
+                    templateFileInfo.size()});
+    m_visitedTemplatePaths.insert(absolutePath);
     m_pContext->setSkinTemplatePath(templateFileInfo.absoluteDir().absolutePath());
     return tmpl.documentElement();
 }
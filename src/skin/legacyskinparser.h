@@ -158,6 +158,8 @@ class LegacySkinParser : public QObject, public SkinParser {
     std::unique_ptr<SkinContext> m_pContext;
     QString m_style;
     Tooltips m_tooltips;
-    QHash<QString, QDomElement> m_templateCache;
+    // Template files visited during this parse. The parsed templates
+    // themselves are cached across skin loads in the translation unit.
+    QSet<QString> m_visitedTemplatePaths;
     static QSet<QString> s_sharedGroupStrings;
 };
@@ -1,8 +1,12 @@
 #include "skin/skinloader.h"
 
 #include <QApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
 #include <QString>
+#include <QTextStream>
 #include <QtDebug>
 
 #include "vinylcontrol/vinylcontrolmanager.h"
@@ -128,7 +132,47 @@ QWidget* SkinLoader::loadConfiguredSkin(QWidget* pParent,
             pVCMan,
             pEffectsManager,
             pRecordingManager);
-    return legacy.parseSkin(skinPath, pParent);
+    QWidget* pSkinWidget = legacy.parseSkin(skinPath, pParent);
+    m_lastLoadedSkinFingerprint =
+            pSkinWidget ? getSkinFingerprint() : QString();
+    return pSkinWidget;
+}
+
+bool SkinLoader::skinUnchangedSinceLoad() const {
+    return !m_lastLoadedSkinFingerprint.isEmpty() &&
+            m_lastLoadedSkinFingerprint == getSkinFingerprint();
+}
+
+QString SkinLoader::getSkinFingerprint() const {
+    const QString skinPath = getConfiguredSkinPath();
+    if (skinPath.isEmpty()) {
+        return QString();
+    }
+
+    QString fingerprint;
+    QTextStream stream(&fingerprint);
+    stream << skinPath << '\n';
+    // Configuration values the parser consults while building widgets; a
+    // change to any of them produces a different widget tree from the same
+    // skin files.
+    stream << m_pConfig->getValueString(ConfigKey("[Config]", "Scheme")) << '\n';
+    stream << m_pConfig->getValueString(
+                      ConfigKey("[Waveform]", "WaveformOverviewType"))
+           << '\n';
+
+    // Sizes and modification times stand in for the file contents; hashing
+    // every template of a large skin on each reboot would cost more than
+    // the check saves.
+    QDirIterator it(skinPath,
+            QDir::Files | QDir::NoDotAndDotDot,
+            QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        const QFileInfo fileInfo = it.fileInfo();
+        stream << fileInfo.filePath() << ':' << fileInfo.size() << ':'
+               << fileInfo.lastModified().toMSecsSinceEpoch() << '\n';
+    }
+    return fingerprint;
 }
 
 LaunchImage* SkinLoader::loadLaunchImage(QWidget* pParent) {
@@ -40,8 +40,21 @@ class SkinLoader {
     QString getDefaultSkinName() const;
     QList<QDir> getSkinSearchPaths() const;
 
+    // Returns true if reloading the configured skin would rebuild the same
+    // widget tree that the last loadConfiguredSkin() call produced: same
+    // skin directory with unmodified files and unchanged skin-affecting
+    // configuration. Used to skip the expensive teardown/rebuild on reboots
+    // where nothing effectively changed.
+    bool skinUnchangedSinceLoad() const;
+
   private:
     QString pickResizableSkin(const QString& oldSkin) const;
 
+    // Fingerprint of everything the skin widget tree is built from: the
+    // skin directory contents (file sizes and modification times) and the
+    // configuration values the parser consults.
+    QString getSkinFingerprint() const;
+
     UserSettingsPointer m_pConfig;
+    QString m_lastLoadedSkinFingerprint;
 };
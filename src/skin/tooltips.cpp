@@ -3,13 +3,17 @@
 #include "moc_tooltips.cpp"
 
 Tooltips::Tooltips() {
-    addStandardTooltips();
 }
 
 Tooltips::~Tooltips() {
 }
 
-QString Tooltips::tooltipForId(const QString& id) const {
+QString Tooltips::tooltipForId(const QString& id) {
+    if (m_tooltips.isEmpty()) {
+        // Build the table on first use instead of in the constructor,
+        // which runs for every skin load.
+        addStandardTooltips();
+    }
     // We always add a separator at the end.
     QString joined = m_tooltips.value(id, QStringList()).join(tooltipSeparator());
     if (joined.length() > 0) {
@@ -9,12 +9,15 @@ class Tooltips : public QObject {
   public:
     Tooltips();
     virtual ~Tooltips();
-    QString tooltipForId(const QString& id) const;
+    QString tooltipForId(const QString& id);
 
   private:
     void addStandardTooltips();
     QString tooltipSeparator() const;
     QList<QString>& add(const QString& id);
 
+    // Filled lazily on the first lookup. Building all translated
+    // strings eagerly would burden every skin load up front, even for
+    // skins that do not use tooltip ids.
     QHash<QString, QStringList> m_tooltips;
 };
@@ -28,6 +28,13 @@ const int kNetworkLatencyFrames = 8192; // 185 ms @ 44100 Hz
 // which is 185 @ 44100 ms and twice the maximum of the max mixxx audio buffer
 
 const mixxx::Logger kLogger("SoundDeviceNetwork");
+
+// Number of consecutive callback chunks a buffer fill deviation has to
+// persist before it is treated as clock drift and corrected by duplicating
+// or skipping frames. A single deviating observation is usually scheduling
+// jitter; correcting it right away causes an audible click without fixing
+// anything.
+const int kDriftConfirmChunks = 3;
 } // namespace
 
 SoundDeviceNetwork::SoundDeviceNetwork(UserSettingsPointer config,
@@ -35,7 +42,7 @@ SoundDeviceNetwork::SoundDeviceNetwork(UserSettingsPointer config,
                                        QSharedPointer<EngineNetworkStream> pNetworkStream)
         : SoundDevice(config, sm),
           m_pNetworkStream(pNetworkStream),
-          m_inputDrift(false),
+          m_inputDriftChunks(0),
           m_framesSinceAudioLatencyUsageUpdate(0),
           m_denormals(false),
           m_targetTime(0) {
@@ -159,17 +166,17 @@ void SoundDeviceNetwork::readProcess() {
 
         if (readAvailable > writeAvailable + inChunkSize / 2) {
             // we are not able to consume all frames
-            if (m_inputDrift) {
+            if (m_inputDriftChunks >= kDriftConfirmChunks) {
                 // Skip one frame
                 //kLogger.debug() << "readProcess() skip one frame"
                 //                << (float)writeAvailable / inChunkSize << (float)readAvailable / inChunkSize;
                 m_pNetworkStream->read(dataPtr1, 1);
             } else {
-                m_inputDrift = true;
+                m_inputDriftChunks++;
             }
         } else if (readAvailable < inChunkSize / 2) {
             // We should read at least inChunkSize
-            if (m_inputDrift) {
+            if (m_inputDriftChunks >= kDriftConfirmChunks) {
                 // duplicate one frame
                 //kLogger.debug() << "readProcess() duplicate one frame"
                 //                << (float)writeAvailable / inChunkSize << (float)readAvailable / inChunkSize;
@@ -181,10 +188,10 @@ void SoundDeviceNetwork::readProcess() {
                     m_inputFifo->releaseWriteRegions(size1);
                 }
             } else {
-                m_inputDrift = true;
+                m_inputDriftChunks++;
             }
         } else {
-            m_inputDrift = false;
+            m_inputDriftChunks = 0;
         }
     }
 
@@ -302,28 +309,28 @@ void SoundDeviceNetwork::workerWriteProcess(NetworkOutputStreamWorkerPtr pWorker
             m_pSoundManager->underflowHappened(24);
         } else if (writeAvailable - copyCount > outChunkSize / 2) {
             // try to keep PAs buffer filled up to 0.5 chunks
-            if (pWorker->outputDrift()) {
+            if (pWorker->outputDriftChunks() >= kDriftConfirmChunks) {
                 // duplicate one frame
                 //kLogger.debug() << "workerWriteProcess() duplicate one frame"
                 //                << (float)writeAvailable / outChunkSize << (float)readAvailable / outChunkSize;
                 workerWrite(pWorker, dataPtr1, 1);
             } else {
-                pWorker->setOutputDrift(true);
+                pWorker->incOutputDriftChunks();
             }
         } else if (writeAvailable < outChunkSize / 2 ||
                 readAvailable > outChunkSize * 1.5
            ) {
             // We are not able to store at least the half of the new frames
             // or we have a risk of an m_outputFifo overflow
-            if (pWorker->outputDrift()) {
+            if (pWorker->outputDriftChunks() >= kDriftConfirmChunks) {
                 //kLogger.debug() << "SoundDeviceNetwork::workerWriteProcess() skip one frame"
                 //                << (float)writeAvailable / outChunkSize << (float)readAvailable / outChunkSize;
                 copyCount = qMin(readAvailable, copyCount + m_iNumOutputChannels);
             } else {
-                pWorker->setOutputDrift(true);
+                pWorker->incOutputDriftChunks();
             }
         } else {
-            pWorker->setOutputDrift(false);
+            pWorker->resetOutputDriftChunks();
         }
 
         workerWrite(pWorker, dataPtr1, size1 / m_iNumOutputChannels);
@@ -57,7 +57,9 @@ class SoundDeviceNetwork : public SoundDevice {
     QSharedPointer<EngineNetworkStream> m_pNetworkStream;
     std::unique_ptr<FIFO<CSAMPLE> > m_outputFifo;
     std::unique_ptr<FIFO<CSAMPLE> > m_inputFifo;
-    bool m_inputDrift;
+    // Consecutive callback chunks with a deviating input buffer fill, see
+    // readProcess().
+    int m_inputDriftChunks;
 
     std::unique_ptr<ControlProxy> m_pMasterAudioLatencyUsage;
     mixxx::Duration m_timeInAudioCallback;
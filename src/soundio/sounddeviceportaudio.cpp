@@ -14,6 +14,7 @@
 #include "util/denormalsarezero.h"
 #include "util/fifo.h"
 #include "util/math.h"
+#include "util/rtallocaudit.h"
 #include "util/sample.h"
 #include "util/timer.h"
 #include "util/trace.h"
@@ -23,6 +24,9 @@
 #ifdef __LINUX__
 // for PaAlsa_EnableRealtimeScheduling
 #include <pa_linux_alsa.h>
+// for the SCHED_FIFO fallback in callbackProcessClkRef()
+#include <pthread.h>
+#include <sched.h>
 #endif
 
 namespace {
@@ -39,6 +43,16 @@ constexpr int kCpuUsageUpdateRate = 30; // in 1/s, fits to display frame rate
 // callbacks can be always wrong due to a setup/open jitter
 const int m_invalidTimeInfoWarningCount = 3;
 
+// A callback that arrives later than this factor times the buffer period
+// means the OS did not schedule the callback thread in time (core
+// migration, frequency scaling or a preempting task), even if the FIFOs
+// were deep enough to absorb the gap without an audible underflow.
+constexpr double kLateCallbackFactor = 1.5;
+
+// The first callbacks after starting a stream are always irregular,
+// see m_invalidTimeInfoWarningCount above.
+constexpr int kLateCallbackSettlingCount = 3;
+
 int paV19Callback(const void *inputBuffer, void *outputBuffer,
                   unsigned long framesPerBuffer,
                   const PaStreamCallbackTimeInfo *timeInfo,
@@ -90,6 +104,9 @@ SoundDevicePortAudio::SoundDevicePortAudio(UserSettingsPointer config,
           m_framesSinceAudioLatencyUsageUpdate(0),
           m_syncBuffers(2),
           m_invalidTimeInfoCount(0),
+          m_clkRefCallbackCount(0),
+          m_lateCallbackCount(0),
+          m_maxCallbackGapSecs(0),
           m_lastCallbackEntrytoDacSecs(0) {
     // Setting parent class members:
     m_hostAPI = Pa_GetHostApiInfo(deviceInfo->hostApi)->name;
@@ -370,6 +387,9 @@ SoundDeviceError SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffers
         ControlObject::set(ConfigKey("[Master]", "samplerate"), m_dSampleRate);
         ControlObject::set(ConfigKey("[Master]", "audio_buffer_size"), bufferMSec);
         m_invalidTimeInfoCount = 0;
+        m_clkRefCallbackCount = 0;
+        m_lateCallbackCount = 0;
+        m_maxCallbackGapSecs = 0;
         m_clkRefTimer.start();
     }
     m_pStream = pStream;
@@ -435,6 +455,16 @@ SoundDeviceError SoundDevicePortAudio::close() {
     m_inputFifo = nullptr;
     m_bSetThreadPriority = false;
 
+    if (m_lateCallbackCount > 0) {
+        // Summary of the scheduling watchdog, see
+        // updateCallbackEntryToDacTime(). A non-zero count on a machine
+        // with sufficiently large buffers points at power management or
+        // scheduler misconfiguration rather than an overloaded engine.
+        qInfo() << "SoundDevicePortAudio: callback thread was scheduled late"
+                << m_lateCallbackCount << "times, longest gap was"
+                << m_maxCallbackGapSecs * 1000 << "ms" << m_deviceId;
+    }
+
     return SOUNDDEVICE_ERROR_OK;
 }
 
@@ -683,6 +713,7 @@ int SoundDevicePortAudio::callbackProcessDrift(
         const PaStreamCallbackTimeInfo *timeInfo,
         PaStreamCallbackFlags statusFlags) {
     Q_UNUSED(timeInfo);
+    const mixxx::RtAllocAuditScope rtAllocAuditScope;
     Trace trace("SoundDevicePortAudio::callbackProcessDrift %1",
             m_deviceId.debugName());
 
@@ -816,6 +847,7 @@ int SoundDevicePortAudio::callbackProcess(const SINT framesPerBuffer,
         const PaStreamCallbackTimeInfo *timeInfo,
         PaStreamCallbackFlags statusFlags) {
     Q_UNUSED(timeInfo);
+    const mixxx::RtAllocAuditScope rtAllocAuditScope;
     Trace trace("SoundDevicePortAudio::callbackProcess %1", m_deviceId.debugName());
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
@@ -870,16 +902,40 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     // This must be the very first call, else timeInfo becomes invalid
     updateCallbackEntryToDacTime(timeInfo);
 
+    const mixxx::RtAllocAuditScope rtAllocAuditScope;
     Trace trace("SoundDevicePortAudio::callbackProcessClkRef %1",
                 m_deviceId.debugName());
 
     //qDebug() << "SoundDevicePortAudio::callbackProcess:" << m_deviceId;
-    // Turn on TimeCritical priority for the callback thread. If we are running
-    // in Linux userland, for example, this will have no effect.
+    // Turn on TimeCritical priority for the callback thread.
     if (!m_bSetThreadPriority) {
         QThread::currentThread()->setPriority(QThread::TimeCriticalPriority);
         m_bSetThreadPriority = true;
 
+#ifdef __LINUX__
+        // QThread::setPriority() above is a no-op for SCHED_OTHER threads
+        // on Linux and PaAlsa_EnableRealtimeScheduling() only covers ALSA
+        // streams, so request SCHED_FIFO directly if the host API has not
+        // already done so. This succeeds only if the user is permitted to
+        // use realtime scheduling (RLIMIT_RTPRIO, typically granted via
+        // membership in the audio group).
+        int policy = SCHED_OTHER;
+        struct sched_param schedParam = {};
+        if (pthread_getschedparam(pthread_self(), &policy, &schedParam) == 0 &&
+                policy != SCHED_FIFO && policy != SCHED_RR) {
+            schedParam.sched_priority = sched_get_priority_max(SCHED_FIFO) / 2;
+            if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &schedParam) == 0) {
+                qDebug() << "Callback thread now runs with SCHED_FIFO priority"
+                         << schedParam.sched_priority;
+            } else {
+                qInfo() << "Callback thread could not get realtime scheduling"
+                        << "(check the RTPRIO limit, e.g. membership in the"
+                        << "audio group), falling back to the default policy."
+                        << "Expect audio dropouts under load.";
+            }
+        }
+#endif
+
 
 #ifdef __SSE__
         // This disables the denormals calculations, to avoid a
@@ -1020,6 +1076,25 @@ void SoundDevicePortAudio::updateCallbackEntryToDacTime(
             - timeInfo->currentTime;
     double bufferSizeSec = m_framesPerBuffer / m_dSampleRate;
 
+    // Scheduling watchdog: the DAC consumes exactly one buffer per period,
+    // so a callback arriving much later than one buffer period after the
+    // previous one means the callback thread lost its scheduling budget.
+    // Record these events so users can tell a misconfigured machine apart
+    // from an overloaded engine.
+    if (m_clkRefCallbackCount < kLateCallbackSettlingCount) {
+        m_clkRefCallbackCount++;
+    } else if (timeSinceLastCbSecs > bufferSizeSec * kLateCallbackFactor) {
+        m_lateCallbackCount++;
+        if (timeSinceLastCbSecs > m_maxCallbackGapSecs) {
+            m_maxCallbackGapSecs = timeSinceLastCbSecs;
+        }
+        if (CmdlineArgs::Instance().getDeveloper()) {
+            qWarning() << "SoundDevicePortAudio: callback thread scheduled late,"
+                       << timeSinceLastCbSecs * 1000 << "ms since last callback,"
+                       << "expected" << bufferSizeSec * 1000 << "ms";
+        }
+    }
+
 
     double diff = (timeSinceLastCbSecs + callbackEntrytoDacSecs) -
             (m_lastCallbackEntrytoDacSecs + bufferSizeSec);
@@ -77,6 +77,12 @@ class SoundDevicePortAudio : public SoundDevice {
     int m_framesSinceAudioLatencyUsageUpdate;
     int m_syncBuffers;
     int m_invalidTimeInfoCount;
+    // Scheduling watchdog for the clock reference callback thread,
+    // see updateCallbackEntryToDacTime(). Only touched from the
+    // callback thread, except for the summary logged in close().
+    int m_clkRefCallbackCount;
+    int m_lateCallbackCount;
+    double m_maxCallbackGapSecs;
     PerformanceTimer m_clkRefTimer;
     PaTime m_lastCallbackEntrytoDacSecs;
 };
@@ -3,6 +3,7 @@
 #include <portaudio.h>
 
 #include <QLibrary>
+#include <QtConcurrentRun>
 #include <QtDebug>
 #include <cstring> // for memcpy and strcmp
 
@@ -50,6 +51,7 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
           m_paInitialized(false),
           m_config(this),
           m_pErrorDevice(nullptr),
+          m_devicesRequeryInProgress(false),
           m_underflowHappened(0),
           m_underflowUpdateCount(0) {
     // TODO(xxx) some of these ControlObject are not needed by soundmanager, or are unused here.
@@ -75,6 +77,11 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
     m_pNetworkStream = QSharedPointer<EngineNetworkStream>(
             new EngineNetworkStream(2, 0));
 
+    connect(&m_devicesRequeryWatcher,
+            &QFutureWatcher<void>::finished,
+            this,
+            &SoundManager::slotDeviceRequeryFinished);
+
     queryDevices();
 
     if (!m_config.readFromDisk()) {
@@ -85,6 +92,10 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
 }
 
 SoundManager::~SoundManager() {
+    // An asynchronous device requery must not touch PortAudio after the
+    // Pa_Terminate() below.
+    m_devicesRequeryWatcher.waitForFinished();
+
     // Clean up devices.
     const bool sleepAfterClosing = false;
     clearDeviceList(sleepAfterClosing);
@@ -158,6 +169,9 @@ void SoundManager::closeDevices(bool sleepAfterClosing) {
         }
     }
 
+    // All callbacks have stopped, nothing iterates the list anymore.
+    m_openDevices.clear();
+
     if (closed && sleepAfterClosing) {
 #ifdef __LINUX__
         // Sleep for 5 sec to allow asynchronously sound APIs like "pulse" to free
@@ -249,6 +263,63 @@ void SoundManager::clearAndQueryDevices() {
     queryDevices();
 }
 
+void SoundManager::clearAndQueryDevicesAsync() {
+    if (m_devicesRequeryInProgress) {
+        return;
+    }
+    m_devicesRequeryInProgress = true;
+
+    // Closing the devices notifies the registered sources and
+    // destinations, so it has to happen on the main thread. The sleep
+    // that usually follows is moved onto the worker below.
+    const bool closedAnyDevice = !m_openDevices.isEmpty();
+    const bool sleepAfterClosing = false;
+    closeDevices(sleepAfterClosing);
+    m_devices.clear();
+    m_pErrorDevice.clear();
+
+    // The blocking part: give asynchronous sound servers time to release
+    // the closed devices, then cycle PortAudio so that the drivers are
+    // re-probed. With some ASIO drivers this takes seconds, which used
+    // to freeze the GUI for the duration of the requery.
+    QFuture<void> future = QtConcurrent::run([this, closedAnyDevice] {
+#ifdef __LINUX__
+        if (closedAnyDevice) {
+            sleep(kSleepSecondsAfterClosingDevice);
+        }
+#else
+        Q_UNUSED(closedAnyDevice);
+#endif
+        if (m_paInitialized) {
+            Pa_Terminate();
+            m_paInitialized = false;
+        }
+#ifdef Q_OS_LINUX
+        setJACKName();
+#endif
+        // Pa_Initialize() performs the actual driver probing and is by
+        // far the slowest part of the requery.
+        const PaError err = Pa_Initialize();
+        if (err == paNoError) {
+            m_paInitialized = true;
+        } else {
+            qDebug() << "Error:" << Pa_GetErrorText(err);
+        }
+    });
+    m_devicesRequeryWatcher.setFuture(future);
+}
+
+void SoundManager::slotDeviceRequeryFinished() {
+    if (!m_devicesRequeryInProgress) {
+        // Spurious signal, e.g. after waitForFinished() in the destructor.
+        return;
+    }
+    m_devicesRequeryInProgress = false;
+    // Back on the main thread: materialize SoundDevice objects from the
+    // refreshed driver list. This emits devicesUpdated() when done.
+    queryDevices();
+}
+
 void SoundManager::queryDevicesPortaudio() {
     PaError err = paNoError;
     if (!m_paInitialized) {
@@ -447,6 +518,16 @@ SoundDeviceError SoundManager::setupDevices() {
         }
     }
 
+    // Publish the devices the clock reference callback has to service before
+    // any device is opened, because the callback starts firing as soon as the
+    // clock reference device is open. Devices that fail to open below stay in
+    // the list; their readProcess()/writeProcess() bail out on the closed
+    // stream.
+    m_openDevices.clear();
+    for (const auto& mode: qAsConst(toOpen)) {
+        m_openDevices.append(mode.pDevice);
+    }
+
     for (const auto& mode: toOpen) {
         SoundDevicePointer pDevice = mode.pDevice;
         m_pErrorDevice = pDevice;
@@ -607,7 +688,10 @@ void SoundManager::pushInputBuffers(const QList<AudioInputBuffer>& inputs,
 }
 
 void SoundManager::writeProcess() const {
-    for (const auto& pDevice: m_devices) {
+    // Called from the clock reference callback, so only the devices of the
+    // active configuration are worth a look. m_devices holds every device on
+    // the system and most of them are not even open.
+    for (const auto& pDevice: m_openDevices) {
         if (pDevice) {
             pDevice->writeProcess();
         }
@@ -615,7 +699,7 @@ void SoundManager::writeProcess() const {
 }
 
 void SoundManager::readProcess() const {
-    for (const auto& pDevice: m_devices) {
+    for (const auto& pDevice: m_openDevices) {
         if (pDevice) {
             pDevice->readProcess();
         }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QHash>
 #include <QList>
 #include <QObject>
@@ -50,6 +52,15 @@ class SoundManager : public QObject {
 
     // Creates a list of sound devices
     void clearAndQueryDevices();
+    // Like clearAndQueryDevices(), but runs the blocking driver probing
+    // on a worker thread so the GUI stays responsive while drivers are
+    // re-enumerated (seconds with some ASIO drivers). devicesUpdated()
+    // is emitted once the refreshed device list is available. Does
+    // nothing if a requery is already in flight.
+    void clearAndQueryDevicesAsync();
+    bool isDeviceQueryInProgress() const {
+        return m_devicesRequeryInProgress;
+    }
     void queryDevices();
     void queryDevicesPortaudio();
     void queryDevicesMixxx();
@@ -125,6 +136,10 @@ class SoundManager : public QObject {
     // isn't open is safe.
     void closeDevices(bool sleepAfterClosing);
 
+    // Runs on the main thread when the worker of
+    // clearAndQueryDevicesAsync() has finished cycling PortAudio.
+    void slotDeviceRequeryFinished();
+
     void setJACKName() const;
 
     EngineMaster *m_pMaster;
@@ -132,6 +147,11 @@ class SoundManager : public QObject {
     bool m_paInitialized;
     mixxx::audio::SampleRate m_jackSampleRate;
     QList<SoundDevicePointer> m_devices;
+    // The subset of m_devices that is part of the active sound configuration.
+    // m_devices enumerates every device on the system, so the clock reference
+    // callback iterates this list instead, see readProcess()/writeProcess().
+    // Only modified while no device is open.
+    QList<SoundDevicePointer> m_openDevices;
     QList<unsigned int> m_samplerates;
     QList<CSAMPLE*> m_inputBuffers;
 
@@ -144,6 +164,11 @@ class SoundManager : public QObject {
 
     QSharedPointer<EngineNetworkStream> m_pNetworkStream;
 
+    // Tracks the asynchronous device requery started by
+    // clearAndQueryDevicesAsync().
+    QFutureWatcher<void> m_devicesRequeryWatcher;
+    bool m_devicesRequeryInProgress;
+
     QAtomicInt m_underflowHappened;
     int m_underflowUpdateCount;
     ControlProxy* m_pMasterAudioLatencyOverloadCount;
@@ -1,5 +1,7 @@
 #include "sources/soundsourceffmpeg.h"
 
+#include <QThread>
+
 #include <mutex>
 
 #include "util/logger.h"
@@ -62,6 +64,13 @@ constexpr SINT kMinFrameIndex = 0;
 
 constexpr SINT kSamplesPerMP3Frame = 1152;
 
+// Maximum number of threads per decoding context. Audio decoding is
+// lightweight compared to video, so a few threads are sufficient to
+// keep up with real-time playback. This also limits the total number
+// of spawned threads, because each deck, preview deck, and analyzer
+// opens its own decoding context.
+constexpr int kMaxDecodingThreads = 4;
+
 const Logger kLogger("SoundSourceFFmpeg");
 
 std::once_flag initFFmpegLibFlag;
@@ -571,6 +580,19 @@ SoundSource::OpenResult SoundSourceFFmpeg::tryOpen(
     av_codec_set_pkt_timebase(pavCodecContext, pavStream->time_base);
 #endif
 
+    // Negotiate multi-threaded decoding for codecs that support it.
+    // Most audio decoders are single-threaded and simply ignore these
+    // hints, but some compute-intensive codecs can distribute their
+    // work across frames or slices.
+    if (pDecoder->capabilities &
+            (AV_CODEC_CAP_FRAME_THREADS | AV_CODEC_CAP_SLICE_THREADS)) {
+        pavCodecContext->thread_count = math_min(
+                QThread::idealThreadCount(), kMaxDecodingThreads);
+        pavCodecContext->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+    } else {
+        pavCodecContext->thread_count = 1;
+    }
+
     // Request output format
     pavCodecContext->request_sample_fmt = kavSampleFormat;
     if (params.getSignalInfo().getChannelCount().isValid()) {
@@ -93,6 +93,10 @@ SoundSourceFLAC::SoundSourceFLAC(const QUrl& url)
           m_decoder(nullptr),
           m_maxBlocksize(0),
           m_bitsPerSample(kBitsPerSampleDefault),
+          m_pWriteDestination(nullptr),
+          m_writeDestinationCapacity(0),
+          m_writeDestinationFrameIndex(0),
+          m_writeDestinationSampleCount(0),
           m_curFrameIndex(0) {
 }
 
@@ -260,11 +264,33 @@ ReadableSampleFrames SoundSourceFLAC::readSampleFramesClamped(
         if (m_sampleBuffer.empty()) {
             // Save the current frame index
             const SINT curFrameIndexBeforeProcessing = m_curFrameIndex;
+            // Arm the zero-copy path if the remaining destination buffer
+            // is guaranteed to accommodate any decoded block. The write
+            // callback will then interleave the decoded samples directly
+            // into the destination buffer instead of staging them in
+            // m_sampleBuffer.
+            DEBUG_ASSERT(m_writeDestinationSampleCount == 0);
+            if (writableSampleFrames.writableData() &&
+                    (numberOfSamplesRemaining >=
+                            getSignalInfo().frames2samples(m_maxBlocksize))) {
+                m_pWriteDestination =
+                        writableSampleFrames.writableData(outputSampleOffset);
+                m_writeDestinationCapacity = numberOfSamplesRemaining;
+                m_writeDestinationFrameIndex = m_curFrameIndex;
+            }
             // Documentation of FLAC__stream_decoder_process_single():
             // "Depending on what was decoded, the metadata or write callback
             // will be called with the decoded metadata block or audio frame."
             // See also: https://xiph.org/flac/api/group__flac__stream__decoder.html#ga9d6df4a39892c05955122cf7f987f856
-            if (!FLAC__stream_decoder_process_single(m_decoder)) {
+            const FLAC__bool processSingleResult =
+                    FLAC__stream_decoder_process_single(m_decoder);
+            // Disarm the zero-copy path before any recursive invocation,
+            // i.e. before skipping frames after a lost sync (see below).
+            m_pWriteDestination = nullptr;
+            const SINT numberOfSamplesWrittenDirectly =
+                    m_writeDestinationSampleCount;
+            m_writeDestinationSampleCount = 0;
+            if (!processSingleResult) {
                 kLogger.warning()
                         << "Failed to decode FLAC file"
                         << m_file.fileName();
@@ -300,6 +326,17 @@ ReadableSampleFrames SoundSourceFLAC::readSampleFramesClamped(
                 }
             }
             DEBUG_ASSERT(curFrameIndexBeforeProcessing == m_curFrameIndex);
+            if (numberOfSamplesWrittenDirectly > 0) {
+                // The write callback has interleaved the decoded block
+                // directly into the destination buffer, nothing left to
+                // copy from m_sampleBuffer for this block.
+                DEBUG_ASSERT(m_sampleBuffer.empty());
+                outputSampleOffset += numberOfSamplesWrittenDirectly;
+                m_curFrameIndex +=
+                        getSignalInfo().samples2frames(numberOfSamplesWrittenDirectly);
+                numberOfSamplesRemaining -= numberOfSamplesWrittenDirectly;
+                continue;
+            }
         }
         if (m_sampleBuffer.empty()) {
             break; // EOF
@@ -446,20 +483,33 @@ FLAC__StreamDecoderWriteStatus SoundSourceFLAC::flacWrite(
 
     // Decode buffer should be empty before decoding the next frame
     DEBUG_ASSERT(m_sampleBuffer.empty());
-    const SampleBuffer::WritableSlice writableSlice(
-            m_sampleBuffer.growForWriting(
-                    getSignalInfo().frames2samples(numReadableFrames)));
-
-    const SINT numWritableFrames =
-            getSignalInfo().samples2frames(writableSlice.length());
-    DEBUG_ASSERT(numWritableFrames <= numReadableFrames);
-    if (numWritableFrames < numReadableFrames) {
-        kLogger.warning()
-                << "Sample buffer has not enough free space for all decoded FLAC samples:"
-                << numWritableFrames << "<" << numReadableFrames;
+    CSAMPLE* pSampleBuffer;
+    SINT numWritableFrames;
+    if (m_pWriteDestination &&
+            (m_curFrameIndex == m_writeDestinationFrameIndex) &&
+            (getSignalInfo().frames2samples(numReadableFrames) <=
+                    m_writeDestinationCapacity)) {
+        // Zero-copy path: Interleave the decoded block directly into
+        // the destination buffer of the pending read request instead
+        // of staging it in m_sampleBuffer.
+        pSampleBuffer = m_pWriteDestination;
+        numWritableFrames = numReadableFrames;
+        m_writeDestinationSampleCount =
+                getSignalInfo().frames2samples(numReadableFrames);
+    } else {
+        const SampleBuffer::WritableSlice writableSlice(
+                m_sampleBuffer.growForWriting(
+                        getSignalInfo().frames2samples(numReadableFrames)));
+        numWritableFrames =
+                getSignalInfo().samples2frames(writableSlice.length());
+        DEBUG_ASSERT(numWritableFrames <= numReadableFrames);
+        if (numWritableFrames < numReadableFrames) {
+            kLogger.warning()
+                    << "Sample buffer has not enough free space for all decoded FLAC samples:"
+                    << numWritableFrames << "<" << numReadableFrames;
+        }
+        pSampleBuffer = writableSlice.data();
     }
-
-    CSAMPLE* pSampleBuffer = writableSlice.data();
     DEBUG_ASSERT(getSignalInfo().getChannelCount() <= numChannels);
     switch (getSignalInfo().getChannelCount()) {
     case 1: {
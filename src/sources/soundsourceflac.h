@@ -49,6 +49,19 @@ class SoundSourceFLAC final : public SoundSource {
 
     ReadAheadSampleBuffer m_sampleBuffer;
 
+    // Zero-copy decoding: While armed the write callback interleaves
+    // decoded blocks directly into this external destination buffer
+    // instead of staging them in m_sampleBuffer. The callback only
+    // takes the direct path if the decoded frame index matches the
+    // expected index, i.e. the decoder has not lost sync.
+    CSAMPLE* m_pWriteDestination;
+    SINT m_writeDestinationCapacity;
+    SINT m_writeDestinationFrameIndex;
+    // Number of samples the callback has written into the destination
+    // buffer during the pending decoder invocation, 0 if it took the
+    // buffered path.
+    SINT m_writeDestinationSampleCount;
+
     void invalidateCurFrameIndex() {
         m_curFrameIndex = frameIndexMax();
     }
@@ -3,9 +3,15 @@
 
 #include "util/logger.h"
 #include "util/math.h"
+#include "util/memory.h"
 
 #include <id3tag.h>
 
+#include <QCache>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QMutex>
+
 namespace mixxx {
 
 namespace {
@@ -85,6 +91,38 @@ constexpr SINT kMaxMp3FramesPerSecond = 39; // fixed: 1 MP3 frame = 26 ms -> ~ 1
 constexpr SINT kSeekFrameListCapacity =
         kMinutesPerFile * kSecondsPerMinute * kMaxMp3FramesPerSecond;
 
+// In-process cache for the results of completed header scans.
+//
+// Building the seek frame list requires restoring sync on the whole
+// file header by header, which dominates the time needed for opening
+// long VBR files. Mixxx typically opens the same file several times
+// in a row (track loading, analysis, waveform generation), so the
+// scan results are shared between all SoundSourceMp3 instances of
+// the process. Input positions are stored as offsets relative to the
+// mapped file data, because the mapping address differs between opens.
+struct SeekFrameListCacheEntry {
+    struct SeekFrame {
+        SINT frameIndex;
+        quint64 inputOffset;
+    };
+    qint64 fileSize;
+    QDateTime lastModified;
+    audio::ChannelCount channelCount;
+    audio::SampleRate sampleRate;
+    SINT frameCount;
+    unsigned long avgBitrateKbps; // 0 = unknown
+    std::vector<SeekFrame> seekFrames;
+};
+
+// The cache cost is measured in MP3 frames. A 2-hour VBR file consists
+// of roughly 275_000 frames of 16 bytes each, i.e. this limit bounds
+// the worst case memory usage at about 32 MB.
+constexpr int kSeekFrameListCacheCostLimit = 2000000;
+
+QMutex s_seekFrameListCacheMutex;
+QCache<QString, SeekFrameListCacheEntry> s_seekFrameListCache(
+        kSeekFrameListCacheCostLimit);
+
 inline QString formatHeaderFlags(int headerFlags) {
     return QString("0x%1").arg(headerFlags, 4, 16, QLatin1Char('0'));
 }
@@ -225,6 +263,62 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     DEBUG_ASSERT(m_seekFrameList.empty());
     m_avgSeekFrameCount = 0;
     m_curFrameIndex = 0;
+
+    // Restore the seek frame list from a previous open of the same,
+    // unmodified file instead of scanning the whole file again.
+    const QFileInfo fileInfo(m_file);
+    const QString seekFrameListCacheKey = fileInfo.absoluteFilePath();
+    const QDateTime fileLastModified = fileInfo.lastModified();
+    bool restoredFromCache = false;
+    auto cachedChannelCount = audio::ChannelCount();
+    auto cachedSampleRate = audio::SampleRate();
+    unsigned long cachedAvgBitrateKbps = 0;
+    {
+        QMutexLocker locker(&s_seekFrameListCacheMutex);
+        const SeekFrameListCacheEntry* pCacheEntry =
+                s_seekFrameListCache.object(seekFrameListCacheKey);
+        if (pCacheEntry &&
+                (pCacheEntry->fileSize == static_cast<qint64>(m_fileSize)) &&
+                (pCacheEntry->lastModified == fileLastModified)) {
+            m_seekFrameList.reserve(pCacheEntry->seekFrames.size() + 1);
+            for (const auto& seekFrame : pCacheEntry->seekFrames) {
+                addSeekFrame(seekFrame.frameIndex,
+                        m_pFileData + seekFrame.inputOffset);
+            }
+            m_curFrameIndex = pCacheEntry->frameCount;
+            cachedChannelCount = pCacheEntry->channelCount;
+            cachedSampleRate = pCacheEntry->sampleRate;
+            cachedAvgBitrateKbps = pCacheEntry->avgBitrateKbps;
+            restoredFromCache = true;
+        }
+    }
+    if (restoredFromCache) {
+        DEBUG_ASSERT(!m_seekFrameList.empty());
+        DEBUG_ASSERT(m_seekFrameList.front().frameIndex == 0);
+        initChannelCountOnce(cachedChannelCount);
+        initSampleRateOnce(cachedSampleRate);
+        initFrameIndexRangeOnce(IndexRange::forward(0, m_curFrameIndex));
+        m_avgSeekFrameCount = frameLength() / m_seekFrameList.size();
+        if (cachedAvgBitrateKbps > 0) {
+            initBitrateOnce(cachedAvgBitrateKbps);
+        }
+
+        // Terminate m_seekFrameList
+        addSeekFrame(m_curFrameIndex, nullptr);
+        DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
+
+        // Restart decoding at the beginning of the audio stream
+        restartDecoding(m_seekFrameList.front());
+
+        if (m_curFrameIndex != frameIndexMin()) {
+            kLogger.warning() << "Failed to start decoding:" << m_file.fileName();
+            // Abort
+            return OpenResult::Failed;
+        }
+
+        return OpenResult::Succeeded;
+    }
+
     int headerPerSampleRate[kSampleRateCount];
     for (int i = 0; i < kSampleRateCount; ++i) {
         headerPerSampleRate[i] = 0;
@@ -390,9 +484,11 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     // Calculate average bitrate values
     DEBUG_ASSERT(m_seekFrameList.size() > 0); // see above
     m_avgSeekFrameCount = frameLength() / m_seekFrameList.size();
+    unsigned long avgBitrateKbps = 0;
     if (cntBitrateFrames > 0) {
         const unsigned long avgBitrate = sumBitrateFrames / cntBitrateFrames;
-        initBitrateOnce(avgBitrate / 1000); // bps -> kbps
+        avgBitrateKbps = avgBitrate / 1000; // bps -> kbps
+        initBitrateOnce(avgBitrateKbps);
     } else {
         kLogger.warning() << "Bitrate cannot be calculated from headers";
     }
@@ -401,6 +497,33 @@ SoundSource::OpenResult SoundSourceMp3::tryOpen(
     addSeekFrame(m_curFrameIndex, nullptr);
     DEBUG_ASSERT(m_seekFrameList.back().frameIndex == frameIndexMax());
 
+    // Share the scan results with subsequent opens of the same file
+    {
+        auto pCacheEntry = std::make_unique<SeekFrameListCacheEntry>();
+        pCacheEntry->fileSize = static_cast<qint64>(m_fileSize);
+        pCacheEntry->lastModified = fileLastModified;
+        pCacheEntry->channelCount = maxChannelCount;
+        pCacheEntry->sampleRate = getSignalInfo().getSampleRate();
+        pCacheEntry->frameCount = m_curFrameIndex;
+        pCacheEntry->avgBitrateKbps = avgBitrateKbps;
+        pCacheEntry->seekFrames.reserve(m_seekFrameList.size() - 1);
+        for (const auto& seekFrame : m_seekFrameList) {
+            if (seekFrame.pInputData == nullptr) {
+                // Skip the terminator
+                continue;
+            }
+            pCacheEntry->seekFrames.push_back(SeekFrameListCacheEntry::SeekFrame{
+                    seekFrame.frameIndex,
+                    static_cast<quint64>(seekFrame.pInputData - m_pFileData)});
+        }
+        const int cacheCost = static_cast<int>(pCacheEntry->seekFrames.size());
+        QMutexLocker locker(&s_seekFrameListCacheMutex);
+        // Entries that exceed the cost limit are rejected and deleted
+        // by QCache, i.e. overlong files are simply not cached.
+        s_seekFrameListCache.insert(
+                seekFrameListCacheKey, pCacheEntry.release(), cacheCost);
+    }
+
     // Restart decoding at the beginning of the audio stream
     restartDecoding(m_seekFrameList.front());
 
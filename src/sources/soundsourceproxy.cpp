@@ -547,12 +547,13 @@ bool SoundSourceProxy::updateTrackFromSource(
     // properties imported from file tags (see below).
     const auto preciseStreamInfo = trackMetadata.getStreamInfo();
 
-    // Embedded cover art is imported together with the track's metadata.
-    // But only if the user has not selected external cover art for this
-    // track!
-    QImage coverImg;
-    DEBUG_ASSERT(coverImg.isNull());
-    QImage* pCoverImg = nullptr; // pointer also serves as a flag
+    // Embedded cover art is guessed and imported together with the track's
+    // metadata. But only if the user has not selected external cover art for
+    // this track! The actual extraction of the embedded image is deferred to
+    // a worker thread (see below), because decoding the image data may take
+    // much longer than reading the text tags and is not needed for starting
+    // playback.
+    bool guessCoverInfoFromSource = false;
 
     // If the file tags have already been parsed at least once, the
     // existing track metadata should not be updated implicitly, i.e.
@@ -575,7 +576,7 @@ bool SoundSourceProxy::updateTrackFromSource(
             }
         } else {
             // Request reimport of embedded cover art
-            pCoverImg = &coverImg;
+            guessCoverInfoFromSource = true;
         }
     }
 
@@ -583,12 +584,11 @@ bool SoundSourceProxy::updateTrackFromSource(
     auto metadataImportedFromSource =
             importTrackMetadataAndCoverImage(
                     &trackMetadata,
-                    pCoverImg);
+                    nullptr);
     if (metadataImportedFromSource.first ==
             mixxx::MetadataSource::ImportResult::Failed) {
         kLogger.warning()
                 << "Failed to import track metadata"
-                << (pCoverImg ? "and embedded cover art" : "")
                 << "from file"
                 << getUrl().toString();
         // make sure that the trackMetadata was not messed up due to the failure
@@ -598,7 +598,7 @@ bool SoundSourceProxy::updateTrackFromSource(
     // Partial import
     if (mergeExtraMetadataFromSource) {
         // No reimport of embedded cover image desired in this case
-        DEBUG_ASSERT(!pCoverImg);
+        DEBUG_ASSERT(!guessCoverInfoFromSource);
         if (metadataImportedFromSource.first == mixxx::MetadataSource::ImportResult::Succeeded) {
             // Partial import of properties that are not (yet) stored
             // in the database
@@ -618,12 +618,12 @@ bool SoundSourceProxy::updateTrackFromSource(
         if (kLogger.debugEnabled()) {
             kLogger.debug()
                     << "Updating track metadata"
-                    << (pCoverImg ? "and embedded cover art" : "")
+                    << (guessCoverInfoFromSource ? "and embedded cover art" : "")
                     << "from file"
                     << getUrl().toString();
         }
     } else {
-        DEBUG_ASSERT(pCoverImg);
+        DEBUG_ASSERT(guessCoverInfoFromSource);
         if (kLogger.debugEnabled()) {
             kLogger.debug()
                     << "Initializing track metadata and embedded cover art from file"
@@ -709,15 +709,12 @@ bool SoundSourceProxy::updateTrackFromSource(
                         Track::ImportStatus::Complete);
     }
 
-    if (pCoverImg) {
-        // If the pointer is not null then the cover art should be guessed
-        auto coverInfo =
-                CoverInfoGuesser().guessCoverInfo(
-                        m_pTrack->getFileInfo(),
-                        m_pTrack->getAlbum(),
-                        *pCoverImg);
-        DEBUG_ASSERT(coverInfo.source == CoverInfo::GUESSED);
-        m_pTrack->setCoverInfo(coverInfo);
+    if (guessCoverInfoFromSource) {
+        // Extract the embedded cover image and guess the cover info on a
+        // worker thread. This must not happen before the metadata has been
+        // replaced (see above), because guessing takes the track's current
+        // album into account.
+        guessTrackCoverInfoConcurrently(m_pTrack);
     }
 
     return true;
@@ -132,7 +132,9 @@ class SoundSourceProxy {
     ///
     /// An existing cover image is only replaced if it also has been imported
     /// from the file. Custom cover images that have been selected by the user
-    /// are preserved.
+    /// are preserved. The embedded cover image is extracted asynchronously
+    /// on a worker thread, i.e. the cover info of the track object might
+    /// not yet be updated when this function returns.
     ///
     /// This function works in a best effort manner without returning a value.
     /// Only the track object will be modified as a side effect. There are simply
@@ -44,6 +44,7 @@ class FakeDeck : public BaseTrackPlayer {
               trackSamples(ConfigKey(group, "track_samples")),
               samplerate(ConfigKey(group, "track_samplerate")),
               rateratio(ConfigKey(group, "rate_ratio"), true, false, false, 1.0),
+              pregain(ConfigKey(group, "pregain"), true, false, false, 1.0),
               playposition(ConfigKey(group, "playposition"), 0.0, 1.0, 0, 0, true),
               play(ConfigKey(group, "play")),
               repeat(ConfigKey(group, "repeat")),
@@ -100,6 +101,7 @@ class FakeDeck : public BaseTrackPlayer {
     ControlObject trackSamples;
     ControlObject samplerate;
     ControlObject rateratio;
+    ControlObject pregain;
     ControlLinPotmeter playposition;
     ControlPushButton play;
     ControlPushButton repeat;
@@ -314,4 +314,47 @@ TEST_F(BeatMapTest, TestBpmAround) {
     EXPECT_DOUBLE_EQ(filebpm, pMap->getBpmAroundPosition(1 * approx_beat_length, 4));
 }
 
+TEST_F(BeatMapTest, TestFlatSerializationRoundTrip) {
+    const double bpm = 60.0;
+    m_pTrack->trySetBpm(bpm);
+    const int numBeats = 100;
+    QVector<double> beats = createBeatVector(7, numBeats, getBeatLengthFrames(bpm));
+    auto pMap = BeatMap::makeBeatMap(m_pTrack->getSampleRate(), QString(), beats);
+
+    EXPECT_EQ(BEAT_MAP_2_VERSION, pMap->getVersion());
+    const QByteArray byteArray = pMap->toByteArray();
+    auto pLoadedMap = BeatMap::makeBeatMap(
+            m_pTrack->getSampleRate(), QString(), byteArray);
+
+    EXPECT_TRUE(pLoadedMap->isValid());
+    EXPECT_DOUBLE_EQ(pMap->getBpm(), pLoadedMap->getBpm());
+    EXPECT_DOUBLE_EQ(pMap->findNextBeat(0), pLoadedMap->findNextBeat(0));
+    const double lastBeatSample = (numBeats - 1) * getBeatLengthSamples(bpm);
+    EXPECT_DOUBLE_EQ(pMap->findPrevBeat(2 * lastBeatSample),
+            pLoadedMap->findPrevBeat(2 * lastBeatSample));
+}
+
+TEST_F(BeatMapTest, TestProtobufFallback) {
+    const double bpm = 60.0;
+    m_pTrack->trySetBpm(bpm);
+    const int numBeats = 100;
+    const double beatLengthFrames = getBeatLengthFrames(bpm);
+
+    // Serialize the legacy protobuf representation by hand, as blobs
+    // written by older versions of Mixxx still contain it.
+    mixxx::track::io::BeatMap map;
+    for (int i = 0; i < numBeats; ++i) {
+        map.add_beat()->set_frame_position(
+                static_cast<google::protobuf::int32>(i * beatLengthFrames));
+    }
+    std::string output;
+    map.SerializeToString(&output);
+    const QByteArray byteArray(output.data(), static_cast<int>(output.length()));
+
+    auto pMap = BeatMap::makeBeatMap(
+            m_pTrack->getSampleRate(), QString(), byteArray);
+    EXPECT_TRUE(pMap->isValid());
+    EXPECT_DOUBLE_EQ(bpm, pMap->getBpm());
+}
+
 }  // namespace
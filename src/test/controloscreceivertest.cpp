@@ -0,0 +1,111 @@
+#include "control/controloscreceiver.h"
+
+#include <gtest/gtest.h>
+
+#include <QtEndian>
+#include <cstring>
+
+#include "control/controlobject.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+// Builds OSC packets byte by byte, big-endian with four-byte padding as
+// specified by OSC 1.0.
+QByteArray oscString(const QByteArray& string) {
+    QByteArray padded = string;
+    padded.append('\0');
+    while (padded.size() % 4 != 0) {
+        padded.append('\0');
+    }
+    return padded;
+}
+
+QByteArray oscInt32(qint32 value) {
+    QByteArray bytes(4, '\0');
+    qToBigEndian(value, reinterpret_cast<uchar*>(bytes.data()));
+    return bytes;
+}
+
+QByteArray oscFloat32(float value) {
+    qint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return oscInt32(bits);
+}
+
+QByteArray oscMessage(const QByteArray& address,
+        const QByteArray& typeTags,
+        const QByteArray& arguments = QByteArray()) {
+    return oscString(address) + oscString(typeTags) + arguments;
+}
+
+QByteArray oscBundle(const QList<QByteArray>& elements) {
+    QByteArray bundle = oscString("#bundle");
+    // Timetag "immediately".
+    bundle.append(oscInt32(0));
+    bundle.append(oscInt32(1));
+    for (const QByteArray& element : elements) {
+        bundle.append(oscInt32(element.size()));
+        bundle.append(element);
+    }
+    return bundle;
+}
+
+class ControlOscReceiverTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        co1 = std::make_unique<ControlObject>(ConfigKey("[Channel1]", "osc_co1"));
+        co2 = std::make_unique<ControlObject>(ConfigKey("[Channel1]", "osc_co2"));
+        // The port is never bound, dispatchPacket() is driven directly.
+        m_pReceiver = std::make_unique<ControlOscReceiver>(0);
+    }
+
+    std::unique_ptr<ControlObject> co1;
+    std::unique_ptr<ControlObject> co2;
+    std::unique_ptr<ControlOscReceiver> m_pReceiver;
+};
+
+TEST_F(ControlOscReceiverTest, SetsControlFromFloatMessage) {
+    m_pReceiver->dispatchPacket(
+            oscMessage("/Channel1/osc_co1", ",f", oscFloat32(0.5f)));
+    EXPECT_DOUBLE_EQ(0.5, co1->get());
+}
+
+TEST_F(ControlOscReceiverTest, AcceptsBracketedGroupAndIntArgument) {
+    m_pReceiver->dispatchPacket(
+            oscMessage("/[Channel1]/osc_co1", ",i", oscInt32(3)));
+    EXPECT_DOUBLE_EQ(3.0, co1->get());
+}
+
+TEST_F(ControlOscReceiverTest, UsesFirstNumericArgument) {
+    // A leading string argument must be skipped, not misread as the
+    // value.
+    m_pReceiver->dispatchPacket(oscMessage("/Channel1/osc_co1",
+            ",sf",
+            oscString("ignored") + oscFloat32(2.0f)));
+    EXPECT_DOUBLE_EQ(2.0, co1->get());
+}
+
+TEST_F(ControlOscReceiverTest, DispatchesAllBundleElements) {
+    m_pReceiver->dispatchPacket(oscBundle({
+            oscMessage("/Channel1/osc_co1", ",f", oscFloat32(1.0f)),
+            oscMessage("/Channel1/osc_co2", ",T"),
+    }));
+    EXPECT_DOUBLE_EQ(1.0, co1->get());
+    EXPECT_DOUBLE_EQ(1.0, co2->get());
+}
+
+TEST_F(ControlOscReceiverTest, IgnoresMalformedAndUnknownMessages) {
+    co1->set(7.0);
+    // Unknown address.
+    m_pReceiver->dispatchPacket(
+            oscMessage("/Channel1/does_not_exist", ",f", oscFloat32(1.0f)));
+    // Truncated argument data.
+    m_pReceiver->dispatchPacket(oscMessage("/Channel1/osc_co1", ",f"));
+    // Not an OSC packet at all.
+    m_pReceiver->dispatchPacket(QByteArrayLiteral("garbage"));
+    EXPECT_DOUBLE_EQ(7.0, co1->get());
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+#include "control/controlrecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+#include "control/controlobject.h"
+#include "test/mixxxtest.h"
+#include "util/memory.h"
+
+namespace {
+
+class ControlRecorderTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        ASSERT_TRUE(m_tempDir.isValid());
+        m_recordPath = m_tempDir.filePath("controls.log");
+        ck1 = ConfigKey("[Channel1]", "recorder_co1");
+        ck2 = ConfigKey("[Channel1]", "recorder_co2");
+        co1 = std::make_unique<ControlObject>(ck1);
+        co2 = std::make_unique<ControlObject>(ck2);
+    }
+
+    void TearDown() override {
+        // Never leak an active recording into other tests.
+        ControlRecorder::stopRecording();
+    }
+
+    QStringList readRecordedLines() const {
+        QFile file(m_recordPath);
+        EXPECT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+        QStringList lines;
+        QTextStream in(&file);
+        while (!in.atEnd()) {
+            lines.append(in.readLine());
+        }
+        return lines;
+    }
+
+    QTemporaryDir m_tempDir;
+    QString m_recordPath;
+    ConfigKey ck1, ck2;
+    std::unique_ptr<ControlObject> co1;
+    std::unique_ptr<ControlObject> co2;
+};
+
+TEST_F(ControlRecorderTest, RecordsChangesWithMonotonicTimestamps) {
+    ControlRecorder::startRecording(m_recordPath);
+    EXPECT_TRUE(ControlRecorder::isRecording());
+    co1->set(1.0);
+    co2->set(2.5);
+    co1->set(-3.0);
+    ControlRecorder::stopRecording();
+    EXPECT_FALSE(ControlRecorder::isRecording());
+
+    const QStringList lines = readRecordedLines();
+    ASSERT_EQ(3, lines.size());
+
+    qint64 lastTimeNanos = -1;
+    for (const QString& line : lines) {
+        const QStringList fields = line.split(QChar(','));
+        ASSERT_EQ(4, fields.size()) << line.toStdString();
+        bool ok = false;
+        const qint64 timeNanos = fields.at(0).toLongLong(&ok);
+        EXPECT_TRUE(ok);
+        EXPECT_LE(lastTimeNanos, timeNanos);
+        lastTimeNanos = timeNanos;
+    }
+
+    EXPECT_EQ(ck1.group, lines.at(0).split(QChar(',')).at(1));
+    EXPECT_EQ(ck1.item, lines.at(0).split(QChar(',')).at(2));
+    EXPECT_DOUBLE_EQ(1.0, lines.at(0).split(QChar(',')).at(3).toDouble());
+    EXPECT_EQ(ck2.item, lines.at(1).split(QChar(',')).at(2));
+    EXPECT_DOUBLE_EQ(2.5, lines.at(1).split(QChar(',')).at(3).toDouble());
+    EXPECT_DOUBLE_EQ(-3.0, lines.at(2).split(QChar(',')).at(3).toDouble());
+}
+
+TEST_F(ControlRecorderTest, IgnoresChangesWhenNotRecording) {
+    co1->set(1.0);
+    ControlRecorder::startRecording(m_recordPath);
+    co1->set(2.0);
+    ControlRecorder::stopRecording();
+    co1->set(3.0);
+
+    const QStringList lines = readRecordedLines();
+    ASSERT_EQ(1, lines.size());
+    EXPECT_DOUBLE_EQ(2.0, lines.at(0).split(QChar(',')).at(3).toDouble());
+}
+
+TEST_F(ControlRecorderTest, ReplayerSetsRecordedValues) {
+    ControlRecorder::startRecording(m_recordPath);
+    co1->set(7.0);
+    co2->set(-1.5);
+    ControlRecorder::stopRecording();
+
+    co1->set(0.0);
+    co2->set(0.0);
+
+    ControlReplayer replayer(m_recordPath);
+    replayer.start();
+    replayer.wait();
+
+    EXPECT_DOUBLE_EQ(7.0, co1->get());
+    EXPECT_DOUBLE_EQ(-1.5, co2->get());
+}
+
+} // namespace
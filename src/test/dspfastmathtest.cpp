@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "engine/filters/enginefilterbiquad1.h"
+#include "util/sample.h"
+
+// This translation unit is compiled with -fno-fast-math (see CMakeLists.txt)
+// and gates the numeric deviation of the aggressively optimized mixxx-dsp
+// objects against strict IEEE math. If a fast-math transformation in the
+// sample or filter code starts to change results beyond the tolerances
+// below, these tests fail in the strict build.
+
+namespace {
+
+constexpr SINT kBufferSize = 1024;
+
+// Maximum tolerated absolute deviation between the fast-math compiled
+// SampleUtil routines and the strict per-sample reference loops. Fast math
+// may contract multiply-add and reorder sums, which perturbs the last bits
+// of a float but must not change results audibly.
+constexpr CSAMPLE kMaxDeviation = 1e-6f;
+
+class DspFastMathTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        m_pInput = SampleUtil::alloc(kBufferSize);
+        m_pFast = SampleUtil::alloc(kBufferSize);
+        m_pStrict = SampleUtil::alloc(kBufferSize);
+        // A decaying sine covers regular values, values close to zero and
+        // the denormal range at the tail.
+        for (SINT i = 0; i < kBufferSize; ++i) {
+            m_pInput[i] = static_cast<CSAMPLE>(
+                    std::sin(0.01 * i) * std::exp(-0.05 * i));
+        }
+    }
+
+    void TearDown() override {
+        SampleUtil::free(m_pInput);
+        SampleUtil::free(m_pFast);
+        SampleUtil::free(m_pStrict);
+    }
+
+    void assertWithinTolerance(const CSAMPLE* pFast, const CSAMPLE* pStrict) {
+        for (SINT i = 0; i < kBufferSize; ++i) {
+            ASSERT_TRUE(std::isfinite(pFast[i])) << "at index " << i;
+            ASSERT_NEAR(pStrict[i], pFast[i], kMaxDeviation)
+                    << "at index " << i;
+        }
+    }
+
+    CSAMPLE* m_pInput;
+    CSAMPLE* m_pFast;
+    CSAMPLE* m_pStrict;
+};
+
+TEST_F(DspFastMathTest, applyGainMatchesStrictReference) {
+    const CSAMPLE_GAIN gain = 0.7071f;
+    SampleUtil::copy(m_pFast, m_pInput, kBufferSize);
+    SampleUtil::applyGain(m_pFast, gain, kBufferSize);
+    for (SINT i = 0; i < kBufferSize; ++i) {
+        m_pStrict[i] = m_pInput[i] * gain;
+    }
+    assertWithinTolerance(m_pFast, m_pStrict);
+}
+
+TEST_F(DspFastMathTest, copyWithRampingGainMatchesStrictReference) {
+    const CSAMPLE_GAIN oldGain = 0.25f;
+    const CSAMPLE_GAIN newGain = 1.0f;
+    SampleUtil::copyWithRampingGain(
+            m_pFast, m_pInput, oldGain, newGain, kBufferSize);
+    const CSAMPLE_GAIN gainDelta =
+            (newGain - oldGain) / CSAMPLE_GAIN(kBufferSize / 2);
+    for (SINT i = 0; i < kBufferSize / 2; ++i) {
+        const CSAMPLE_GAIN gain = oldGain + gainDelta * (i + 1);
+        m_pStrict[i * 2] = m_pInput[i * 2] * gain;
+        m_pStrict[i * 2 + 1] = m_pInput[i * 2 + 1] * gain;
+    }
+    assertWithinTolerance(m_pFast, m_pStrict);
+}
+
+TEST_F(DspFastMathTest, addWithGainMatchesStrictReference) {
+    const CSAMPLE_GAIN gain = 0.5f;
+    SampleUtil::fill(m_pFast, 0.1f, kBufferSize);
+    SampleUtil::addWithGain(m_pFast, m_pInput, gain, kBufferSize);
+    for (SINT i = 0; i < kBufferSize; ++i) {
+        m_pStrict[i] = 0.1f + m_pInput[i] * gain;
+    }
+    assertWithinTolerance(m_pFast, m_pStrict);
+}
+
+TEST_F(DspFastMathTest, biquadOutputStaysFiniteAndBounded) {
+    // The IIR filter state decays towards the denormal range when the input
+    // falls silent. With -ffast-math denormals are flushed to zero, which
+    // is fine; NaNs or unbounded output are not.
+    EngineFilterBiquad1Low filter(44100, 1000.0, 0.7, false);
+    filter.process(m_pInput, m_pFast, kBufferSize);
+    SampleUtil::clear(m_pStrict, kBufferSize);
+    for (int pass = 0; pass < 8; ++pass) {
+        filter.process(m_pStrict, m_pFast, kBufferSize);
+        for (SINT i = 0; i < kBufferSize; ++i) {
+            ASSERT_TRUE(std::isfinite(m_pFast[i])) << "at index " << i;
+            ASSERT_LE(std::abs(m_pFast[i]), 1.0f) << "at index " << i;
+        }
+    }
+}
+
+} // namespace
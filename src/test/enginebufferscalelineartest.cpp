@@ -1,3 +1,4 @@
+#include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -296,4 +297,40 @@ TEST_F(EngineBufferScaleLinearTest, TestRepeatedScaleCalls) {
     SampleUtil::free(pOutput);
 }
 
+// A ReadAheadManager that feeds a constant signal without the gmock
+// call bookkeeping, so the benchmarks below measure the scaler only.
+class BenchReadAheadManager : public ReadAheadManager {
+  public:
+    SINT getNextSamples(double dRate, CSAMPLE* pBuffer, SINT requestedSamples) override {
+        Q_UNUSED(dRate);
+        SampleUtil::fill(pBuffer, 0.1f, requestedSamples);
+        return requestedSamples;
+    }
+};
+
+// The argument is the playback rate in percent.
+static void BM_ScaleBufferLinear(benchmark::State& state) {
+    const double rate = static_cast<double>(state.range(0)) / 100.0;
+    BenchReadAheadManager readAhead;
+    EngineBufferScaleLinear scaler(&readAhead);
+    scaler.setSampleRate(mixxx::audio::SampleRate(44100));
+    double tempoRatio = rate;
+    double pitchRatio = rate;
+    // Set the parameters twice to prevent rate LERP'ing
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+
+    const int kBufferSize = 1024;
+    CSAMPLE* pOutput = SampleUtil::alloc(kBufferSize);
+
+    while (state.KeepRunning()) {
+        scaler.scaleBuffer(pOutput, kBufferSize);
+    }
+
+    SampleUtil::free(pOutput);
+}
+// 100 = unity playback, interpolation-free fast path;
+// 95/120 = typical pitch fader positions
+BENCHMARK(BM_ScaleBufferLinear)->Arg(100)->Arg(95)->Arg(120);
+
 }  // namespace
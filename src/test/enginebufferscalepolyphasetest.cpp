@@ -0,0 +1,173 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <QVector>
+#include <QtDebug>
+
+#include "engine/bufferscalers/enginebufferscalepolyphase.h"
+#include "engine/readaheadmanager.h"
+#include "test/mixxxtest.h"
+#include "util/math.h"
+#include "util/sample.h"
+#include "util/types.h"
+
+using ::testing::StrictMock;
+using ::testing::Invoke;
+using ::testing::_;
+
+namespace {
+
+// Maximum deviation from the input level we accept once the filter has
+// settled. Bounded by the passband ripple of the windowed-sinc filter.
+constexpr CSAMPLE kMaxPassbandDeviation = 1e-3f;
+
+class ReadAheadManagerMock : public ReadAheadManager {
+  public:
+    ReadAheadManagerMock()
+            : ReadAheadManager(),
+              m_pBuffer(NULL),
+              m_iBufferSize(0),
+              m_iReadPosition(0),
+              m_iSamplesRead(0) {
+    }
+
+    SINT getNextSamplesFake(double dRate, CSAMPLE* buffer, SINT requested_samples) {
+        Q_UNUSED(dRate);
+        bool hasBuffer = m_pBuffer != NULL;
+        // You forgot to set the mock read buffer.
+        EXPECT_TRUE(hasBuffer);
+
+        for (SINT i = 0; i < requested_samples; ++i) {
+            buffer[i] = hasBuffer ? m_pBuffer[m_iReadPosition++ % m_iBufferSize] : 0;
+        }
+        m_iSamplesRead += requested_samples;
+        return requested_samples;
+    }
+
+    void setReadBuffer(CSAMPLE* pBuffer, SINT iBufferSize) {
+        m_pBuffer = pBuffer;
+        m_iBufferSize = iBufferSize;
+        m_iReadPosition = 0;
+    }
+
+    int getSamplesRead() {
+        return m_iSamplesRead;
+    }
+
+    MOCK_METHOD3(getNextSamples, SINT(double dRate, CSAMPLE* buffer, SINT requested_samples));
+
+    CSAMPLE* m_pBuffer;
+    SINT m_iBufferSize;
+    SINT m_iReadPosition;
+    SINT m_iSamplesRead;
+};
+
+class EngineBufferScalePolyphaseTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pReadAheadMock = new StrictMock<ReadAheadManagerMock>();
+        m_pScaler = new EngineBufferScalePolyphase(m_pReadAheadMock);
+
+        // Tell the RAMAN mock to invoke getNextSamplesFake
+        EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+                .WillRepeatedly(Invoke(m_pReadAheadMock,
+                        &ReadAheadManagerMock::getNextSamplesFake));
+    }
+
+    void TearDown() override {
+        delete m_pScaler;
+        delete m_pReadAheadMock;
+    }
+
+    void SetRateNoLerp(double rate) {
+        // Set it twice to prevent rate LERP'ing
+        double tempoRatio = rate;
+        double pitchRatio = rate;
+        m_pScaler->setSampleRate(mixxx::audio::SampleRate(44100));
+        m_pScaler->setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+        m_pScaler->setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+
+    // Scales and discards one buffer so the filter history is fully primed
+    // with signal instead of the silence it starts from, then scales a
+    // second buffer and checks that every sample stays within the passband
+    // ripple of the input level.
+    void AssertSettledOutputNear(CSAMPLE expected) {
+        CSAMPLE* pOutput = SampleUtil::alloc(kiPolyphaseScaleReadAheadLength);
+        m_pScaler->scaleBuffer(pOutput, kiPolyphaseScaleReadAheadLength);
+        m_pScaler->scaleBuffer(pOutput, kiPolyphaseScaleReadAheadLength);
+        for (int i = 0; i < kiPolyphaseScaleReadAheadLength; ++i) {
+            EXPECT_NEAR(expected, pOutput[i], kMaxPassbandDeviation);
+        }
+        SampleUtil::free(pOutput);
+    }
+
+    StrictMock<ReadAheadManagerMock>* m_pReadAheadMock;
+    EngineBufferScalePolyphase* m_pScaler;
+};
+
+TEST_F(EngineBufferScalePolyphaseTest, UnityRateIsSamplePerfect) {
+    SetRateNoLerp(1.0);
+
+    QVector<CSAMPLE> readBuffer;
+    for (int i = 0; i < 1000; ++i) {
+        readBuffer.push_back(i);
+    }
+    m_pReadAheadMock->setReadBuffer(readBuffer.data(), readBuffer.size());
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiPolyphaseScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, kiPolyphaseScaleReadAheadLength);
+
+    // Unity playback takes the copy path and must not be filtered.
+    int cycleRead = 0;
+    for (int i = 0; i < kiPolyphaseScaleReadAheadLength; ++i) {
+        EXPECT_FLOAT_EQ(readBuffer[cycleRead++ % readBuffer.size()], pOutput[i]);
+    }
+
+    // Check that the total samples read from the RAMAN is equal to the
+    // samples we requested.
+    ASSERT_EQ(kiPolyphaseScaleReadAheadLength, m_pReadAheadMock->getSamplesRead());
+
+    SampleUtil::free(pOutput);
+}
+
+TEST_F(EngineBufferScalePolyphaseTest, UpsamplingPreservesConstantSignal) {
+    // 44.1 kHz track on a 96 kHz engine.
+    SetRateNoLerp(44100.0 / 96000.0);
+
+    CSAMPLE readBuffer[] = {1.0f, 1.0f};
+    m_pReadAheadMock->setReadBuffer(readBuffer, 2);
+
+    AssertSettledOutputNear(1.0f);
+}
+
+TEST_F(EngineBufferScalePolyphaseTest, DownsamplingPreservesConstantSignal) {
+    // Faster than unity stretches the filter; the normalized DC gain must
+    // still be one.
+    SetRateNoLerp(1.5);
+
+    CSAMPLE readBuffer[] = {1.0f, 1.0f};
+    m_pReadAheadMock->setReadBuffer(readBuffer, 2);
+
+    AssertSettledOutputNear(1.0f);
+}
+
+TEST_F(EngineBufferScalePolyphaseTest, ChannelsDoNotLeakWhenUpsampling) {
+    SetRateNoLerp(44100.0 / 96000.0);
+
+    // Opposite DC levels per channel; any crosstalk between the interleaved
+    // channels would pull both toward zero.
+    CSAMPLE readBuffer[] = {-1.0f, 1.0f};
+    m_pReadAheadMock->setReadBuffer(readBuffer, 2);
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiPolyphaseScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, kiPolyphaseScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, kiPolyphaseScaleReadAheadLength);
+    for (int i = 0; i < kiPolyphaseScaleReadAheadLength; i += 2) {
+        EXPECT_NEAR(-1.0f, pOutput[i], kMaxPassbandDeviation);
+        EXPECT_NEAR(1.0f, pOutput[i + 1], kMaxPassbandDeviation);
+    }
+    SampleUtil::free(pOutput);
+}
+
+}  // namespace
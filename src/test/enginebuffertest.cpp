@@ -201,6 +201,109 @@ TEST_F(EngineBufferTest, ResetPitchAdjustUsesLinear) {
     EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
 }
 
+TEST_F(EngineBufferTest, ScheduledActionFiresOnceOnForwardCrossing) {
+    ControlObject actionTarget(ConfigKey("[Test]", "scheduled_action"));
+    actionTarget.set(0.0);
+    EngineBuffer* pBuffer = m_pChannel1->getEngineBuffer();
+
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ProcessBuffer();
+
+    // Schedule three buffers ahead of the current playposition.
+    const double scheduledPosition =
+            pBuffer->getExactPlayPos() + 3 * kProcessBufferSize;
+    ASSERT_TRUE(pBuffer->scheduleControlAction(
+            scheduledPosition, &actionTarget, 1.0));
+
+    // Not reached yet: the action must not fire early.
+    ProcessBuffer();
+    EXPECT_EQ(0.0, actionTarget.get());
+
+    for (int i = 0; i < 4; ++i) {
+        ProcessBuffer();
+    }
+    ASSERT_GT(pBuffer->getExactPlayPos(), scheduledPosition);
+    EXPECT_EQ(1.0, actionTarget.get());
+
+    // The action fires exactly once; it must not be re-applied in
+    // subsequent callbacks.
+    actionTarget.set(2.0);
+    ProcessBuffer();
+    ProcessBuffer();
+    EXPECT_EQ(2.0, actionTarget.get());
+}
+
+TEST_F(EngineBufferTest, ScheduledActionFiresOnSeekAcrossPosition) {
+    ControlObject actionTarget(ConfigKey("[Test]", "scheduled_action"));
+    actionTarget.set(0.0);
+    EngineBuffer* pBuffer = m_pChannel1->getEngineBuffer();
+
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ProcessBuffer();
+
+    // Schedule far beyond where normal playback will get during this test,
+    // then seek across the position. The jump counts as a crossing.
+    const double scheduledPosition = pBuffer->getExactPlayPos() + 50000;
+    ASSERT_TRUE(pBuffer->scheduleControlAction(
+            scheduledPosition, &actionTarget, 1.0));
+    ProcessBuffer();
+    EXPECT_EQ(0.0, actionTarget.get());
+
+    pBuffer->queueNewPlaypos(scheduledPosition + 10000, EngineBuffer::SEEK_EXACT);
+    ProcessBuffer();
+    EXPECT_EQ(1.0, actionTarget.get());
+}
+
+TEST_F(EngineBufferTest, ScheduledActionFiresOnReverseCrossing) {
+    ControlObject actionTarget(ConfigKey("[Test]", "scheduled_action"));
+    actionTarget.set(0.0);
+    EngineBuffer* pBuffer = m_pChannel1->getEngineBuffer();
+
+    // Start well into the track so there is room to play backwards.
+    pBuffer->queueNewPlaypos(20000, EngineBuffer::SEEK_EXACT);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "reverse"), 1.0);
+    ProcessBuffer();
+
+    const double scheduledPosition =
+            pBuffer->getExactPlayPos() - 3 * kProcessBufferSize;
+    ASSERT_TRUE(pBuffer->scheduleControlAction(
+            scheduledPosition, &actionTarget, 1.0));
+
+    ProcessBuffer();
+    EXPECT_EQ(0.0, actionTarget.get());
+
+    for (int i = 0; i < 4; ++i) {
+        ProcessBuffer();
+    }
+    ASSERT_LT(pBuffer->getExactPlayPos(), scheduledPosition);
+    EXPECT_EQ(1.0, actionTarget.get());
+}
+
+TEST_F(EngineBufferTest, ScheduledActionDroppedOnTrackLoad) {
+    ControlObject actionTarget(ConfigKey("[Test]", "scheduled_action"));
+    actionTarget.set(0.0);
+    EngineBuffer* pBuffer = m_pChannel1->getEngineBuffer();
+
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ProcessBuffer();
+
+    const double scheduledPosition =
+            pBuffer->getExactPlayPos() + 3 * kProcessBufferSize;
+    ASSERT_TRUE(pBuffer->scheduleControlAction(
+            scheduledPosition, &actionTarget, 1.0));
+
+    // Loading a new track drops all pending actions; playing the new track
+    // across the stale position must not fire them.
+    m_pMixerDeck1->loadFakeTrack(false, 0.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    for (int i = 0; i < 10; ++i) {
+        ProcessBuffer();
+    }
+    ASSERT_GT(pBuffer->getExactPlayPos(), scheduledPosition);
+    EXPECT_EQ(0.0, actionTarget.get());
+}
+
 TEST_F(EngineBufferE2ETest, SoundTouchCrashTest) {
     // Soundtouch has a bug where a pitch value of zero causes an infinite loop
     // and crash.
@@ -0,0 +1,72 @@
+#include "engine/effects/engineeffectparameter.h"
+
+#include <gtest/gtest.h>
+
+#include "effects/effectmanifestparameter.h"
+
+namespace {
+
+class EngineEffectParameterTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        m_pManifestParameter = EffectManifestParameterPointer(
+                new EffectManifestParameter());
+        m_pManifestParameter->setMinimum(0.0);
+        m_pManifestParameter->setMaximum(1.0);
+        m_pManifestParameter->setDefault(0.5);
+    }
+
+    EffectManifestParameterPointer m_pManifestParameter;
+};
+
+TEST_F(EngineEffectParameterTest, ModulationDisabledByDefault) {
+    EngineEffectParameter parameter(m_pManifestParameter);
+    parameter.setValue(0.25);
+    parameter.smooth(64, 44100);
+    // Any beat position must leave the value untouched while no
+    // modulation is configured.
+    parameter.modulate(0.3);
+    EXPECT_DOUBLE_EQ(0.25, parameter.value());
+}
+
+TEST_F(EngineEffectParameterTest, ModulationIsPhaseLockedToBeatPosition) {
+    EngineEffectParameter parameter(m_pManifestParameter);
+    parameter.setValue(0.5);
+    parameter.smooth(64, 44100);
+    // One LFO cycle per beat at full depth.
+    parameter.setModulation(1.0, 1.0);
+
+    // At the start of a beat the LFO crosses zero.
+    parameter.modulate(4.0);
+    EXPECT_NEAR(0.5, parameter.value(), 1.0e-9);
+    // A quarter beat in, the LFO peaks at +depth/2 of the range.
+    parameter.modulate(4.25);
+    EXPECT_NEAR(1.0, parameter.value(), 1.0e-9);
+    // Three quarters in, it reaches the opposite extreme.
+    parameter.modulate(4.75);
+    EXPECT_NEAR(0.0, parameter.value(), 1.0e-9);
+    // The phase only depends on the beat position, not on how many
+    // blocks were processed before: the same position yields the same
+    // value again.
+    parameter.modulate(4.25);
+    EXPECT_NEAR(1.0, parameter.value(), 1.0e-9);
+}
+
+TEST_F(EngineEffectParameterTest, MultiBeatPeriodAndClamping) {
+    EngineEffectParameter parameter(m_pManifestParameter);
+    parameter.setValue(0.75);
+    parameter.smooth(64, 44100);
+    // A four beat period peaks one beat into the cycle.
+    parameter.setModulation(4.0, 1.0);
+    parameter.modulate(1.0);
+    // 0.75 + 0.5 exceeds the maximum and must be clamped.
+    EXPECT_DOUBLE_EQ(1.0, parameter.value());
+
+    // Disabling the modulation restores the plain knob value with the
+    // next block.
+    parameter.setModulation(0.0, 0.0);
+    parameter.smooth(64, 44100);
+    EXPECT_DOUBLE_EQ(0.75, parameter.value());
+}
+
+} // namespace
@@ -1,6 +1,8 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
 #include "engine/filters/enginefilterbiquad1.h"
+#include "util/sample.h"
 
 namespace {
 
@@ -19,4 +21,41 @@ TEST_F(EngineFilterBiquadTest, fidspecLengthIsLongEnough) {
     ASSERT_TRUE(FIDSPEC_LENGTH > strlen("LsBq/1.2200000000/-12.0000000000"));
 }
 
+static void BM_BiquadProcess(benchmark::State& state) {
+    const int size = static_cast<int>(state.range(0));
+    EngineFilterBiquad1Peaking filter(44100, 1100.0, 0.3);
+    filter.setFrequencyCorners(44100, 1100.0, 0.3, 6.0);
+    CSAMPLE* pInput = SampleUtil::alloc(size);
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+    SampleUtil::fill(pInput, 0.1f, size);
+    SampleUtil::clear(pOutput, size);
+
+    while (state.KeepRunning()) {
+        filter.process(pInput, pOutput, size);
+    }
+
+    SampleUtil::free(pInput);
+    SampleUtil::free(pOutput);
+}
+BENCHMARK(BM_BiquadProcess)->Range(64, 4096);
+
+// Coefficient design cost of an EQ sweep, i.e. a continuously changing
+// gain. Repeated sweeps revisit the same quantized gain values and are
+// expected to be served from the design cache in
+// EngineFilterIIR::designCoefs().
+static void BM_BiquadSetFrequencyCornersSweep(benchmark::State& state) {
+    EngineFilterBiquad1Peaking filter(44100, 1100.0, 0.3);
+    double gainDb = -12.0;
+    double stepDb = 0.25;
+
+    while (state.KeepRunning()) {
+        gainDb += stepDb;
+        if (gainDb >= 12.0 || gainDb <= -12.0) {
+            stepDb = -stepDb;
+        }
+        filter.setFrequencyCorners(44100, 1100.0, 0.3, gainDb);
+    }
+}
+BENCHMARK(BM_BiquadSetFrequencyCornersSweep);
+
 } // namespace
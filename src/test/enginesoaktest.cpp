@@ -0,0 +1,134 @@
+#include <QVector>
+#include <QtDebug>
+#include <QtGlobal>
+
+#include <algorithm>
+#include <cmath>
+
+#include "control/controlobject.h"
+#include "test/signalpathtest.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+// Scripted show-load soak test for the engine callback.
+//
+// The test drives the full signal path of the SignalPathTest fixture
+// (three decks plus the preview deck) for a configurable wall-clock
+// duration with continuous scratching, sync, rate and mixer movements,
+// and records the processing time of every callback. A callback that
+// takes longer than the real-time budget of one buffer would have been
+// an audible under-run on a real sound device, and is logged together
+// with the engine state that produced it.
+//
+// The test is disabled by default because it runs for minutes. Enable
+// it for overnight runs with
+//
+//   mixxx-test --gtest_also_run_disabled_tests --gtest_filter='*SoakTest*'
+//
+// and set MIXXX_SOAK_SECONDS to override the default duration.
+
+constexpr int kDefaultSoakSeconds = 60;
+
+class EngineSoakTest : public SignalPathTest {
+};
+
+TEST_F(EngineSoakTest, DISABLED_ShowLoad) {
+    bool ok = false;
+    int soakSeconds = qEnvironmentVariableIntValue("MIXXX_SOAK_SECONDS", &ok);
+    if (!ok || soakSeconds <= 0) {
+        soakSeconds = kDefaultSoakSeconds;
+    }
+
+    // The fixture processes stereo buffers of kProcessBufferSize
+    // samples at 44.1 kHz.
+    const double bufferSeconds =
+            (kProcessBufferSize / 2) / 44100.0;
+    const qint64 budgetNanos =
+            static_cast<qint64>(bufferSeconds * 1e9);
+
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup3, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sPreviewGroup, "play"), 1.0);
+
+    // Deck 3 follows the sync leader for the whole run.
+    ControlObject::set(ConfigKey(m_sGroup3, "sync_enabled"), 1.0);
+
+    QVector<qint64> callbackNanos;
+    callbackNanos.reserve(soakSeconds * static_cast<int>(1.0 / bufferSeconds) + 1);
+    int underruns = 0;
+
+    PerformanceTimer wallClock;
+    wallClock.start();
+    qint64 iteration = 0;
+    while (wallClock.elapsed().toDoubleSeconds() < soakSeconds) {
+        // Scripted "performance": wiggle the controls a real show would
+        // touch, at rates faster than any human to provoke the worst
+        // case. All values are deterministic functions of the iteration
+        // so runs are reproducible.
+        const double phase = iteration * bufferSeconds;
+        ControlObject::set(ConfigKey(m_sMasterGroup, "crossfader"),
+                std::sin(phase * 0.5));
+        ControlObject::set(ConfigKey(m_sGroup1, "rate"),
+                0.1 * std::sin(phase * 0.2));
+        if (iteration % 512 == 0) {
+            // Toggle scratching on deck 2 every few seconds
+            const bool scratching = (iteration / 512) % 2 != 0;
+            ControlObject::set(ConfigKey(m_sGroup2, "scratch2_enable"),
+                    scratching ? 1.0 : 0.0);
+        }
+        if (ControlObject::get(ConfigKey(m_sGroup2, "scratch2_enable")) != 0.0) {
+            ControlObject::set(ConfigKey(m_sGroup2, "scratch2"),
+                    2.0 * std::sin(phase * 8.0));
+        }
+        if (iteration % 2048 == 0) {
+            // Seek back periodically so the decks never run off the
+            // end of the test track, emulating AutoDJ-style restarts.
+            ControlObject::set(ConfigKey(m_sGroup1, "playposition"), 0.05);
+            ControlObject::set(ConfigKey(m_sGroup2, "playposition"), 0.05);
+            ControlObject::set(ConfigKey(m_sGroup3, "playposition"), 0.05);
+        }
+
+        PerformanceTimer callbackTimer;
+        callbackTimer.start();
+        m_pEngineMaster->process(kProcessBufferSize);
+        const qint64 elapsedNanos = callbackTimer.elapsed().toIntegerNanos();
+
+        callbackNanos.append(elapsedNanos);
+        if (elapsedNanos > budgetNanos) {
+            ++underruns;
+            qWarning() << "Callback over budget:" << elapsedNanos << "ns >"
+                       << budgetNanos << "ns at iteration" << iteration
+                       << "play positions"
+                       << ControlObject::get(ConfigKey(m_sGroup1, "playposition"))
+                       << ControlObject::get(ConfigKey(m_sGroup2, "playposition"))
+                       << ControlObject::get(ConfigKey(m_sGroup3, "playposition"))
+                       << "scratching"
+                       << ControlObject::get(ConfigKey(m_sGroup2, "scratch2_enable"));
+        }
+        ++iteration;
+    }
+
+    ASSERT_FALSE(callbackNanos.isEmpty());
+    std::sort(callbackNanos.begin(), callbackNanos.end());
+    const auto percentile = [&callbackNanos](double p) {
+        const int index = static_cast<int>(p * (callbackNanos.size() - 1));
+        return callbackNanos.at(index);
+    };
+    qWarning() << "Soak test processed" << callbackNanos.size()
+               << "callbacks in" << soakSeconds << "seconds";
+    qWarning() << "Callback time ns: min" << callbackNanos.first()
+               << "median" << percentile(0.5)
+               << "p99" << percentile(0.99)
+               << "max" << callbackNanos.last()
+               << "budget" << budgetNanos;
+    qWarning() << "Callbacks over budget:" << underruns;
+
+    // The timing distribution is informational; machines running the
+    // full test suite in parallel may show sporadic outliers. Only an
+    // under-run rate above 1% fails the run.
+    EXPECT_LT(underruns, callbackNanos.size() / 100);
+}
+
+} // namespace
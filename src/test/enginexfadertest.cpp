@@ -0,0 +1,84 @@
+#include "engine/enginexfader.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// The interpolated table must stay close to the exact curve over the
+// whole crossfader range for representative parameter sets.
+constexpr CSAMPLE_GAIN kMaxInterpolationError = 0.005f;
+
+class EngineXfaderGainTableTest : public testing::Test {
+  protected:
+    void verifyAgainstExactCurve(double transform, double curve) {
+        const double powerCalibration =
+                EngineXfader::getPowerCalibration(transform);
+        m_table.update(transform, powerCalibration, curve);
+        for (int i = 0; i <= 1000; ++i) {
+            const double xfadePosition = -1.0 + 2.0 * i / 1000;
+            CSAMPLE_GAIN exactGain1, exactGain2;
+            EngineXfader::getXfadeGains(xfadePosition,
+                    transform,
+                    powerCalibration,
+                    curve,
+                    false,
+                    &exactGain1,
+                    &exactGain2);
+            CSAMPLE_GAIN tableGain1, tableGain2;
+            m_table.getGains(xfadePosition, false, &tableGain1, &tableGain2);
+            EXPECT_NEAR(exactGain1, tableGain1, kMaxInterpolationError)
+                    << "gain1 at position " << xfadePosition
+                    << " transform " << transform << " curve " << curve;
+            EXPECT_NEAR(exactGain2, tableGain2, kMaxInterpolationError)
+                    << "gain2 at position " << xfadePosition
+                    << " transform " << transform << " curve " << curve;
+        }
+    }
+
+    EngineXfaderGainTable m_table;
+};
+
+TEST_F(EngineXfaderGainTableTest, MatchesExactCurveAdditive) {
+    verifyAgainstExactCurve(EngineXfader::kTransformDefault, MIXXX_XFADER_ADDITIVE);
+    verifyAgainstExactCurve(EngineXfader::kTransformMin, MIXXX_XFADER_ADDITIVE);
+    verifyAgainstExactCurve(8.0, MIXXX_XFADER_ADDITIVE);
+}
+
+TEST_F(EngineXfaderGainTableTest, MatchesExactCurveConstPower) {
+    verifyAgainstExactCurve(EngineXfader::kTransformDefault, MIXXX_XFADER_CONSTPWR);
+    verifyAgainstExactCurve(EngineXfader::kTransformMin, MIXXX_XFADER_CONSTPWR);
+    verifyAgainstExactCurve(8.0, MIXXX_XFADER_CONSTPWR);
+}
+
+TEST_F(EngineXfaderGainTableTest, ReverseSwapsGains) {
+    const double powerCalibration =
+            EngineXfader::getPowerCalibration(EngineXfader::kTransformDefault);
+    m_table.update(EngineXfader::kTransformDefault,
+            powerCalibration,
+            MIXXX_XFADER_CONSTPWR);
+    CSAMPLE_GAIN gain1, gain2;
+    m_table.getGains(-0.5, false, &gain1, &gain2);
+    CSAMPLE_GAIN reverseGain1, reverseGain2;
+    m_table.getGains(-0.5, true, &reverseGain1, &reverseGain2);
+    EXPECT_FLOAT_EQ(gain1, reverseGain2);
+    EXPECT_FLOAT_EQ(gain2, reverseGain1);
+}
+
+TEST_F(EngineXfaderGainTableTest, EndpointsAreExact) {
+    const double powerCalibration =
+            EngineXfader::getPowerCalibration(EngineXfader::kTransformDefault);
+    m_table.update(EngineXfader::kTransformDefault,
+            powerCalibration,
+            MIXXX_XFADER_ADDITIVE);
+    CSAMPLE_GAIN gain1, gain2;
+    // Full left: only the left side is audible.
+    m_table.getGains(-1.0, false, &gain1, &gain2);
+    EXPECT_FLOAT_EQ(1.0f, gain1);
+    EXPECT_FLOAT_EQ(0.0f, gain2);
+    // Full right: only the right side is audible.
+    m_table.getGains(1.0, false, &gain1, &gain2);
+    EXPECT_FLOAT_EQ(0.0f, gain1);
+    EXPECT_FLOAT_EQ(1.0f, gain2);
+}
+
+} // namespace
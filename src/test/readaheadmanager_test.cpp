@@ -19,16 +19,35 @@ const QString kGroup = "[test]";
 class StubReader : public CachingReader {
   public:
     StubReader()
-            : CachingReader(kGroup, UserSettingsPointer()) {
+            : CachingReader(kGroup, UserSettingsPointer()),
+              m_readValue(CSAMPLE_ZERO),
+              m_failNextRead(false) {
     }
 
     CachingReader::ReadResult read(SINT startSample, SINT numSamples, bool reverse,
              CSAMPLE* buffer) override {
         Q_UNUSED(startSample);
         Q_UNUSED(reverse);
-        SampleUtil::clear(buffer, numSamples);
+        if (m_failNextRead) {
+            // Cache miss - the buffer is left untouched
+            m_failNextRead = false;
+            return CachingReader::ReadResult::UNAVAILABLE;
+        }
+        SampleUtil::fill(buffer, m_readValue, numSamples);
         return CachingReader::ReadResult::AVAILABLE;
     }
+
+    void setReadValue(CSAMPLE readValue) {
+        m_readValue = readValue;
+    }
+
+    void failNextRead() {
+        m_failNextRead = true;
+    }
+
+  private:
+    CSAMPLE m_readValue;
+    bool m_failNextRead;
 };
 
 class StubLoopControl : public LoopingControl {
@@ -149,3 +168,33 @@ TEST_F(ReadAheadManagerTest, FractionalFrameLoop) {
     // The rounding error must not exceed a half frame (one samples in stereo)
     EXPECT_NEAR(16, m_pReadAheadManager->getPlaypos(), 1);
 }
+
+TEST_F(ReadAheadManagerTest, UnderrunConcealment) {
+    m_pReadAheadManager->notifySeek(0.0);
+    for (int i = 0; i < 3; ++i) {
+        m_pLoopControl->pushTriggerReturnValue(kNoTrigger);
+        m_pLoopControl->pushTargetReturnValue(kNoTrigger);
+    }
+    m_pReader->setReadValue(1.0f);
+
+    // A good read hands out the reader's samples unchanged.
+    EXPECT_EQ(100, m_pReadAheadManager->getNextSamples(1.0, m_pBuffer, 100));
+    EXPECT_EQ(0, m_pReadAheadManager->underrunCount());
+    EXPECT_FLOAT_EQ(1.0f, m_pBuffer[0]);
+    EXPECT_FLOAT_EQ(1.0f, m_pBuffer[99]);
+
+    // A cache miss repeats the last good samples, fading towards half the
+    // level instead of cutting to silence.
+    m_pReader->failNextRead();
+    EXPECT_EQ(100, m_pReadAheadManager->getNextSamples(1.0, m_pBuffer, 100));
+    EXPECT_EQ(1, m_pReadAheadManager->underrunCount());
+    EXPECT_GT(m_pBuffer[0], 0.9f);
+    EXPECT_LT(m_pBuffer[99], 0.6f);
+    EXPECT_GT(m_pBuffer[99], 0.4f);
+
+    // Once the reader recovers, playback ramps back in from silence.
+    EXPECT_EQ(100, m_pReadAheadManager->getNextSamples(1.0, m_pBuffer, 100));
+    EXPECT_EQ(1, m_pReadAheadManager->underrunCount());
+    EXPECT_LT(m_pBuffer[0], 0.1f);
+    EXPECT_FLOAT_EQ(1.0f, m_pBuffer[99]);
+}
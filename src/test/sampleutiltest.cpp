@@ -1,6 +1,8 @@
 #include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <QtDebug>
 #include <QList>
 #include <QPair>
@@ -121,6 +123,38 @@ TEST_F(SampleUtilTest, addWithGain) {
     }
 }
 
+TEST_F(SampleUtilTest, addAndApplyRampingGain) {
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        CSAMPLE* buffer2 = SampleUtil::alloc(size);
+        FillBuffer(buffer2, 1.0f, size);
+
+        // Constant gain: (1.0 + 1.0) * 2.0
+        FillBuffer(buffer, 1.0f, size);
+        SampleUtil::addAndApplyRampingGain(buffer, buffer2, 2.0, 2.0, size);
+        AssertWholeBufferEquals(buffer, 4.0f, size);
+
+        // Zero gain clears the buffer regardless of the input
+        FillBuffer(buffer, 1.0f, size);
+        SampleUtil::addAndApplyRampingGain(buffer, buffer2, 0.0, 0.0, size);
+        AssertWholeBufferEquals(buffer, 0.0f, size);
+
+        // Ramping gain must match a separate add() and applyRampingGain() pass
+        FillBuffer(buffer, 0.5f, size);
+        SampleUtil::addAndApplyRampingGain(buffer, buffer2, 1.0, 3.0, size);
+        CSAMPLE* reference = SampleUtil::alloc(size);
+        FillBuffer(reference, 0.5f, size);
+        SampleUtil::add(reference, buffer2, size);
+        SampleUtil::applyRampingGain(reference, 1.0, 3.0, size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_FLOAT_EQ(buffer[j], reference[j]);
+        }
+        SampleUtil::free(reference);
+        SampleUtil::free(buffer2);
+    }
+}
+
 
 TEST_F(SampleUtilTest, add2WithGain) {
     for (int i = 0; i < buffers.size(); ++i) {
@@ -303,6 +337,34 @@ TEST_F(SampleUtilTest, sumAbsPerChannel) {
     }
 }
 
+TEST_F(SampleUtilTest, applyRampingAlternatingGainAndSumAbsPerChannel) {
+    for (int i = 0; i < evenBuffers.size(); ++i) {
+        int j = evenBuffers[i];
+        CSAMPLE* buffer = buffers[j];
+        int size = sizes[j];
+        FillBuffer(buffer, 1.0f, size);
+        CSAMPLE fSumL = 0, fSumR = 0;
+        // Steady gains behave like applyAlternatingGain + sumAbsPerChannel.
+        SampleUtil::CLIP_STATUS clipped =
+                SampleUtil::applyRampingAlternatingGainAndSumAbsPerChannel(
+                        buffer, 0.5, 2.0, 0.5, 2.0, &fSumL, &fSumR, size);
+        EXPECT_FLOAT_EQ(fSumL, size / 4.0f);
+        EXPECT_FLOAT_EQ(fSumR, size);
+        EXPECT_TRUE(clipped & SampleUtil::CLIPPING_RIGHT);
+        EXPECT_FALSE(clipped & SampleUtil::CLIPPING_LEFT);
+        for (int k = 0; k < size / 2; ++k) {
+            EXPECT_FLOAT_EQ(0.5f, buffer[k * 2]);
+            EXPECT_FLOAT_EQ(2.0f, buffer[k * 2 + 1]);
+        }
+        // Ramping gains end at the new gain like applyRampingAlternatingGain.
+        FillBuffer(buffer, 1.0f, size);
+        SampleUtil::applyRampingAlternatingGainAndSumAbsPerChannel(
+                buffer, 1.0, 0.0, 0.0, 1.0, &fSumL, &fSumR, size);
+        EXPECT_FLOAT_EQ(1.0f, buffer[size - 2]);
+        EXPECT_FLOAT_EQ(0.0f, buffer[size - 1]);
+    }
+}
+
 TEST_F(SampleUtilTest, interleaveBuffer) {
     for (int i = 0; i < buffers.size(); ++i) {
         CSAMPLE* buffer = buffers[i];
@@ -350,6 +412,93 @@ TEST_F(SampleUtilTest, deinterleaveBuffer) {
     }
 }
 
+TEST_F(SampleUtilTest, copyMultiToStereo) {
+    // Covers both the fixed-stride kernels for the common surround
+    // layouts and the generic fallback (5 channels)
+    const int channelCounts[] = {3, 4, 5, 6, 8};
+    for (int numChannels : channelCounts) {
+        const int numFrames = 101;
+        CSAMPLE* pSrc = SampleUtil::alloc(numFrames * numChannels);
+        CSAMPLE* pDest = SampleUtil::alloc(numFrames * 2);
+        for (int i = 0; i < numFrames; ++i) {
+            for (int c = 0; c < numChannels; ++c) {
+                // Encode frame and channel in the sample value
+                pSrc[i * numChannels + c] = i * 10.0f + c;
+            }
+        }
+        SampleUtil::copyMultiToStereo(pDest, pSrc, numFrames, numChannels);
+        for (int i = 0; i < numFrames; ++i) {
+            EXPECT_FLOAT_EQ(pDest[i * 2], i * 10.0f);
+            EXPECT_FLOAT_EQ(pDest[i * 2 + 1], i * 10.0f + 1);
+        }
+        // The in-place variant must produce the same result
+        SampleUtil::stripMultiToStereo(pSrc, numFrames, numChannels);
+        for (int i = 0; i < numFrames; ++i) {
+            EXPECT_FLOAT_EQ(pSrc[i * 2], i * 10.0f);
+            EXPECT_FLOAT_EQ(pSrc[i * 2 + 1], i * 10.0f + 1);
+        }
+        SampleUtil::free(pDest);
+        SampleUtil::free(pSrc);
+    }
+}
+
+TEST_F(SampleUtilTest, isSilence) {
+    // Odd size covers both the chunked and the scalar tail loop
+    const int size = 1027;
+    CSAMPLE* buffer = SampleUtil::alloc(size);
+    SampleUtil::clear(buffer, size);
+    EXPECT_TRUE(SampleUtil::isSilence(buffer, size));
+    // A single non-zero sample anywhere must defeat the check, including
+    // in the tail
+    buffer[0] = 0.001f;
+    EXPECT_FALSE(SampleUtil::isSilence(buffer, size));
+    buffer[0] = 0.0f;
+    buffer[size - 1] = -0.001f;
+    EXPECT_FALSE(SampleUtil::isSilence(buffer, size));
+    buffer[size - 1] = 0.0f;
+    buffer[size / 2] = 1.0f;
+    EXPECT_FALSE(SampleUtil::isSilence(buffer, size));
+    SampleUtil::free(buffer);
+}
+
+TEST_F(SampleUtilTest, mixStemsToStereoWithRampingGain) {
+    // Covers the fixed-count kernels (2 and 4 stems) and the generic
+    // fallback (3 stems)
+    const int stemCounts[] = {2, 3, 4};
+    for (int numStems : stemCounts) {
+        const int numFrames = 100;
+        CSAMPLE* pSrc = SampleUtil::alloc(numFrames * numStems * 2);
+        CSAMPLE* pDest = SampleUtil::alloc(numFrames * 2);
+        for (int i = 0; i < numFrames; ++i) {
+            for (int s = 0; s < numStems; ++s) {
+                pSrc[(i * numStems + s) * 2] = 1.0f;
+                pSrc[(i * numStems + s) * 2 + 1] = -1.0f;
+            }
+        }
+        // Constant unity gain on every stem: the mixdown is the plain sum.
+        std::vector<CSAMPLE_GAIN> unityGain(numStems, 1.0f);
+        SampleUtil::mixStemsToStereoWithRampingGain(pDest, pSrc,
+                unityGain.data(), unityGain.data(), numStems, numFrames);
+        for (int i = 0; i < numFrames; ++i) {
+            EXPECT_FLOAT_EQ(pDest[i * 2], numStems * 1.0f);
+            EXPECT_FLOAT_EQ(pDest[i * 2 + 1], numStems * -1.0f);
+        }
+        // Ramping one stem from 0.0 to 1.0 while muting the others must
+        // reach the target gain at the end of the buffer.
+        std::vector<CSAMPLE_GAIN> oldGain(numStems, 0.0f);
+        std::vector<CSAMPLE_GAIN> newGain(numStems, 0.0f);
+        newGain[0] = 1.0f;
+        SampleUtil::mixStemsToStereoWithRampingGain(pDest, pSrc,
+                oldGain.data(), newGain.data(), numStems, numFrames);
+        EXPECT_FLOAT_EQ(pDest[(numFrames - 1) * 2], 1.0f);
+        EXPECT_FLOAT_EQ(pDest[(numFrames - 1) * 2 + 1], -1.0f);
+        // The first frame carries one ramp step of gain.
+        EXPECT_FLOAT_EQ(pDest[0], 1.0f / numFrames);
+        SampleUtil::free(pDest);
+        SampleUtil::free(pSrc);
+    }
+}
+
 TEST_F(SampleUtilTest, reverse) {
     if (buffers.size() > 0 && sizes[0] > 10) {
         CSAMPLE* buffer = buffers[1];
@@ -583,4 +732,278 @@ static void BM_Copy2WithRampingGain(benchmark::State& state) {
 }
 BENCHMARK(BM_Copy2WithRampingGain)->Range(64, 4096);
 
+// The following benchmarks compare the unrolled per-sample mixdown that
+// the generated ChannelMixer used (see the removed
+// channelmixer_autogen.cpp) with the cache-blocked SampleUtil::copy/add
+// mixdown that replaced it in
+// ChannelMixer::applyEffectsInPlaceAndMixChannels.
+
+static void BM_MixChannels4Unrolled(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[4];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (SINT i = 0; i < size; ++i) {
+            pOutput[i] = buffers[0][i] + buffers[1][i] + buffers[2][i] +
+                    buffers[3][i];
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_MixChannels4Unrolled)->Range(64, 4096);
+
+static void BM_MixChannels4Blocked(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[4];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        SampleUtil::copy(pOutput, buffers[0], size);
+        for (int ch = 1; ch < 4; ++ch) {
+            SampleUtil::add(pOutput, buffers[ch], size);
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_MixChannels4Blocked)->Range(64, 4096);
+
+static void BM_MixChannels16Unrolled(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[16];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (SINT i = 0; i < size; ++i) {
+            pOutput[i] = buffers[0][i] + buffers[1][i] + buffers[2][i] +
+                    buffers[3][i] + buffers[4][i] + buffers[5][i] +
+                    buffers[6][i] + buffers[7][i] + buffers[8][i] +
+                    buffers[9][i] + buffers[10][i] + buffers[11][i] +
+                    buffers[12][i] + buffers[13][i] + buffers[14][i] +
+                    buffers[15][i];
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_MixChannels16Unrolled)->Range(64, 4096);
+
+static void BM_MixChannels16Blocked(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[16];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        SampleUtil::copy(pOutput, buffers[0], size);
+        for (int ch = 1; ch < 16; ++ch) {
+            SampleUtil::add(pOutput, buffers[ch], size);
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_MixChannels16Blocked)->Range(64, 4096);
+
+// The following benchmarks compare the two possible processing orders for
+// the per-channel post-fader stage in
+// ChannelMixer::applyEffectsInPlaceAndMixChannels: stage-major runs the
+// gain/effects pass over all channel buffers first and mixes them down in
+// a second pass, channel-major mixes each channel into the output right
+// after its gain/effects pass while the buffer is still cache-resident.
+// The ramping gain pass stands in for the post-fader processing. The
+// difference shows at large buffer sizes (4096 samples = 2048 frames per
+// channel), where stage-major has evicted the first channel buffers from
+// the close caches by the time the mixdown re-reads them.
+
+static void BM_ChannelPipeline4StageMajor(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[4];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (CSAMPLE* pBuffer : buffers) {
+            SampleUtil::applyRampingGain(pBuffer, 0.99f, 1.0f, size);
+        }
+        SampleUtil::copy(pOutput, buffers[0], size);
+        for (int ch = 1; ch < 4; ++ch) {
+            SampleUtil::add(pOutput, buffers[ch], size);
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_ChannelPipeline4StageMajor)->Range(64, 4096);
+
+static void BM_ChannelPipeline4ChannelMajor(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[4];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (int ch = 0; ch < 4; ++ch) {
+            SampleUtil::applyRampingGain(buffers[ch], 0.99f, 1.0f, size);
+            if (ch == 0) {
+                SampleUtil::copy(pOutput, buffers[ch], size);
+            } else {
+                SampleUtil::add(pOutput, buffers[ch], size);
+            }
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_ChannelPipeline4ChannelMajor)->Range(64, 4096);
+
+static void BM_ChannelPipeline16StageMajor(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[16];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (CSAMPLE* pBuffer : buffers) {
+            SampleUtil::applyRampingGain(pBuffer, 0.99f, 1.0f, size);
+        }
+        SampleUtil::copy(pOutput, buffers[0], size);
+        for (int ch = 1; ch < 16; ++ch) {
+            SampleUtil::add(pOutput, buffers[ch], size);
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_ChannelPipeline16StageMajor)->Range(64, 4096);
+
+static void BM_ChannelPipeline16ChannelMajor(benchmark::State& state) {
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffers[16];
+    for (CSAMPLE*& pBuffer : buffers) {
+        pBuffer = SampleUtil::alloc(size);
+        SampleUtil::fill(pBuffer, 0.1f, size);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(size);
+
+    while (state.KeepRunning()) {
+        for (int ch = 0; ch < 16; ++ch) {
+            SampleUtil::applyRampingGain(buffers[ch], 0.99f, 1.0f, size);
+            if (ch == 0) {
+                SampleUtil::copy(pOutput, buffers[ch], size);
+            } else {
+                SampleUtil::add(pOutput, buffers[ch], size);
+            }
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_ChannelPipeline16ChannelMajor)->Range(64, 4096);
+
+// Mixing four stems the way four independent decks would: deinterleave
+// each stem into its own buffer, apply the gain ramp per stem, then sum.
+
+static void BM_MixStems4SeparatePasses(benchmark::State& state) {
+    SINT numFrames = static_cast<SINT>(state.range(0));
+    CSAMPLE* pSrc = SampleUtil::alloc(numFrames * 4 * 2);
+    SampleUtil::fill(pSrc, 0.1f, numFrames * 4 * 2);
+    CSAMPLE* stemBuffers[4];
+    for (CSAMPLE*& pBuffer : stemBuffers) {
+        pBuffer = SampleUtil::alloc(numFrames * 2);
+    }
+    CSAMPLE* pOutput = SampleUtil::alloc(numFrames * 2);
+
+    while (state.KeepRunning()) {
+        for (int s = 0; s < 4; ++s) {
+            for (SINT i = 0; i < numFrames; ++i) {
+                stemBuffers[s][i * 2] = pSrc[(i * 4 + s) * 2];
+                stemBuffers[s][i * 2 + 1] = pSrc[(i * 4 + s) * 2 + 1];
+            }
+            SampleUtil::applyRampingGain(
+                    stemBuffers[s], 0.99f, 1.0f, numFrames * 2);
+            if (s == 0) {
+                SampleUtil::copy(pOutput, stemBuffers[s], numFrames * 2);
+            } else {
+                SampleUtil::add(pOutput, stemBuffers[s], numFrames * 2);
+            }
+        }
+    }
+
+    SampleUtil::free(pOutput);
+    for (CSAMPLE* pBuffer : stemBuffers) {
+        SampleUtil::free(pBuffer);
+    }
+    SampleUtil::free(pSrc);
+}
+BENCHMARK(BM_MixStems4SeparatePasses)->Range(64, 4096);
+
+static void BM_MixStems4SinglePass(benchmark::State& state) {
+    SINT numFrames = static_cast<SINT>(state.range(0));
+    CSAMPLE* pSrc = SampleUtil::alloc(numFrames * 4 * 2);
+    SampleUtil::fill(pSrc, 0.1f, numFrames * 4 * 2);
+    CSAMPLE* pOutput = SampleUtil::alloc(numFrames * 2);
+    const CSAMPLE_GAIN oldGain[4] = {0.99f, 0.99f, 0.99f, 0.99f};
+    const CSAMPLE_GAIN newGain[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    while (state.KeepRunning()) {
+        SampleUtil::mixStemsToStereoWithRampingGain(
+                pOutput, pSrc, oldGain, newGain, 4, numFrames);
+    }
+
+    SampleUtil::free(pOutput);
+    SampleUtil::free(pSrc);
+}
+BENCHMARK(BM_MixStems4SinglePass)->Range(64, 4096);
+
 }  // namespace
@@ -43,6 +43,25 @@ TEST_F(SoftTakeoverTest, DoesntIgnoreNonPotmeter) {
     EXPECT_FALSE(st_control.ignore(co.get(), 0));
 }
 
+TEST_F(SoftTakeoverTest, EnableAndIgnoreDoesntIgnoreNonPotmeter) {
+    auto co = std::make_unique<ControlPushButton>(ConfigKey("[Channel1]", "test_button"));
+
+    SoftTakeoverCtrl st_control;
+    // First update is always ignored so this proves the CPB is not enabled for
+    // soft-takeover.
+    EXPECT_FALSE(st_control.enableAndIgnore(co.get(), 0));
+}
+
+TEST_F(SoftTakeoverTest, EnableAndIgnoreBehavesLikeEnableThenIgnore) {
+    // Range -1.0 to 1.0
+    auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Channel1]", "test_pot"), -1.0, 1.0);
+
+    SoftTakeoverCtrl st_control;
+    // First is always ignored.
+    EXPECT_TRUE(st_control.enableAndIgnore(co.get(), 5));
+    EXPECT_FALSE(st_control.enableAndIgnore(co.get(), co->getParameterForValue(co->get())));
+}
+
 TEST_F(SoftTakeoverTest, IgnoresFirstValue) {
     // Range -1.0 to 1.0
     auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Channel1]", "test_pot"), -1.0, 1.0);
@@ -56,3 +56,31 @@ TEST_F(TrackDAOTest, detectMovedTracks) {
     QSet<QString> trackLocations = trackDAO.getAllTrackLocations();
     EXPECT_THAT(trackLocations, UnorderedElementsAre(newFile.location(), otherFile.location()));
 }
+
+TEST_F(TrackDAOTest, saveTracks) {
+    TrackDAO& trackDAO = internalCollection()->getTrackDAO();
+
+    QList<TrackPointer> tracks;
+    for (int i = 0; i < 3; ++i) {
+        mixxx::FileInfo file(QDir(QDir::tempPath() + QStringLiteral("/batch")),
+                QStringLiteral("file%1.mp3").arg(i));
+        TrackPointer pTrack = Track::newTemporary(mixxx::FileAccess(file));
+        internalCollection()->addTrack(pTrack, false);
+        ASSERT_TRUE(pTrack->getId().isValid());
+        pTrack->setTitle(QStringLiteral("title%1").arg(i));
+        ASSERT_TRUE(pTrack->isDirty());
+        tracks.append(pTrack);
+    }
+
+    trackDAO.saveTracks(tracks);
+
+    QSqlQuery query(dbConnection());
+    query.prepare("SELECT title FROM library WHERE id=:id");
+    for (int i = 0; i < tracks.size(); ++i) {
+        EXPECT_FALSE(tracks[i]->isDirty());
+        query.bindValue(":id", tracks[i]->getId().toVariant());
+        ASSERT_TRUE(query.exec());
+        ASSERT_TRUE(query.next());
+        EXPECT_EQ(QStringLiteral("title%1").arg(i), query.value(0).toString());
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <QByteArray>
+
+#include <algorithm>
+
+#include "waveform/waveform.h"
+
+namespace {
+
+class WaveformTest : public testing::Test {
+};
+
+// Round-trip through the serialized representation and verify that every
+// band survives unchanged. This covers the delta encoding introduced with
+// Waveform-6.0.
+TEST_F(WaveformTest, ToByteArrayRoundTrip) {
+    Waveform waveform(44100, 44100 * 2, 441, -1);
+    ASSERT_TRUE(waveform.isValid());
+
+    const int dataSize = waveform.getDataSize();
+    WaveformData* pData = waveform.data();
+    for (int i = 0; i < dataSize; ++i) {
+        // Arbitrary but deterministic pattern covering the full byte range
+        // including wrap-arounds between neighboring values.
+        pData[i].filtered.all = static_cast<unsigned char>(i * 7);
+        pData[i].filtered.low = static_cast<unsigned char>(255 - (i % 256));
+        pData[i].filtered.mid = static_cast<unsigned char>((i * i) % 256);
+        pData[i].filtered.high = static_cast<unsigned char>(i % 3 ? 0 : 255);
+    }
+    waveform.setCompletion(dataSize);
+
+    const QByteArray data = waveform.toByteArray();
+    ASSERT_FALSE(data.isEmpty());
+
+    Waveform loaded(data);
+    ASSERT_TRUE(loaded.isValid());
+    ASSERT_EQ(dataSize, loaded.getDataSize());
+    EXPECT_EQ(waveform.getCompletion(), loaded.getCompletion());
+    EXPECT_DOUBLE_EQ(waveform.getAudioVisualRatio(), loaded.getAudioVisualRatio());
+
+    for (int i = 0; i < dataSize; ++i) {
+        ASSERT_EQ(waveform.getAll(i), loaded.getAll(i)) << "at index " << i;
+        ASSERT_EQ(waveform.getLow(i), loaded.getLow(i)) << "at index " << i;
+        ASSERT_EQ(waveform.getMid(i), loaded.getMid(i)) << "at index " << i;
+        ASSERT_EQ(waveform.getHigh(i), loaded.getHigh(i)) << "at index " << i;
+    }
+}
+
+// The summary pyramid must hold the component-wise maximum of the base
+// frames each summary frame covers, and the level selection must match
+// the zoom so renderers touch only a few entries per pixel column.
+TEST_F(WaveformTest, SummaryPyramid) {
+    // 10 minutes of audio yields roughly 132k visual frames, enough for
+    // several summary levels.
+    Waveform waveform(44100, 44100 * 600, 441, -1);
+    ASSERT_TRUE(waveform.isValid());
+
+    const int dataSize = waveform.getDataSize();
+    WaveformData* pData = waveform.data();
+    for (int i = 0; i < dataSize; ++i) {
+        pData[i].filtered.all = static_cast<unsigned char>((i * 13) % 256);
+        pData[i].filtered.low = static_cast<unsigned char>((i * 7) % 256);
+        pData[i].filtered.mid = static_cast<unsigned char>((i * 3) % 256);
+        pData[i].filtered.high = static_cast<unsigned char>(i % 251);
+    }
+    waveform.setCompletion(dataSize);
+
+    EXPECT_EQ(0, waveform.getSummaryLevelCount());
+    waveform.buildSummaryPyramid();
+    const int levelCount = waveform.getSummaryLevelCount();
+    ASSERT_GT(levelCount, 0);
+
+    // Zoomed in, the base data is used unchanged.
+    int shift = -1;
+    int summaryDataSize = 0;
+    const WaveformData* pSummary =
+            waveform.summaryForFramesPerPixel(1.0, &shift, &summaryDataSize);
+    EXPECT_EQ(0, shift);
+    EXPECT_EQ(dataSize, summaryDataSize);
+    EXPECT_EQ(waveform.data(), pSummary);
+
+    // Zoomed far out, a coarse level takes over and every summary frame
+    // is the maximum of the base frames it covers.
+    pSummary = waveform.summaryForFramesPerPixel(256.0, &shift, &summaryDataSize);
+    ASSERT_GT(shift, 0);
+    ASSERT_LE(shift, levelCount);
+    const int baseFrames = dataSize / 2;
+    const int summaryFrames = summaryDataSize / 2;
+    ASSERT_EQ((baseFrames + (1 << shift) - 1) >> shift, summaryFrames);
+    for (int frame : {0, summaryFrames / 2, summaryFrames - 1}) {
+        for (int channel = 0; channel < 2; ++channel) {
+            unsigned char maxLow = 0;
+            unsigned char maxHigh = 0;
+            for (int baseFrame = frame << shift;
+                    baseFrame < std::min((frame + 1) << shift, baseFrames);
+                    ++baseFrame) {
+                const WaveformData& datum = pData[baseFrame * 2 + channel];
+                maxLow = std::max(maxLow, datum.filtered.low);
+                maxHigh = std::max(maxHigh, datum.filtered.high);
+            }
+            const WaveformData& summaryDatum = pSummary[frame * 2 + channel];
+            EXPECT_EQ(maxLow, summaryDatum.filtered.low)
+                    << "frame " << frame << " channel " << channel;
+            EXPECT_EQ(maxHigh, summaryDatum.filtered.high)
+                    << "frame " << frame << " channel " << channel;
+        }
+    }
+}
+
+} // namespace
@@ -22,7 +22,8 @@ mixxx::BeatsPointer BeatFactory::loadBeatsFromByteArray(
         auto pGrid = mixxx::BeatGrid::makeBeatGrid(sampleRate, beatsSubVersion, beatsSerialized);
         qDebug() << "Successfully deserialized BeatGrid";
         return pGrid;
-    } else if (beatsVersion == BEAT_MAP_VERSION) {
+    } else if (beatsVersion == BEAT_MAP_VERSION ||
+            beatsVersion == BEAT_MAP_2_VERSION) {
         auto pMap = mixxx::BeatMap::makeBeatMap(sampleRate, beatsSubVersion, beatsSerialized);
         qDebug() << "Successfully deserialized BeatMap";
         return pMap;
@@ -43,7 +44,7 @@ QString BeatFactory::getPreferredVersion(bool fixedTempo) {
     if (fixedTempo) {
         return BEAT_GRID_2_VERSION;
     }
-    return BEAT_MAP_VERSION;
+    return BEAT_MAP_2_VERSION;
 }
 
 QString BeatFactory::getPreferredSubVersion(
@@ -107,7 +108,7 @@ mixxx::BeatsPointer BeatFactory::makePreferredBeats(
         auto pGrid = mixxx::BeatGrid::makeBeatGrid(
                 sampleRate, subVersion, constBPM, firstBeat * 2);
         return pGrid;
-    } else if (version == BEAT_MAP_VERSION) {
+    } else if (version == BEAT_MAP_2_VERSION) {
         QVector<double> ironedBeats = BeatUtils::getBeats(constantRegions);
         auto pBeatMap = mixxx::BeatMap::makeBeatMap(sampleRate, subVersion, ironedBeats);
         return pBeatMap;
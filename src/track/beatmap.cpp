@@ -11,6 +11,7 @@
 #include <QtDebug>
 #include <QtGlobal>
 #include <algorithm>
+#include <cstring>
 
 #include "track/beatutils.h"
 #include "track/track.h"
@@ -27,10 +28,21 @@ inline double samplesToFrames(const double samples) {
     return floor(samples / kFrameSize);
 }
 
-inline double framesToSamples(const int frames) {
+inline double framesToSamples(const double frames) {
     return frames * kFrameSize;
 }
 
+std::vector<double> buildEnabledBeatFrames(const BeatList& beats) {
+    std::vector<double> beatFrames;
+    beatFrames.reserve(beats.size());
+    for (const auto& beat : beats) {
+        if (beat.enabled()) {
+            beatFrames.push_back(beat.frame_position());
+        }
+    }
+    return beatFrames;
+}
+
 bool BeatLessThan(const Beat& beat1, const Beat& beat2) {
     return beat1.frame_position() < beat2.frame_position();
 }
@@ -144,6 +156,91 @@ double calculateNominalBpm(const BeatList& beats, mixxx::audio::SampleRate sampl
     return BeatUtils::calculateBpm(beatvect, mixxx::audio::SampleRate(sampleRate));
 }
 
+// Flat serialization of a beat map (BEAT_MAP_2_VERSION): a fixed header
+// followed by a contiguous array of beat frame positions and one flag
+// byte per beat. Loading only needs a size check and a bulk copy, while
+// the protobuf representation (BEAT_MAP_VERSION) decodes every Beat
+// message individually, which dominates the track load time of long
+// tracks. Protobuf blobs never start with the magic number, so legacy
+// blobs are detected and parsed by the protobuf fallback.
+constexpr quint32 kFlatBeatsMagic = 0x54414542; // "BEAT" when read as bytes
+constexpr quint32 kFlatBeatsVersion = 1;
+constexpr quint8 kFlatBeatEnabledFlag = 0x01;
+constexpr int kFlatBeatSourceShift = 1; // track::io::Source in bits 1..2
+
+struct FlatBeatsHeader {
+    quint32 magic;
+    quint32 version;
+    quint32 beatCount;
+    quint32 reserved; // always 0, for future use
+};
+
+QByteArray beatListToFlatByteArray(const BeatList& beats) {
+    FlatBeatsHeader header;
+    header.magic = kFlatBeatsMagic;
+    header.version = kFlatBeatsVersion;
+    header.beatCount = static_cast<quint32>(beats.size());
+    header.reserved = 0;
+
+    QByteArray byteArray;
+    byteArray.resize(static_cast<int>(sizeof(header)) +
+            beats.size() * static_cast<int>(sizeof(double) + sizeof(quint8)));
+    char* pWrite = byteArray.data();
+    memcpy(pWrite, &header, sizeof(header));
+    pWrite += sizeof(header);
+    for (const auto& beat : beats) {
+        const double framePosition = beat.frame_position();
+        memcpy(pWrite, &framePosition, sizeof(framePosition));
+        pWrite += sizeof(framePosition);
+    }
+    for (const auto& beat : beats) {
+        quint8 flags = static_cast<quint8>(beat.source() << kFlatBeatSourceShift);
+        if (beat.enabled()) {
+            flags |= kFlatBeatEnabledFlag;
+        }
+        *pWrite++ = static_cast<char>(flags);
+    }
+    return byteArray;
+}
+
+bool parseFlatByteArray(const QByteArray& byteArray, BeatList* pBeatList) {
+    FlatBeatsHeader header;
+    if (byteArray.size() < static_cast<int>(sizeof(header))) {
+        return false;
+    }
+    memcpy(&header, byteArray.constData(), sizeof(header));
+    if (header.magic != kFlatBeatsMagic ||
+            header.version != kFlatBeatsVersion) {
+        return false;
+    }
+    const qint64 expectedSize = static_cast<qint64>(sizeof(header)) +
+            static_cast<qint64>(header.beatCount) *
+                    (sizeof(double) + sizeof(quint8));
+    if (byteArray.size() != expectedSize) {
+        qDebug() << "ERROR: Flat BeatMap of size" << byteArray.size()
+                 << "does not match its advertised beat count" << header.beatCount;
+        return false;
+    }
+
+    const char* pPositions = byteArray.constData() + sizeof(header);
+    const char* pFlags = pPositions + header.beatCount * sizeof(double);
+    Beat beat;
+    for (quint32 i = 0; i < header.beatCount; ++i) {
+        double framePosition;
+        memcpy(&framePosition, pPositions + i * sizeof(double), sizeof(framePosition));
+        const quint8 flags = static_cast<quint8>(pFlags[i]);
+        beat.Clear();
+        beat.set_frame_position(static_cast<google::protobuf::int32>(framePosition));
+        beat.set_enabled((flags & kFlatBeatEnabledFlag) != 0);
+        const int source = flags >> kFlatBeatSourceShift;
+        if (mixxx::track::io::Source_IsValid(source)) {
+            beat.set_source(static_cast<mixxx::track::io::Source>(source));
+        }
+        pBeatList->append(beat);
+    }
+    return true;
+}
+
 } // namespace
 
 namespace mixxx {
@@ -185,14 +282,16 @@ BeatMap::BeatMap(
         : m_subVersion(subVersion),
           m_sampleRate(sampleRate),
           m_nominalBpm(nominalBpm),
-          m_beats(std::move(beats)) {
+          m_beats(std::move(beats)),
+          m_enabledBeatFrames(buildEnabledBeatFrames(m_beats)) {
 }
 
 BeatMap::BeatMap(const BeatMap& other, BeatList beats, double nominalBpm)
         : m_subVersion(other.m_subVersion),
           m_sampleRate(other.m_sampleRate),
           m_nominalBpm(nominalBpm),
-          m_beats(std::move(beats)) {
+          m_beats(std::move(beats)),
+          m_enabledBeatFrames(buildEnabledBeatFrames(m_beats)) {
 }
 
 BeatMap::BeatMap(const BeatMap& other)
@@ -207,16 +306,21 @@ BeatsPointer BeatMap::makeBeatMap(
     double nominalBpm = 0.0;
     BeatList beatList;
 
-    track::io::BeatMap map;
-    if (map.ParseFromArray(byteArray.constData(), byteArray.size())) {
-        for (int i = 0; i < map.beat_size(); ++i) {
-            const Beat& beat = map.beat(i);
-            beatList.append(beat);
-        }
+    if (parseFlatByteArray(byteArray, &beatList)) {
         nominalBpm = calculateNominalBpm(beatList, sampleRate);
     } else {
-        qDebug() << "ERROR: Could not parse BeatMap from QByteArray of size"
-                 << byteArray.size();
+        // Not a flat blob, fall back to the legacy protobuf representation.
+        track::io::BeatMap map;
+        if (map.ParseFromArray(byteArray.constData(), byteArray.size())) {
+            for (int i = 0; i < map.beat_size(); ++i) {
+                const Beat& beat = map.beat(i);
+                beatList.append(beat);
+            }
+            nominalBpm = calculateNominalBpm(beatList, sampleRate);
+        } else {
+            qDebug() << "ERROR: Could not parse BeatMap from QByteArray of size"
+                     << byteArray.size();
+        }
     }
     return BeatsPointer(new BeatMap(sampleRate, subVersion, beatList, nominalBpm));
 }
@@ -248,21 +352,11 @@ BeatsPointer BeatMap::makeBeatMap(
 }
 
 QByteArray BeatMap::toByteArray() const {
-    // No guarantees BeatLists are made of a data type which located adjacent
-    // items in adjacent memory locations.
-    mixxx::track::io::BeatMap map;
-
-    for (int i = 0; i < m_beats.size(); ++i) {
-        map.add_beat()->CopyFrom(m_beats[i]);
-    }
-
-    std::string output;
-    map.SerializeToString(&output);
-    return QByteArray(output.data(), static_cast<int>(output.length()));
+    return beatListToFlatByteArray(m_beats);
 }
 
 QString BeatMap::getVersion() const {
-    return BEAT_MAP_VERSION;
+    return BEAT_MAP_2_VERSION;
 }
 
 QString BeatMap::getSubVersion() const {
@@ -298,36 +392,36 @@ double BeatMap::findClosestBeat(double dSamples) const {
 }
 
 double BeatMap::findNthBeat(double dSamples, int n) const {
-    if (!isValid() || n == 0) {
+    if (!isValid() || n == 0 || m_enabledBeatFrames.empty()) {
         return -1;
     }
 
-    Beat beat;
     // Reduce sample offset to a frame offset.
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dSamples)));
+    const double beatFrame = samplesToFrames(dSamples);
+    const auto beatsBegin = m_enabledBeatFrames.begin();
+    const auto beatsEnd = m_enabledBeatFrames.end();
 
-    // it points at the first occurrence of beat or the next largest beat
-    BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
+    // it points at the first occurrence of beatFrame or the next largest beat
+    auto it = std::lower_bound(beatsBegin, beatsEnd, beatFrame);
 
     // If the position is within 1/10th of a second of the next or previous
     // beat, pretend we are on that beat.
     const double kFrameEpsilon = 0.1 * m_sampleRate;
 
     // Back-up by one.
-    if (it != m_beats.begin()) {
+    if (it != beatsBegin) {
         --it;
     }
 
     // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
-        qint32 delta = it->frame_position() - beat.frame_position();
+    auto on_beat = beatsEnd;
+    auto previous_beat = beatsEnd;
+    auto next_beat = beatsEnd;
+    for (; it != beatsEnd; ++it) {
+        const double delta = *it - beatFrame;
 
         // We are "on" this beat.
-        if (abs(delta) < kFrameEpsilon) {
+        if (fabs(delta) < kFrameEpsilon) {
             on_beat = it;
             break;
         }
@@ -347,36 +441,20 @@ double BeatMap::findNthBeat(double dSamples, int n) const {
 
     // If we are within epsilon samples of a beat then the immediately next and
     // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
+    if (on_beat != beatsEnd) {
         next_beat = on_beat;
         previous_beat = on_beat;
     }
 
     if (n > 0) {
-        for (; next_beat != m_beats.end(); ++next_beat) {
-            if (!next_beat->enabled()) {
-                continue;
-            }
-            if (n == 1) {
-                // Return a sample offset
-                return framesToSamples(next_beat->frame_position());
-            }
-            --n;
+        if (next_beat != beatsEnd && std::distance(next_beat, beatsEnd) >= n) {
+            // Return a sample offset
+            return framesToSamples(*(next_beat + (n - 1)));
         }
-    } else if (n < 0 && previous_beat != m_beats.end()) {
-        for (; true; --previous_beat) {
-            if (previous_beat->enabled()) {
-                if (n == -1) {
-                    // Return a sample offset
-                    return framesToSamples(previous_beat->frame_position());
-                }
-                ++n;
-            }
-
-            // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
-                break;
-            }
+    } else if (n < 0 && previous_beat != beatsEnd) {
+        if (std::distance(beatsBegin, previous_beat) >= -n - 1) {
+            // Return a sample offset
+            return framesToSamples(*(previous_beat + (n + 1)));
         }
     }
     return -1;
@@ -392,32 +470,38 @@ bool BeatMap::findPrevNextBeats(double dSamples,
         return false;
     }
 
-    Beat beat;
+    if (m_enabledBeatFrames.empty()) {
+        *dpPrevBeatSamples = -1;
+        *dpNextBeatSamples = -1;
+        return false;
+    }
+
     // Reduce sample offset to a frame offset.
-    beat.set_frame_position(static_cast<google::protobuf::int32>(samplesToFrames(dSamples)));
+    const double beatFrame = samplesToFrames(dSamples);
+    const auto beatsBegin = m_enabledBeatFrames.begin();
+    const auto beatsEnd = m_enabledBeatFrames.end();
 
-    // it points at the first occurrence of beat or the next largest beat
-    BeatList::const_iterator it =
-            std::lower_bound(m_beats.constBegin(), m_beats.constEnd(), beat, BeatLessThan);
+    // it points at the first occurrence of beatFrame or the next largest beat
+    auto it = std::lower_bound(beatsBegin, beatsEnd, beatFrame);
 
     // If the position is within 1/10th of a second of the next or previous
     // beat, pretend we are on that beat.
     const double kFrameEpsilon = 0.1 * m_sampleRate;
 
     // Back-up by one.
-    if (it != m_beats.begin()) {
+    if (it != beatsBegin) {
         --it;
     }
 
     // Scan forward to find whether we are on a beat.
-    BeatList::const_iterator on_beat = m_beats.constEnd();
-    BeatList::const_iterator previous_beat = m_beats.constEnd();
-    BeatList::const_iterator next_beat = m_beats.constEnd();
-    for (; it != m_beats.end(); ++it) {
-        qint32 delta = it->frame_position() - beat.frame_position();
+    auto on_beat = beatsEnd;
+    auto previous_beat = beatsEnd;
+    auto next_beat = beatsEnd;
+    for (; it != beatsEnd; ++it) {
+        const double delta = *it - beatFrame;
 
         if ((!snapToNearBeats && (delta == 0)) ||
-                (snapToNearBeats && (abs(delta) < kFrameEpsilon))) {
+                (snapToNearBeats && (fabs(delta) < kFrameEpsilon))) {
             // We are "on" this beat.
             on_beat = it;
             break;
@@ -438,7 +522,7 @@ bool BeatMap::findPrevNextBeats(double dSamples,
 
     // If we are within epsilon samples of a beat then the immediately next and
     // previous beats are the beat we are on.
-    if (on_beat != m_beats.end()) {
+    if (on_beat != beatsEnd) {
         previous_beat = on_beat;
         next_beat = on_beat + 1;
     }
@@ -446,25 +530,11 @@ bool BeatMap::findPrevNextBeats(double dSamples,
     *dpPrevBeatSamples = -1;
     *dpNextBeatSamples = -1;
 
-    for (; next_beat != m_beats.end(); ++next_beat) {
-        if (!next_beat->enabled()) {
-            continue;
-        }
-        *dpNextBeatSamples = framesToSamples(next_beat->frame_position());
-        break;
+    if (next_beat != beatsEnd) {
+        *dpNextBeatSamples = framesToSamples(*next_beat);
     }
-    if (previous_beat != m_beats.end()) {
-        for (; true; --previous_beat) {
-            if (previous_beat->enabled()) {
-                *dpPrevBeatSamples = framesToSamples(previous_beat->frame_position());
-                break;
-            }
-
-            // Don't step before the start of the list.
-            if (previous_beat == m_beats.begin()) {
-                break;
-            }
-        }
+    if (previous_beat != beatsEnd) {
+        *dpPrevBeatSamples = framesToSamples(*previous_beat);
     }
     return *dpPrevBeatSamples != -1 && *dpNextBeatSamples != -1;
 }
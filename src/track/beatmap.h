@@ -7,10 +7,16 @@
 
 #pragma once
 
+#include <vector>
+
 #include "proto/beats.pb.h"
 #include "track/beats.h"
 
+// Serialized as a protobuf track::io::BeatMap message.
 #define BEAT_MAP_VERSION "BeatMap-1.0"
+// Serialized in the flat binary format: a fixed header followed by a
+// contiguous array of beat frame positions and one flag byte per beat.
+#define BEAT_MAP_2_VERSION "BeatMap-2.0"
 
 class Track;
 
@@ -88,6 +94,11 @@ class BeatMap final : public Beats {
     const audio::SampleRate m_sampleRate;
     const double m_nominalBpm;
     const BeatList m_beats;
+    // Frame positions of the enabled beats from m_beats as a flat,
+    // sorted array. Built once at construction and used by the beat
+    // queries that run on every engine callback, which would otherwise
+    // chase the QList/protobuf indirection of m_beats.
+    const std::vector<double> m_enabledBeatFrames;
 };
 
 } // namespace mixxx
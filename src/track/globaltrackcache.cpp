@@ -7,6 +7,7 @@
 #include "util/assert.h"
 #include "util/logger.h"
 #include "util/thread_affinity.h"
+#include "waveform/waveform.h"
 
 namespace {
 
@@ -62,6 +63,25 @@ TrackRef validateAndCanonicalizeRequestedTrackRef(
     }
 }
 
+// Rough lower bound of the resident memory of a single cached Track
+// object. The waveform data dominates by far, followed by the overview
+// waveform and the cue list. String metadata is not accounted for.
+std::size_t estimateTrackMemoryUsage(const Track& track) {
+    std::size_t memoryUsage = sizeof(Track);
+    const ConstWaveformPointer pWaveform = track.getWaveform();
+    if (pWaveform) {
+        memoryUsage += sizeof(Waveform) +
+                pWaveform->getTextureSize() * sizeof(WaveformData);
+    }
+    const ConstWaveformPointer pWaveformSummary = track.getWaveformSummary();
+    if (pWaveformSummary) {
+        memoryUsage += sizeof(Waveform) +
+                pWaveformSummary->getTextureSize() * sizeof(WaveformData);
+    }
+    memoryUsage += track.getCuePoints().size() * sizeof(Cue);
+    return memoryUsage;
+}
+
 class EvictAndSaveFunctor {
   public:
     explicit EvictAndSaveFunctor(
@@ -130,7 +150,9 @@ void GlobalTrackCacheLocker::unlockCache() {
                     << "#tracksById ="
                     << m_pInstance->m_tracksById.size()
                     << "/ #tracksByCanonicalLocation ="
-                    << m_pInstance->m_tracksByCanonicalLocation.size();
+                    << m_pInstance->m_tracksByCanonicalLocation.size()
+                    << "/ estimated memory usage [B] ="
+                    << m_pInstance->estimateCachedTrackMemoryUsage();
         }
         m_pInstance->m_mutex.unlock();
         if (traceLogEnabled()) {
@@ -178,6 +200,11 @@ QSet<TrackId> GlobalTrackCacheLocker::getCachedTrackIds() const {
     return m_pInstance->getCachedTrackIds();
 }
 
+std::size_t GlobalTrackCacheLocker::estimateCachedTrackMemoryUsage() const {
+    DEBUG_ASSERT(m_pInstance);
+    return m_pInstance->estimateCachedTrackMemoryUsage();
+}
+
 GlobalTrackCacheResolver::GlobalTrackCacheResolver(
         mixxx::FileAccess fileAccess)
         : m_lookupResult(GlobalTrackCacheLookupResult::None) {
@@ -523,6 +550,30 @@ QSet<TrackId> GlobalTrackCache::getCachedTrackIds() const {
     return trackIds;
 }
 
+std::size_t GlobalTrackCache::estimateCachedTrackMemoryUsage() const {
+    // Tracks are indexed by canonical location and only additionally
+    // by id, but transiently an entry might exist in a single index
+    // only. Deduplicate by the plain pointer to count each cached
+    // track once.
+    QSet<const Track*> countedTracks;
+    std::size_t memoryUsage = 0;
+    for (const auto& entry : m_tracksByCanonicalLocation) {
+        const Track* plainPtr = entry.second->getPlainPtr();
+        if (!countedTracks.contains(plainPtr)) {
+            countedTracks.insert(plainPtr);
+            memoryUsage += estimateTrackMemoryUsage(*plainPtr);
+        }
+    }
+    for (const auto& entry : m_tracksById) {
+        const Track* plainPtr = entry.second->getPlainPtr();
+        if (!countedTracks.contains(plainPtr)) {
+            countedTracks.insert(plainPtr);
+            memoryUsage += estimateTrackMemoryUsage(*plainPtr);
+        }
+    }
+    return memoryUsage;
+}
+
 TrackPointer GlobalTrackCache::revive(
         GlobalTrackCacheEntryPointer entryPtr) {
 
@@ -116,6 +116,12 @@ public:
             const TrackRef& trackRef) const;
     QSet<TrackId> getCachedTrackIds() const;
 
+    // Estimates the resident memory of all cached Track objects
+    // including their waveform data and cue lists. Only a rough
+    // lower bound for introspection and debugging, obtained by
+    // iterating over all cached tracks.
+    std::size_t estimateCachedTrackMemoryUsage() const;
+
   private:
     friend class GlobalTrackCache;
 
@@ -252,6 +258,8 @@ class GlobalTrackCache : public QObject {
 
     QSet<TrackId> getCachedTrackIds() const;
 
+    std::size_t estimateCachedTrackMemoryUsage() const;
+
     TrackPointer revive(GlobalTrackCacheEntryPointer entryPtr);
 
     void resolve(
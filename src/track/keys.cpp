@@ -43,6 +43,17 @@ QString Keys::getGlobalKeyText() const {
     return QString::fromStdString(m_keyMap.global_key_text());
 }
 
+KeyChangeList Keys::getKeyChanges() const {
+    KeyChangeList keyChanges;
+    keyChanges.reserve(m_keyMap.key_change_size());
+    for (int i = 0; i < m_keyMap.key_change_size(); ++i) {
+        const KeyMap::KeyChange& change = m_keyMap.key_change(i);
+        keyChanges.push_back(qMakePair(
+                change.key(), static_cast<double>(change.frame_position())));
+    }
+    return keyChanges;
+}
+
 bool Keys::readByteArray(const QByteArray& byteArray) {
     if (!m_keyMap.ParseFromArray(byteArray.constData(), byteArray.size())) {
         qDebug() << "ERROR: Could not parse Keys from QByteArray of size"
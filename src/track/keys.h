@@ -41,6 +41,10 @@ class Keys final {
     mixxx::track::io::key::ChromaticKey getGlobalKey() const;
     QString getGlobalKeyText() const;
 
+    // Return the stored key changes with their frame positions. Empty for
+    // keys that only carry a global key (e.g. imported from metadata).
+    KeyChangeList getKeyChanges() const;
+
   private:
     explicit Keys(const mixxx::track::io::key::KeyMap& m_keyMap);
 
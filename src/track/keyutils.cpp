@@ -4,6 +4,8 @@
 #include <QPair>
 #include <QRegExp>
 
+#include <array>
+
 #include "track/keyutils.h"
 #include "util/math.h"
 
@@ -13,6 +15,9 @@
 using mixxx::track::io::key::ChromaticKey;
 using mixxx::track::io::key::ChromaticKey_IsValid;
 
+// Number of entries in the ChromaticKey enum, including INVALID.
+static constexpr int kNumKeys = mixxx::track::io::key::B_MINOR + 1;
+
 // OpenKey notation, the numbers 1-12 followed by d (dur, major) or m (moll, minor).
 static const QString s_openKeyPattern("^\\s*(1[0-2]|[1-9])([dm])\\s*$");
 
@@ -194,6 +199,38 @@ void KeyUtils::setNotation(const QMap<ChromaticKey, QString>& notation) {
     }
 }
 
+// Formats a key for a fixed (non-custom) notation. Only used to populate
+// the cache in KeyUtils::keyToString(); all repeated lookups are served
+// from the cached strings.
+static QString formatKeyString(ChromaticKey key,
+        KeyUtils::KeyNotation notation) {
+    using KeyNotation = KeyUtils::KeyNotation;
+    if (notation == KeyNotation::OpenKey) {
+        bool major = KeyUtils::keyIsMajor(key);
+        int number = KeyUtils::keyToOpenKeyNumber(key);
+        return QString::number(number) + (major ? "d" : "m");
+    } else if (notation == KeyNotation::OpenKeyAndTraditional) {
+        bool major = KeyUtils::keyIsMajor(key);
+        int number = KeyUtils::keyToOpenKeyNumber(key);
+        QString trad = s_traditionalKeyNames[static_cast<int>(key)];
+        return QString::number(number) + (major ? "d" : "m") + " (" + trad + ")";
+    } else if (notation == KeyNotation::Lancelot) {
+        bool major = KeyUtils::keyIsMajor(key);
+        int number = openKeyNumberToLancelotNumber(
+                KeyUtils::keyToOpenKeyNumber(key));
+        return QString::number(number) + (major ? "B" : "A");
+    } else if (notation == KeyNotation::LancelotAndTraditional) {
+        bool major = KeyUtils::keyIsMajor(key);
+        int number = openKeyNumberToLancelotNumber(
+                KeyUtils::keyToOpenKeyNumber(key));
+        QString trad = s_traditionalKeyNames[static_cast<int>(key)];
+        return QString::number(number) + (major ? "B" : "A") + " (" + trad + ")";
+    } else if (notation == KeyNotation::Traditional) {
+        return s_traditionalKeyNames[static_cast<int>(key)];
+    }
+    return KeyUtils::keyDebugName(key);
+}
+
 // static
 QString KeyUtils::keyToString(ChromaticKey key,
                               KeyNotation notation) {
@@ -211,26 +248,31 @@ QString KeyUtils::keyToString(ChromaticKey key,
         if (it != s_notation.constEnd()) {
             return it.value();
         }
-    } else if (notation == KeyNotation::OpenKey) {
-        bool major = keyIsMajor(key);
-        int number = keyToOpenKeyNumber(key);
-        return QString::number(number) + (major ? "d" : "m");
-    } else if (notation == KeyNotation::OpenKeyAndTraditional) {
-        bool major = keyIsMajor(key);
-        int number = keyToOpenKeyNumber(key);
-        QString trad = s_traditionalKeyNames[static_cast<int>(key)];
-        return QString::number(number) + (major ? "d" : "m") + " (" + trad + ")";
-    } else if (notation == KeyNotation::Lancelot) {
-        bool major = keyIsMajor(key);
-        int number = openKeyNumberToLancelotNumber(keyToOpenKeyNumber(key));
-        return QString::number(number) + (major ? "B" : "A");
-    } else if (notation == KeyNotation::LancelotAndTraditional) {
-        bool major = keyIsMajor(key);
-        int number = openKeyNumberToLancelotNumber(keyToOpenKeyNumber(key));
-        QString trad = s_traditionalKeyNames[static_cast<int>(key)];
-        return QString::number(number) + (major ? "B" : "A") + " (" + trad + ")";
-    } else if (notation == KeyNotation::Traditional) {
-        return s_traditionalKeyNames[static_cast<int>(key)];
+    } else if (notation > KeyNotation::Custom &&
+            notation < KeyNotation::NumKeyNotations) {
+        // All other notations are fixed, so the formatted strings can be
+        // cached per (key, notation) pair. The key column delegate calls
+        // this for every painted row, which makes the repeated number and
+        // string concatenation show up in GUI profiles on large views.
+        static const auto s_keyStrings = [] {
+            std::array<std::array<QString, kNumKeys>,
+                    static_cast<size_t>(KeyNotation::NumKeyNotations)>
+                    strings;
+            for (int keyIndex = 1; keyIndex < kNumKeys; ++keyIndex) {
+                for (int notationIndex =
+                                static_cast<int>(KeyNotation::Custom) + 1;
+                        notationIndex <
+                        static_cast<int>(KeyNotation::NumKeyNotations);
+                        ++notationIndex) {
+                    strings[notationIndex][keyIndex] = formatKeyString(
+                            static_cast<ChromaticKey>(keyIndex),
+                            static_cast<KeyNotation>(notationIndex));
+                }
+            }
+            return strings;
+        }();
+        // Copying the cached QString is thread-safe (atomic refcount).
+        return s_keyStrings[static_cast<size_t>(notation)][static_cast<size_t>(key)];
     }
     return keyDebugName(key);
 }
@@ -385,27 +427,36 @@ ChromaticKey KeyUtils::scaleKeySteps(ChromaticKey key, int key_changes) {
         return mixxx::track::io::key::INVALID;
     }
 
-    if (key_changes == 0) {
-        return key;
+    // Reduce to a transposition within one octave.
+    int steps = key_changes % 12;
+    if (steps < 0) {
+        steps += 12;
     }
-
-    // We know the key is in the set of valid values. Save whether or not the
-    // value is major.
-    bool major = keyIsMajor(key);
-
-    // Tonic, 0-indexed.
-    int tonic = keyToTonic(key);
-
-    // Add the key_changes, mod 12.
-    tonic = (tonic + key_changes) % 12;
-
-    // If tonic + key_changes ended up negative, the modulus could have ended up
-    // negative (it's implementation specific). Add 12 until we are positive.
-    while (tonic < 0) {
-        tonic += 12;
+    if (steps == 0) {
+        return key;
     }
 
-    return tonicToKey(tonic, major);
+    // Precomputed transpose table, built once from the tonic arithmetic.
+    // Pitch-shift aware callers transpose on every parameter change, so
+    // repeated calls are served by a plain lookup.
+    static const auto s_transposedKeys = [] {
+        std::array<std::array<ChromaticKey, 12>, kNumKeys> table{};
+        for (int keyIndex = 1; keyIndex < kNumKeys; ++keyIndex) {
+            const auto fromKey = static_cast<ChromaticKey>(keyIndex);
+            // We know the key is in the set of valid values. Save whether
+            // or not the value is major.
+            const bool major = keyIsMajor(fromKey);
+            // Tonic, 0-indexed.
+            const int tonic = keyToTonic(fromKey);
+            for (int stepIndex = 0; stepIndex < 12; ++stepIndex) {
+                // Add the steps, mod 12.
+                table[keyIndex][stepIndex] =
+                        tonicToKey((tonic + stepIndex) % 12, major);
+            }
+        }
+        return table;
+    }();
+    return s_transposedKeys[static_cast<int>(key)][steps];
 }
 
 // static
@@ -527,17 +578,16 @@ int KeyUtils::shortestStepsToCompatibleKey(
     return shortestDistance; // in the range of -2 .. +2
 }
 
-QList<mixxx::track::io::key::ChromaticKey> KeyUtils::getCompatibleKeys(
+// Builds the list of harmonically compatible keys for the given key.
+// Only used to populate the cache in KeyUtils::getCompatibleKeys().
+static QList<mixxx::track::io::key::ChromaticKey> computeCompatibleKeys(
         mixxx::track::io::key::ChromaticKey key) {
     QList<mixxx::track::io::key::ChromaticKey> compatible;
-    if (!ChromaticKey_IsValid(key) || key == mixxx::track::io::key::INVALID) {
-        return compatible;
-    }
 
     int openKeyNumber = KeyUtils::keyToOpenKeyNumber(key);
     // We know the key is in the set of valid values. Save whether or not the
     // value is minor.
-    bool major = keyIsMajor(key);
+    bool major = KeyUtils::keyIsMajor(key);
 
     // The compatible keys of particular key are:
     // * The relative major/minor key.
@@ -554,7 +604,7 @@ QList<mixxx::track::io::key::ChromaticKey> KeyUtils::getCompatibleKeys(
     // The key is compatible with tracks in the same key.
     compatible << key;
 
-    auto relativeKey = openKeyNumberToKey(openKeyNumber, !major);
+    auto relativeKey = KeyUtils::openKeyNumberToKey(openKeyNumber, !major);
     int relativeOpenKeyNumber = KeyUtils::keyToOpenKeyNumber(relativeKey);
 
     // The relative major/minor key is compatible.
@@ -562,17 +612,36 @@ QList<mixxx::track::io::key::ChromaticKey> KeyUtils::getCompatibleKeys(
 
     // The perfect 4th and perfect 5th of BOTH major and minor key are compatible
     // (as explained by Phil Morse: https://youtu.be/9eECvYYAwbg?t=2370)
-    compatible << openKeyNumberToKey(
+    compatible << KeyUtils::openKeyNumberToKey(
             openKeyNumber == 12 ? 1 : openKeyNumber + 1, major);
-    compatible << openKeyNumberToKey(
+    compatible << KeyUtils::openKeyNumberToKey(
             relativeOpenKeyNumber == 12 ? 1 : relativeOpenKeyNumber + 1, !major);
-    compatible << openKeyNumberToKey(
+    compatible << KeyUtils::openKeyNumberToKey(
             openKeyNumber == 1 ? 12 : openKeyNumber - 1, major);
-    compatible << openKeyNumberToKey(
+    compatible << KeyUtils::openKeyNumberToKey(
             relativeOpenKeyNumber == 1 ? 12 : relativeOpenKeyNumber - 1, !major);
     return compatible;
 }
 
+QList<mixxx::track::io::key::ChromaticKey> KeyUtils::getCompatibleKeys(
+        mixxx::track::io::key::ChromaticKey key) {
+    if (!ChromaticKey_IsValid(key) || key == mixxx::track::io::key::INVALID) {
+        return {};
+    }
+    // Key compatibility never changes, so the per-key lists are computed
+    // once and shared. Returning a copy of the cached QList is cheap due
+    // to implicit sharing.
+    static const auto s_compatibleKeys = [] {
+        std::array<QList<mixxx::track::io::key::ChromaticKey>, kNumKeys> table;
+        for (int keyIndex = 1; keyIndex < kNumKeys; ++keyIndex) {
+            table[keyIndex] = computeCompatibleKeys(
+                    static_cast<mixxx::track::io::key::ChromaticKey>(keyIndex));
+        }
+        return table;
+    }();
+    return s_compatibleKeys[static_cast<int>(key)];
+}
+
 int KeyUtils::keyToCircleOfFifthsOrder(mixxx::track::io::key::ChromaticKey key,
                                        KeyNotation notation) {
     if (!ChromaticKey_IsValid(key)) {
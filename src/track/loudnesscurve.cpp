@@ -0,0 +1,35 @@
+#include "track/loudnesscurve.h"
+
+#include "util/math.h"
+
+namespace mixxx {
+
+double LoudnessCurve::averageLufs(double startSeconds, double endSeconds) const {
+    if (!isValid() || endSeconds <= startSeconds) {
+        return -HUGE_VAL;
+    }
+    const int firstIndex = math_max(0,
+            static_cast<int>(std::floor(startSeconds / m_intervalSeconds)));
+    const int lastIndex = math_min(m_lufs.size() - 1,
+            static_cast<int>(std::ceil(endSeconds / m_intervalSeconds)));
+    if (firstIndex > lastIndex) {
+        return -HUGE_VAL;
+    }
+    double energySum = 0.0;
+    int count = 0;
+    for (int i = firstIndex; i <= lastIndex; ++i) {
+        const double lufs = m_lufs.at(i);
+        if (lufs == -HUGE_VAL) {
+            // Silent measurement, no energy contribution.
+            continue;
+        }
+        energySum += std::pow(10.0, lufs / 10.0);
+        ++count;
+    }
+    if (count == 0) {
+        return -HUGE_VAL;
+    }
+    return 10.0 * std::log10(energySum / count);
+}
+
+} // namespace mixxx
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QVector>
+
+namespace mixxx {
+
+// DTO for the short-term loudness curve measured by AnalyzerEbur128.
+//
+// The curve holds one LUFS value per measurement interval, starting at
+// the beginning of the track. It is kept in memory only and is neither
+// persisted in the database nor written into file tags. AutoDJ uses it
+// to plan the gain staging of a transition before the fade starts.
+class LoudnessCurve final {
+  public:
+    LoudnessCurve()
+            : m_intervalSeconds(0.0) {
+    }
+    LoudnessCurve(double intervalSeconds, QVector<double> lufs)
+            : m_intervalSeconds(intervalSeconds),
+              m_lufs(std::move(lufs)) {
+    }
+
+    bool isValid() const {
+        return m_intervalSeconds > 0.0 && !m_lufs.isEmpty();
+    }
+
+    double getIntervalSeconds() const {
+        return m_intervalSeconds;
+    }
+
+    const QVector<double>& getLufs() const {
+        return m_lufs;
+    }
+
+    // Returns the average loudness in LUFS over the given range of track
+    // seconds, or -HUGE_VAL if the range does not overlap the curve.
+    // LUFS values are logarithmic, so the average is taken in the energy
+    // domain.
+    double averageLufs(double startSeconds, double endSeconds) const;
+
+  private:
+    double m_intervalSeconds;
+    QVector<double> m_lufs;
+};
+
+} // namespace mixxx
+
+Q_DECLARE_TYPEINFO(mixxx::LoudnessCurve, Q_MOVABLE_TYPE);
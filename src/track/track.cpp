@@ -187,6 +187,9 @@ void Track::replaceMetadataFromSource(
                     mixxx::track::io::key::FILE_METADATA);
         }
         modified |= keysModified;
+        if (keysModified) {
+            updateSnapshotWhileLocked();
+        }
         const auto newKey = m_record.getGlobalKey();
 
         // Import track color from Serato tags if available
@@ -322,12 +325,27 @@ bool Track::trySetAndLockBeats(mixxx::BeatsPointer pBeats) {
     return trySetBeatsMarkDirtyAndUnlock(&lock, pBeats, true);
 }
 
+void Track::updateSnapshotWhileLocked() {
+    // Publish a new immutable snapshot for lock-free readers. The
+    // pointer swap is atomic, so readers see either the complete old
+    // or the complete new state.
+    std::atomic_store_explicit(
+            &m_pSnapshot,
+            mixxx::TrackSnapshotPointer(
+                    std::make_shared<const mixxx::TrackSnapshot>(
+                            m_pBeats,
+                            m_cuePoints,
+                            m_record.getKeys())),
+            std::memory_order_release);
+}
+
 bool Track::setBeatsWhileLocked(mixxx::BeatsPointer pBeats) {
     if (m_pBeats == pBeats) {
         return false;
     }
     m_pBeats = std::move(pBeats);
     m_record.refMetadata().refTrackInfo().setBpm(getBeatsPointerBpm(m_pBeats));
+    updateSnapshotWhileLocked();
     return true;
 }
 
@@ -365,8 +383,11 @@ bool Track::trySetBeatsMarkDirtyAndUnlock(
 }
 
 mixxx::BeatsPointer Track::getBeats() const {
-    QMutexLocker lock(&m_qMutex);
-    return m_pBeats;
+    // Read from the published snapshot instead of taking m_qMutex so
+    // that the engine thread never contends with GUI or analysis
+    // threads here.
+    const mixxx::TrackSnapshotPointer pSnapshot = getSnapshot();
+    return pSnapshot ? pSnapshot->beats() : mixxx::BeatsPointer();
 }
 
 void Track::afterBeatsAndBpmUpdated(
@@ -758,6 +779,16 @@ void Track::setWaveformSummary(ConstWaveformPointer pWaveform) {
     emit waveformSummaryUpdated();
 }
 
+mixxx::LoudnessCurve Track::getLoudnessCurve() const {
+    QMutexLocker lock(&m_qMutex);
+    return m_loudnessCurve;
+}
+
+void Track::setLoudnessCurve(const mixxx::LoudnessCurve& loudnessCurve) {
+    QMutexLocker lock(&m_qMutex);
+    m_loudnessCurve = loudnessCurve;
+}
+
 void Track::setCuePoint(CuePosition cue) {
     QMutexLocker lock(&m_qMutex);
 
@@ -793,6 +824,7 @@ void Track::setCuePoint(CuePosition cue) {
         m_cuePoints.removeOne(pLoadCue);
     }
 
+    updateSnapshotWhileLocked();
     markDirtyAndUnlock(&lock);
     emit cuesUpdated();
 }
@@ -845,6 +877,7 @@ CuePointer Track::createAndAddCue(
             &Track::slotCueUpdated);
     QMutexLocker lock(&m_qMutex);
     m_cuePoints.push_back(pCue);
+    updateSnapshotWhileLocked();
     markDirtyAndUnlock(&lock);
     emit cuesUpdated();
     return pCue;
@@ -886,6 +919,7 @@ void Track::removeCue(const CuePointer& pCue) {
     if (pCue->getType() == mixxx::CueType::MainCue) {
         m_record.setCuePoint(CuePosition());
     }
+    updateSnapshotWhileLocked();
     markDirtyAndUnlock(&lock);
     emit cuesUpdated();
 }
@@ -907,6 +941,7 @@ void Track::removeCuesOfType(mixxx::CueType type) {
         dirty = true;
     }
     if (dirty) {
+        updateSnapshotWhileLocked();
         markDirtyAndUnlock(&lock);
         emit cuesUpdated();
     }
@@ -1086,6 +1121,7 @@ bool Track::setCuePointsWhileLocked(const QList<CuePointer>& cuePoints) {
             m_record.setCuePoint(CuePosition(pCue->getPosition()));
         }
     }
+    updateSnapshotWhileLocked();
     return true;
 }
 
@@ -1227,6 +1263,7 @@ void Track::setRating (int rating) {
 }
 
 void Track::afterKeysUpdated(QMutexLocker* pLock) {
+    updateSnapshotWhileLocked();
     const auto newKey = m_record.getGlobalKey();
     markDirtyAndUnlock(pLock);
     emitKeysUpdated(newKey);
@@ -1251,8 +1288,9 @@ void Track::resetKeys() {
 }
 
 Keys Track::getKeys() const {
-    QMutexLocker lock(&m_qMutex);
-    return m_record.getKeys();
+    // Lock-free read from the published snapshot, see getBeats().
+    const mixxx::TrackSnapshotPointer pSnapshot = getSnapshot();
+    return pSnapshot ? pSnapshot->keys() : Keys();
 }
 
 void Track::setKey(mixxx::track::io::key::ChromaticKey key,
@@ -11,8 +11,10 @@
 #include "track/beats.h"
 #include "track/cue.h"
 #include "track/cueinfoimporter.h"
+#include "track/loudnesscurve.h"
 #include "track/track_decl.h"
 #include "track/trackrecord.h"
+#include "track/tracksnapshot.h"
 #include "util/fileaccess.h"
 #include "util/memory.h"
 #include "waveform/waveform.h"
@@ -248,6 +250,11 @@ class Track : public QObject {
     ConstWaveformPointer getWaveformSummary() const;
     void setWaveformSummary(ConstWaveformPointer pWaveform);
 
+    /// Short-term loudness curve measured by AnalyzerEbur128. Kept in
+    /// memory only; used by AutoDJ to plan transition gain staging.
+    mixxx::LoudnessCurve getLoudnessCurve() const;
+    void setLoudnessCurve(const mixxx::LoudnessCurve& loudnessCurve);
+
     // Get the track's main cue point
     CuePosition getCuePoint() const;
     // Set the track's main cue point
@@ -268,8 +275,8 @@ class Track : public QObject {
     void removeCue(const CuePointer& pCue);
     void removeCuesOfType(mixxx::CueType);
     QList<CuePointer> getCuePoints() const {
-        // Copying implicitly shared collections is thread-safe
-        return m_cuePoints;
+        const mixxx::TrackSnapshotPointer pSnapshot = getSnapshot();
+        return pSnapshot ? pSnapshot->cuePoints() : QList<CuePointer>();
     }
 
     void setCuePoints(const QList<CuePointer>& cuePoints);
@@ -289,6 +296,14 @@ class Track : public QObject {
 
     bool isDirty();
 
+    /// Returns the most recently published immutable snapshot of beats,
+    /// cue points and keys. Reading the snapshot never takes m_qMutex,
+    /// so the engine thread cannot block on GUI or analysis threads
+    /// that update the track while it is playing.
+    mixxx::TrackSnapshotPointer getSnapshot() const {
+        return std::atomic_load_explicit(&m_pSnapshot, std::memory_order_acquire);
+    }
+
     // Get the track's Beats list
     mixxx::BeatsPointer getBeats() const;
 
@@ -403,6 +418,12 @@ class Track : public QObject {
     void afterBeatsAndBpmUpdated(QMutexLocker* pLock);
     void emitBeatsAndBpmUpdated(mixxx::Bpm newBpm);
 
+    /// Publishes a new immutable snapshot of beats, cue points and keys
+    /// for lock-free readers, see getSnapshot(). Must be called after
+    /// any of these properties changed, while the caller still holds
+    /// the lock.
+    void updateSnapshotWhileLocked();
+
     /// Sets beats and returns a boolean to indicate if BPM/Beats were updated.
     /// Only supposed to be called while the caller guards this a lock.
     bool setBeatsWhileLocked(mixxx::BeatsPointer pBeats);
@@ -490,10 +511,18 @@ class Track : public QObject {
     // Storage for the track's beats
     mixxx::BeatsPointer m_pBeats;
 
+    // Published snapshot of beats, cue points and keys for lock-free
+    // readers. Only written via updateSnapshotWhileLocked() and only
+    // accessed through std::atomic_load/atomic_store.
+    mixxx::TrackSnapshotPointer m_pSnapshot;
+
     //Visual waveform data
     ConstWaveformPointer m_waveform;
     ConstWaveformPointer m_waveformSummary;
 
+    // Transient short-term loudness curve (not persisted)
+    mixxx::LoudnessCurve m_loudnessCurve;
+
     mixxx::BeatsImporterPointer m_pBeatsImporterPending;
     mixxx::CueInfoImporterPointer m_pCueInfoImporterPending;
 
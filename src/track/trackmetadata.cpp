@@ -150,8 +150,8 @@ QString TrackMetadata::reformatYear(const QString& year) {
 }
 
 void TrackMetadata::normalizeBeforeExport() {
-    m_albumInfo.normalizeBeforeExport();
-    m_trackInfo.normalizeBeforeExport();
+    refAlbumInfo().normalizeBeforeExport();
+    refTrackInfo().normalizeBeforeExport();
 }
 
 bool TrackMetadata::anyFileTagsModified(
@@ -166,6 +166,10 @@ bool TrackMetadata::anyFileTagsModified(
 }
 
 bool operator==(const TrackMetadata& lhs, const TrackMetadata& rhs) {
+    if (lhs.m_data.constData() == rhs.m_data.constData()) {
+        // Both operands share the same payload
+        return true;
+    }
     return lhs.getStreamInfo() == rhs.getStreamInfo() &&
             lhs.getAlbumInfo() == rhs.getAlbumInfo() &&
             lhs.getTrackInfo() == rhs.getTrackInfo();
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <QDateTime>
+#include <QSharedData>
+#include <QSharedDataPointer>
 
 #include "audio/streaminfo.h"
 #include "track/albuminfo.h"
@@ -9,20 +11,92 @@
 namespace mixxx {
 
 class TrackMetadata final {
-    // Audio properties
-    //  - read-only
-    //  - stored in file tags
-    //  - adjusted when opening the audio stream (if available)
-    MIXXX_DECL_PROPERTY(audio::StreamInfo, streamInfo, StreamInfo)
-
-    // Track properties
-    //   - read-write
-    //   - stored in file tags
-    MIXXX_DECL_PROPERTY(AlbumInfo, albumInfo, AlbumInfo)
-    MIXXX_DECL_PROPERTY(TrackInfo, trackInfo, TrackInfo)
+    // The QString-heavy properties are stored in an implicitly shared
+    // payload. Snapshots obtained through Track::getMetadata() and
+    // passed around in signal payloads only copy a pointer; the payload
+    // is copied lazily upon the first mutation of a shared instance.
+    //
+    // The accessors mirror those declared by MIXXX_DECL_PROPERTY in
+    // util/macros.h, which is unaware of the shared payload. Both the
+    // mutable ref...() and ptr...() accessors detach.
+    class Data : public QSharedData {
+      public:
+        // Audio properties
+        //  - read-only
+        //  - stored in file tags
+        //  - adjusted when opening the audio stream (if available)
+        audio::StreamInfo streamInfo;
+
+        // Track properties
+        //   - read-write
+        //   - stored in file tags
+        AlbumInfo albumInfo;
+        TrackInfo trackInfo;
+    };
+    QSharedDataPointer<Data> m_data;
 
   public:
-    TrackMetadata() = default;
+    void setStreamInfo(audio::StreamInfo streamInfo) {
+        m_data->streamInfo = std::move(streamInfo);
+    }
+    const audio::StreamInfo& getStreamInfo() const {
+        return m_data->streamInfo;
+    }
+    audio::StreamInfo& refStreamInfo() {
+        return m_data->streamInfo;
+    }
+    audio::StreamInfo* ptrStreamInfo() {
+        return &m_data->streamInfo;
+    }
+    const audio::StreamInfo* ptrStreamInfo() const {
+        return &m_data->streamInfo;
+    }
+    QDebug dbgStreamInfo(QDebug dbg) const {
+        return dbg << "streamInfo:" << m_data->streamInfo;
+    }
+
+    void setAlbumInfo(AlbumInfo albumInfo) {
+        m_data->albumInfo = std::move(albumInfo);
+    }
+    const AlbumInfo& getAlbumInfo() const {
+        return m_data->albumInfo;
+    }
+    AlbumInfo& refAlbumInfo() {
+        return m_data->albumInfo;
+    }
+    AlbumInfo* ptrAlbumInfo() {
+        return &m_data->albumInfo;
+    }
+    const AlbumInfo* ptrAlbumInfo() const {
+        return &m_data->albumInfo;
+    }
+    QDebug dbgAlbumInfo(QDebug dbg) const {
+        return dbg << "albumInfo:" << m_data->albumInfo;
+    }
+
+    void setTrackInfo(TrackInfo trackInfo) {
+        m_data->trackInfo = std::move(trackInfo);
+    }
+    const TrackInfo& getTrackInfo() const {
+        return m_data->trackInfo;
+    }
+    TrackInfo& refTrackInfo() {
+        return m_data->trackInfo;
+    }
+    TrackInfo* ptrTrackInfo() {
+        return &m_data->trackInfo;
+    }
+    const TrackInfo* ptrTrackInfo() const {
+        return &m_data->trackInfo;
+    }
+    QDebug dbgTrackInfo(QDebug dbg) const {
+        return dbg << "trackInfo:" << m_data->trackInfo;
+    }
+
+  public:
+    TrackMetadata()
+            : m_data(new Data()) {
+    }
     TrackMetadata(TrackMetadata&&) = default;
     TrackMetadata(const TrackMetadata&) = default;
     /*non-virtual*/ ~TrackMetadata() = default;
@@ -76,6 +150,9 @@ class TrackMetadata final {
     static QString formatCalendarYear(const QString& year, bool* pValid = nullptr);
 
     static QString reformatYear(const QString& year);
+
+  private:
+    friend bool operator==(const TrackMetadata& lhs, const TrackMetadata& rhs);
 };
 
 bool operator==(const TrackMetadata& lhs, const TrackMetadata& rhs);
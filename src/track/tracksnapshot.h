@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+
+#include <QList>
+
+#include "track/beats.h"
+#include "track/cue.h"
+#include "track/keys.h"
+
+namespace mixxx {
+
+/// Immutable snapshot of the track properties that are read on the
+/// engine thread while a track is playing.
+///
+/// A Track publishes a new snapshot whenever beats, cue points or keys
+/// change (see Track::updateSnapshotWhileLocked()). Readers obtain the
+/// snapshot through an atomic shared_ptr load and therefore never take
+/// the track's mutex, which GUI and analysis threads hold while
+/// updating the track.
+class TrackSnapshot final {
+  public:
+    TrackSnapshot() = default;
+    TrackSnapshot(
+            BeatsPointer pBeats,
+            QList<CuePointer> cuePoints,
+            Keys keys)
+            : m_pBeats(std::move(pBeats)),
+              m_cuePoints(std::move(cuePoints)),
+              m_keys(std::move(keys)) {
+    }
+
+    const BeatsPointer& beats() const {
+        return m_pBeats;
+    }
+    const QList<CuePointer>& cuePoints() const {
+        return m_cuePoints;
+    }
+    const Keys& keys() const {
+        return m_keys;
+    }
+
+  private:
+    BeatsPointer m_pBeats;
+    QList<CuePointer> m_cuePoints;
+    Keys m_keys;
+};
+
+typedef std::shared_ptr<const TrackSnapshot> TrackSnapshotPointer;
+
+} // namespace mixxx
@@ -25,7 +25,9 @@ Battery::Battery(QObject* parent)
           m_iMinutesLeft(0),
           m_timer(this) {
     connect(&m_timer, &GuiTickTimer::timeout, this, &Battery::update);
-    m_timer.start(mixxx::Duration::fromMillis(kiUpdateInterval));
+    // Battery polling can wait out a busy GUI without the user noticing.
+    m_timer.start(mixxx::Duration::fromMillis(kiUpdateInterval),
+            GuiTickTimer::Priority::Low);
 }
 
 Battery* Battery::getBattery(QObject* parent) {
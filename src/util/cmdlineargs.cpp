@@ -18,6 +18,7 @@
 
 CmdlineArgs::CmdlineArgs()
         : m_startInFullscreen(false), // Initialize vars
+          m_headless(false),
           m_midiDebug(false),
           m_developer(false),
           m_safeMode(false),
@@ -79,6 +80,14 @@ bool CmdlineArgs::parse(const QStringList& arguments) {
             QCoreApplication::translate("main", "Starts Mixxx in full-screen mode"));
     parser.addOption(fullscreen);
 
+    const QCommandLineOption headless(QStringLiteral("headless"),
+            QCoreApplication::translate("main",
+                    "Runs the audio engine, library and controllers without "
+                    "any UI, e.g. for unattended AutoDJ streaming. Combine "
+                    "with '-platform offscreen' to run without a display "
+                    "server."));
+    parser.addOption(headless);
+
     const QCommandLineOption locale(QStringLiteral("locale"),
             QCoreApplication::translate("main",
                     "Use a custom locale for loading translations. (e.g "
@@ -109,6 +118,31 @@ bool CmdlineArgs::parse(const QStringList& arguments) {
             QCoreApplication::translate("main", "Path the timeline is written to"));
     parser.addOption(timelinePath);
 
+    const QCommandLineOption controlRecordPath(QStringLiteral("control-record-path"),
+            QCoreApplication::translate("main",
+                    "Record all control changes with timestamps into the "
+                    "given file for a later deterministic replay with "
+                    "--control-replay-path."),
+            QStringLiteral("controlRecordPath"));
+    parser.addOption(controlRecordPath);
+
+    const QCommandLineOption controlReplayPath(QStringLiteral("control-replay-path"),
+            QCoreApplication::translate("main",
+                    "Replay the control changes recorded with "
+                    "--control-record-path at their recorded times, e.g. to "
+                    "compare engine timing of the same performance between "
+                    "builds."),
+            QStringLiteral("controlReplayPath"));
+    parser.addOption(controlReplayPath);
+
+    const QCommandLineOption oscPort(QStringLiteral("osc-port"),
+            QCoreApplication::translate("main",
+                    "Listen on the given UDP port for OSC messages and "
+                    "apply them to the controls, e.g. /Channel1/play sets "
+                    "[Channel1],play."),
+            QStringLiteral("oscPort"));
+    parser.addOption(oscPort);
+
     const QCommandLineOption controllerDebug(QStringList() << "controller-debug"
                                                            << "controllerDebug"
                                                            << "midi-debug"
@@ -194,6 +228,7 @@ bool CmdlineArgs::parse(const QStringList& arguments) {
     }
 
     m_startInFullscreen = parser.isSet(fullscreen);
+    m_headless = parser.isSet(headless);
 
     if (parser.isSet(locale)) {
         m_locale = parser.value(locale);
@@ -211,6 +246,24 @@ bool CmdlineArgs::parse(const QStringList& arguments) {
         m_resourcePath = parser.value(resourcePath);
     }
 
+    if (parser.isSet(controlRecordPath)) {
+        m_controlRecordPath = parser.value(controlRecordPath);
+    }
+
+    if (parser.isSet(controlReplayPath)) {
+        m_controlReplayPath = parser.value(controlReplayPath);
+    }
+
+    if (parser.isSet(oscPort)) {
+        bool ok = false;
+        const int port = parser.value(oscPort).toInt(&ok);
+        if (ok && port > 0 && port <= 65535) {
+            m_oscPort = port;
+        } else {
+            fputs("--osc-port must be a port number between 1 and 65535\n", stdout);
+        }
+    }
+
     m_midiDebug = parser.isSet(controllerDebug);
     m_developer = parser.isSet(developer);
     m_safeMode = parser.isSet(safeMode);
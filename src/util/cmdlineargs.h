@@ -25,6 +25,7 @@ class CmdlineArgs final {
 
     const QList<QString>& getMusicFiles() const { return m_musicFiles; }
     bool getStartInFullscreen() const { return m_startInFullscreen; }
+    bool getHeadless() const { return m_headless; }
     bool getMidiDebug() const { return m_midiDebug; }
     bool getDeveloper() const { return m_developer; }
     bool getSafeMode() const { return m_safeMode; }
@@ -43,10 +44,14 @@ class CmdlineArgs final {
     }
     const QString& getResourcePath() const { return m_resourcePath; }
     const QString& getTimelinePath() const { return m_timelinePath; }
+    const QString& getControlRecordPath() const { return m_controlRecordPath; }
+    const QString& getControlReplayPath() const { return m_controlReplayPath; }
+    int getOscPort() const { return m_oscPort; }
 
   private:
     QList<QString> m_musicFiles;    // List of files to load into players at startup
     bool m_startInFullscreen;       // Start in fullscreen mode
+    bool m_headless; // Run the engine and library without any UI
     bool m_midiDebug;
     bool m_developer; // Developer Mode
     bool m_safeMode;
@@ -59,4 +64,7 @@ class CmdlineArgs final {
     QString m_settingsPath;
     QString m_resourcePath;
     QString m_timelinePath;
+    QString m_controlRecordPath; // Log of control changes for deterministic replay
+    QString m_controlReplayPath;
+    int m_oscPort = 0; // UDP port for remote control via OSC, 0 = disabled
 };
@@ -303,6 +303,27 @@ bool initDatabase(const QSqlDatabase& database, mixxx::StringCollator* pCollator
                 << "Failed to install custom 3-arg LIKE function for SQLite3:"
                 << result;
     }
+
+    // Switch the connection to write-ahead logging so writer transactions
+    // (library scanner, AutoDJ history) no longer block concurrent readers
+    // (GUI search queries). The journal mode is a property of the database
+    // file, so the first connection performs the actual switch and all
+    // subsequently pooled connections simply inherit it. In-memory
+    // databases (unit tests) ignore the request and keep their default
+    // mode. With WAL, synchronous=NORMAL is the recommended durability
+    // level: commits no longer fsync, only checkpoints do; see
+    // DbWalCheckpointer for the checkpoint scheduling.
+    result = sqlite3_exec(handle,
+            "PRAGMA journal_mode=WAL;"
+            "PRAGMA synchronous=NORMAL;",
+            nullptr,
+            nullptr,
+            nullptr);
+    VERIFY_OR_DEBUG_ASSERT(result == SQLITE_OK) {
+        kLogger.warning()
+                << "Failed to enable WAL journal mode for SQLite3:"
+                << result;
+    }
 #else
     Q_UNUSED(database);
     Q_UNUSED(pCollator);
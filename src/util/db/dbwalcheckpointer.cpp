@@ -0,0 +1,93 @@
+#include "util/db/dbwalcheckpointer.h"
+
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "moc_dbwalcheckpointer.cpp"
+#include "util/db/dbconnectionpooled.h"
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("DbWalCheckpointer");
+
+// How often to attempt a passive checkpoint. Checkpoints are cheap no-ops
+// while nothing has been written, so the interval mainly bounds how long
+// committed pages linger in the log before readers stop paying the extra
+// WAL lookup for them.
+constexpr int kCheckpointIntervalMillis = 60 * 1000;
+
+// Truncate the log once it holds more frames than this and all of them
+// could be checkpointed. 1000 frames matches SQLite's own default
+// auto-checkpoint threshold (~4 MiB at 4 KiB pages).
+constexpr int kTruncateWalFrames = 1000;
+
+} // anonymous namespace
+
+DbWalCheckpointer::DbWalCheckpointer(
+        DbConnectionPoolPtr pDbConnectionPool,
+        QObject* parent)
+        : QObject(parent),
+          m_pDbConnectionPool(std::move(pDbConnectionPool)) {
+    connect(&m_checkpointTimer,
+            &QTimer::timeout,
+            this,
+            &DbWalCheckpointer::slotCheckpoint);
+    m_checkpointTimer.start(kCheckpointIntervalMillis);
+}
+
+void DbWalCheckpointer::slotCheckpoint() {
+    const QSqlDatabase database = DbConnectionPooled(m_pDbConnectionPool);
+    if (!database.isOpen()) {
+        return;
+    }
+
+    // Returns one row: busy (1 if the checkpoint could not run or finish
+    // due to concurrent activity), the number of frames in the log, and
+    // the number of frames checkpointed.
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral("PRAGMA wal_checkpoint(PASSIVE)")) ||
+            !query.next()) {
+        kLogger.warning()
+                << "Passive WAL checkpoint failed"
+                << query.lastError();
+        return;
+    }
+    const int busy = query.value(0).toInt();
+    const int logFrames = query.value(1).toInt();
+    const int checkpointedFrames = query.value(2).toInt();
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Passive WAL checkpoint:"
+                << "busy" << busy
+                << "log" << logFrames
+                << "checkpointed" << checkpointedFrames;
+    }
+    if (busy != 0 || checkpointedFrames < logFrames) {
+        // Concurrent readers or writers are using the log. Don't get in
+        // their way; the next tick will pick up where this one stopped.
+        return;
+    }
+    if (logFrames < kTruncateWalFrames) {
+        return;
+    }
+
+    // The database is quiet and the log has grown large, typically right
+    // after a library scan. Truncate it so readers stop scanning a long
+    // WAL index for every lookup.
+    QSqlQuery truncateQuery(database);
+    if (!truncateQuery.exec(QStringLiteral("PRAGMA wal_checkpoint(TRUNCATE)"))) {
+        kLogger.warning()
+                << "Truncating WAL checkpoint failed"
+                << truncateQuery.lastError();
+        return;
+    }
+    kLogger.info()
+            << "Truncated write-ahead log after"
+            << logFrames
+            << "frames";
+}
+
+} // namespace mixxx
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+
+#include "util/db/dbconnectionpool.h"
+
+namespace mixxx {
+
+/// Periodically checkpoints the write-ahead log of the pooled SQLite
+/// database (see the WAL setup in DbConnection).
+///
+/// Passive checkpoints by design never block readers or writers; they
+/// simply transfer whatever WAL frames are not in use back into the
+/// database file. When the log could be fully checkpointed and has grown
+/// large, i.e. the database has gone quiet after a write burst like a
+/// library scan, the log file itself is truncated. If concurrent activity
+/// prevented the checkpoint from completing we just try again on the next
+/// tick instead of stalling anyone.
+///
+/// Must be created in a thread that holds a pooled database connection
+/// (in practice: the main thread, by CoreServices).
+class DbWalCheckpointer : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit DbWalCheckpointer(
+            DbConnectionPoolPtr pDbConnectionPool,
+            QObject* parent = nullptr);
+    ~DbWalCheckpointer() override = default;
+
+  private slots:
+    void slotCheckpoint();
+
+  private:
+    const DbConnectionPoolPtr m_pDbConnectionPool;
+    QTimer m_checkpointTimer;
+};
+
+} // namespace mixxx
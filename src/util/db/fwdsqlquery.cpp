@@ -2,6 +2,7 @@
 
 #include <QSqlRecord>
 
+#include "util/db/sqlquerylog.h"
 #include "util/performancetimer.h"
 #include "util/logger.h"
 #include "util/assert.h"
@@ -11,6 +12,15 @@ namespace {
 
 const mixxx::Logger kLogger("FwdSqlQuery");
 
+QString boundValuesToString(const QSqlQuery& query) {
+    QStringList formatted;
+    const auto boundValues = query.boundValues();
+    for (auto i = boundValues.constBegin(); i != boundValues.constEnd(); ++i) {
+        formatted.append(i.key() + QLatin1Char('=') + i.value().toString());
+    }
+    return formatted.join(QStringLiteral(", "));
+}
+
 bool prepareQuery(QSqlQuery& query, const QString& statement) {
     DEBUG_ASSERT(!query.isActive());
     query.setForwardOnly(true);
@@ -36,6 +46,7 @@ FwdSqlQuery::FwdSqlQuery(
         const QSqlDatabase& database,
         const QString& statement)
         : QSqlQuery(database),
+          m_database(database),
           m_prepared(prepareQuery(*this, statement)) {
     if (!m_prepared) {
         DEBUG_ASSERT(!database.isOpen() || hasError());
@@ -51,7 +62,8 @@ bool FwdSqlQuery::execPrepared() {
     DEBUG_ASSERT(isPrepared());
     DEBUG_ASSERT(!hasError());
     PerformanceTimer timer;
-    if (kLogger.traceEnabled()) {
+    const bool instrumented = mixxx::SqlQueryLog::isEnabled();
+    if (kLogger.traceEnabled() || instrumented) {
         timer.start();
     }
     if (exec()) {
@@ -62,6 +74,13 @@ bool FwdSqlQuery::execPrepared() {
                         timer);
             }
         }
+        if (instrumented) {
+            mixxx::SqlQueryLog::recordQuery(
+                    m_database,
+                    lastQuery(),
+                    boundValuesToString(*this),
+                    timer.elapsed().toIntegerNanos());
+        }
         DEBUG_ASSERT(!hasError());
         // Verify our assumption that the size of the result set
         // is unavailable for forward-only queries. Otherwise we
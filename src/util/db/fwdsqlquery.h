@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QSqlDatabase>
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlRecord>
@@ -106,5 +107,8 @@ class FwdSqlQuery : protected QSqlQuery {
     bool fieldValueBoolean(DbFieldIndex fieldIndex) const;
 
   private:
+    // Keep a handle on the connection for capturing query plans
+    // when instrumentation is enabled (see SqlQueryLog).
+    QSqlDatabase m_database;
     bool m_prepared;
 };
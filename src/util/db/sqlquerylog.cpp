@@ -0,0 +1,135 @@
+#include "util/db/sqlquerylog.h"
+
+#include <QAtomicInt>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSqlQuery>
+#include <QSqlRecord>
+#include <QStringList>
+
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("SqlQueryLog");
+
+// Number of entries kept in the ring buffer before the oldest ones
+// are overwritten.
+constexpr int kRingBufferSize = 256;
+
+// Capturing EXPLAIN QUERY PLAN runs a second statement on the same
+// connection, so only do that for queries that are already slow.
+constexpr double kDefaultPlanCaptureThresholdMillis = 10.0;
+
+QAtomicInt s_enabled(0);
+
+// Guards all of the following state
+QMutex s_mutex;
+QVector<SqlQueryLog::Entry> s_ringBuffer;
+int s_nextIndex = 0;
+double s_planCaptureThresholdMillis = kDefaultPlanCaptureThresholdMillis;
+
+QString capturePlan(
+        const QSqlDatabase& database,
+        const QString& statement) {
+    QSqlQuery planQuery(database);
+    planQuery.setForwardOnly(true);
+    // Unbound parameters are treated as NULL by SQLite, which is
+    // sufficient for plan selection.
+    if (!planQuery.exec(QStringLiteral("EXPLAIN QUERY PLAN ") + statement)) {
+        return QString();
+    }
+    QStringList planLines;
+    while (planQuery.next()) {
+        // The last column ("detail") contains the human readable
+        // description of the plan step.
+        planLines.append(planQuery.value(
+                planQuery.record().count() - 1).toString());
+    }
+    return planLines.join(QStringLiteral("; "));
+}
+
+} // anonymous namespace
+
+void SqlQueryLog::setEnabled(bool enabled) {
+    s_enabled = enabled ? 1 : 0;
+    kLogger.info() << "Query instrumentation"
+                   << (enabled ? "enabled" : "disabled");
+}
+
+bool SqlQueryLog::isEnabled() {
+    return s_enabled.load() != 0;
+}
+
+void SqlQueryLog::setPlanCaptureThresholdMillis(double thresholdMillis) {
+    QMutexLocker locked(&s_mutex);
+    s_planCaptureThresholdMillis = thresholdMillis;
+}
+
+void SqlQueryLog::recordQuery(
+        const QSqlDatabase& database,
+        const QString& statement,
+        const QString& boundValues,
+        qint64 durationNanos) {
+    if (!isEnabled()) {
+        return;
+    }
+    Entry entry;
+    entry.timestamp = QDateTime::currentDateTime();
+    entry.statement = statement;
+    entry.boundValues = boundValues;
+    entry.durationMillis = durationNanos / 1.0e6;
+
+    QMutexLocker locked(&s_mutex);
+    if (entry.durationMillis >= s_planCaptureThresholdMillis) {
+        entry.queryPlan = capturePlan(database, statement);
+    }
+    if (s_ringBuffer.size() < kRingBufferSize) {
+        s_ringBuffer.append(entry);
+        s_nextIndex = s_ringBuffer.size() % kRingBufferSize;
+    } else {
+        s_ringBuffer[s_nextIndex] = entry;
+        s_nextIndex = (s_nextIndex + 1) % kRingBufferSize;
+    }
+}
+
+QVector<SqlQueryLog::Entry> SqlQueryLog::entries() {
+    QMutexLocker locked(&s_mutex);
+    if (s_ringBuffer.size() < kRingBufferSize) {
+        return s_ringBuffer;
+    }
+    // Unroll the ring so the oldest entry comes first
+    QVector<Entry> result;
+    result.reserve(s_ringBuffer.size());
+    for (int i = 0; i < s_ringBuffer.size(); ++i) {
+        result.append(s_ringBuffer.at((s_nextIndex + i) % kRingBufferSize));
+    }
+    return result;
+}
+
+void SqlQueryLog::dump() {
+    const QVector<Entry> bufferedEntries = entries();
+    kLogger.info() << "Dumping" << bufferedEntries.size() << "recorded queries";
+    for (const Entry& entry : bufferedEntries) {
+        kLogger.info()
+                << entry.timestamp.toString(Qt::ISODateWithMs)
+                << QString::number(entry.durationMillis, 'f', 3) + " ms"
+                << entry.statement
+                << (entry.boundValues.isEmpty()
+                                ? QString()
+                                : QStringLiteral("binds: ") + entry.boundValues)
+                << (entry.queryPlan.isEmpty()
+                                ? QString()
+                                : QStringLiteral("plan: ") + entry.queryPlan);
+    }
+}
+
+void SqlQueryLog::clear() {
+    QMutexLocker locked(&s_mutex);
+    s_ringBuffer.clear();
+    s_nextIndex = 0;
+}
+
+} // namespace mixxx
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <QDateTime>
+#include <QSqlDatabase>
+#include <QString>
+#include <QVector>
+
+namespace mixxx {
+
+// Opt-in instrumentation for database queries.
+//
+// When enabled, every query executed through FwdSqlQuery is recorded
+// with its statement text, bound parameters and wall time into a fixed
+// size ring buffer. For queries above a configurable duration threshold
+// the SQLite EXPLAIN QUERY PLAN output is captured as well, which shows
+// whether an index is being missed. The buffer can be dumped from the
+// developer menu while the application is running.
+//
+// Recording is disabled by default and recordQuery() is a cheap no-op
+// then, so the instrumentation can stay compiled in.
+class SqlQueryLog {
+  public:
+    struct Entry {
+        QDateTime timestamp;
+        QString statement;
+        QString boundValues;
+        double durationMillis;
+        // Empty unless the query was above the plan capture threshold
+        QString queryPlan;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // Duration above which the EXPLAIN QUERY PLAN output of a query
+    // is captured along with the timing.
+    static void setPlanCaptureThresholdMillis(double thresholdMillis);
+
+    // Records an executed query. The database connection is needed to
+    // run EXPLAIN QUERY PLAN for slow queries. A no-op while disabled.
+    static void recordQuery(
+            const QSqlDatabase& database,
+            const QString& statement,
+            const QString& boundValues,
+            qint64 durationNanos);
+
+    // Returns a copy of the buffered entries, oldest first.
+    static QVector<Entry> entries();
+
+    // Writes the buffered entries to the log output.
+    static void dump();
+
+    static void clear();
+
+    SqlQueryLog() = delete;
+};
+
+} // namespace mixxx
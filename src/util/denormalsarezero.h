@@ -44,3 +44,61 @@
 #define _MM_GET_DENORMALS_ZERO_MODE()
 
 #endif
+
+namespace mixxx {
+
+// Enables flush-to-zero and denormals-are-zero for the calling thread
+// for the lifetime of the scope and restores the previous modes
+// afterwards. Denormal operands are processed in microcode and can slow
+// floating-point code down by an order of magnitude; decaying filter and
+// reverb tails produce them in abundance. The audio callback sets these
+// modes inline (see SoundDevicePortAudio::callbackProcessClkRef()), but
+// the modes are per-thread, so every other thread that runs DSP code
+// (engine workers, analyzers, sidechain workers) must enter a scope like
+// this at its entry point.
+class DenormalsAreZeroScope final {
+  public:
+#ifdef __SSE__
+    DenormalsAreZeroScope()
+            : m_savedCsr(_mm_getcsr()) {
+        _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+        _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    }
+    ~DenormalsAreZeroScope() {
+        _mm_setcsr(m_savedCsr);
+    }
+#elif defined(aarch64)
+    // Flush-to-zero on aarch64 is controlled by bit 24 of the per-thread
+    // Floating-point Control Register, see
+    // SoundDevicePortAudio::callbackProcessClkRef().
+    DenormalsAreZeroScope() {
+        asm volatile("mrs %[savedFPCR], FPCR"
+                     : [ savedFPCR ] "=r"(m_savedFPCR));
+        asm volatile("msr FPCR, %[src]"
+                     :
+                     : [ src ] "r"(m_savedFPCR | (1 << 24)));
+    }
+    ~DenormalsAreZeroScope() {
+        asm volatile("msr FPCR, %[src]"
+                     :
+                     : [ src ] "r"(m_savedFPCR));
+    }
+#else
+    // No-op on armhf (DAZ is the default) and legacy i386 builds.
+    DenormalsAreZeroScope() {
+    }
+#endif
+
+    DenormalsAreZeroScope(const DenormalsAreZeroScope&) = delete;
+    DenormalsAreZeroScope& operator=(const DenormalsAreZeroScope&) = delete;
+
+#if defined(__SSE__)
+  private:
+    const unsigned int m_savedCsr;
+#elif defined(aarch64)
+  private:
+    int m_savedFPCR;
+#endif
+};
+
+} // namespace mixxx
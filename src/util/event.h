@@ -9,7 +9,8 @@
 class Event {
   public:
     Event()
-            : m_type(Stat::UNSPECIFIED) {
+            : m_type(Stat::UNSPECIFIED),
+              m_threadId(-1) {
     }
 
     typedef Stat::StatType EventType;
@@ -17,6 +18,10 @@ class Event {
     QString m_tag;
     EventType m_type;
     mixxx::Duration m_time;
+    // The recording thread, derived from the per-thread stats pipe the
+    // event arrived through. Used to correlate events on a timeline.
+    int m_threadId;
+    QString m_threadName;
 
     static bool event(const QString& tag, Event::EventType type = Stat::EVENT) {
         return Stat::track(tag, type, Stat::experimentFlags(Stat::COUNT), 0.0);
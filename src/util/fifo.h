@@ -1,38 +1,89 @@
 #pragma once
 
+// Still included for the ring_buffer_size_t typedef that is part of the
+// public FIFO API and used directly by some callers.
 #include "pa_ringbuffer.h"
 
+#include <atomic>
+
 #include "util/class.h"
 #include "util/math.h"
 
+// Single-producer/single-consumer lock-free FIFO.
+//
+// The implementation follows the PaUtilRingBuffer algorithm (power-of-2
+// capacity with free-running indices), but keeps the write and read
+// indices on separate cache lines. In the original layout both indices
+// share one line, so every advance by the producer invalidated the
+// consumer's cached copy and vice versa, which shows up as false sharing
+// on the control pipes between the engine and controller threads.
+//
+// Batched access is supported through the aquire/release region methods:
+// acquire space for N items, fill them in place and commit them with a
+// single index advance instead of per-item write() calls.
 template <class DataType>
 class FIFO {
   public:
     explicit FIFO(int size)
-            : m_data(NULL) {
+            : m_data(nullptr),
+              m_bufferSize(0),
+              m_bigMask(0),
+              m_smallMask(0),
+              m_writeIndex(0),
+              m_readIndex(0) {
         size = roundUpToPowerOf2(size);
         // If we can't represent the next higher power of 2 then bail.
         if (size < 0) {
             return;
         }
         m_data = new DataType[size];
-        PaUtil_InitializeRingBuffer(
-                &m_ringBuffer, sizeof(DataType), size, m_data);
+        m_bufferSize = size;
+        m_bigMask = (size * 2) - 1;
+        m_smallMask = size - 1;
     }
     virtual ~FIFO() {
         delete [] m_data;
     }
     int readAvailable() const {
-        return PaUtil_GetRingBufferReadAvailable(&m_ringBuffer);
+        return (m_writeIndex.load(std::memory_order_acquire) -
+                       m_readIndex.load(std::memory_order_relaxed)) &
+                m_bigMask;
     }
     int writeAvailable() const {
-        return PaUtil_GetRingBufferWriteAvailable(&m_ringBuffer);
+        return m_bufferSize -
+                ((m_writeIndex.load(std::memory_order_relaxed) -
+                         m_readIndex.load(std::memory_order_acquire)) &
+                        m_bigMask);
     }
     int read(DataType* pData, int count) {
-        return PaUtil_ReadRingBuffer(&m_ringBuffer, pData, count);
+        DataType* pData1;
+        DataType* pData2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        count = aquireReadRegions(count, &pData1, &size1, &pData2, &size2);
+        for (ring_buffer_size_t i = 0; i < size1; ++i) {
+            pData[i] = pData1[i];
+        }
+        for (ring_buffer_size_t i = 0; i < size2; ++i) {
+            pData[size1 + i] = pData2[i];
+        }
+        releaseReadRegions(count);
+        return count;
     }
     int write(const DataType* pData, int count) {
-        return PaUtil_WriteRingBuffer(&m_ringBuffer, pData, count);
+        DataType* pData1;
+        DataType* pData2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        count = aquireWriteRegions(count, &pData1, &size1, &pData2, &size2);
+        for (ring_buffer_size_t i = 0; i < size1; ++i) {
+            pData1[i] = pData[i];
+        }
+        for (ring_buffer_size_t i = 0; i < size2; ++i) {
+            pData2[i] = pData[size1 + i];
+        }
+        releaseWriteRegions(count);
+        return count;
     }
     void writeBlocking(const DataType* pData, int count) {
         int written = 0;
@@ -43,28 +94,79 @@ class FIFO {
     int aquireWriteRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferWriteRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const int available = writeAvailable();
+        if (count > available) {
+            count = available;
+        }
+        const ring_buffer_size_t index =
+                m_writeIndex.load(std::memory_order_relaxed) & m_smallMask;
+        if (index + count > m_bufferSize) {
+            const ring_buffer_size_t firstHalf = m_bufferSize - index;
+            *dataPtr1 = m_data + index;
+            *sizePtr1 = firstHalf;
+            *dataPtr2 = m_data;
+            *sizePtr2 = count - firstHalf;
+        } else {
+            *dataPtr1 = m_data + index;
+            *sizePtr1 = count;
+            *dataPtr2 = nullptr;
+            *sizePtr2 = 0;
+        }
+        return count;
     }
     int releaseWriteRegions(int count) {
-        return PaUtil_AdvanceRingBufferWriteIndex(&m_ringBuffer, count);
+        const ring_buffer_size_t writeIndex =
+                (m_writeIndex.load(std::memory_order_relaxed) + count) &
+                m_bigMask;
+        // Publishes the written items to the consumer
+        m_writeIndex.store(writeIndex, std::memory_order_release);
+        return writeIndex;
     }
     int aquireReadRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferReadRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const int available = readAvailable();
+        if (count > available) {
+            count = available;
+        }
+        const ring_buffer_size_t index =
+                m_readIndex.load(std::memory_order_relaxed) & m_smallMask;
+        if (index + count > m_bufferSize) {
+            const ring_buffer_size_t firstHalf = m_bufferSize - index;
+            *dataPtr1 = m_data + index;
+            *sizePtr1 = firstHalf;
+            *dataPtr2 = m_data;
+            *sizePtr2 = count - firstHalf;
+        } else {
+            *dataPtr1 = m_data + index;
+            *sizePtr1 = count;
+            *dataPtr2 = nullptr;
+            *sizePtr2 = 0;
+        }
+        return count;
     }
     int releaseReadRegions(int count) {
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, count);
+        const ring_buffer_size_t readIndex =
+                (m_readIndex.load(std::memory_order_relaxed) + count) &
+                m_bigMask;
+        // Releases the consumed slots back to the producer
+        m_readIndex.store(readIndex, std::memory_order_release);
+        return readIndex;
     }
     int flushReadData(int count) {
         int flush = math_min(readAvailable(), count);
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, flush);
+        return releaseReadRegions(flush);
     }
 
   private:
     DataType* m_data;
-    PaUtilRingBuffer m_ringBuffer;
+    ring_buffer_size_t m_bufferSize;
+    ring_buffer_size_t m_bigMask;
+    ring_buffer_size_t m_smallMask;
+    // Each index is written by only one of the two threads. Keeping them
+    // on separate cache lines prevents false sharing between producer
+    // and consumer.
+    alignas(64) std::atomic<ring_buffer_size_t> m_writeIndex;
+    alignas(64) std::atomic<ring_buffer_size_t> m_readIndex;
     DISALLOW_COPY_AND_ASSIGN(FIFO<DataType>);
 };
@@ -40,6 +40,12 @@ class MessagePipe {
         return true;
     }
 
+    // Returns the number of SenderMessageType messages written by the sender
+    // that the receiver has not yet read. Non-blocking.
+    int sendMessageCount() const {
+        return m_receiver_messages.size();
+    }
+
     // Writes a message to the receiver and returns true on success.
     bool writeMessage(const SenderMessageType& message) {
         return m_receiver_messages.try_push(message);
@@ -0,0 +1,128 @@
+#include "util/rtallocaudit.h"
+
+#ifdef MIXXX_RTALLOC_AUDIT
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef __LINUX__
+#include <execinfo.h>
+#endif
+
+namespace {
+
+// Depth of nested real-time scopes on the current thread. The
+// allocation operators only report violations while this is > 0.
+thread_local int t_realTimeScopeDepth = 0;
+
+// Guards against recursion: reporting a violation may itself
+// allocate (e.g. in backtrace_symbols_fd or stdio).
+thread_local bool t_reportingViolation = false;
+
+std::atomic<int> s_violationCount(0);
+
+constexpr int kMaxBacktraceFrames = 32;
+
+void reportViolation(const char* what, std::size_t size) {
+    t_reportingViolation = true;
+    s_violationCount.fetch_add(1, std::memory_order_relaxed);
+    std::fprintf(stderr,
+            "RTALLOC_AUDIT: %s of %zu bytes on real-time thread\n",
+            what,
+            size);
+#ifdef __LINUX__
+    void* frames[kMaxBacktraceFrames];
+    const int frameCount = backtrace(frames, kMaxBacktraceFrames);
+    backtrace_symbols_fd(frames, frameCount, 2 /*stderr*/);
+#endif
+    t_reportingViolation = false;
+}
+
+inline void auditAllocation(const char* what, std::size_t size) {
+    if ((t_realTimeScopeDepth > 0) && !t_reportingViolation) {
+        reportViolation(what, size);
+    }
+}
+
+} // anonymous namespace
+
+namespace mixxx {
+
+RtAllocAuditScope::RtAllocAuditScope() {
+    ++t_realTimeScopeDepth;
+}
+
+RtAllocAuditScope::~RtAllocAuditScope() {
+    --t_realTimeScopeDepth;
+}
+
+// static
+int RtAllocAuditScope::violationCount() {
+    return s_violationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace mixxx
+
+// Replace the global allocation operators with auditing variants that
+// delegate to malloc/free. This also intercepts all allocations of Qt
+// and the standard library, which route through operator new.
+
+void* operator new(std::size_t size) {
+    auditAllocation("operator new", size);
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    auditAllocation("operator new[]", size);
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    auditAllocation("operator new", size);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    auditAllocation("operator new[]", size);
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr) {
+        auditAllocation("operator delete", 0);
+        std::free(ptr);
+    }
+}
+
+void operator delete[](void* ptr) noexcept {
+    if (ptr) {
+        auditAllocation("operator delete[]", 0);
+        std::free(ptr);
+    }
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept {
+    if (ptr) {
+        auditAllocation("operator delete", size);
+        std::free(ptr);
+    }
+}
+
+void operator delete[](void* ptr, std::size_t size) noexcept {
+    if (ptr) {
+        auditAllocation("operator delete[]", size);
+        std::free(ptr);
+    }
+}
+
+#endif // MIXXX_RTALLOC_AUDIT
@@ -0,0 +1,38 @@
+#pragma once
+
+// Audit mode for detecting heap allocations on real-time threads.
+//
+// When building with the RTALLOC_AUDIT=ON CMake option the global
+// allocation operators are instrumented: any allocation or
+// deallocation performed while the current thread is inside an
+// RtAllocAuditScope is counted and reported to stderr together with
+// a call stack (on platforms with backtrace support). The audio
+// callback enters such a scope, so rare allocation stalls that cause
+// xruns at small buffer sizes can be traced back to their call sites.
+//
+// Without the option the scope class is an empty shell and the
+// allocation operators remain untouched.
+
+namespace mixxx {
+
+class RtAllocAuditScope final {
+  public:
+#ifdef MIXXX_RTALLOC_AUDIT
+    RtAllocAuditScope();
+    ~RtAllocAuditScope();
+#else
+    RtAllocAuditScope() {
+    }
+#endif
+
+    RtAllocAuditScope(const RtAllocAuditScope&) = delete;
+    RtAllocAuditScope& operator=(const RtAllocAuditScope&) = delete;
+
+#ifdef MIXXX_RTALLOC_AUDIT
+    // Total number of allocations/deallocations that have been
+    // detected on real-time threads since the start of the process.
+    static int violationCount();
+#endif
+};
+
+} // namespace mixxx
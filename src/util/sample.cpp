@@ -10,6 +10,23 @@ typedef qint64 int64_t;
 typedef qint32 int32_t;
 #endif
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// GCC and Clang allow compiling single functions for a newer instruction
+// set via __attribute__((target(...))) without changing the baseline of
+// the whole translation unit.
+#define MIXXX_SAMPLE_KERNELS_AVX2 1
+#define MIXXX_SAMPLE_KERNELS_SSE 1
+#include <immintrin.h>
+#elif defined(__SSE__) || (defined(_MSC_VER) && defined(_M_X64))
+#define MIXXX_SAMPLE_KERNELS_SSE 1
+#include <xmmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MIXXX_SAMPLE_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
 // LOOP VECTORIZED below marks the loops that are processed with the 128 bit SSE
 // registers as tested with gcc 7.5 and the -ftree-vectorize -fopt-info-vec-optimized flags on
 // an Intel i5 CPU. When changing, be careful to not disturb the vectorization.
@@ -19,6 +36,21 @@ typedef qint32 int32_t;
 // "SINT i" is the preferred loop index type that should allow vectorization in
 // general. Unfortunatly there are expetions where "int i" is required for some reasons.
 
+// In addition to the auto-vectorized loops below, the hottest kernels
+// (applyGain, copyWithGain, add, addWithGain, copyClampBuffer and the
+// (de)interleave functions) have explicit SIMD variants that are selected
+// once at startup via a kernel table:
+// - AVX2 variants are compiled per-function with the "avx2" target
+//   attribute (GCC/Clang on x86) and enabled at runtime via
+//   __builtin_cpu_supports(), so the default build stays runnable on
+//   baseline x86-64 CPUs.
+// - SSE is part of the x86-64 baseline, so the SSE shuffle kernels for
+//   interleaving need no runtime check.
+// - NEON is part of the AArch64 baseline, so NEON kernels are selected at
+//   compile time there.
+// The AVX2 kernels deliberately use mul+add instead of FMA so that they
+// produce bit-identical results to the scalar fallback.
+
 namespace {
 
 #ifdef __AVX__
@@ -36,6 +68,427 @@ constexpr bool useAlignedAlloc() {
             sizeof(CSAMPLE*) == sizeof(size_t);
 }
 
+// Scalar fallback kernels. These are the plain loops that were previously
+// inlined into the SampleUtil functions; the compiler still auto-vectorizes
+// them for the baseline instruction set.
+
+void applyGainScalar(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+void copyWithGainScalar(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void addScalar(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i];
+    }
+}
+
+void addWithGainScalar(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void copyClampScalar(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = CSAMPLE_clamp(pSrc[i]);
+    }
+}
+
+void interleaveScalar(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveScalar(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+#ifdef MIXXX_SAMPLE_KERNELS_AVX2
+
+// Engine buffers from SampleUtil::alloc() are 32-byte aligned, but callers
+// may pass pointers at arbitrary sample offsets, so all AVX2 kernels use
+// unaligned loads/stores. These are not slower than aligned accesses on
+// AVX2-capable CPUs when the address happens to be aligned.
+
+__attribute__((target("avx2")))
+void applyGainAvx2(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        _mm256_storeu_ps(pBuffer + i,
+                _mm256_mul_ps(_mm256_loadu_ps(pBuffer + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+__attribute__((target("avx2")))
+void copyWithGainAvx2(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        _mm256_storeu_ps(pDest + i,
+                _mm256_mul_ps(_mm256_loadu_ps(pSrc + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+__attribute__((target("avx2")))
+void addAvx2(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        _mm256_storeu_ps(pDest + i,
+                _mm256_add_ps(_mm256_loadu_ps(pDest + i),
+                        _mm256_loadu_ps(pSrc + i)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i];
+    }
+}
+
+__attribute__((target("avx2")))
+void addWithGainAvx2(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m256 vGain = _mm256_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        // mul+add (not FMA) to stay bit-identical with the scalar kernel
+        _mm256_storeu_ps(pDest + i,
+                _mm256_add_ps(_mm256_loadu_ps(pDest + i),
+                        _mm256_mul_ps(_mm256_loadu_ps(pSrc + i), vGain)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+__attribute__((target("avx2")))
+void copyClampAvx2(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    const __m256 vMin = _mm256_set1_ps(-CSAMPLE_PEAK);
+    const __m256 vMax = _mm256_set1_ps(CSAMPLE_PEAK);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        _mm256_storeu_ps(pDest + i,
+                _mm256_min_ps(vMax,
+                        _mm256_max_ps(vMin, _mm256_loadu_ps(pSrc + i))));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = CSAMPLE_clamp(pSrc[i]);
+    }
+}
+
+#endif // MIXXX_SAMPLE_KERNELS_AVX2
+
+#ifdef MIXXX_SAMPLE_KERNELS_SSE
+
+// SSE is part of the x86-64 baseline, so these kernels are always safe to
+// call on x86 builds and do not participate in the runtime dispatch.
+
+void interleaveSse(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const __m128 l = _mm_loadu_ps(pSrc1 + i);
+        const __m128 r = _mm_loadu_ps(pSrc2 + i);
+        _mm_storeu_ps(pDest + 2 * i, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(pDest + 2 * i + 4, _mm_unpackhi_ps(l, r));
+    }
+    for (; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveSse(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const __m128 a = _mm_loadu_ps(pSrc + 2 * i); // L0 R0 L1 R1
+        const __m128 b = _mm_loadu_ps(pSrc + 2 * i + 4); // L2 R2 L3 R3
+        _mm_storeu_ps(pDest1 + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(pDest2 + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    for (; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+#endif // MIXXX_SAMPLE_KERNELS_SSE
+
+#ifdef MIXXX_SAMPLE_KERNELS_NEON
+
+// NEON is part of the AArch64 baseline; on 32-bit ARM these kernels are
+// only compiled when the build already targets NEON (__ARM_NEON), so no
+// runtime check is needed either.
+
+void applyGainNeon(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pBuffer + i, vmulq_n_f32(vld1q_f32(pBuffer + i), gain));
+    }
+    for (; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+void copyWithGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i, vmulq_n_f32(vld1q_f32(pSrc + i), gain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void addNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i,
+                vaddq_f32(vld1q_f32(pDest + i), vld1q_f32(pSrc + i)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i];
+    }
+}
+
+void addWithGainNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        // mul+add (not vmlaq/FMA) to stay bit-identical with the scalar kernel
+        vst1q_f32(pDest + i,
+                vaddq_f32(vld1q_f32(pDest + i),
+                        vmulq_n_f32(vld1q_f32(pSrc + i), gain)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void copyClampNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    const float32x4_t vMin = vdupq_n_f32(-CSAMPLE_PEAK);
+    const float32x4_t vMax = vdupq_n_f32(CSAMPLE_PEAK);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i,
+                vminq_f32(vMax, vmaxq_f32(vMin, vld1q_f32(pSrc + i))));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = CSAMPLE_clamp(pSrc[i]);
+    }
+}
+
+void interleaveNeon(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        float32x4x2_t frames;
+        frames.val[0] = vld1q_f32(pSrc1 + i);
+        frames.val[1] = vld1q_f32(pSrc2 + i);
+        vst2q_f32(pDest + 2 * i, frames);
+    }
+    for (; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveNeon(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const float32x4x2_t frames = vld2q_f32(pSrc + 2 * i);
+        vst1q_f32(pDest1 + i, frames.val[0]);
+        vst1q_f32(pDest2 + i, frames.val[1]);
+    }
+    for (; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+#endif // MIXXX_SAMPLE_KERNELS_NEON
+
+// Kernel table filled once at startup. All kernels take the full special
+// cases (gain == 0/1 etc.) already filtered out by their SampleUtil
+// callers.
+struct SampleKernels {
+    void (*applyGain)(CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*copyWithGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*add)(CSAMPLE*, const CSAMPLE*, SINT);
+    void (*addWithGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*copyClamp)(CSAMPLE*, const CSAMPLE*, SINT);
+    void (*interleave)(CSAMPLE*, const CSAMPLE*, const CSAMPLE*, SINT);
+    void (*deinterleave)(CSAMPLE*, CSAMPLE*, const CSAMPLE*, SINT);
+};
+
+SampleKernels selectSampleKernels() {
+    SampleKernels kernels = {
+            applyGainScalar,
+            copyWithGainScalar,
+            addScalar,
+            addWithGainScalar,
+            copyClampScalar,
+            interleaveScalar,
+            deinterleaveScalar,
+    };
+#ifdef MIXXX_SAMPLE_KERNELS_SSE
+    kernels.interleave = interleaveSse;
+    kernels.deinterleave = deinterleaveSse;
+#endif
+#ifdef MIXXX_SAMPLE_KERNELS_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.applyGain = applyGainAvx2;
+        kernels.copyWithGain = copyWithGainAvx2;
+        kernels.add = addAvx2;
+        kernels.addWithGain = addWithGainAvx2;
+        kernels.copyClamp = copyClampAvx2;
+    }
+#endif
+#ifdef MIXXX_SAMPLE_KERNELS_NEON
+    kernels.applyGain = applyGainNeon;
+    kernels.copyWithGain = copyWithGainNeon;
+    kernels.add = addNeon;
+    kernels.addWithGain = addWithGainNeon;
+    kernels.copyClamp = copyClampNeon;
+    kernels.interleave = interleaveNeon;
+    kernels.deinterleave = deinterleaveNeon;
+#endif
+    return kernels;
+}
+
+// Resolved before the audio callback starts; reads from the engine thread
+// are plain loads of immutable function pointers.
+const SampleKernels kSampleKernels = selectSampleKernels();
+
+// Extracting the first two channels with an interleave stride that is
+// known at compile time allows the compiler to turn the strided loads
+// into vector shuffles instead of scalar gathers.
+
+template<int channelCount>
+void copyMultiToStereoFixedStride(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[i * 2] = pSrc[i * channelCount];
+        pDest[i * 2 + 1] = pSrc[i * channelCount + 1];
+    }
+}
+
+// Folding all stems of a frame in one pass keeps every source sample in
+// registers between the gain multiply and the accumulate, so the mixdown
+// touches the (large) stem buffer exactly once. A compile-time stem count
+// lets the compiler unroll the inner fold and vectorize over frames.
+
+template<int numStems>
+void mixStemsToStereoFixedCount(
+        CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        const CSAMPLE_GAIN* pOldGain,
+        const CSAMPLE_GAIN* pNewGain,
+        SINT numFrames) {
+    CSAMPLE_GAIN startGain[numStems];
+    CSAMPLE_GAIN gainDelta[numStems];
+    for (int s = 0; s < numStems; ++s) {
+        gainDelta[s] = (pNewGain[s] - pOldGain[s]) / CSAMPLE_GAIN(numFrames);
+        startGain[s] = pOldGain[s] + gainDelta[s];
+    }
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        CSAMPLE left = 0;
+        CSAMPLE right = 0;
+        for (int s = 0; s < numStems; ++s) {
+            const CSAMPLE_GAIN gain = startGain[s] + gainDelta[s] * i;
+            left += pSrc[(i * numStems + s) * 2] * gain;
+            right += pSrc[(i * numStems + s) * 2 + 1] * gain;
+        }
+        pDest[i * 2] = left;
+        pDest[i * 2 + 1] = right;
+    }
+}
+
+template<int channelCount>
+void stripMultiToStereoFixedStride(
+        CSAMPLE* pBuffer,
+        SINT numFrames) {
+    // In-place forward compaction: the write position never overtakes
+    // the read position, because the stride is greater than 2.
+    static_assert(channelCount > 2, "in-place compaction requires stride > 2");
+    for (SINT i = 0; i < numFrames; ++i) {
+        pBuffer[i * 2] = pBuffer[i * channelCount];
+        pBuffer[i * 2 + 1] = pBuffer[i * channelCount + 1];
+    }
+}
+
 } // anonymous namespace
 
 // static
@@ -119,10 +572,7 @@ void SampleUtil::applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pBuffer[i] *= gain;
-    }
+    kSampleKernels.applyGain(pBuffer, gain, numSamples);
 }
 
 // static
@@ -155,6 +605,37 @@ void SampleUtil::applyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN old_gain,
     }
 }
 
+// static
+void SampleUtil::addAndApplyRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN old_gain, CSAMPLE_GAIN new_gain, SINT numSamples) {
+    if (old_gain == CSAMPLE_GAIN_ZERO && new_gain == CSAMPLE_GAIN_ZERO) {
+        clear(pDest, numSamples);
+        return;
+    }
+    if (old_gain == CSAMPLE_GAIN_ONE && new_gain == CSAMPLE_GAIN_ONE) {
+        add(pDest, pSrc, numSamples);
+        return;
+    }
+
+    const CSAMPLE_GAIN gain_delta = (new_gain - old_gain)
+            / CSAMPLE_GAIN(numSamples / 2);
+    if (gain_delta != 0) {
+        const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+            pDest[i * 2] = (pDest[i * 2] + pSrc[i * 2]) * gain;
+            pDest[i * 2 + 1] = (pDest[i * 2 + 1] + pSrc[i * 2 + 1]) * gain;
+        }
+    } else {
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples; ++i) {
+            pDest[i] = (pDest[i] + pSrc[i]) * old_gain;
+        }
+    }
+}
+
 // static
 void SampleUtil::applyAlternatingGain(CSAMPLE* pBuffer, CSAMPLE gain1,
         CSAMPLE gain2, SINT numSamples) {
@@ -217,10 +698,7 @@ void SampleUtil::applyRampingAlternatingGain(CSAMPLE* pBuffer,
 void SampleUtil::add(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numSamples) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i];
-    }
+    kSampleKernels.add(pDest, pSrc, numSamples);
 }
 
 // static
@@ -231,10 +709,7 @@ void SampleUtil::addWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i] * gain;
-    }
+    kSampleKernels.addWithGain(pDest, pSrc, gain, numSamples);
 }
 
 void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
@@ -318,14 +793,7 @@ void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyGain(pDest, gain);
+    kSampleKernels.copyWithGain(pDest, pSrc, gain, numSamples);
 }
 
 // static
@@ -394,6 +862,18 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
     }
 }
 
+// static
+void SampleUtil::convertFloat32ToS16WithGain(SAMPLE* pDest, const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain, SINT numSamples) {
+    const CSAMPLE conversionFactor = SAMPLE_MINIMUM * -1.0f * gain;
+    // note: LOOP VECTORIZED only with "int i" (not SINT i)
+    for (int i = 0; i < numSamples; ++i) {
+        pDest[i] = static_cast<SAMPLE>(math_clamp(pSrc[i] * conversionFactor,
+                static_cast<CSAMPLE>(SAMPLE_MINIMUM),
+                static_cast<CSAMPLE>(SAMPLE_MAXIMUM)));
+    }
+}
+
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
         CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT numSamples) {
@@ -426,12 +906,80 @@ SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
 }
 
 // static
-void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
-        const CSAMPLE* M_RESTRICT pSrc, SINT iNumSamples) {
+SampleUtil::CLIP_STATUS SampleUtil::applyRampingAlternatingGainAndSumAbsPerChannel(
+        CSAMPLE* pBuffer,
+        CSAMPLE gain1, CSAMPLE gain2,
+        CSAMPLE gain1Old, CSAMPLE gain2Old,
+        CSAMPLE* pfAbsL, CSAMPLE* pfAbsR, SINT numSamples) {
+    const CSAMPLE_GAIN gain1Delta = (gain1 - gain1Old)
+            / CSAMPLE_GAIN(numSamples / 2);
+    const CSAMPLE_GAIN gain2Delta = (gain2 - gain2Old)
+            / CSAMPLE_GAIN(numSamples / 2);
+    // With a delta of 0 this degenerates to a constant gain of
+    // gain1Old == gain1, so a single loop covers both the ramping and the
+    // steady case.
+    const CSAMPLE_GAIN gain1Start = gain1Old + gain1Delta;
+    const CSAMPLE_GAIN gain2Start = gain2Old + gain2Delta;
+
+    CSAMPLE fAbsL = CSAMPLE_ZERO;
+    CSAMPLE fAbsR = CSAMPLE_ZERO;
+    CSAMPLE clippedL = 0;
+    CSAMPLE clippedR = 0;
+
     // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < iNumSamples; ++i) {
-        pDest[i] = clampSample(pSrc[i]);
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        pBuffer[i * 2] *= gain1Start + gain1Delta * i;
+        const CSAMPLE absl = fabs(pBuffer[i * 2]);
+        fAbsL += absl;
+        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
+        pBuffer[i * 2 + 1] *= gain2Start + gain2Delta * i;
+        const CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
+        fAbsR += absr;
+        // Replacing the code with a bool clipped will prevent vetorizing
+        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
+    if (clippedL > 0) {
+        clipping |= SampleUtil::CLIPPING_LEFT;
     }
+    if (clippedR > 0) {
+        clipping |= SampleUtil::CLIPPING_RIGHT;
+    }
+    return clipping;
+}
+
+// static
+bool SampleUtil::isSilence(const CSAMPLE* pBuffer, SINT numSamples) {
+    // Summing the absolute values lets the loop vectorize; checking chunks
+    // of the sum still exits early on clearly audible buffers without
+    // branching on every sample.
+    constexpr SINT chunkSize = 64;
+    SINT i = 0;
+    for (; i + chunkSize <= numSamples; i += chunkSize) {
+        CSAMPLE sum = CSAMPLE_ZERO;
+        // note: LOOP VECTORIZED.
+        for (SINT j = 0; j < chunkSize; ++j) {
+            sum += fabs(pBuffer[i + j]);
+        }
+        if (sum != CSAMPLE_ZERO) {
+            return false;
+        }
+    }
+    for (; i < numSamples; ++i) {
+        if (pBuffer[i] != CSAMPLE_ZERO) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// static
+void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc, SINT iNumSamples) {
+    kSampleKernels.copyClamp(pDest, pSrc, iNumSamples);
 }
 
 // static
@@ -439,11 +987,7 @@ void SampleUtil::interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc1,
         const CSAMPLE* M_RESTRICT pSrc2,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest[2 * i] = pSrc1[i];
-        pDest[2 * i + 1] = pSrc2[i];
-    }
+    kSampleKernels.interleave(pDest, pSrc1, pSrc2, numFrames);
 }
 
 // static
@@ -451,11 +995,7 @@ void SampleUtil::deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
         CSAMPLE* M_RESTRICT pDest2,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest1[i] = pSrc[i * 2];
-        pDest2[i] = pSrc[i * 2 + 1];
-    }
+    kSampleKernels.deinterleave(pDest1, pDest2, pSrc, numFrames);
 }
 
 // static
@@ -566,10 +1106,25 @@ void SampleUtil::stripMultiToStereo(
         SINT numFrames,
         int numChannels) {
     DEBUG_ASSERT(numChannels > 2);
-    // forward loop
-    for (SINT i = 0; i < numFrames; ++i) {
-        pBuffer[i * 2] = pBuffer[i * numChannels];
-        pBuffer[i * 2 + 1] = pBuffer[i * numChannels + 1];
+    // Dispatch on the common surround layouts to benefit from
+    // compile-time interleave strides
+    switch (numChannels) {
+    case 4:
+        stripMultiToStereoFixedStride<4>(pBuffer, numFrames);
+        break;
+    case 6:
+        stripMultiToStereoFixedStride<6>(pBuffer, numFrames);
+        break;
+    case 8:
+        stripMultiToStereoFixedStride<8>(pBuffer, numFrames);
+        break;
+    default:
+        // forward loop
+        for (SINT i = 0; i < numFrames; ++i) {
+            pBuffer[i * 2] = pBuffer[i * numChannels];
+            pBuffer[i * 2 + 1] = pBuffer[i * numChannels + 1];
+        }
+        break;
     }
 }
 
@@ -580,14 +1135,65 @@ void SampleUtil::copyMultiToStereo(
         SINT numFrames,
         int numChannels) {
     DEBUG_ASSERT(numChannels > 2);
-    // forward loop
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest[i * 2] = pSrc[i * numChannels];
-        pDest[i * 2 + 1] = pSrc[i * numChannels + 1];
+    // Dispatch on the common surround layouts to benefit from
+    // compile-time interleave strides
+    switch (numChannels) {
+    case 4:
+        copyMultiToStereoFixedStride<4>(pDest, pSrc, numFrames);
+        break;
+    case 6:
+        copyMultiToStereoFixedStride<6>(pDest, pSrc, numFrames);
+        break;
+    case 8:
+        copyMultiToStereoFixedStride<8>(pDest, pSrc, numFrames);
+        break;
+    default:
+        // forward loop
+        for (SINT i = 0; i < numFrames; ++i) {
+            pDest[i * 2] = pSrc[i * numChannels];
+            pDest[i * 2 + 1] = pSrc[i * numChannels + 1];
+        }
+        break;
     }
 }
 
 
+// static
+void SampleUtil::mixStemsToStereoWithRampingGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        const CSAMPLE_GAIN* pOldGain,
+        const CSAMPLE_GAIN* pNewGain,
+        int numStems,
+        SINT numFrames) {
+    DEBUG_ASSERT(numStems > 0);
+    // Dispatch on the common stem layouts to benefit from compile-time
+    // stem counts, like copyMultiToStereo does for surround strides.
+    switch (numStems) {
+    case 2:
+        mixStemsToStereoFixedCount<2>(pDest, pSrc, pOldGain, pNewGain, numFrames);
+        break;
+    case 4:
+        mixStemsToStereoFixedCount<4>(pDest, pSrc, pOldGain, pNewGain, numFrames);
+        break;
+    default:
+        // Generic fallback: accumulate stem by stem. pDest stays cache-hot
+        // while the stem buffer is still only read once per stem.
+        clear(pDest, numFrames * 2);
+        for (int s = 0; s < numStems; ++s) {
+            const CSAMPLE_GAIN gainDelta =
+                    (pNewGain[s] - pOldGain[s]) / CSAMPLE_GAIN(numFrames);
+            const CSAMPLE_GAIN startGain = pOldGain[s] + gainDelta;
+            // note: LOOP VECTORIZED.
+            for (SINT i = 0; i < numFrames; ++i) {
+                const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+                pDest[i * 2] += pSrc[(i * numStems + s) * 2] * gain;
+                pDest[i * 2 + 1] += pSrc[(i * numStems + s) * 2 + 1] * gain;
+            }
+        }
+        break;
+    }
+}
+
 // static
 void SampleUtil::reverse(CSAMPLE* pBuffer, SINT numSamples) {
     for (SINT j = 0; j < numSamples / 4; ++j) {
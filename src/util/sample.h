@@ -153,6 +153,13 @@ class SampleUtil {
     static void applyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN old_gain,
             CSAMPLE_GAIN new_gain, SINT numSamples);
 
+    // Add pSrc to pDest and apply a ramping gain to the sum, i.e.
+    // pDest = (pDest + pSrc) * gain, in a single pass over both buffers
+    // instead of a separate add() and applyRampingGain() pass.
+    static void addAndApplyRampingGain(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN old_gain, CSAMPLE_GAIN new_gain,
+            SINT numSamples);
+
     // Copy pSrc to pDest and ramp gain
     // For optimum performance use the in-place function applyRampingGain()
     // if pDest == pSrc!
@@ -194,6 +201,11 @@ class SampleUtil {
     static void convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
             SINT numSamples);
 
+    // Like convertFloat32ToS16() but multiplies each sample by gain before
+    // the conversion, clamping to the valid SAMPLE range.
+    static void convertFloat32ToS16WithGain(SAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain, SINT numSamples);
+
     // For each pair of samples in pBuffer (l,r) -- stores the sum of the
     // absolute values of l in pfAbsL, and the sum of the absolute values of r
     // in pfAbsR.
@@ -201,6 +213,22 @@ class SampleUtil {
     static CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
             const CSAMPLE* pBuffer, SINT numSamples);
 
+    // Applies a ramping gain to every other sample like
+    // applyRampingAlternatingGain() and accumulates the per-channel absolute
+    // value sums of the result like sumAbsPerChannel(), fusing both into a
+    // single traversal of the buffer.
+    // The return value tells whether there is clipping in pBuffer or not.
+    static CLIP_STATUS applyRampingAlternatingGainAndSumAbsPerChannel(
+            CSAMPLE* pBuffer,
+            CSAMPLE gain1, CSAMPLE gain2,
+            CSAMPLE gain1Old, CSAMPLE gain2Old,
+            CSAMPLE* pfAbsL, CSAMPLE* pfAbsR, SINT numSamples);
+
+    // Returns true if every sample in pBuffer is exactly zero, i.e. the
+    // buffer is digitally silent. Exits early once a non-zero sample has
+    // been found.
+    static bool isSilence(const CSAMPLE* pBuffer, SINT numSamples);
+
     // Copies every sample in pSrc to pDest, limiting the values in pDest
     // to the valid range of CSAMPLE. pDest and pSrc must not overlap.
     static void copyClampBuffer(CSAMPLE* pDest, const CSAMPLE* pSrc,
@@ -272,6 +300,23 @@ class SampleUtil {
     static void copyMultiToStereo(CSAMPLE* pDest, const CSAMPLE* pSrc,
             SINT numFrames, int numChannels);
 
+    // Mixes interleaved multi-stem sample data down to a single stereo
+    // stream in one pass over the source buffer, applying a per-stem gain
+    // ramp. pSrc is frame-major: each frame holds numStems consecutive
+    // stereo pairs (L0 R0 L1 R1 .. ), as a multi-stream (stem) decoder
+    // delivers them. pOldGain and pNewGain hold numStems gains each; every
+    // stem's gain ramps linearly from its old to its new value across the
+    // buffer like copyWithRampingGain.
+    // pSrc must contain (numFrames * numStems * 2) samples
+    // (numFrames * 2) samples will be written into pDest
+    // pDest must not be an alias of pSrc.
+    static void mixStemsToStereoWithRampingGain(CSAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            const CSAMPLE_GAIN* pOldGain,
+            const CSAMPLE_GAIN* pNewGain,
+            int numStems,
+            SINT numFrames);
+
     // reverses stereo sample in place
     static void reverse(CSAMPLE* pBuffer, SINT numSamples);
 
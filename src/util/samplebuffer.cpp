@@ -1,17 +1,140 @@
 #include "util/samplebuffer.h"
 
+#include <QMutex>
+
+#include <vector>
+
+#include "util/logger.h"
+#include "util/math.h"
 #include "util/sample.h"
 
 
 namespace mixxx {
 
+namespace {
+
+const Logger kLogger("SampleBuffer");
+
+// Pool of recently freed sample buffers for reuse. The decoder
+// readahead buffers are reallocated on every track load and weigh
+// in at several hundred KiB to a few MiB each. Loading tracks on
+// multiple decks in quick succession would otherwise trigger
+// repeated large allocations that fragment the heap on long-running
+// installs. Small buffers are not worth pooling and bypass it.
+//
+// Buffers are grouped into power-of-2 size classes, i.e. pooled
+// allocations are rounded up to the class size so that subsequent
+// requests of similar size can reuse them.
+constexpr SINT kPoolMinBufferSize = 1 << 16; // 64 Ki samples = 256 KiB
+constexpr SINT kPoolMaxTotalSize = 1 << 24;  // 16 Mi samples = 64 MiB
+
+inline SINT allocSizeForCapacity(SINT size) {
+    if (size < kPoolMinBufferSize) {
+        // Not pooled, allocated with the exact size
+        return size;
+    }
+    return roundUpToPowerOf2(static_cast<int>(size));
+}
+
+struct PooledBuffer {
+    CSAMPLE* data;
+    SINT size;
+};
+
+struct SampleBufferPool {
+    ~SampleBufferPool() {
+        for (const PooledBuffer& pooledBuffer : buffers) {
+            SampleUtil::free(pooledBuffer.data);
+        }
+    }
+
+    QMutex mutex;
+    std::vector<PooledBuffer> buffers;
+    SINT pooledTotalSize = 0;
+    // Instrumentation: Count, total and peak size of all live sample
+    // buffers, including those that are too small to be pooled. This
+    // is the single place where the memory usage of all DSP buffers
+    // can be observed, see SampleBuffer::statistics().
+    SINT liveBufferCount = 0;
+    SINT liveTotalSize = 0;
+    SINT liveHighWaterMark = 0;
+};
+
+SampleBufferPool s_pool;
+
+CSAMPLE* allocPooled(SINT size) {
+    const SINT allocSize = allocSizeForCapacity(size);
+    CSAMPLE* data = nullptr;
+    if (allocSize >= kPoolMinBufferSize) {
+        QMutexLocker locked(&s_pool.mutex);
+        for (auto it = s_pool.buffers.begin(); it != s_pool.buffers.end(); ++it) {
+            if (it->size == allocSize) {
+                data = it->data;
+                s_pool.buffers.erase(it);
+                s_pool.pooledTotalSize -= allocSize;
+                break;
+            }
+        }
+    }
+    if (!data) {
+        data = SampleUtil::alloc(allocSize);
+        if (!data) {
+            return nullptr;
+        }
+    }
+    QMutexLocker locked(&s_pool.mutex);
+    s_pool.liveBufferCount++;
+    s_pool.liveTotalSize += allocSize;
+    if (s_pool.liveTotalSize > s_pool.liveHighWaterMark) {
+        s_pool.liveHighWaterMark = s_pool.liveTotalSize;
+        if (kLogger.debugEnabled()) {
+            kLogger.debug()
+                    << "New high-water mark of live sample buffers:"
+                    << (s_pool.liveHighWaterMark * static_cast<SINT>(sizeof(CSAMPLE)))
+                    << "bytes";
+        }
+    }
+    return data;
+}
+
+void freePooled(CSAMPLE* data, SINT size) {
+    if (!data) {
+        return;
+    }
+    const SINT allocSize = allocSizeForCapacity(size);
+    QMutexLocker locked(&s_pool.mutex);
+    s_pool.liveBufferCount--;
+    s_pool.liveTotalSize -= allocSize;
+    if ((allocSize >= kPoolMinBufferSize) &&
+            (s_pool.pooledTotalSize + allocSize <= kPoolMaxTotalSize)) {
+        s_pool.buffers.push_back(PooledBuffer{data, allocSize});
+        s_pool.pooledTotalSize += allocSize;
+        return;
+    }
+    locked.unlock();
+    SampleUtil::free(data);
+}
+
+} // anonymous namespace
+
+//static
+SampleBuffer::Statistics SampleBuffer::statistics() {
+    QMutexLocker locked(&s_pool.mutex);
+    Statistics statistics;
+    statistics.liveBufferCount = s_pool.liveBufferCount;
+    statistics.liveSamples = s_pool.liveTotalSize;
+    statistics.pooledSamples = s_pool.pooledTotalSize;
+    statistics.highWaterMarkSamples = s_pool.liveHighWaterMark;
+    return statistics;
+}
+
 SampleBuffer::SampleBuffer(SINT size)
-        : m_data((size > 0) ? SampleUtil::alloc(size) : nullptr),
+        : m_data((size > 0) ? allocPooled(size) : nullptr),
           m_size((m_data != nullptr) ? size : 0) {
 }
 
 SampleBuffer::~SampleBuffer() {
-    SampleUtil::free(m_data);
+    freePooled(m_data, m_size);
 }
 
 void SampleBuffer::clear() {
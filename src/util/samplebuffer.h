@@ -33,6 +33,18 @@ namespace mixxx {
 //
 class SampleBuffer final {
   public:
+    // Snapshot of the global accounting of all live sample buffers
+    // and of the internal reuse pool, in units of samples. Multiply
+    // with sizeof(CSAMPLE) for bytes. Live sizes are rounded up to
+    // the allocated capacity of the respective size class.
+    struct Statistics {
+        SINT liveBufferCount;
+        SINT liveSamples;
+        SINT pooledSamples;
+        SINT highWaterMarkSamples;
+    };
+    static Statistics statistics();
+
     SampleBuffer()
         : m_data(nullptr),
           m_size(0) {
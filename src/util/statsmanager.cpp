@@ -3,6 +3,7 @@
 #include <QFile>
 #include <QMetaType>
 #include <QMutexLocker>
+#include <QSet>
 #include <QTextStream>
 #include <QtDebug>
 
@@ -12,7 +13,11 @@
 
 // In practice we process stats pipes about once a minute @1ms latency.
 const int kStatsPipeSize = 1 << 10;
-const int kProcessLength = kStatsPipeSize * 4 / 5;
+
+// Interval at which the stats thread drains all pipes. Together with
+// the pipe capacity this bounds the report rate a thread can sustain
+// without losing reports: kStatsPipeSize / kDrainIntervalMillis.
+const unsigned long kDrainIntervalMillis = 100;
 
 // static
 bool StatsManager::s_bStatsManagerEnabled = false;
@@ -21,6 +26,14 @@ StatsPipe::StatsPipe(StatsManager* pManager)
         : m_pManager(pManager),
           m_queue(kStatsPipeSize) {
     qRegisterMetaType<Stat>("Stat");
+    // Pipes are created lazily on the thread that reports through them,
+    // so the current thread is the pipe's owner.
+    static QAtomicInt nextTraceThreadId(0);
+    m_traceThreadId = nextTraceThreadId.fetchAndAddRelaxed(1);
+    m_traceThreadName = QThread::currentThread()->objectName();
+    if (m_traceThreadName.isEmpty()) {
+        m_traceThreadName = QString("Thread %1").arg(m_traceThreadId);
+    }
 }
 
 StatsPipe::~StatsPipe() {
@@ -120,6 +133,14 @@ void StatsManager::writeTimeline(const QString& filename) {
     // Sort by time.
     std::sort(m_events.begin(), m_events.end(), OrderByTime());
 
+    if (filename.endsWith(QStringLiteral(".json"), Qt::CaseInsensitive)) {
+        // Chrome trace event format, to be loaded into chrome://tracing
+        // or compatible viewers for a per-thread timeline.
+        writeChromeTrace(&timeline);
+        timeline.close();
+        return;
+    }
+
     mixxx::Duration last_time = m_events[0].m_time;
 
     QMap<QString, qint64> startTimes;
@@ -163,6 +184,73 @@ void StatsManager::writeTimeline(const QString& filename) {
     timeline.close();
 }
 
+namespace {
+QString escapeJsonString(QString str) {
+    return str.replace(QChar('\\'), QStringLiteral("\\\\"))
+            .replace(QChar('"'), QStringLiteral("\\\""));
+}
+} // namespace
+
+void StatsManager::writeChromeTrace(QFile* pFile) {
+    QTextStream out(pFile);
+    out << "[";
+    bool first = true;
+    const auto writeSeparator = [&out, &first] {
+        if (!first) {
+            out << ",";
+        }
+        first = false;
+        out << "\n";
+    };
+
+    // Announce the thread names once so the viewer labels the rows.
+    QSet<int> namedThreads;
+    foreach (const Event& event, m_events) {
+        if (namedThreads.contains(event.m_threadId)) {
+            continue;
+        }
+        namedThreads.insert(event.m_threadId);
+        writeSeparator();
+        out << QString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                       "\"tid\":%1,\"args\":{\"name\":\"%2\"}}")
+                        .arg(QString::number(event.m_threadId),
+                                escapeJsonString(event.m_threadName));
+    }
+
+    foreach (const Event& event, m_events) {
+        const char* phase = nullptr;
+        switch (event.m_type) {
+        case Stat::EVENT_START:
+            phase = "B";
+            break;
+        case Stat::EVENT_END:
+            phase = "E";
+            break;
+        case Stat::EVENT:
+            // Thread-scoped instant event
+            phase = "i";
+            break;
+        default:
+            continue;
+        }
+        writeSeparator();
+        // Timestamps are expected in microseconds.
+        const QString tsMicros = QString::number(
+                event.m_time.toIntegerNanos() / 1000.0, 'f', 3);
+        out << QString("{\"name\":\"%1\",\"cat\":\"mixxx\",\"ph\":\"%2\","
+                       "\"ts\":%3,\"pid\":0,\"tid\":%4")
+                        .arg(escapeJsonString(event.m_tag),
+                                QString::fromLatin1(phase),
+                                tsMicros,
+                                QString::number(event.m_threadId));
+        if (event.m_type == Stat::EVENT) {
+            out << ",\"s\":\"t\"";
+        }
+        out << "}";
+    }
+    out << "\n]\n";
+}
+
 void StatsManager::onStatsPipeDestroyed(StatsPipe* pPipe) {
     QMutexLocker locker(&m_statsPipeLock);
     processIncomingStatReports();
@@ -186,9 +274,11 @@ bool StatsManager::maybeWriteReport(StatReport report) {
         return false;
     }
     bool success = pStatsPipe->enqueue(std::move(report));
-    if (pStatsPipe->remainingCapacity() < kProcessLength) {
-        m_statsPipeCondition.wakeAll();
-    }
+    // Deliberately do not signal the stats thread from here: waking it
+    // takes a lock and a syscall, which would perturb the real-time
+    // threads this telemetry is supposed to observe. The stats thread
+    // drains all pipes periodically on its own, so after the enqueue
+    // above the hot path is entirely lock-free.
     static bool warnedAboutOverflow = false;
     if (!success && !warnedAboutOverflow) {
         qWarning() << "StatsManager FIFO for thread overflowed at least once."
@@ -232,6 +322,8 @@ void StatsManager::processIncomingStatReports() {
                 event.m_tag = tag;
                 event.m_type = report.type;
                 event.m_time = mixxx::Duration::fromNanos(report.time);
+                event.m_threadId = pStatsPipe->traceThreadId();
+                event.m_threadName = pStatsPipe->traceThreadName();
                 m_events.append(event);
             }
         }
@@ -242,7 +334,11 @@ void StatsManager::run() {
     qDebug() << "StatsManager thread starting up.";
     while (true) {
         m_statsPipeLock.lock();
-        m_statsPipeCondition.wait(&m_statsPipeLock);
+        // Waking up periodically instead of being signalled by the
+        // reporting threads keeps their hot path lock-free. The wait
+        // condition is still used to react promptly to updateStats()
+        // and shutdown requests.
+        m_statsPipeCondition.wait(&m_statsPipeLock, kDrainIntervalMillis);
         // We want to process reports even when we are about to quit since we
         // want to print the most accurate stat report on shutdown.
         processIncomingStatReports();
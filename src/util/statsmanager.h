@@ -17,6 +17,7 @@
 #include "util/stat.h"
 #include "util/event.h"
 
+class QFile;
 class StatsManager;
 
 class StatsPipe final {
@@ -42,9 +43,20 @@ class StatsPipe final {
         return m_queue.capacity() - m_queue.size();
     }
 
+    // Identifies the thread this pipe belongs to, captured when the
+    // thread requested its pipe for the first time.
+    int traceThreadId() const {
+        return m_traceThreadId;
+    }
+    const QString& traceThreadName() const {
+        return m_traceThreadName;
+    }
+
   private:
     StatsManager* m_pManager;
     rigtorp::SPSCQueue<StatReport> m_queue;
+    int m_traceThreadId;
+    QString m_traceThreadName;
 };
 
 class StatsManager : public QThread, public Singleton<StatsManager> {
@@ -78,6 +90,7 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
     StatsPipe* getStatsPipeForThread();
     void onStatsPipeDestroyed(StatsPipe* pPipe);
     void writeTimeline(const QString& filename);
+    void writeChromeTrace(QFile* pFile);
 
     QAtomicInt m_emitAllStats;
     QAtomicInt m_quit;
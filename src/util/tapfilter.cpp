@@ -1,27 +1,40 @@
 #include "util/tapfilter.h"
 
 #include "moc_tapfilter.cpp"
+#include "util/time.h"
 
 TapFilter::TapFilter(QObject* pParent, int filterLength, mixxx::Duration maxInterval)
         : QObject(pParent),
+          m_hasLastTap(false),
           m_mean(MovingInterquartileMean(filterLength)),
           m_maxInterval(maxInterval) {
-    m_timer.start();
 }
 
 TapFilter::~TapFilter() {
 }
 
 void TapFilter::tap() {
+    tapAt(mixxx::Time::elapsed());
+}
+
+void TapFilter::tapAt(mixxx::Duration timestamp) {
     QMutexLocker locker(&m_mutex);
-    mixxx::Duration elapsed = m_timer.restart();
-    if (elapsed <= m_maxInterval) {
+    if (!m_hasLastTap) {
+        m_hasLastTap = true;
+        m_lastTapTime = timestamp;
+        return;
+    }
+    const mixxx::Duration elapsed = timestamp - m_lastTapTime;
+    m_lastTapTime = timestamp;
+    if (elapsed > mixxx::Duration::fromMillis(0) && elapsed <= m_maxInterval) {
         double averageLength = m_mean.insert(elapsed.toDoubleMillis());
         int numSamples = m_mean.size();
         locker.unlock();
         emit tapped(averageLength, numSamples);
     } else {
-        // Reset the filter
+        // Reset the filter. Negative intervals can happen when taps from
+        // differently clocked sources are mixed; treat them like a
+        // timeout.
         m_mean.clear();
     }
 }
@@ -5,7 +5,6 @@
 
 #include "util/duration.h"
 #include "util/movinginterquartilemean.h"
-#include "util/performancetimer.h"
 #include "util/types.h"
 
 class TapFilter : public QObject {
@@ -15,13 +14,23 @@ class TapFilter : public QObject {
     virtual ~TapFilter();
 
   public slots:
+    // Processes a tap timestamped with the current time. Prefer tapAt()
+    // when the time of the input event is known, since any delay until
+    // this slot runs adds jitter to the measured intervals.
     void tap();
+    // Processes a tap that happened at the given point in time. Only the
+    // differences between consecutive timestamps are used, so any
+    // monotonic clock works as long as consecutive taps come from the
+    // same source; a negative interval resets the filter just like an
+    // overlong one.
+    void tapAt(mixxx::Duration timestamp);
 
   signals:
     void tapped(double averageLength, int numSamples);
 
   private:
-    PerformanceTimer m_timer;
+    mixxx::Duration m_lastTapTime;
+    bool m_hasLastTap;
     MovingInterquartileMean m_mean;
     mixxx::Duration m_maxInterval;
     QMutex m_mutex;
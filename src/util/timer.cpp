@@ -81,17 +81,40 @@ mixxx::Duration SuspendableTimer::elapsed(bool report) {
     return m_leapTime;
 }
 
+namespace {
+// A low-priority timer is deferred for at most this many of its own
+// intervals while the tick chain is over budget, so shedding never starves
+// a subscriber entirely.
+constexpr int kMaxShedIntervals = 4;
+} // namespace
+
 GuiTickTimer::GuiTickTimer(QObject* pParent)
         : QObject(pParent),
           m_pGuiTick(make_parented<ControlProxy>(
               "[Master]", "guiTickTime", this)),
+          m_priority(Priority::Normal),
           m_bActive(false) {
 }
 
-void GuiTickTimer::start(mixxx::Duration duration) {
+void GuiTickTimer::start(mixxx::Duration interval, Priority priority) {
     m_pGuiTick->connectValueChanged(this, &GuiTickTimer::slotGuiTick);
-    m_interval = duration;
-    m_lastUpdate = mixxx::Duration::fromSeconds(0);
+    m_interval = interval;
+    m_priority = priority;
+    if (priority == Priority::Low && !m_pGuiTickOverBudget) {
+        m_pGuiTickOverBudget = make_parented<ControlProxy>(
+                "[Master]", "guiTickOverBudget", this);
+    }
+    // Stagger timers with the same interval across ticks, instead of having
+    // every one of them run its work on the very next render event.
+    const qint64 intervalNanos = m_interval.toIntegerNanos();
+    if (intervalNanos > 0) {
+        const qint64 phaseNanos = static_cast<qint64>(
+                reinterpret_cast<quintptr>(this) % intervalNanos);
+        m_lastUpdate = mixxx::Time::elapsed() - m_interval +
+                mixxx::Duration::fromNanos(phaseNanos);
+    } else {
+        m_lastUpdate = mixxx::Duration::fromSeconds(0);
+    }
     m_bActive = true;
 }
 
@@ -106,6 +129,14 @@ void GuiTickTimer::slotGuiTick(double) {
     if (m_bActive) {
         auto time = mixxx::Time::elapsed();
         if (time - m_lastUpdate >= m_interval) {
+            if (m_priority == Priority::Low &&
+                    m_pGuiTickOverBudget &&
+                    m_pGuiTickOverBudget->toBool() &&
+                    time - m_lastUpdate < m_interval * kMaxShedIntervals) {
+                // The tick chain is over budget; defer this subscriber
+                // until the load clears or it has waited long enough.
+                return;
+            }
             m_lastUpdate = time;
             emit timeout();
         }
@@ -115,9 +115,17 @@ class ScopedTimer {
 class GuiTickTimer : public QObject {
     Q_OBJECT
   public:
+    // Low-priority timers are deferred while GuiTick reports the 50ms tick
+    // chain over budget (e.g. during library scans), bounded so they are
+    // never starved entirely.
+    enum class Priority {
+        Normal,
+        Low,
+    };
+
     GuiTickTimer(QObject* pParent);
 
-    void start(mixxx::Duration interval);
+    void start(mixxx::Duration interval, Priority priority = Priority::Normal);
     bool isActive() const { return m_bActive; }
     void stop();
 
@@ -129,7 +137,9 @@ class GuiTickTimer : public QObject {
 
   private:
     parented_ptr<ControlProxy> m_pGuiTick;
+    parented_ptr<ControlProxy> m_pGuiTickOverBudget;
     mixxx::Duration m_interval;
     mixxx::Duration m_lastUpdate;
+    Priority m_priority;
     bool m_bActive;
 };
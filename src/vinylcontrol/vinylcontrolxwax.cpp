@@ -7,6 +7,7 @@
 #include "control/controlobject.h"
 #include "util/math.h"
 #include "util/defs.h"
+#include "util/sample.h"
 
 /****** TODO *******
    Stuff to maybe implement here
@@ -122,6 +123,9 @@ VinylControlXwax::VinylControlXwax(UserSettingsPointer pConfig, const QString& g
         qDebug() << "Failed to get sane latency, assuming 20 as a reasonable value";
         latency = 20;
     }
+    // Kept for compensating the audio round trip on position syncs, see
+    // syncPosition().
+    m_dLatency = latency;
 
     int iSampleRate = m_pConfig->getValueString(
         ConfigKey("[Soundcard]","Samplerate")).toULong();
@@ -207,17 +211,10 @@ void VinylControlXwax::analyzeSamples(CSAMPLE* pSamples, size_t nFrames) {
     }
 
     // Convert CSAMPLE samples to shorts, preventing overflow.
-    for (int i = 0; i < static_cast<int>(samplesSize); ++i) {
-        CSAMPLE sample = pSamples[i] * gain * SAMPLE_MAXIMUM;
-
-        if (sample > SAMPLE_MAXIMUM) {
-            m_pWorkBuffer[i] = SAMPLE_MAXIMUM;
-        } else if (sample < SAMPLE_MINIMUM) {
-            m_pWorkBuffer[i] = SAMPLE_MINIMUM;
-        } else {
-            m_pWorkBuffer[i] = static_cast<short>(sample);
-        }
-    }
+    SampleUtil::convertFloat32ToS16WithGain(m_pWorkBuffer,
+            pSamples,
+            gain,
+            static_cast<SINT>(samplesSize));
 
     // Submit the samples to the xwax timecode processor. The size argument is
     // in stereo frames.
@@ -746,8 +743,14 @@ double VinylControlXwax::checkSteadyPitch(double pitch, double time) {
 //Synchronize Mixxx's position to the position of the timecoded vinyl.
 void VinylControlXwax::syncPosition() {
     //qDebug() << "sync position" << m_dVinylPosition / m_dOldDuration;
+    // The decoded position tells us where the needle was when this buffer
+    // was captured, one audio round trip ago. The record kept moving in the
+    // meantime, so compensate with the reported latency to make needle
+    // drops land where the needle is now instead of ~one buffer behind.
+    double position = m_dVinylPosition +
+            timecoder_get_pitch(&timecoder) * m_dLatency / 1000.0;
     // VinylPos in seconds / total length of song.
-    vinylSeek->slotSet(m_dVinylPosition / m_dOldDuration);
+    vinylSeek->slotSet(position / m_dOldDuration);
 }
 
 bool VinylControlXwax::checkEnabled(bool was, bool is) {
@@ -131,6 +131,10 @@ class VinylControlXwax : public VinylControl {
     // with updates.
     double m_dUiUpdateTime;
 
+    // The configured audio buffer latency in milliseconds, used to
+    // compensate the audio round trip when syncing the position.
+    double m_dLatency;
+
     // Contains information that xwax's code needs internally about the timecode
     // and how to process it.
     struct timecoder timecoder;
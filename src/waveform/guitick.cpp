@@ -1,23 +1,59 @@
 #include <QTimer>
 
 #include "waveform/guitick.h"
+#include "control/controlcoalescer.h"
 #include "control/controlobject.h"
 
-GuiTick::GuiTick() {
+namespace {
+// Budget for the combined work of all guiTick50ms subscribers on one tick.
+// The 50ms tick shares the GUI thread with waveform rendering; subscribers
+// that together exceed this make the whole chain (and the next render) late.
+constexpr double kTick50msBudgetSeconds = 0.010;
+// Number of consecutive over- (or under-) budget ticks before the shedding
+// flag flips, so a single slow tick does not toggle subscribers on and off.
+constexpr int kOverBudgetThresholdTicks = 3;
+} // namespace
+
+GuiTick::GuiTick()
+        : m_overBudgetTicks(0) {
     m_pCOGuiTickTime = std::make_unique<ControlObject>(ConfigKey("[Master]", "guiTickTime"));
     m_pCOGuiTick50ms = std::make_unique<ControlObject>(ConfigKey("[Master]", "guiTick50ms"));
+    m_pCOGuiTick50msCost = std::make_unique<ControlObject>(
+            ConfigKey("[Master]", "guiTick50msCost"));
+    m_pCOGuiTickOverBudget = std::make_unique<ControlObject>(
+            ConfigKey("[Master]", "guiTickOverBudget"));
     m_cpuTimer.start();
 }
 
 // this is called from WaveformWidgetFactory::render in the main thread with the
 // configured waveform frame rate
 void GuiTick::process() {
+    // Deliver coalesced control updates (one per control per GUI frame)
+    // before updating the tick COs, so widgets paint the latest values.
+    ControlCoalescer::flush();
+
     m_cpuTimeLastTick += m_cpuTimer.restart();
     double cpuTimeLastTickSeconds = m_cpuTimeLastTick.toDoubleSeconds();
     m_pCOGuiTickTime->set(cpuTimeLastTickSeconds);
 
     if (m_cpuTimeLastTick - m_lastUpdateTime >= mixxx::Duration::fromMillis(50)) {
         m_lastUpdateTime = m_cpuTimeLastTick;
+        // The subscribers run synchronously from this set() call, so timing
+        // it measures the whole 50ms tick chain.
+        PerformanceTimer fanoutTimer;
+        fanoutTimer.start();
         m_pCOGuiTick50ms->set(cpuTimeLastTickSeconds);
+        const double fanoutSeconds = fanoutTimer.elapsed().toDoubleSeconds();
+        m_pCOGuiTick50msCost->set(fanoutSeconds);
+
+        if (fanoutSeconds > kTick50msBudgetSeconds) {
+            if (m_overBudgetTicks < kOverBudgetThresholdTicks) {
+                m_overBudgetTicks++;
+            }
+        } else if (m_overBudgetTicks > 0) {
+            m_overBudgetTicks--;
+        }
+        m_pCOGuiTickOverBudget->set(
+                m_overBudgetTicks >= kOverBudgetThresholdTicks ? 1.0 : 0.0);
     }
 }
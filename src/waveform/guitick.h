@@ -17,7 +17,15 @@ class GuiTick {
   private:
     std::unique_ptr<ControlObject> m_pCOGuiTickTime;
     std::unique_ptr<ControlObject> m_pCOGuiTick50ms;
+    // Cost of the last 50ms fan-out in seconds, i.e. the combined work of
+    // all slots connected to guiTick50ms. Exposed so the tick chain can be
+    // inspected at runtime.
+    std::unique_ptr<ControlObject> m_pCOGuiTick50msCost;
+    // Set to 1.0 while the 50ms fan-out repeatedly exceeds its budget.
+    // Low-priority GuiTickTimers shed their work while this is set.
+    std::unique_ptr<ControlObject> m_pCOGuiTickOverBudget;
     PerformanceTimer m_cpuTimer;
     mixxx::Duration m_lastUpdateTime;
     mixxx::Duration m_cpuTimeLastTick;
+    int m_overBudgetTicks;
 };
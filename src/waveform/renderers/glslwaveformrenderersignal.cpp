@@ -6,6 +6,7 @@
 
 #include "moc_glslwaveformrenderersignal.cpp"
 #include "track/track.h"
+#include "util/math.h"
 #include "waveform/renderers/waveformwidgetrenderer.h"
 #include "waveform/waveform.h"
 #include "waveform/waveformwidgetfactory.h"
@@ -16,6 +17,8 @@ GLSLWaveformRendererSignal::GLSLWaveformRendererSignal(WaveformWidgetRenderer* w
         : WaveformRendererSignalBase(waveformWidgetRenderer),
           m_unitQuadListId(-1),
           m_textureId(0),
+          m_allocatedTextureWidth(0),
+          m_allocatedTextureHeight(0),
           m_textureRenderedWaveformCompletion(0),
           m_bDumpPng(false),
           m_shadersValid(false),
@@ -126,9 +129,13 @@ bool GLSLWaveformRendererSignal::loadTexture() {
         if (error) {
             qDebug() << "GLSLWaveformRendererSignal::loadTexture - glTexImage2D error" << error;
         }
+        m_allocatedTextureWidth = textureWidth;
+        m_allocatedTextureHeight = textureHeight;
     } else {
         glDeleteTextures(1, &m_textureId);
         m_textureId = 0;
+        m_allocatedTextureWidth = 0;
+        m_allocatedTextureHeight = 0;
     }
 
     glDisable(GL_TEXTURE_2D);
@@ -136,6 +143,41 @@ bool GLSLWaveformRendererSignal::loadTexture() {
     return true;
 }
 
+void GLSLWaveformRendererSignal::updateTexture(
+        const Waveform* waveform, int fromIndex, int toIndex) {
+    const int textureWidth = waveform->getTextureStride();
+    const int textureHeight = waveform->getTextureSize() / waveform->getTextureStride();
+    if (m_textureId == 0 ||
+            textureWidth != m_allocatedTextureWidth ||
+            textureHeight != m_allocatedTextureHeight) {
+        // The texture was not (or not for this waveform) allocated yet.
+        loadTexture();
+        return;
+    }
+    if (fromIndex >= toIndex) {
+        return;
+    }
+
+    // One data element is one RGBA texel, laid out row by row with
+    // getTextureStride() texels per row. Upload only the rows that contain
+    // new data instead of re-uploading the entire texture on every repaint
+    // while the analyzer is running.
+    const int firstRow = fromIndex / textureWidth;
+    const int lastRow = math_min((toIndex - 1) / textureWidth, textureHeight - 1);
+    const WaveformData* data = waveform->data();
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, m_textureId);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow,
+            textureWidth, lastRow - firstRow + 1,
+            GL_RGBA, GL_UNSIGNED_BYTE, data + firstRow * textureWidth);
+    int error = glGetError();
+    if (error) {
+        qDebug() << "GLSLWaveformRendererSignal::updateTexture - glTexSubImage2D error" << error;
+    }
+    glDisable(GL_TEXTURE_2D);
+}
+
 void GLSLWaveformRendererSignal::createGeometry() {
 
     if (m_unitQuadListId != -1) {
@@ -285,7 +327,9 @@ void GLSLWaveformRendererSignal::draw(QPainter* painter, QPaintEvent* /*event*/)
     // do not remove currenCompletion temp variable !
     const int currentCompletion = waveform->getCompletion();
     if (m_textureRenderedWaveformCompletion < currentCompletion) {
-        loadTexture();
+        updateTexture(waveform.data(),
+                m_textureRenderedWaveformCompletion,
+                currentCompletion);
         m_textureRenderedWaveformCompletion = currentCompletion;
     }
 
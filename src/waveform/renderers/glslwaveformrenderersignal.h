@@ -10,6 +10,8 @@
 QT_FORWARD_DECLARE_CLASS(QGLFramebufferObject)
 QT_FORWARD_DECLARE_CLASS(QGLShaderProgram)
 
+class Waveform;
+
 class GLSLWaveformRendererSignal : public QObject,
                                    public WaveformRendererSignalBase,
                                    public GLWaveformRenderer {
@@ -43,9 +45,19 @@ class GLSLWaveformRendererSignal : public QObject,
   private:
     void createGeometry();
     void createFrameBuffers();
+    // Uploads only the texture rows covering the data elements in
+    // [fromIndex, toIndex). Used while the analyzer is still filling the
+    // waveform, where a full glTexImage2D upload per repaint would stall the
+    // render thread. Falls back to loadTexture() if the allocated texture
+    // does not match the waveform.
+    void updateTexture(const Waveform* waveform, int fromIndex, int toIndex);
 
     GLint m_unitQuadListId;
     GLuint m_textureId;
+    // Dimensions the texture was allocated with by loadTexture(), zero if no
+    // texture is allocated.
+    int m_allocatedTextureWidth;
+    int m_allocatedTextureHeight;
 
     TrackPointer m_loadedTrack;
     int m_textureRenderedWaveformCompletion;
@@ -2,6 +2,8 @@
 #include <QPaintEvent>
 #include <QPainter>
 
+#include <algorithm>
+
 #include "waveform/renderers/waveformrenderbeat.h"
 
 #include "control/controlobject.h"
@@ -12,7 +14,9 @@
 #include "util/painterscope.h"
 
 WaveformRenderBeat::WaveformRenderBeat(WaveformWidgetRenderer* waveformWidgetRenderer)
-        : WaveformRendererAbstract(waveformWidgetRenderer) {
+        : WaveformRendererAbstract(waveformWidgetRenderer),
+          m_cachedFirstSample(0.0),
+          m_cachedLastSample(0.0) {
     m_beats.resize(128);
 }
 
@@ -56,12 +60,22 @@ void WaveformRenderBeat::draw(QPainter* painter, QPaintEvent* /*event*/) {
     //          << "firstDisplayedPosition" << firstDisplayedPosition
     //          << "lastDisplayedPosition" << lastDisplayedPosition;
 
-    std::unique_ptr<mixxx::BeatIterator> it(trackBeats->findBeats(
-            firstDisplayedPosition * trackSamples,
-            lastDisplayedPosition * trackSamples));
+    const double firstDisplayedSample = firstDisplayedPosition * trackSamples;
+    const double lastDisplayedSample = lastDisplayedPosition * trackSamples;
+
+    updateBeatCache(trackBeats, firstDisplayedSample, lastDisplayedSample, trackSamples);
+
+    // The cached window is a superset of the displayed range; narrow it down
+    // to the beats that are actually on screen.
+    const auto firstVisible = std::lower_bound(m_beatPositions.constBegin(),
+            m_beatPositions.constEnd(),
+            firstDisplayedSample);
+    const auto lastVisible = std::upper_bound(firstVisible,
+            m_beatPositions.constEnd(),
+            lastDisplayedSample);
 
     // if no beat do not waste time saving/restoring painter
-    if (!it || !it->hasNext()) {
+    if (firstVisible == lastVisible) {
         return;
     }
 
@@ -79,10 +93,9 @@ void WaveformRenderBeat::draw(QPainter* painter, QPaintEvent* /*event*/) {
 
     int beatCount = 0;
 
-    while (it->hasNext()) {
-        double beatPosition = it->next();
+    for (auto it = firstVisible; it != lastVisible; ++it) {
         double xBeatPoint =
-                m_waveformRenderer->transformSamplePositionInRendererWorld(beatPosition);
+                m_waveformRenderer->transformSamplePositionInRendererWorld(*it);
 
         xBeatPoint = qRound(xBeatPoint);
 
@@ -101,3 +114,31 @@ void WaveformRenderBeat::draw(QPainter* painter, QPaintEvent* /*event*/) {
     // Make sure to use constData to prevent detaches!
     painter->drawLines(m_beats.constData(), beatCount);
 }
+
+void WaveformRenderBeat::updateBeatCache(const mixxx::BeatsPointer& trackBeats,
+        double firstDisplayedSample,
+        double lastDisplayedSample,
+        int trackSamples) {
+    if (trackBeats == m_pCachedBeats &&
+            firstDisplayedSample >= m_cachedFirstSample &&
+            lastDisplayedSample <= m_cachedLastSample) {
+        return;
+    }
+
+    // Cache one displayed span of lookahead on both sides so steady scrolling
+    // at the current zoom only requires a refill every few seconds.
+    const double displayedSpan = lastDisplayedSample - firstDisplayedSample;
+    m_cachedFirstSample = std::max(0.0, firstDisplayedSample - displayedSpan);
+    m_cachedLastSample = std::min(static_cast<double>(trackSamples),
+            lastDisplayedSample + displayedSpan);
+
+    m_beatPositions.clear();
+    std::unique_ptr<mixxx::BeatIterator> it(
+            trackBeats->findBeats(m_cachedFirstSample, m_cachedLastSample));
+    if (it) {
+        while (it->hasNext()) {
+            m_beatPositions.append(it->next());
+        }
+    }
+    m_pCachedBeats = trackBeats;
+}
@@ -3,6 +3,7 @@
 #include <QColor>
 
 #include "skin/skincontext.h"
+#include "track/beats.h"
 #include "util/class.h"
 #include "waveform/renderers/waveformrendererabstract.h"
 
@@ -15,8 +16,24 @@ class WaveformRenderBeat : public WaveformRendererAbstract {
     virtual void draw(QPainter* painter, QPaintEvent* event);
 
   private:
+    // Refill m_beatPositions from trackBeats if the cached window no longer
+    // covers the displayed sample range.
+    void updateBeatCache(const mixxx::BeatsPointer& trackBeats,
+            double firstDisplayedSample,
+            double lastDisplayedSample,
+            int trackSamples);
+
     QColor m_beatColor;
     QVector<QLineF> m_beats;
 
+    // Beat sample positions cached for a window around the displayed range,
+    // so scrolling does not create and iterate a BeatIterator every frame.
+    // The cache holds a reference to the Beats it was built from; any grid
+    // edit replaces the track's Beats object, which invalidates it.
+    mixxx::BeatsPointer m_pCachedBeats;
+    QVector<double> m_beatPositions;
+    double m_cachedFirstSample;
+    double m_cachedLastSample;
+
     DISALLOW_COPY_AND_ASSIGN(WaveformRenderBeat);
 };
@@ -69,6 +69,14 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
     const double gain = (lastVisualIndex - firstVisualIndex) /
             (double)m_waveformRenderer->getLength();
 
+    // Pick the summary level matching the zoom so that the per-pixel max
+    // loop below iterates over a handful of entries regardless of how far
+    // the waveform is zoomed out.
+    int summaryShift = 0;
+    int summaryDataSize = dataSize;
+    const WaveformData* summaryData = waveform->summaryForFramesPerPixel(
+            gain / 2.0, &summaryShift, &summaryDataSize);
+
     // Per-band gain from the EQ knobs.
     float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
     getGains(&allGain, &lowGain, &midGain, &highGain);
@@ -124,6 +132,11 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
+        // Map the base frame window onto the selected summary level; each
+        // summary frame covers (1 << summaryShift) base frames.
+        visualFrameStart >>= summaryShift;
+        visualFrameStop >>= summaryShift;
+
         int visualIndexStart = visualFrameStart * 2;
         int visualIndexStop = visualFrameStop * 2;
 
@@ -143,9 +156,9 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
         unsigned char maxHigh[2] = {0, 0};
 
         for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = *(data + i);
-            const WaveformData& waveformDataNext = *(data + i + 1);
+             i >= 0 && i + 1 < summaryDataSize && i + 1 <= visualIndexStop; i += 2) {
+            const WaveformData& waveformData = *(summaryData + i);
+            const WaveformData& waveformDataNext = *(summaryData + i + 1);
             maxLow[0] = math_max(maxLow[0], waveformData.filtered.low);
             maxLow[1] = math_max(maxLow[1], waveformDataNext.filtered.low);
             maxMid[0] = math_max(maxMid[0], waveformData.filtered.mid);
@@ -63,6 +63,14 @@ void WaveformRendererRGB::draw(QPainter* painter,
     const double gain = (lastVisualIndex - firstVisualIndex) /
             (double)m_waveformRenderer->getLength();
 
+    // Pick the summary level matching the zoom so that the per-pixel max
+    // loop below iterates over a handful of entries regardless of how far
+    // the waveform is zoomed out.
+    int summaryShift = 0;
+    int summaryDataSize = dataSize;
+    const WaveformData* summaryData = waveform->summaryForFramesPerPixel(
+            gain / 2.0, &summaryShift, &summaryDataSize);
+
     // Per-band gain from the EQ knobs.
     float allGain(1.0), lowGain(1.0), midGain(1.0), highGain(1.0);
     getGains(&allGain, &lowGain, &midGain, &highGain);
@@ -110,6 +118,11 @@ void WaveformRendererRGB::draw(QPainter* painter,
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
+        // Map the base frame window onto the selected summary level; each
+        // summary frame covers (1 << summaryShift) base frames.
+        visualFrameStart >>= summaryShift;
+        visualFrameStop >>= summaryShift;
+
         int visualIndexStart = visualFrameStart * 2;
         int visualIndexStop  = visualFrameStop * 2;
 
@@ -120,9 +133,9 @@ void WaveformRendererRGB::draw(QPainter* painter,
         float maxAllNext = 0.;
 
         for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = data[i];
-            const WaveformData& waveformDataNext = data[i + 1];
+             i >= 0 && i + 1 < summaryDataSize && i + 1 <= visualIndexStop; i += 2) {
+            const WaveformData& waveformData = summaryData[i];
+            const WaveformData& waveformDataNext = summaryData[i + 1];
 
             maxLow  = math_max3(maxLow,  waveformData.filtered.low,  waveformDataNext.filtered.low);
             maxMid  = math_max3(maxMid,  waveformData.filtered.mid,  waveformDataNext.filtered.mid);
@@ -198,14 +198,19 @@ void WaveformRenderMark::slotCuesUpdated() {
 
         QString newLabel = pCue->getLabel();
         QColor newColor = mixxx::RgbColor::toQColor(pCue->getColor());
-        if (pMark->m_text.isNull() || newLabel != pMark->m_text ||
-                !pMark->fillColor().isValid() ||
-                newColor != pMark->fillColor()) {
-            pMark->m_text = newLabel;
-            int dimBrightThreshold = m_waveformRenderer->getDimBrightThreshold();
-            pMark->setBaseColor(newColor, dimBrightThreshold);
-            generateMarkImage(pMark);
+        if (!pMark->m_image.isNull() && newLabel == pMark->m_text &&
+                newColor == pMark->fillColor()) {
+            // The rendered mark image is still up to date. Cues also fire
+            // updates when only their position changes (e.g. continuously
+            // while a loop is dragged); positioning happens in draw(), so
+            // the image must not be regenerated for those.
+            continue;
         }
+        pMark->m_text = newLabel;
+        int dimBrightThreshold = m_waveformRenderer->getDimBrightThreshold();
+        pMark->setBaseColor(newColor, dimBrightThreshold);
+        generateMarkImage(pMark);
+        m_waveformRenderer->markDirty();
     }
 }
 
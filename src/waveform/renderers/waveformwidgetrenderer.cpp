@@ -19,6 +19,12 @@ const double WaveformWidgetRenderer::s_defaultPlayMarkerPosition = 0.5;
 
 namespace {
 constexpr int kDefaultDimBrightThreshold = 127;
+
+// Upper bound on how many render ticks a widget may be skipped by the damage
+// tracking. This catches the few inputs that are not part of the tracked
+// render state (e.g. hotcue or beat grid edits while the deck is paused)
+// without rebuilding the full dependency graph of all sub-renderers.
+constexpr int kMaxFramesWithoutRepaint = 15;
 } // namespace
 
 WaveformWidgetRenderer::WaveformWidgetRenderer(const QString& group)
@@ -49,8 +55,11 @@ WaveformWidgetRenderer::WaveformWidgetRenderer(const QString& group)
           m_gain(1.0),
           m_pTrackSamplesControlObject(nullptr),
           m_trackSamples(0.0),
+          m_pEndOfTrackControlObject(nullptr),
           m_scaleFactor(1.0),
-          m_playMarkerPosition(s_defaultPlayMarkerPosition) {
+          m_playMarkerPosition(s_defaultPlayMarkerPosition),
+          m_dirty(true),
+          m_framesSinceLastRender(0) {
     //qDebug() << "WaveformWidgetRenderer";
 
 #ifdef WAVEFORMWIDGETRENDERER_DEBUG
@@ -77,6 +86,7 @@ WaveformWidgetRenderer::~WaveformWidgetRenderer() {
     delete m_pRateRatioCO;
     delete m_pGainControlObject;
     delete m_pTrackSamplesControlObject;
+    delete m_pEndOfTrackControlObject;
 
 #ifdef WAVEFORMWIDGETRENDERER_DEBUG
     delete m_timer;
@@ -94,6 +104,8 @@ bool WaveformWidgetRenderer::init() {
             m_group, "total_gain");
     m_pTrackSamplesControlObject = new ControlProxy(
             m_group, "track_samples");
+    m_pEndOfTrackControlObject = new ControlProxy(
+            m_group, "end_of_track");
 
     for (int i = 0; i < m_rendererStack.size(); ++i) {
         if (!m_rendererStack[i]->init()) {
@@ -107,6 +119,13 @@ void WaveformWidgetRenderer::onPreRender(VSyncThread* vsyncThread) {
     // For a valid track to render we need
     m_trackSamples = static_cast<int>(m_pTrackSamplesControlObject->get());
     if (m_trackSamples <= 0) {
+        // Keep the damage tracking up to date so ejecting a track repaints
+        // the background exactly once.
+        m_pendingRenderState = RenderState();
+        m_pendingRenderState.trackSamples = m_trackSamples;
+        if (!(m_pendingRenderState == m_renderedState)) {
+            m_dirty = true;
+        }
         return;
     }
 
@@ -124,11 +143,13 @@ void WaveformWidgetRenderer::onPreRender(VSyncThread* vsyncThread) {
     double visualSamplePerPixel = m_zoomFactor * m_rateRatio / m_scaleFactor;
     m_visualSamplePerPixel = math_max(0.01, visualSamplePerPixel);
 
+    int waveformCompletion = -1;
     TrackPointer pTrack = m_pTrack;
     if (pTrack) {
         ConstWaveformPointer pWaveform = pTrack->getWaveform();
         if (pWaveform) {
             m_audioVisualRatio = pWaveform->getAudioVisualRatio();
+            waveformCompletion = pWaveform->getCompletion();
         }
     }
 
@@ -166,6 +187,25 @@ void WaveformWidgetRenderer::onPreRender(VSyncThread* vsyncThread) {
         m_playPos = -1; // disable renderers
     }
 
+    // Collect the inputs of the image we are about to render. If nothing
+    // changed since the last rendered frame, the widget does not need to be
+    // repainted this tick. The end-of-track overlay pulses with wall clock
+    // time while active, so it always requires repainting.
+    m_pendingRenderState.playPos = m_playPos;
+    m_pendingRenderState.firstDisplayedPosition = m_firstDisplayedPosition;
+    m_pendingRenderState.lastDisplayedPosition = m_lastDisplayedPosition;
+    m_pendingRenderState.gain = m_gain;
+    m_pendingRenderState.trackSamples = m_trackSamples;
+    m_pendingRenderState.completion = waveformCompletion;
+    m_pendingRenderState.width = m_width;
+    m_pendingRenderState.height = m_height;
+    m_pendingRenderState.pTrack = pTrack.get();
+    if (!(m_pendingRenderState == m_renderedState) ||
+            m_pEndOfTrackControlObject->toBool() ||
+            ++m_framesSinceLastRender >= kMaxFramesWithoutRepaint) {
+        m_dirty = true;
+    }
+
     //qDebug() << "WaveformWidgetRenderer::onPreRender" <<
     //        "m_group" << m_group <<
     //        "m_trackSamples" << m_trackSamples <<
@@ -347,6 +387,13 @@ void WaveformWidgetRenderer::setZoom(double zoom) {
 
 void WaveformWidgetRenderer::setDisplayBeatGridAlpha(int alpha) {
     m_alphaBeatGrid = alpha;
+    markDirty();
+}
+
+void WaveformWidgetRenderer::markClean() {
+    m_renderedState = m_pendingRenderState;
+    m_framesSinceLastRender = 0;
+    m_dirty = false;
 }
 
 void WaveformWidgetRenderer::setTrack(TrackPointer track) {
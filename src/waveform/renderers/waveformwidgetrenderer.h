@@ -36,6 +36,21 @@ class WaveformWidgetRenderer {
     void onPreRender(VSyncThread* vsyncThread);
     void draw(QPainter* painter, QPaintEvent* event);
 
+    // Damage tracking. onPreRender() compares the inputs of the rendered
+    // image against the last frame that was passed to markClean() and raises
+    // the dirty flag when they differ, so the factory can skip repainting
+    // widgets whose on-screen content cannot have changed.
+    bool isDirty() const {
+        return m_dirty;
+    }
+    // Forces a repaint on the next render tick regardless of the tracked
+    // state, e.g. after the widget was hidden or a mark image changed.
+    void markDirty() {
+        m_dirty = true;
+    }
+    // Called by the factory after the frame was actually rendered.
+    void markClean();
+
     const QString& getGroup() const {
         return m_group;
     }
@@ -154,6 +169,34 @@ class WaveformWidgetRenderer {
     }
 
   protected:
+    // Snapshot of the inputs that determine the rendered image, used for the
+    // damage tracking above. Mark and beat edits are not part of the snapshot;
+    // they are either reported through markDirty() or picked up by the
+    // periodic forced repaint in onPreRender().
+    struct RenderState {
+        double playPos = -2.0;
+        double firstDisplayedPosition = 0.0;
+        double lastDisplayedPosition = 0.0;
+        double gain = 0.0;
+        int trackSamples = -1;
+        int completion = -1;
+        int width = -1;
+        int height = -1;
+        const Track* pTrack = nullptr;
+
+        bool operator==(const RenderState& other) const {
+            return playPos == other.playPos &&
+                    firstDisplayedPosition == other.firstDisplayedPosition &&
+                    lastDisplayedPosition == other.lastDisplayedPosition &&
+                    gain == other.gain &&
+                    trackSamples == other.trackSamples &&
+                    completion == other.completion &&
+                    width == other.width &&
+                    height == other.height &&
+                    pTrack == other.pTrack;
+        }
+    };
+
     const QString m_group;
     TrackPointer m_pTrack;
     QList<WaveformRendererAbstract*> m_rendererStack;
@@ -187,9 +230,15 @@ class WaveformWidgetRenderer {
     double m_gain;
     ControlProxy* m_pTrackSamplesControlObject;
     int m_trackSamples;
+    ControlProxy* m_pEndOfTrackControlObject;
     double m_scaleFactor;
     double m_playMarkerPosition;   // 0.0 - left, 0.5 - center, 1.0 - right
 
+    bool m_dirty;
+    int m_framesSinceLastRender;
+    RenderState m_pendingRenderState;
+    RenderState m_renderedState;
+
 #ifdef WAVEFORMWIDGETRENDERER_DEBUG
     PerformanceTimer* m_timer;
     int m_lastFrameTime;
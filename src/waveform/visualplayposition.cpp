@@ -2,8 +2,6 @@
 
 #include <QtDebug>
 
-#include "control/controlobject.h"
-#include "control/controlproxy.h"
 #include "moc_visualplayposition.cpp"
 #include "util/math.h"
 #include "waveform/vsyncthread.h"
@@ -13,7 +11,6 @@ namespace {
 // This should be sufficiant to compensate jitter,
 // but does not continue in case of underflows.
 constexpr int kMaxOffsetBufferCnt = 2;
-constexpr int kMicrosPerMillis = 1000; // 1 ms contains 1000 µs
 } // anonymous namespace
 
 
@@ -25,10 +22,6 @@ double VisualPlayPosition::m_dCallbackEntryToDacSecs = 0;
 VisualPlayPosition::VisualPlayPosition(const QString& key)
         : m_valid(false),
           m_key(key) {
-    m_audioBufferSize = new ControlProxy(
-            "[Master]", "audio_buffer_size", this);
-    m_audioBufferSize->connectValueChanged(this, &VisualPlayPosition::slotAudioBufferSizeChanged);
-    m_audioBufferMicros = static_cast<int>(m_audioBufferSize->get() * kMicrosPerMillis);
 }
 
 VisualPlayPosition::~VisualPlayPosition() {
@@ -36,7 +29,8 @@ VisualPlayPosition::~VisualPlayPosition() {
 }
 
 void VisualPlayPosition::set(double playPos, double rate, double positionStep,
-        double slipPosition, double tempoTrackSeconds) {
+        double slipPosition, double tempoTrackSeconds,
+        int audioBufferMicros) {
     VisualPlayPositionData data;
     data.m_referenceTime = m_timeInfoTime;
     data.m_callbackEntrytoDac = static_cast<int>(m_dCallbackEntryToDacSecs * 1000000); // s to µs
@@ -45,12 +39,28 @@ void VisualPlayPosition::set(double playPos, double rate, double positionStep,
     data.m_positionStep = positionStep;
     data.m_slipPosition = slipPosition;
     data.m_tempoTrackSeconds = tempoTrackSeconds;
+    data.m_audioBufferMicros = audioBufferMicros;
 
     // Atomic write
     m_data.setValue(data);
     m_valid = true;
 }
 
+double VisualPlayPosition::calcPosAtNextVSync(
+        VSyncThread* vSyncThread, const VisualPlayPositionData& data) {
+    double playPos = data.m_enginePlayPos;  // load playPos for the first sample in Buffer
+    if (data.m_audioBufferMicros > 0) {
+        int refToVSync = vSyncThread->fromTimerToNextSyncMicros(data.m_referenceTime);
+        int offset = refToVSync - data.m_callbackEntrytoDac;
+        offset = math_min(offset, data.m_audioBufferMicros * kMaxOffsetBufferCnt);
+        // add the offset for the position of the sample that will be transferred to the DAC
+        // When the next display frame is displayed
+        playPos += data.m_positionStep * offset * data.m_rate / data.m_audioBufferMicros;
+    }
+    //qDebug() << "playPos" << playPos;
+    return playPos;
+}
+
 double VisualPlayPosition::getAtNextVSync(VSyncThread* vSyncThread) {
     //static double testPos = 0;
     //testPos += 0.000017759; //0.000016608; //  1.46257e-05;
@@ -58,15 +68,7 @@ double VisualPlayPosition::getAtNextVSync(VSyncThread* vSyncThread) {
 
     if (m_valid) {
         VisualPlayPositionData data = m_data.getValue();
-        int refToVSync = vSyncThread->fromTimerToNextSyncMicros(data.m_referenceTime);
-        int offset = refToVSync - data.m_callbackEntrytoDac;
-        offset = math_min(offset, m_audioBufferMicros * kMaxOffsetBufferCnt);
-        double playPos = data.m_enginePlayPos;  // load playPos for the first sample in Buffer
-        // add the offset for the position of the sample that will be transferred to the DAC
-        // When the next display frame is displayed
-        playPos += data.m_positionStep * offset * data.m_rate / m_audioBufferMicros;
-        //qDebug() << "playPos" << playPos << offset;
-        return playPos;
+        return calcPosAtNextVSync(vSyncThread, data);
     }
     return -1;
 }
@@ -78,12 +80,7 @@ void VisualPlayPosition::getPlaySlipAtNextVSync(VSyncThread* vSyncThread, double
 
     if (m_valid) {
         VisualPlayPositionData data = m_data.getValue();
-        int refToVSync = vSyncThread->fromTimerToNextSyncMicros(data.m_referenceTime);
-        int offset = refToVSync - data.m_callbackEntrytoDac;
-        offset = math_min(offset, m_audioBufferMicros * kMaxOffsetBufferCnt);
-        double playPos = data.m_enginePlayPos;  // load playPos for the first sample in Buffer
-        playPos += data.m_positionStep * offset * data.m_rate / m_audioBufferMicros;
-        *pPlayPosition = playPos;
+        *pPlayPosition = calcPosAtNextVSync(vSyncThread, data);
         *pSlipPosition = data.m_slipPosition;
     }
 }
@@ -108,10 +105,6 @@ void VisualPlayPosition::getTrackTime(double* pPlayPosition, double* pTempoTrack
     }
 }
 
-void VisualPlayPosition::slotAudioBufferSizeChanged(double sizeMillis) {
-    m_audioBufferMicros = static_cast<int>(sizeMillis * kMicrosPerMillis);
-}
-
 //static
 QSharedPointer<VisualPlayPosition> VisualPlayPosition::getVisualPlayPosition(const QString& group) {
     QSharedPointer<VisualPlayPosition> vpp = m_listVisualPlayPosition.value(group);
@@ -8,7 +8,6 @@
 #include "util/performancetimer.h"
 #include "control/controlvalue.h"
 
-class ControlProxy;
 class VSyncThread;
 
 // This class is for synchronizing the sound device DAC time with the waveforms, displayed on the
@@ -34,6 +33,12 @@ class VisualPlayPositionData {
     double m_positionStep;
     double m_slipPosition;
     double m_tempoTrackSeconds; // total track time, taking the current tempo into account
+    // Duration of the processed buffer, measured in the engine from the
+    // actual callback buffer size and sample rate. Scaling the extrapolation
+    // with this instead of the configured latency keeps the predicted
+    // position accurate when the device period differs from the
+    // configuration.
+    int m_audioBufferMicros;
 };
 
 
@@ -46,7 +51,8 @@ class VisualPlayPosition : public QObject {
     // WARNING: Not thread safe. This function must be called only from the
     // engine thread.
     void set(double playPos, double rate, double positionStep,
-            double slipPosition, double tempoTrackSeconds);
+            double slipPosition, double tempoTrackSeconds,
+            int audioBufferMicros);
     double getAtNextVSync(VSyncThread* vsyncThread);
     void getPlaySlipAtNextVSync(VSyncThread* vSyncThread, double* playPosition, double* slipPosition);
     double getEnginePlayPos();
@@ -61,13 +67,11 @@ class VisualPlayPosition : public QObject {
 
     void setInvalid() { m_valid = false; };
 
-  private slots:
-    void slotAudioBufferSizeChanged(double sizeMs);
-
   private:
+    double calcPosAtNextVSync(VSyncThread* vSyncThread,
+            const VisualPlayPositionData& data);
+
     ControlValueAtomic<VisualPlayPositionData> m_data;
-    ControlProxy* m_audioBufferSize;
-    int m_audioBufferMicros; // Audio buffer size in µs
     bool m_valid;
     QString m_key;
 
@@ -6,10 +6,17 @@
 #include <QtDebug>
 
 #include "moc_vsyncthread.cpp"
+#include "util/event.h"
 #include "util/math.h"
 #include "util/performancetimer.h"
 #include "waveform/guitick.h"
 
+namespace {
+// Spans for the recorded timeline (--developer --timeline <file>)
+const QString kRenderTag = QStringLiteral("VSyncThread render");
+const QString kSwapTag = QStringLiteral("VSyncThread swap");
+} // namespace
+
 VSyncThread::VSyncThread(QObject* pParent)
         : QThread(pParent),
           m_bDoRendering(true),
@@ -53,11 +60,13 @@ void VSyncThread::run() {
             m_waitToSwapMicros = 1000;
             usleep(1000);
         } else { // if (m_vSyncMode == ST_TIMER) {
+            Event::start(kRenderTag);
             emit vsyncRender(); // renders the new waveform.
 
             // wait until rendering was scheduled. It might be delayed due a
             // pending swap (depends one driver vSync settings)
             m_semaVsyncSlot.acquire();
+            Event::end(kRenderTag);
 
             // qDebug() << "ST_TIMER                      " << lastMicros << restMicros;
             int remainingForSwap = m_waitToSwapMicros - static_cast<int>(
@@ -68,11 +77,13 @@ void VSyncThread::run() {
             }
 
             // swaps the new waveform to front in case of gl-wf
+            Event::start(kSwapTag);
             emit vsyncSwap();
 
             // wait until swap occurred. It might be delayed due to driver vSync
             // settings.
             m_semaVsyncSlot.acquire();
+            Event::end(kSwapTag);
 
             // <- Assume we are VSynced here ->
             int lastSwapTime = static_cast<int>(m_timer.restart().toIntegerMicros());
@@ -2,6 +2,8 @@
 
 #include "waveform/waveform.h"
 #include "proto/waveform.pb.h"
+#include "util/assert.h"
+#include "util/math.h"
 
 using namespace mixxx::track;
 
@@ -24,7 +26,8 @@ Waveform::Waveform(const QByteArray& data)
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
           m_textureStride(computeTextureStride(0)),
-          m_completion(-1) {
+          m_completion(-1),
+          m_summaryLevelCount(0) {
     readByteArray(data);
 }
 
@@ -36,7 +39,8 @@ Waveform::Waveform(int audioSampleRate, int audioSamples,
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
           m_textureStride(1024),
-          m_completion(-1) {
+          m_completion(-1),
+          m_summaryLevelCount(0) {
     int numberOfVisualSamples = 0;
     if (audioSampleRate > 0) {
         if (maxVisualSamples == -1) {
@@ -106,18 +110,39 @@ QByteArray Waveform::toByteArray() const {
     high->set_units(io::Waveform::RMS);
     high->set_channels(numChannels);
 
+    // Since Waveform-6.0 every band is stored as one delta-encoded byte per
+    // value instead of a varint per value. Neighboring visual frames differ
+    // only slightly, so the deltas cluster around zero and the blob shrinks
+    // far better under the qCompress pass in AnalysisDao than the old
+    // encoding did.
     int dataSize = getDataSize();
+    std::string allData(dataSize, 0);
+    std::string lowData(dataSize, 0);
+    std::string midData(dataSize, 0);
+    std::string highData(dataSize, 0);
+    unsigned char lastAll = 0;
+    unsigned char lastLow = 0;
+    unsigned char lastMid = 0;
+    unsigned char lastHigh = 0;
     for (int i = 0; i < dataSize; ++i) {
         const WaveformData& datum = m_data.at(i);
-        all->add_value(datum.filtered.all);
-        low->add_value(datum.filtered.low);
-        mid->add_value(datum.filtered.mid);
-        high->add_value(datum.filtered.high);
+        allData[i] = static_cast<char>(datum.filtered.all - lastAll);
+        lowData[i] = static_cast<char>(datum.filtered.low - lastLow);
+        midData[i] = static_cast<char>(datum.filtered.mid - lastMid);
+        highData[i] = static_cast<char>(datum.filtered.high - lastHigh);
+        lastAll = datum.filtered.all;
+        lastLow = datum.filtered.low;
+        lastMid = datum.filtered.mid;
+        lastHigh = datum.filtered.high;
     }
+    all->set_value_deltas(allData);
+    low->set_value_deltas(lowData);
+    mid->set_value_deltas(midData);
+    high->set_value_deltas(highData);
 
     qDebug() << "Writing waveform from byte array:"
              << "dataSize" << dataSize
-             << "allSignalSize" << all->value_size()
+             << "allSignalSize" << static_cast<int>(all->value_deltas().size())
              << "visualSampleRate" << waveform.visual_sample_rate()
              << "audioVisualRatio" << waveform.audio_visual_ratio();
 
@@ -155,16 +180,23 @@ void Waveform::readByteArray(const QByteArray& data) {
     const io::Waveform::Signal& mid = waveform.signal_filtered().mid();
     const io::Waveform::Signal& high = waveform.signal_filtered().high();
 
+    // Since Waveform-6.0 the bands are stored as delta-encoded bytes, older
+    // analyses store a varint per value. Both encodings remain readable.
+    const bool deltaEncoded = all.has_value_deltas();
+    const int allSignalSize = deltaEncoded
+            ? static_cast<int>(all.value_deltas().size())
+            : all.value_size();
+
     qDebug() << "Reading waveform from byte array:"
-             << "allSignalSize" << all.value_size()
+             << "allSignalSize" << allSignalSize
              << "visualSampleRate" << waveform.visual_sample_rate()
              << "audioVisualRatio" << waveform.audio_visual_ratio();
 
-    resize(all.value_size());
+    resize(allSignalSize);
 
     int dataSize = getDataSize();
-    if (all.value_size() != dataSize) {
-        qDebug() << "ERROR: Couldn't resize Waveform to" << all.value_size()
+    if (allSignalSize != dataSize) {
+        qDebug() << "ERROR: Couldn't resize Waveform to" << allSignalSize
                  << "while reading.";
         resize(0);
         m_saveState = SaveState::NotSaved;
@@ -173,28 +205,137 @@ void Waveform::readByteArray(const QByteArray& data) {
 
     m_visualSampleRate = waveform.visual_sample_rate();
     m_audioVisualRatio = waveform.audio_visual_ratio();
-    if (low.value_size() != dataSize ||
-        mid.value_size() != dataSize ||
-        high.value_size() != dataSize) {
-        qDebug() << "WARNING: Filtered data size does not match all-signal size.";
-    }
 
     // TODO(XXX) If non-RMS, convert but since we only save RMS today we can add
     // this later.
     bool low_valid = low.units() == io::Waveform::RMS;
     bool mid_valid = mid.units() == io::Waveform::RMS;
     bool high_valid = high.units() == io::Waveform::RMS;
-    for (int i = 0; i < dataSize; ++i) {
-        m_data[i].filtered.all = static_cast<unsigned char>(all.value(i));
-        bool use_low = low_valid && i < low.value_size();
-        bool use_mid = mid_valid && i < mid.value_size();
-        bool use_high = high_valid && i < high.value_size();
-        m_data[i].filtered.low = use_low ? static_cast<unsigned char>(low.value(i)) : 0;
-        m_data[i].filtered.mid = use_mid ? static_cast<unsigned char>(mid.value(i)) : 0;
-        m_data[i].filtered.high = use_high ? static_cast<unsigned char>(high.value(i)) : 0;
+    if (deltaEncoded) {
+        const std::string& allDeltas = all.value_deltas();
+        const std::string& lowDeltas = low.value_deltas();
+        const std::string& midDeltas = mid.value_deltas();
+        const std::string& highDeltas = high.value_deltas();
+        if (static_cast<int>(lowDeltas.size()) != dataSize ||
+            static_cast<int>(midDeltas.size()) != dataSize ||
+            static_cast<int>(highDeltas.size()) != dataSize) {
+            qDebug() << "WARNING: Filtered data size does not match all-signal size.";
+        }
+        unsigned char runningAll = 0;
+        unsigned char runningLow = 0;
+        unsigned char runningMid = 0;
+        unsigned char runningHigh = 0;
+        for (int i = 0; i < dataSize; ++i) {
+            runningAll += static_cast<unsigned char>(allDeltas[i]);
+            m_data[i].filtered.all = runningAll;
+            bool use_low = low_valid && i < static_cast<int>(lowDeltas.size());
+            bool use_mid = mid_valid && i < static_cast<int>(midDeltas.size());
+            bool use_high = high_valid && i < static_cast<int>(highDeltas.size());
+            if (use_low) {
+                runningLow += static_cast<unsigned char>(lowDeltas[i]);
+            }
+            if (use_mid) {
+                runningMid += static_cast<unsigned char>(midDeltas[i]);
+            }
+            if (use_high) {
+                runningHigh += static_cast<unsigned char>(highDeltas[i]);
+            }
+            m_data[i].filtered.low = use_low ? runningLow : 0;
+            m_data[i].filtered.mid = use_mid ? runningMid : 0;
+            m_data[i].filtered.high = use_high ? runningHigh : 0;
+        }
+    } else {
+        if (low.value_size() != dataSize ||
+            mid.value_size() != dataSize ||
+            high.value_size() != dataSize) {
+            qDebug() << "WARNING: Filtered data size does not match all-signal size.";
+        }
+        for (int i = 0; i < dataSize; ++i) {
+            m_data[i].filtered.all = static_cast<unsigned char>(all.value(i));
+            bool use_low = low_valid && i < low.value_size();
+            bool use_mid = mid_valid && i < mid.value_size();
+            bool use_high = high_valid && i < high.value_size();
+            m_data[i].filtered.low = use_low ? static_cast<unsigned char>(low.value(i)) : 0;
+            m_data[i].filtered.mid = use_mid ? static_cast<unsigned char>(mid.value(i)) : 0;
+            m_data[i].filtered.high = use_high ? static_cast<unsigned char>(high.value(i)) : 0;
+        }
     }
     m_completion = dataSize;
     m_saveState = SaveState::Saved;
+    buildSummaryPyramid();
+}
+
+void Waveform::buildSummaryPyramid() {
+    const int dataSize = getDataSize();
+    DEBUG_ASSERT(getCompletion() == dataSize);
+    if (getSummaryLevelCount() > 0) {
+        // Already built.
+        return;
+    }
+
+    // Stop once a level no longer pays off: below this frame count a
+    // renderer iterates so few entries per frame that another halving
+    // would only cost memory.
+    constexpr int kMinSummaryFrames = 512;
+
+    std::vector<std::vector<WaveformData>> levels;
+    const WaveformData* source = data();
+    int sourceFrames = dataSize / kNumChannels;
+    while (sourceFrames / 2 >= kMinSummaryFrames) {
+        const int levelFrames = (sourceFrames + 1) / 2;
+        std::vector<WaveformData> level(levelFrames * kNumChannels,
+                WaveformData(0));
+        for (int frame = 0; frame < levelFrames; ++frame) {
+            for (int channel = 0; channel < kNumChannels; ++channel) {
+                const WaveformData& first =
+                        source[(2 * frame) * kNumChannels + channel];
+                WaveformData& target = level[frame * kNumChannels + channel];
+                target = first;
+                if (2 * frame + 1 < sourceFrames) {
+                    const WaveformData& second =
+                            source[(2 * frame + 1) * kNumChannels + channel];
+                    target.filtered.low =
+                            math_max(target.filtered.low, second.filtered.low);
+                    target.filtered.mid =
+                            math_max(target.filtered.mid, second.filtered.mid);
+                    target.filtered.high =
+                            math_max(target.filtered.high, second.filtered.high);
+                    target.filtered.all =
+                            math_max(target.filtered.all, second.filtered.all);
+                }
+            }
+        }
+        levels.push_back(std::move(level));
+        source = levels.back().data();
+        sourceFrames = levelFrames;
+    }
+
+    // Publish the finished pyramid. Readers acquire the level count before
+    // touching m_summaryLevels, so they never see a partially built level.
+    m_summaryLevels = std::move(levels);
+    m_summaryLevelCount.storeRelease(static_cast<int>(m_summaryLevels.size()));
+}
+
+const WaveformData* Waveform::summaryForFramesPerPixel(double framesPerPixel,
+        int* pShift, int* pDataSize) const {
+    int shift = 0;
+    const int levelCount = getSummaryLevelCount();
+    // Select the coarsest level that still provides at least two frames
+    // per pixel column, so the per-pixel max window keeps a few entries
+    // to work with and the rendering stays visually identical.
+    while (shift < levelCount && framesPerPixel >= 4.0) {
+        framesPerPixel /= 2.0;
+        ++shift;
+    }
+    if (shift == 0) {
+        *pShift = 0;
+        *pDataSize = getDataSize();
+        return data();
+    }
+    const std::vector<WaveformData>& level = m_summaryLevels[shift - 1];
+    *pShift = shift;
+    *pDataSize = static_cast<int>(level.size());
+    return level.data();
 }
 
 void Waveform::resize(int size) {
@@ -132,6 +132,29 @@ class Waveform {
     // constructor runs.
     const WaveformData* data() const { return &m_data[0];}
 
+    // Builds the multi-resolution summary pyramid from m_data. Level k
+    // summarizes (1 << k) visual frames per entry with the component-wise
+    // maximum of the filtered bands, so renderers can pick a level matching
+    // their zoom instead of iterating all base samples per pixel column.
+    // Must only be called once the waveform data is complete (after analysis
+    // or deserialization); the levels are published atomically so concurrent
+    // readers either see the finished pyramid or none at all.
+    void buildSummaryPyramid();
+
+    // Number of summary levels available, 0 until buildSummaryPyramid() has
+    // finished.
+    int getSummaryLevelCount() const {
+        return atomicLoadAcquire(m_summaryLevelCount);
+    }
+
+    // Returns the waveform data best suited for rendering with the given
+    // number of visual frames per pixel column, falling back to the base
+    // data while no pyramid is available. On return *pShift holds the
+    // log2 of base frames per returned frame (0 for the base data) and
+    // *pDataSize the number of data elements in the returned array.
+    const WaveformData* summaryForFramesPerPixel(double framesPerPixel,
+            int* pShift, int* pDataSize) const;
+
     void dump() const;
 
   private:
@@ -177,6 +200,12 @@ class Waveform {
     // the mutex. The completion of the waveform calculation.
     QAtomicInt m_completion;
 
+    // The summary pyramid built by buildSummaryPyramid(). The vectors are
+    // only written before m_summaryLevelCount is published, so readers that
+    // observe a non-zero level count may access them without locking.
+    std::vector<std::vector<WaveformData>> m_summaryLevels;
+    QAtomicInt m_summaryLevelCount;
+
     mutable QMutex m_mutex;
 
     DISALLOW_COPY_AND_ASSIGN(Waveform);
@@ -39,6 +39,43 @@
 #include "widget/wwaveformviewer.h"
 
 namespace {
+// Runtime quality scaling: degrade once the smoothed render time has
+// exceeded this share of the frame budget for this many consecutive
+// measurement intervals (one interval per second, see render()).
+constexpr double kRenderBudgetRatio = 0.8;
+constexpr int kDegradeAfterSeconds = 5;
+// Never auto-degrade the frame rate below this. Dropping further would
+// make the scratching feedback unusable, so a cheaper widget type is
+// tried instead.
+constexpr int kMinAutoFrameRate = 20;
+// Exponential smoothing weight for the per-frame render time. A single
+// slow frame (e.g. a deferred shader compile) must not trigger scaling.
+constexpr double kRenderTimeSmoothing = 0.05;
+
+// Next cheaper backend for runtime quality scaling: GLSL renderers fall
+// back to their fixed-pipeline GL counterpart, GL and Qt renderers to the
+// pure software painter of the same flavor. Returns
+// Count_WaveformwidgetType when there is nothing cheaper left.
+WaveformWidgetType::Type cheaperWidgetType(WaveformWidgetType::Type type) {
+    switch (type) {
+    case WaveformWidgetType::GLSLFilteredWaveform:
+        return WaveformWidgetType::GLFilteredWaveform;
+    case WaveformWidgetType::GLSLRGBWaveform:
+    case WaveformWidgetType::GLSLRGBStackedWaveform:
+        return WaveformWidgetType::GLRGBWaveform;
+    case WaveformWidgetType::GLFilteredWaveform:
+    case WaveformWidgetType::QtWaveform:
+        return WaveformWidgetType::SoftwareWaveform;
+    case WaveformWidgetType::GLRGBWaveform:
+    case WaveformWidgetType::QtRGBWaveform:
+        return WaveformWidgetType::RGBWaveform;
+    case WaveformWidgetType::QtHSVWaveform:
+        return WaveformWidgetType::HSVWaveform;
+    default:
+        return WaveformWidgetType::Count_WaveformwidgetType;
+    }
+}
+
 // Returns true if the given waveform should be rendered.
 bool shouldRenderWaveform(WaveformWidgetAbstract* pWaveformWidget) {
     if (pWaveformWidget == nullptr ||
@@ -104,6 +141,10 @@ WaveformWidgetFactory::WaveformWidgetFactory()
           m_config(nullptr),
           m_skipRender(false),
           m_frameRate(30),
+          m_autoQualityScaling(true),
+          m_effectiveFrameRate(30),
+          m_avgRenderMicros(0),
+          m_overBudgetSeconds(0),
           m_endOfTrackWarningTime(30),
           m_defaultZoom(WaveformWidgetRenderer::s_waveformDefaultZoom),
           m_zoomSync(true),
@@ -285,6 +326,10 @@ bool WaveformWidgetFactory::setConfig(UserSettingsPointer config) {
 
     int frameRate = m_config->getValue(ConfigKey("[Waveform]","FrameRate"), m_frameRate);
     m_frameRate = math_clamp(frameRate, 1, 120);
+    m_effectiveFrameRate = m_frameRate;
+
+    m_autoQualityScaling = m_config->getValue(
+            ConfigKey("[Waveform]", "AutoQualityScaling"), m_autoQualityScaling);
 
 
     int endTime = m_config->getValueString(ConfigKey("[Waveform]","EndOfTrackWarningTime")).toInt(&ok);
@@ -417,6 +462,9 @@ bool WaveformWidgetFactory::setWaveformWidget(WWaveformViewer* viewer,
 
 void WaveformWidgetFactory::setFrameRate(int frameRate) {
     m_frameRate = math_clamp(frameRate, 1, 120);
+    // An explicit frame rate choice resets any automatic degradation.
+    m_effectiveFrameRate = m_frameRate;
+    m_overBudgetSeconds = 0;
     if (m_config) {
         m_config->set(ConfigKey("[Waveform]","FrameRate"), ConfigValue(m_frameRate));
     }
@@ -507,6 +555,11 @@ bool WaveformWidgetFactory::setWidgetTypeFromHandle(int handleIndex, bool force)
     // change the type
     setWidgetType(handle.m_type);
 
+    recreateWidgets();
+    return true;
+}
+
+void WaveformWidgetFactory::recreateWidgets() {
     m_skipRender = true;
     //qDebug() << "recreate start";
 
@@ -536,9 +589,12 @@ bool WaveformWidgetFactory::setWidgetTypeFromHandle(int handleIndex, bool force)
         viewer->update();
     }
 
+    // Nothing has been rendered for the new widgets yet, so there is
+    // nothing for the next swap() run to show.
+    m_waveformsPendingSwap.assign(m_waveformWidgetHolders.size(), false);
+
     m_skipRender = false;
     //qDebug() << "recreate done";
-    return true;
 }
 
 void WaveformWidgetFactory::setDefaultZoom(double zoom) {
@@ -635,6 +691,9 @@ void WaveformWidgetFactory::render() {
     //qDebug() << "render()" << m_vsyncThread->elapsed();
 
     if (!m_skipRender) {
+        PerformanceTimer renderTimer;
+        renderTimer.start();
+
         if (m_type) {   // no regular updates for an empty waveform
             // next rendered frame is displayed after next buffer swap and than after VSync
             QVarLengthArray<bool, 10> shouldRenderWaveforms(
@@ -646,18 +705,31 @@ void WaveformWidgetFactory::render() {
                 // Don't bother doing the pre-render work if we aren't going to
                 // render this widget.
                 bool shouldRender = shouldRenderWaveform(pWaveformWidget);
-                shouldRenderWaveforms[i] = shouldRender;
-                if (!shouldRender) {
-                    continue;
+                if (shouldRender) {
+                    // Calculate play position for the new Frame in following run
+                    pWaveformWidget->preRender(m_vsyncThread);
+                    // Skip widgets whose image cannot have changed since the
+                    // last rendered frame, e.g. paused decks. This keeps idle
+                    // widgets nearly free instead of repainting all of them on
+                    // every tick. The vsync test widgets paint a new test
+                    // pattern on every draw, so they must not be skipped.
+                    if (m_type != WaveformWidgetType::GLVSyncTest &&
+                            m_type != WaveformWidgetType::QtVSyncTest) {
+                        shouldRender = pWaveformWidget->isDirty();
+                    }
+                } else {
+                    // Make sure the widget is repainted as soon as it becomes
+                    // visible again.
+                    pWaveformWidget->markDirty();
                 }
-                // Calculate play position for the new Frame in following run
-                pWaveformWidget->preRender(m_vsyncThread);
+                shouldRenderWaveforms[i] = shouldRender;
             }
             //qDebug() << "prerender" << m_vsyncThread->elapsed();
 
             // It may happen that there is an artificially delayed due to
             // anti tearing driver settings
             // all render commands are delayed until the swap from the previous run is executed
+            m_waveformsPendingSwap.assign(m_waveformWidgetHolders.size(), false);
             for (decltype(m_waveformWidgetHolders)::size_type i = 0;
                     i < m_waveformWidgetHolders.size();
                     i++) {
@@ -666,6 +738,8 @@ void WaveformWidgetFactory::render() {
                     continue;
                 }
                 pWaveformWidget->render();
+                pWaveformWidget->markClean();
+                m_waveformsPendingSwap[i] = true;
                 //qDebug() << "render" << i << m_vsyncThread->elapsed();
             }
         }
@@ -680,6 +754,11 @@ void WaveformWidgetFactory::render() {
         emit waveformUpdateTick();
         //qDebug() << "emit" << m_vsyncThread->elapsed() - t1;
 
+        // Spinnies and VU meters update on the same tick, so their cost
+        // counts against the frame budget as well.
+        m_avgRenderMicros += kRenderTimeSmoothing *
+                (renderTimer.elapsed().toDoubleMicros() - m_avgRenderMicros);
+
         m_frameCnt += 1.0f;
         mixxx::Duration timeCnt = m_time.elapsed();
         if (timeCnt > mixxx::Duration::fromSeconds(1)) {
@@ -687,6 +766,9 @@ void WaveformWidgetFactory::render() {
             m_frameCnt = m_frameCnt * 1000 / timeCnt.toIntegerMillis(); // latency correction
             emit waveformMeasured(m_frameCnt, m_vsyncThread->droppedFrames());
             m_frameCnt = 0.0;
+            if (m_autoQualityScaling) {
+                maybeDegradeQuality();
+            }
         }
     }
 
@@ -706,8 +788,16 @@ void WaveformWidgetFactory::swap() {
         if (m_type) {   // no regular updates for an empty waveform
             // Show rendered buffer from last render() run
             //qDebug() << "swap() start" << m_vsyncThread->elapsed();
-            for (const auto& holder : m_waveformWidgetHolders) {
-                WaveformWidgetAbstract* pWaveformWidget = holder.m_waveformWidget;
+            for (decltype(m_waveformWidgetHolders)::size_type i = 0;
+                    i < m_waveformWidgetHolders.size();
+                    i++) {
+                WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
+
+                // Nothing was rendered for this widget in the last render()
+                // run, the front buffer is still up to date.
+                if (i >= m_waveformsPendingSwap.size() || !m_waveformsPendingSwap[i]) {
+                    continue;
+                }
 
                 // Don't swap invalid / invisible widgets or widgets with an
                 // unexposed window. Prevents continuous log spew of
@@ -734,6 +824,52 @@ void WaveformWidgetFactory::swap() {
     m_vsyncThread->vsyncSlotFinished();
 }
 
+void WaveformWidgetFactory::maybeDegradeQuality() {
+    const double budgetMicros = 1e6 / m_effectiveFrameRate;
+    if (m_avgRenderMicros <= kRenderBudgetRatio * budgetMicros) {
+        m_overBudgetSeconds = 0;
+        return;
+    }
+    if (++m_overBudgetSeconds < kDegradeAfterSeconds) {
+        return;
+    }
+    m_overBudgetSeconds = 0;
+
+    if (m_effectiveFrameRate > kMinAutoFrameRate) {
+        // First keep the renderer but give it a longer frame budget.
+        m_effectiveFrameRate = math_max(kMinAutoFrameRate, m_effectiveFrameRate / 2);
+        qWarning() << "Waveform rendering takes" << m_avgRenderMicros
+                   << "us per frame, dropping frame rate to"
+                   << m_effectiveFrameRate << "FPS";
+        if (m_vsyncThread) {
+            m_vsyncThread->setSyncIntervalTimeMicros(
+                    static_cast<int>(1e6 / m_effectiveFrameRate));
+        }
+        return;
+    }
+
+    // Already at the minimum frame rate, fall back to the next cheaper
+    // widget type that is available on this machine.
+    WaveformWidgetType::Type cheaperType = cheaperWidgetType(m_type);
+    while (cheaperType != WaveformWidgetType::Count_WaveformwidgetType &&
+            findHandleIndexFromType(cheaperType) == -1) {
+        cheaperType = cheaperWidgetType(cheaperType);
+    }
+    if (cheaperType == WaveformWidgetType::Count_WaveformwidgetType) {
+        // Nothing cheaper left, stay where we are.
+        return;
+    }
+    qWarning() << "Waveform rendering still over budget at"
+               << m_effectiveFrameRate << "FPS, falling back to widget type"
+               << cheaperType;
+    // Only change the live type. m_configType keeps the user's choice, so
+    // the configured renderer is tried again on the next start.
+    m_type = cheaperType;
+    recreateWidgets();
+    // Give the new renderer a fresh measurement window.
+    m_avgRenderMicros = 0;
+}
+
 WaveformWidgetType::Type WaveformWidgetFactory::autoChooseWidgetType() const {
     if (m_openGlAvailable) {
         if (m_openGLShaderAvailable) {
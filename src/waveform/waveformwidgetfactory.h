@@ -155,6 +155,14 @@ class WaveformWidgetFactory : public QObject, public Singleton<WaveformWidgetFac
     WaveformWidgetAbstract* createWaveformWidget(WaveformWidgetType::Type type, WWaveformViewer* viewer);
     int findIndexOf(WWaveformViewer* viewer) const;
 
+    /// Re-creates all waveform widgets for the current m_type, preserving
+    /// per-viewer state (track, zoom, play marker, beat grid alpha).
+    void recreateWidgets();
+    /// Runtime quality scaling, called once per second from render().
+    /// Lowers the frame rate and eventually falls back to a cheaper widget
+    /// type when the smoothed render time keeps exceeding the frame budget.
+    void maybeDegradeQuality();
+
     WaveformWidgetType::Type findTypeFromHandleIndex(int index);
     int findHandleIndexFromType(WaveformWidgetType::Type type);
 
@@ -165,6 +173,10 @@ class WaveformWidgetFactory : public QObject, public Singleton<WaveformWidgetFac
     //Currently in use widgets/visual/node
     std::vector<WaveformWidgetHolder> m_waveformWidgetHolders;
 
+    // Per-holder flag whether the last render() run produced a new frame
+    // that still needs to be shown by swap().
+    std::vector<bool> m_waveformsPendingSwap;
+
     WaveformWidgetType::Type m_type;
     WaveformWidgetType::Type m_configType;
 
@@ -172,6 +184,13 @@ class WaveformWidgetFactory : public QObject, public Singleton<WaveformWidgetFac
 
     bool m_skipRender;
     int m_frameRate;
+    // Runtime quality scaling state, see maybeDegradeQuality(). The
+    // effective frame rate starts at m_frameRate and is lowered when the
+    // renderer cannot keep up; m_frameRate keeps the configured value.
+    bool m_autoQualityScaling;
+    int m_effectiveFrameRate;
+    double m_avgRenderMicros;
+    int m_overBudgetSeconds;
     int m_endOfTrackWarningTime;
     double m_defaultZoom;
     bool m_zoomSync;
@@ -38,7 +38,12 @@ ControlWidgetConnection::ControlWidgetConnection(
         : m_pWidget(pBaseWidget),
           m_pValueTransformer(pTransformer) {
     m_pControl = new ControlProxy(key, this, ControlFlag::NoAssertIfMissing);
-    m_pControl->connectValueChanged(this, &ControlWidgetConnection::slotControlValueChanged);
+    // Skin widget connections only mirror the control value into the widget,
+    // so intermediate values of a fast sweep (e.g. from a MIDI encoder)
+    // carry no information. Coalesce them to one update per GUI frame
+    // instead of queueing one event per value change.
+    m_pControl->connectValueChangedCoalesced(
+            this, &ControlWidgetConnection::slotControlValueChanged);
 }
 
 void ControlWidgetConnection::setControlParameter(double parameter) {
@@ -80,11 +80,24 @@ Paintable::Paintable(const PixmapSource& source, DrawMode mode, double scaleFact
 #endif
             // The SVG renderer doesn't directly support tiling, so we render
             // it to a pixmap which will then get tiled.
-            QImage copy_buffer(m_pSvg->defaultSize() * scaleFactor, QImage::Format_ARGB32);
-            copy_buffer.fill(0x00000000);  // Transparent black.
-            QPainter painter(&copy_buffer);
-            m_pSvg->render(&painter);
-            WPixmapStore::correctImageColors(&copy_buffer);
+            QImage copy_buffer;
+            QSharedPointer<QImage> pPreloaded;
+            if (source.getSvgSourceData().isEmpty()) {
+                // Only file-backed sources can have been preloaded;
+                // inline SVG data may contain skin variables.
+                pPreloaded = WPixmapStore::getPreloadedImage(
+                        source.getPath(), scaleFactor);
+            }
+            if (pPreloaded) {
+                copy_buffer = *pPreloaded;
+            } else {
+                copy_buffer = QImage(m_pSvg->defaultSize() * scaleFactor,
+                        QImage::Format_ARGB32);
+                copy_buffer.fill(0x00000000); // Transparent black.
+                QPainter painter(&copy_buffer);
+                m_pSvg->render(&painter);
+                WPixmapStore::correctImageColors(&copy_buffer);
+            }
 
             m_pPixmap.reset(new QPixmap(copy_buffer.size()));
             m_pPixmap->convertFromImage(copy_buffer);
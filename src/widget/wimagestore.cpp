@@ -6,6 +6,7 @@
 
 #include "skin/imgloader.h"
 #include "util/assert.h"
+#include "widget/wpixmapstore.h"
 
 
 // static
@@ -82,6 +83,12 @@ QImage* WImageStore::getImageNoCache(const PixmapSource& source, double scaleFac
         renderer.render(&painter);
         return pImage;
     } else {
+        // Shared with WPixmapStore, filled by the skin preload pass.
+        QSharedPointer<QImage> pPreloaded =
+                WPixmapStore::getPreloadedImage(source.getPath(), scaleFactor);
+        if (pPreloaded) {
+            return new QImage(*pPreloaded);
+        }
         return m_loader->getImage(source.getPath(), scaleFactor);
     }
 }
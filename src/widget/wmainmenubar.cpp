@@ -9,6 +9,7 @@
 #include "mixer/playermanager.h"
 #include "moc_wmainmenubar.cpp"
 #include "util/cmdlineargs.h"
+#include "util/db/sqlquerylog.h"
 #include "util/experiment.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 
@@ -538,6 +539,35 @@ void WMainMenuBar::initialize() {
                 &WMainMenuBar::slotDeveloperDebugger);
         pDeveloperMenu->addAction(pDeveloperDebugger);
 
+        QString sqlQueryLogTitle = tr("SQL &Query Log");
+        QString sqlQueryLogText = tr(
+            "Records executed database queries with bind parameters, timing "
+            "and query plans for slow queries.");
+        auto* pDeveloperSqlQueryLog = new QAction(sqlQueryLogTitle, this);
+        pDeveloperSqlQueryLog->setCheckable(true);
+        pDeveloperSqlQueryLog->setChecked(mixxx::SqlQueryLog::isEnabled());
+        pDeveloperSqlQueryLog->setStatusTip(sqlQueryLogText);
+        pDeveloperSqlQueryLog->setWhatsThis(buildWhatsThis(
+            sqlQueryLogTitle, sqlQueryLogText));
+        connect(pDeveloperSqlQueryLog,
+                &QAction::triggered,
+                this,
+                &WMainMenuBar::slotDeveloperSqlQueryLog);
+        pDeveloperMenu->addAction(pDeveloperSqlQueryLog);
+
+        QString dumpSqlQueryLogTitle = tr("Dump SQL Query Log");
+        QString dumpSqlQueryLogText = tr(
+            "Writes the recorded database queries to the log output.");
+        auto* pDeveloperDumpSqlQueryLog = new QAction(dumpSqlQueryLogTitle, this);
+        pDeveloperDumpSqlQueryLog->setStatusTip(dumpSqlQueryLogText);
+        pDeveloperDumpSqlQueryLog->setWhatsThis(buildWhatsThis(
+            dumpSqlQueryLogTitle, dumpSqlQueryLogText));
+        connect(pDeveloperDumpSqlQueryLog,
+                &QAction::triggered,
+                this,
+                &WMainMenuBar::slotDeveloperDumpSqlQueryLog);
+        pDeveloperMenu->addAction(pDeveloperDumpSqlQueryLog);
+
         addMenu(pDeveloperMenu);
     }
 
@@ -710,6 +740,14 @@ void WMainMenuBar::slotDeveloperDebugger(bool toggle) {
                    ConfigValue(toggle ? 1 : 0));
 }
 
+void WMainMenuBar::slotDeveloperSqlQueryLog(bool enable) {
+    mixxx::SqlQueryLog::setEnabled(enable);
+}
+
+void WMainMenuBar::slotDeveloperDumpSqlQueryLog() {
+    mixxx::SqlQueryLog::dump();
+}
+
 void WMainMenuBar::slotVisitUrl(const QString& url) {
     QDesktopServices::openUrl(QUrl(url));
 }
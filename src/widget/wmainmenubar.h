@@ -84,6 +84,8 @@ class WMainMenuBar : public QMenuBar {
     void slotDeveloperStatsExperiment(bool enable);
     void slotDeveloperStatsBase(bool enable);
     void slotDeveloperDebugger(bool toggle);
+    void slotDeveloperSqlQueryLog(bool enable);
+    void slotDeveloperDumpSqlQueryLog();
     void slotVisitUrl(const QString& url);
 
   private:
@@ -17,6 +17,7 @@
 #include <QMouseEvent>
 #include <QPaintEvent>
 #include <QPainter>
+#include <QTimer>
 #include <QUrl>
 #include <QtDebug>
 
@@ -65,11 +66,14 @@ WOverview::WOverview(
           m_bTimeRulerActive(false),
           m_orientation(Qt::Horizontal),
           m_iLabelFontSize(10),
+          m_bMarksPixmapDirty(true),
+          m_marksPixmapGain(0.0f),
           m_a(1.0),
           m_b(0.0),
           m_analyzerProgress(kAnalyzerProgressUnknown),
           m_trackLoaded(false),
-          m_scaleFactor(1.0) {
+          m_scaleFactor(1.0),
+          m_bPartRenderScheduled(false) {
     m_endOfTrackControl = new ControlProxy(
             m_group, "end_of_track", this, ControlFlag::NoAssertIfMissing);
     m_endOfTrackControl->connectValueChanged(this, &WOverview::onEndOfTrackChange);
@@ -210,6 +214,9 @@ void WOverview::setup(const QDomNode& node, const SkinContext& context) {
 
     m_bShowCueTimes = context.selectBool(node, "ShowCueTimes", true);
 
+    // The skin may have replaced the marks, the ranges and their colors.
+    m_bMarksPixmapDirty = true;
+
     //qDebug() << "WOverview : m_marks" << m_marks.size();
     //qDebug() << "WOverview : m_markRanges" << m_markRanges.size();
     if (!m_connections.isEmpty()) {
@@ -269,14 +276,27 @@ void WOverview::slotWaveformSummaryUpdated() {
     if (!pTrack) {
         return;
     }
+    ConstWaveformPointer pOldWaveform = m_pWaveform;
     m_pWaveform = pTrack->getWaveformSummary();
     if (m_pWaveform) {
-        // If the waveform is already complete, just draw it.
-        if (m_pWaveform->getCompletion() == m_pWaveform->getDataSize()) {
+        // A different waveform object, e.g. from a freshly (re)started
+        // analysis, restarts the pixmap from the beginning.
+        if (m_pWaveform != pOldWaveform) {
             m_actualCompletion = 0;
-            if (drawNextPixmapPart()) {
-                update();
-            }
+            m_pixmapDone = false;
+        }
+        // Draw whatever has been computed so far. During analysis this
+        // signal is emitted periodically with a partially filled waveform
+        // so the overview refines in place instead of staying blank until
+        // the analysis has finished.
+        if (drawNextPixmapPart()) {
+            update();
+        }
+        // A finished analysis delivers the whole waveform at once. Render
+        // the remainder band by band on following event loop iterations so
+        // playing decks keep repainting in between.
+        if (pixmapPartPending()) {
+            schedulePixmapPart();
         }
     } else {
         // Null waveform pointer means waveform was cleared.
@@ -300,6 +320,35 @@ void WOverview::onTrackAnalyzerProgress(TrackId trackId, AnalyzerProgress analyz
         m_analyzerProgress = analyzerProgress;
         update();
     }
+    if (pixmapPartPending()) {
+        schedulePixmapPart();
+    }
+}
+
+bool WOverview::pixmapPartPending() const {
+    return m_pWaveform && !m_pixmapDone &&
+            m_actualCompletion < m_pWaveform->getCompletion();
+}
+
+void WOverview::schedulePixmapPart() {
+    if (m_bPartRenderScheduled) {
+        return;
+    }
+    m_bPartRenderScheduled = true;
+    QTimer::singleShot(0, this, &WOverview::slotContinuePixmapPart);
+}
+
+void WOverview::slotContinuePixmapPart() {
+    m_bPartRenderScheduled = false;
+    if (!pixmapPartPending()) {
+        return;
+    }
+    if (drawNextPixmapPart()) {
+        update();
+    }
+    if (pixmapPartPending()) {
+        schedulePixmapPart();
+    }
 }
 
 void WOverview::slotTrackLoaded(TrackPointer pTrack) {
@@ -366,6 +415,7 @@ void WOverview::onMarkChanged(double v) {
 void WOverview::onMarkRangeChange(double v) {
     Q_UNUSED(v);
     //qDebug() << "WOverview::onMarkRangeChange()" << v;
+    m_bMarksPixmapDirty = true;
     update();
 }
 
@@ -425,6 +475,7 @@ void WOverview::updateCues(const QList<CuePointer> &loadedCues) {
         }
     }
     std::sort(m_marksToRender.begin(), m_marksToRender.end());
+    m_bMarksPixmapDirty = true;
 }
 
 // connecting the tracks cuesUpdated and onMarkChanged is not possible
@@ -594,8 +645,20 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
             const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
                     static_cast<CSAMPLE_GAIN>(m_trackSamplesControl->get());
 
-            drawRangeMarks(&painter, offset, gain);
-            drawMarks(&painter, offset, gain);
+            if (m_pHoveredMark) {
+                // The hovered mark's label is not elided and the cue position
+                // labels follow the playhead, so the marks cannot come from
+                // the cache while a mark is hovered.
+                drawRangeMarks(&painter, offset, gain);
+                drawMarks(&painter, offset, gain);
+                m_bMarksPixmapDirty = true;
+            } else {
+                if (m_bMarksPixmapDirty || gain != m_marksPixmapGain ||
+                        m_marksPixmap.size() != size() * m_devicePixelRatio) {
+                    updateMarksPixmap(offset, gain);
+                }
+                painter.drawPixmap(rect(), m_marksPixmap);
+            }
             drawPickupPosition(&painter);
             drawTimeRuler(&painter);
             drawMarkLabels(&painter, offset, gain);
@@ -1008,6 +1071,28 @@ void WOverview::drawMarks(QPainter* pPainter, const float offset, const float ga
     }
 }
 
+void WOverview::updateMarksPixmap(const float offset, const float gain) {
+    m_marksPixmap = QPixmap(
+            static_cast<int>(width() * m_devicePixelRatio),
+            static_cast<int>(height() * m_devicePixelRatio));
+    m_marksPixmap.setDevicePixelRatio(m_devicePixelRatio);
+    m_marksPixmap.fill(Qt::transparent);
+
+    QPainter painter(&m_marksPixmap);
+    // drawMarks derives the label font from the painter's font, which would
+    // otherwise be the application default for a pixmap painter.
+    painter.setFont(font());
+    // Besides painting, drawMarks updates the line positions and prerenders
+    // the labels of the marks, which are used for the mouse hit tests and by
+    // drawMarkLabels. Those stay valid between rebuilds since they only
+    // depend on inputs that dirty this pixmap.
+    drawRangeMarks(&painter, offset, gain);
+    drawMarks(&painter, offset, gain);
+
+    m_marksPixmapGain = gain;
+    m_bMarksPixmapDirty = false;
+}
+
 void WOverview::drawPickupPosition(QPainter* pPainter) {
     PainterScope painterScope(pPainter);
 
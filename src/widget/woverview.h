@@ -86,6 +86,13 @@ class WOverview : public WWidget, public TrackDropTarget {
     // Hold the last visual sample processed to generate the pixmap
     int m_actualCompletion;
 
+    // Maximum number of visual samples a single drawNextPixmapPart() call
+    // may render. When a finished analysis delivers the whole waveform at
+    // once, the pixmap is built in bands of this size spread over multiple
+    // event loop iterations (see slotContinuePixmapPart()) instead of
+    // blocking the GUI thread for the entire track.
+    static constexpr int kMaxCompletionIncrement = 1024;
+
     bool m_pixmapDone;
     float m_waveformPeak;
 
@@ -102,6 +109,7 @@ class WOverview : public WWidget, public TrackDropTarget {
     void receiveCuesUpdated();
 
     void slotWaveformSummaryUpdated();
+    void slotContinuePixmapPart();
     void slotCueMenuPopupAboutToHide();
 
   private:
@@ -117,6 +125,7 @@ class WOverview : public WWidget, public TrackDropTarget {
     void drawAnalyzerProgress(QPainter* pPainter);
     void drawRangeMarks(QPainter* pPainter, const float& offset, const float& gain);
     void drawMarks(QPainter* pPainter, const float offset, const float gain);
+    void updateMarksPixmap(const float offset, const float gain);
     void drawPickupPosition(QPainter* pPainter);
     void drawTimeRuler(QPainter* pPainter);
     void drawMarkLabels(QPainter* pPainter, const float offset, const float gain);
@@ -132,6 +141,13 @@ class WOverview : public WWidget, public TrackDropTarget {
 
     void updateCues(const QList<CuePointer> &loadedCues);
 
+    // True while waveform data beyond m_actualCompletion is waiting to be
+    // rendered into the source image.
+    bool pixmapPartPending() const;
+    // Schedules slotContinuePixmapPart() on the event loop unless a
+    // continuation is already queued.
+    void schedulePixmapPart();
+
     const QString m_group;
     UserSettingsPointer m_pConfig;
     ControlProxy* m_endOfTrackControl;
@@ -186,6 +202,14 @@ class WOverview : public WWidget, public TrackDropTarget {
     // List of visible WaveformMarks sorted by the order they appear in the track
     QList<WaveformMarkPointer> m_marksToRender;
     std::vector<WaveformMarkRange> m_markRanges;
+    // Cache of the range marks and mark lines so a moving play position does
+    // not redraw them on every frame. Rebuilt by updateMarksPixmap() when the
+    // marks or the widget geometry change. Not used while a mark is hovered
+    // since label eliding and the cue position labels depend on the hover
+    // state.
+    QPixmap m_marksPixmap;
+    bool m_bMarksPixmapDirty;
+    float m_marksPixmapGain;
     WaveformMarkLabel m_cuePositionLabel;
     WaveformMarkLabel m_cueTimeDistanceLabel;
 
@@ -196,4 +220,5 @@ class WOverview : public WWidget, public TrackDropTarget {
     AnalyzerProgress m_analyzerProgress;
     bool m_trackLoaded;
     double m_scaleFactor;
+    bool m_bPartRenderScheduled;
 };
@@ -52,7 +52,10 @@ bool WOverviewHSV::drawNextPixmapPart() {
         return false;
     }
 
-    const int nextCompletion = m_actualCompletion + completionIncrement;
+    // Cap the band rendered by this call. Any remainder is rendered on a
+    // following event loop iteration, see WOverview::slotContinuePixmapPart().
+    const int nextCompletion = m_actualCompletion +
+            math_min(completionIncrement, kMaxCompletionIncrement);
 
     //qDebug() << "WOverview::drawNextPixmapPart() - nextCompletion:"
     // << nextCompletion
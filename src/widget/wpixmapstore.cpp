@@ -1,7 +1,9 @@
 #include "widget/wpixmapstore.h"
 
 #include <QDir>
+#include <QMutexLocker>
 #include <QString>
+#include <QtConcurrentRun>
 #include <QtDebug>
 
 #include "util/math.h"
@@ -11,6 +13,9 @@
 QHash<QString, WeakPaintablePointer> WPixmapStore::m_paintableCache;
 QSharedPointer<ImgSource> WPixmapStore::m_loader
         = QSharedPointer<ImgSource>(new ImgLoader());
+QHash<QString, QSharedPointer<QImage>> WPixmapStore::m_imageCache;
+QMutex WPixmapStore::m_imageCacheMutex;
+QList<QFuture<void>> WPixmapStore::m_preloadFutures;
 
 // static
 PaintablePointer WPixmapStore::getPaintable(const PixmapSource& source,
@@ -39,14 +44,86 @@ PaintablePointer WPixmapStore::getPaintable(const PixmapSource& source,
 QPixmap* WPixmapStore::getPixmapNoCache(
         const QString& fileName,
         double scaleFactor) {
-    QPixmap* pPixmap = nullptr;
+    QPixmap* pPixmap = new QPixmap();
+    QSharedPointer<QImage> pPreloaded = getPreloadedImage(fileName, scaleFactor);
+    if (pPreloaded) {
+        pPixmap->convertFromImage(*pPreloaded);
+        return pPixmap;
+    }
     QImage* img = m_loader->getImage(fileName, scaleFactor);
-    pPixmap = new QPixmap();
     pPixmap->convertFromImage(*img);
     delete img;
     return pPixmap;
 }
 
+// static
+QString WPixmapStore::imageCacheKey(const QString& fileName, double scaleFactor) {
+    return fileName + QString::number(scaleFactor);
+}
+
+// static
+QImage* WPixmapStore::loadScaledImage(
+        const QSharedPointer<ImgSource>& pLoader,
+        const QString& fileName,
+        double scaleFactor) {
+    if (fileName.endsWith(QStringLiteral(".svg"), Qt::CaseInsensitive)) {
+        QSvgRenderer renderer;
+        if (!renderer.load(fileName)) {
+            // The above line already logs a warning
+            return nullptr;
+        }
+        auto* pImage = new QImage(renderer.defaultSize() * scaleFactor,
+                QImage::Format_ARGB32);
+        pImage->fill(0x00000000); // Transparent black.
+        QPainter painter(pImage);
+        renderer.render(&painter);
+        // Matches the processing in the Paintable constructor so the
+        // preloaded image can be used verbatim there.
+        pLoader->correctImageColors(pImage);
+        return pImage;
+    }
+    return pLoader->getImage(fileName, scaleFactor);
+}
+
+// static
+void WPixmapStore::preloadImages(const QStringList& filePaths, double scaleFactor) {
+    // Keep the loader alive in the workers even if it is swapped out
+    // by setLoader() while they are still running.
+    QSharedPointer<ImgSource> pLoader = m_loader;
+    for (const QString& filePath : filePaths) {
+        m_preloadFutures.append(QtConcurrent::run(
+                [pLoader, filePath, scaleFactor] {
+                    QScopedPointer<QImage> pImage(
+                            loadScaledImage(pLoader, filePath, scaleFactor));
+                    if (!pImage || pImage->isNull()) {
+                        return;
+                    }
+                    QMutexLocker locked(&m_imageCacheMutex);
+                    m_imageCache.insert(
+                            imageCacheKey(filePath, scaleFactor),
+                            QSharedPointer<QImage>(pImage.take()));
+                }));
+    }
+}
+
+// static
+QSharedPointer<QImage> WPixmapStore::getPreloadedImage(
+        const QString& fileName, double scaleFactor) {
+    QMutexLocker locked(&m_imageCacheMutex);
+    return m_imageCache.value(imageCacheKey(fileName, scaleFactor),
+            QSharedPointer<QImage>());
+}
+
+// static
+void WPixmapStore::endPreload() {
+    for (QFuture<void>& future : m_preloadFutures) {
+        future.waitForFinished();
+    }
+    m_preloadFutures.clear();
+    QMutexLocker locked(&m_imageCacheMutex);
+    m_imageCache.clear();
+}
+
 // static
 void WPixmapStore::correctImageColors(QImage* p) {
     m_loader->correctImageColors(p);
@@ -63,4 +140,5 @@ void WPixmapStore::setLoader(QSharedPointer<ImgSource> ld) {
     // loader has changed. The pixmaps will get freed once all the widgets
     // referring to them are destroyed.
     m_paintableCache.clear();
+    endPreload();
 }
@@ -1,14 +1,18 @@
 #pragma once
 
-#include <QPixmap>
+#include <QFuture>
 #include <QHash>
-#include <QSharedPointer>
-#include <QSvgRenderer>
 #include <QImage>
-#include <QScopedPointer>
+#include <QList>
+#include <QMutex>
 #include <QPainter>
+#include <QPixmap>
 #include <QRectF>
+#include <QScopedPointer>
+#include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QSvgRenderer>
 
 #include "skin/imgsource.h"
 #include "skin/pixmapsource.h"
@@ -29,7 +33,37 @@ class WPixmapStore {
     static void correctImageColors(QImage* p);
     static bool willCorrectColors();
 
+    // Decodes the given image files at the given scale factor on the
+    // global thread pool and keeps the results in a shared cache until
+    // endPreload() is called. The skin parser kicks this off right after
+    // the skin XML has been read, so the decodes overlap with widget
+    // creation and repeated references to the same file and scale are
+    // decoded only once.
+    static void preloadImages(const QStringList& filePaths, double scaleFactor);
+
+    // Returns the preloaded image for the given file and scale factor,
+    // or a null pointer if it has not been decoded (yet).
+    static QSharedPointer<QImage> getPreloadedImage(
+            const QString& fileName, double scaleFactor);
+
+    // Waits for outstanding preload jobs and drops the decoded image
+    // cache. The pixmaps built from it stay alive in their widgets.
+    static void endPreload();
+
   private:
+    static QString imageCacheKey(const QString& fileName, double scaleFactor);
+    static QImage* loadScaledImage(
+            const QSharedPointer<ImgSource>& pLoader,
+            const QString& fileName,
+            double scaleFactor);
+
     static QHash<QString, WeakPaintablePointer> m_paintableCache;
     static QSharedPointer<ImgSource> m_loader;
+
+    // Decoded images shared between preload jobs and widget requests.
+    // Guarded by m_imageCacheMutex since the preload jobs run on the
+    // global thread pool.
+    static QHash<QString, QSharedPointer<QImage>> m_imageCache;
+    static QMutex m_imageCacheMutex;
+    static QList<QFuture<void>> m_preloadFutures;
 };
@@ -45,6 +45,9 @@ WSpinny::WSpinny(
           m_pSignalEnabled(nullptr),
           m_pSlipEnabled(nullptr),
           m_bShowCover(true),
+          m_bStaticLayerDirty(true),
+          m_bOverlayDirty(true),
+          m_bSwapPending(false),
           m_dInitialPos(0.),
           m_iVinylInput(-1),
           m_bVinylActive(false),
@@ -142,6 +145,7 @@ void WSpinny::onVinylSignalQualityUpdate(const VinylSignalQualityReport& report)
             line++;
         }
     }
+    m_bOverlayDirty = true;
 #else
     Q_UNUSED(report);
 #endif
@@ -245,6 +249,7 @@ void WSpinny::slotLoadTrack(TrackPointer pTrack) {
     m_lastRequestedCover = CoverInfo();
     m_loadedCover = QPixmap();
     m_loadedCoverScaled = QPixmap();
+    m_bStaticLayerDirty = true;
     m_loadedTrack = pTrack;
     if (m_loadedTrack) {
         connect(m_loadedTrack.get(),
@@ -268,6 +273,7 @@ void WSpinny::slotLoadingTrack(TrackPointer pNewTrack, TrackPointer pOldTrack) {
     m_lastRequestedCover = CoverInfo();
     m_loadedCover = QPixmap();
     m_loadedCoverScaled = QPixmap();
+    m_bStaticLayerDirty = true;
     update();
 }
 
@@ -290,6 +296,7 @@ void WSpinny::slotCoverFound(
             m_loadedTrack->getLocation() == coverInfo.trackLocation) {
         m_loadedCover = pixmap;
         m_loadedCoverScaled = scaledCoverArt(pixmap);
+        m_bStaticLayerDirty = true;
         update();
     }
 }
@@ -329,27 +336,38 @@ void WSpinny::render(VSyncThread* vSyncThread) {
                 &m_dGhostAngleCurrentPlaypos);
     }
 
-    double scaleFactor = getDevicePixelRatioF(this);
-
-    QPainter p(this);
-    p.setRenderHint(QPainter::Antialiasing);
-    p.setRenderHint(QPainter::SmoothPixmapTransform);
+    bool angleChanged = false;
+    if (m_dAngleCurrentPlaypos != m_dAngleLastPlaypos) {
+        m_fAngle = static_cast<float>(calculateAngle(m_dAngleCurrentPlaypos));
+        m_dAngleLastPlaypos = m_dAngleCurrentPlaypos;
+        angleChanged = true;
+    }
 
-    if (m_pBgImage) {
-        p.drawImage(rect(), *m_pBgImage, m_pBgImage->rect());
+    if (m_dGhostAngleCurrentPlaypos != m_dGhostAngleLastPlaypos) {
+        m_fGhostAngle = static_cast<float>(calculateAngle(m_dGhostAngleCurrentPlaypos));
+        m_dGhostAngleLastPlaypos = m_dGhostAngleCurrentPlaypos;
+        angleChanged = true;
     }
 
-    if (m_bShowCover && !m_loadedCoverScaled.isNull()) {
-        // Some covers aren't square, so center them.
-        double x = (width() - m_loadedCoverScaled.width() / scaleFactor) / 2;
-        double y = (height() - m_loadedCoverScaled.height() / scaleFactor) / 2;
-        p.drawPixmap(QPointF(x, y), m_loadedCoverScaled);
+    // A stopped deck produces a stream of identical frames. Skip the repaint
+    // and the buffer swap entirely, the front buffer still shows this frame.
+    if (!angleChanged && !m_bStaticLayerDirty && !m_bOverlayDirty) {
+        return;
     }
+    m_bOverlayDirty = false;
 
-    if (m_pMaskImage) {
-        p.drawImage(rect(), *m_pMaskImage, m_pMaskImage->rect());
+    if (m_bStaticLayerDirty) {
+        composeStaticLayer();
     }
 
+    QPainter p(this);
+    p.setRenderHint(QPainter::Antialiasing);
+    p.setRenderHint(QPainter::SmoothPixmapTransform);
+
+    // Background, cover art and mask, composited once in
+    // composeStaticLayer() and redrawn from the cache since.
+    p.drawPixmap(0, 0, m_staticLayer);
+
 #ifdef __VINYLCONTROL__
     // Overlay the signal quality drawing if vinyl is active
     if (m_bVinylActive && m_bSignalActive) {
@@ -367,21 +385,6 @@ void WSpinny::render(VSyncThread* vSyncThread) {
     bool paintGhost = m_bGhostPlayback && m_pGhostImage && !m_pGhostImage->isNull();
     if (paintGhost) {
         p.save();
-    }
-
-    if (m_dAngleCurrentPlaypos != m_dAngleLastPlaypos) {
-        m_fAngle = static_cast<float>(calculateAngle(m_dAngleCurrentPlaypos));
-        m_dAngleLastPlaypos = m_dAngleCurrentPlaypos;
-    }
-
-    if (m_dGhostAngleCurrentPlaypos != m_dGhostAngleLastPlaypos) {
-        m_fGhostAngle = static_cast<float>(calculateAngle(m_dGhostAngleCurrentPlaypos));
-        m_dGhostAngleLastPlaypos = m_dGhostAngleCurrentPlaypos;
-    }
-
-    if (paintGhost) {
-        p.restore();
-        p.save();
         p.rotate(m_fGhostAngle);
         p.drawImage(-(m_ghostImageScaled.width() / 2),
                     -(m_ghostImageScaled.height() / 2), m_ghostImageScaled);
@@ -397,9 +400,16 @@ void WSpinny::render(VSyncThread* vSyncThread) {
         p.drawImage(-(m_fgImageScaled.width() / 2),
                     -(m_fgImageScaled.height() / 2), m_fgImageScaled);
     }
+
+    m_bSwapPending = true;
 }
 
 void WSpinny::swap() {
+    // Nothing was rendered since the last swap, the front buffer is still
+    // up to date.
+    if (!m_bSwapPending) {
+        return;
+    }
     if (!isValid() || !isVisible()) {
         return;
     }
@@ -411,8 +421,35 @@ void WSpinny::swap() {
         makeCurrent();
     }
     swapBuffers();
+    m_bSwapPending = false;
 }
 
+void WSpinny::composeStaticLayer() {
+    const double scaleFactor = getDevicePixelRatioF(this);
+    m_staticLayer = QPixmap(size() * scaleFactor);
+    m_staticLayer.setDevicePixelRatio(scaleFactor);
+    m_staticLayer.fill(Qt::transparent);
+
+    QPainter p(&m_staticLayer);
+    p.setRenderHint(QPainter::Antialiasing);
+    p.setRenderHint(QPainter::SmoothPixmapTransform);
+
+    if (m_pBgImage) {
+        p.drawImage(rect(), *m_pBgImage, m_pBgImage->rect());
+    }
+
+    if (m_bShowCover && !m_loadedCoverScaled.isNull()) {
+        // Some covers aren't square, so center them.
+        double x = (width() - m_loadedCoverScaled.width() / scaleFactor) / 2;
+        double y = (height() - m_loadedCoverScaled.height() / scaleFactor) / 2;
+        p.drawPixmap(QPointF(x, y), m_loadedCoverScaled);
+    }
+
+    if (m_pMaskImage) {
+        p.drawImage(rect(), *m_pMaskImage, m_pMaskImage->rect());
+    }
+    m_bStaticLayerDirty = false;
+}
 
 QPixmap WSpinny::scaledCoverArt(const QPixmap& normal) {
     if (normal.isNull()) {
@@ -425,6 +462,7 @@ QPixmap WSpinny::scaledCoverArt(const QPixmap& normal) {
 }
 
 void WSpinny::resizeEvent(QResizeEvent* /*unused*/) {
+    m_bStaticLayerDirty = true;
     m_loadedCoverScaled = scaledCoverArt(m_loadedCover);
     if (m_pFgImage && !m_pFgImage->isNull()) {
         m_fgImageScaled = m_pFgImage->scaled(
@@ -536,6 +574,7 @@ void WSpinny::updateVinylControlSignalEnabled(double enabled) {
         return;
     }
     m_bSignalActive = enabled != 0;
+    m_bOverlayDirty = true;
 
     if (m_bSignalActive && m_iVinylInput != -1) {
         m_pVCManager->addSignalQualityListener(this);
@@ -551,10 +590,12 @@ void WSpinny::updateVinylControlSignalEnabled(double enabled) {
 
 void WSpinny::updateVinylControlEnabled(double enabled) {
     m_bVinylActive = enabled != 0;
+    m_bOverlayDirty = true;
 }
 
 void WSpinny::updateSlipEnabled(double enabled) {
     m_bGhostPlayback = static_cast<bool>(enabled);
+    m_bOverlayDirty = true;
 }
 
 void WSpinny::mouseMoveEvent(QMouseEvent * e) {
@@ -667,6 +708,9 @@ void WSpinny::mouseReleaseEvent(QMouseEvent * e)
 
 void WSpinny::showEvent(QShowEvent* event) {
     Q_UNUSED(event);
+    // Repaint as soon as we become visible again, whatever is in the
+    // buffers is stale by now.
+    m_bOverlayDirty = true;
 #ifdef __VINYLCONTROL__
     // If we want to draw the VC signal on this widget then register for
     // updates.
@@ -78,6 +78,7 @@ class WSpinny : public QGLWidget, public WBaseWidget, public VinylSignalQualityL
     int calculateFullRotations(double playpos);
     double calculatePositionFromAngle(double angle);
     QPixmap scaledCoverArt(const QPixmap& normal);
+    void composeStaticLayer();
 
   private:
     const QString m_group;
@@ -105,6 +106,18 @@ class WSpinny : public QGLWidget, public WBaseWidget, public VinylSignalQualityL
     CoverInfo m_lastRequestedCover;
     bool m_bShowCover;
 
+    // Background, cover art and mask composited into a single pixmap, so
+    // the render loop draws one cached layer per frame instead of
+    // recompositing them at the full frame rate.
+    QPixmap m_staticLayer;
+    bool m_bStaticLayerDirty;
+    // Set whenever something other than the rotation angles changed the
+    // frame content, cleared after the frame has been painted.
+    bool m_bOverlayDirty;
+    // A frame has been rendered into the back buffer and still needs to be
+    // shown by swap().
+    bool m_bSwapPending;
+
 
     VinylControlManager* m_pVCManager;
     double m_dInitialPos;
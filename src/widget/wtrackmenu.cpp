@@ -978,27 +978,21 @@ void WTrackMenu::slotPopulatePlaylistMenu() {
     const PlaylistDAO& playlistDao = m_pLibrary->trackCollectionManager()
                                              ->internalCollection()
                                              ->getPlaylistDAO();
-    QMap<QString, int> playlists;
-    int numPlaylists = playlistDao.playlistCount();
-    for (int i = 0; i < numPlaylists; ++i) {
-        int iPlaylistId = playlistDao.getPlaylistId(i);
-        playlists.insert(playlistDao.getPlaylistName(iPlaylistId), iPlaylistId);
-    }
-    QMapIterator<QString, int> it(playlists);
-    while (it.hasNext()) {
-        it.next();
-        if (!playlistDao.isHidden(it.value())) {
-            // No leak because making the menu the parent means they will be
-            // auto-deleted
-            auto* pAction = new QAction(
-                    mixxx::escapeTextPropertyWithoutShortcuts(it.key()),
-                    m_pPlaylistMenu);
-            bool locked = playlistDao.isPlaylistLocked(it.value());
-            pAction->setEnabled(!locked);
-            m_pPlaylistMenu->addAction(pAction);
-            int iPlaylistId = it.value();
-            connect(pAction, &QAction::triggered, this, [this, iPlaylistId] { addSelectionToPlaylist(iPlaylistId); });
-        }
+    // A single query for all unhidden playlists. Querying the id, name,
+    // hidden state and lock state of every playlist individually made
+    // opening this menu take noticeably long for large collections.
+    const QList<PlaylistDAO::PlaylistSummary> playlists =
+            playlistDao.getUnhiddenPlaylistSummaries();
+    for (const PlaylistDAO::PlaylistSummary& playlist : playlists) {
+        // No leak because making the menu the parent means they will be
+        // auto-deleted
+        auto* pAction = new QAction(
+                mixxx::escapeTextPropertyWithoutShortcuts(playlist.name),
+                m_pPlaylistMenu);
+        pAction->setEnabled(!playlist.locked);
+        m_pPlaylistMenu->addAction(pAction);
+        const int iPlaylistId = playlist.id;
+        connect(pAction, &QAction::triggered, this, [this, iPlaylistId] { addSelectionToPlaylist(iPlaylistId); });
     }
     m_pPlaylistMenu->addSeparator();
     QAction* newPlaylistAction = new QAction(tr("Create New Playlist"), m_pPlaylistMenu);